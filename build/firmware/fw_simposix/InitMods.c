@@ -0,0 +1,9 @@
+// Autogenerated file
+ extern unsigned int ManualControlInitialize(void);  extern unsigned int StabilizationInitialize(void);  extern unsigned int GPSInitialize(void);  extern unsigned int PathPlannerInitialize(void);  extern unsigned int PathFollowerInitialize(void);  extern unsigned int CameraStabInitialize(void);  extern unsigned int TelemetryInitialize(void);  extern unsigned int LoggingInitialize(void);  extern unsigned int FirmwareIAPInitialize(void);  extern unsigned int StateEstimationInitialize(void);  extern unsigned int SensorsInitialize(void);  extern unsigned int AirspeedInitialize(void);
+ extern unsigned int ManualControlStart(void);  extern unsigned int StabilizationStart(void);  extern unsigned int GPSStart(void);  extern unsigned int PathPlannerStart(void);  extern unsigned int PathFollowerStart(void);  extern unsigned int CameraStabStart(void);  extern unsigned int TelemetryStart(void);  extern unsigned int LoggingStart(void);  extern unsigned int FirmwareIAPStart(void);  extern unsigned int StateEstimationStart(void);  extern unsigned int SensorsStart(void);  extern unsigned int AirspeedStart(void);
+void InitModules() {
+ ManualControlInitialize();  StabilizationInitialize();  GPSInitialize();  PathPlannerInitialize();  PathFollowerInitialize();  CameraStabInitialize();  TelemetryInitialize();  LoggingInitialize();  FirmwareIAPInitialize();  StateEstimationInitialize();  SensorsInitialize();  AirspeedInitialize();
+}
+void StartModules() {
+ ManualControlStart();  StabilizationStart();  GPSStart();  PathPlannerStart();  PathFollowerStart();  CameraStabStart();  TelemetryStart();  LoggingStart();  FirmwareIAPStart();  StateEstimationStart();  SensorsStart();  AirspeedStart();
+}
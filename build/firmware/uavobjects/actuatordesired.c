@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ActuatorDesired ActuatorDesired
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for ActuatorDesired Object
+ * @{ 
+ *
+ * @file       actuatordesired.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ActuatorDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "actuatordesired.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorDesiredInitialize(void)
+{
+    // Compile time assertion that the ActuatorDesiredDataPacked and ActuatorDesiredData structs
+    // have the same size (though instances of ActuatorDesiredData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ActuatorDesiredDataPacked) == sizeof(ActuatorDesiredData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ACTUATORDESIRED_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ACTUATORDESIRED_OBJID,
+        ACTUATORDESIRED_ISSINGLEINST, ACTUATORDESIRED_ISSETTINGS, ACTUATORDESIRED_ISPRIORITY, ACTUATORDESIRED_NUMBYTES, &ActuatorDesiredSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorDesiredSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ActuatorDesiredData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ActuatorDesiredData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorDesiredHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ActuatorDesiredRollSet(float *NewRoll)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewRoll, offsetof(ActuatorDesiredData, Roll), sizeof(float));
+}
+void ActuatorDesiredRollGet(float *NewRoll)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewRoll, offsetof(ActuatorDesiredData, Roll), sizeof(float));
+}
+void ActuatorDesiredPitchSet(float *NewPitch)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewPitch, offsetof(ActuatorDesiredData, Pitch), sizeof(float));
+}
+void ActuatorDesiredPitchGet(float *NewPitch)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewPitch, offsetof(ActuatorDesiredData, Pitch), sizeof(float));
+}
+void ActuatorDesiredYawSet(float *NewYaw)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewYaw, offsetof(ActuatorDesiredData, Yaw), sizeof(float));
+}
+void ActuatorDesiredYawGet(float *NewYaw)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewYaw, offsetof(ActuatorDesiredData, Yaw), sizeof(float));
+}
+void ActuatorDesiredThrustSet(float *NewThrust)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewThrust, offsetof(ActuatorDesiredData, Thrust), sizeof(float));
+}
+void ActuatorDesiredThrustGet(float *NewThrust)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewThrust, offsetof(ActuatorDesiredData, Thrust), sizeof(float));
+}
+void ActuatorDesiredUpdateTimeSet(float *NewUpdateTime)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewUpdateTime, offsetof(ActuatorDesiredData, UpdateTime), sizeof(float));
+}
+void ActuatorDesiredUpdateTimeGet(float *NewUpdateTime)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewUpdateTime, offsetof(ActuatorDesiredData, UpdateTime), sizeof(float));
+}
+void ActuatorDesiredNumLongUpdatesSet(float *NewNumLongUpdates)
+{
+    UAVObjSetDataField(ActuatorDesiredHandle(), (void *)NewNumLongUpdates, offsetof(ActuatorDesiredData, NumLongUpdates), sizeof(float));
+}
+void ActuatorDesiredNumLongUpdatesGet(float *NewNumLongUpdates)
+{
+    UAVObjGetDataField(ActuatorDesiredHandle(), (void *)NewNumLongUpdates, offsetof(ActuatorDesiredData, NumLongUpdates), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,212 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AuxMagSettings AuxMagSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for AuxMagSettings Object
+ * @{ 
+ *
+ * @file       auxmagsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AuxMagSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "auxmagsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AuxMagSettingsInitialize(void)
+{
+    // Compile time assertion that the AuxMagSettingsDataPacked and AuxMagSettingsData structs
+    // have the same size (though instances of AuxMagSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AuxMagSettingsDataPacked) == sizeof(AuxMagSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(AUXMAGSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(AUXMAGSETTINGS_OBJID,
+        AUXMAGSETTINGS_ISSINGLEINST, AUXMAGSETTINGS_ISSETTINGS, AUXMAGSETTINGS_ISPRIORITY, AUXMAGSETTINGS_NUMBYTES, &AuxMagSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AuxMagSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AuxMagSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AuxMagSettingsData));
+    data.mag_bias.X = 0.000000e+00f;
+    data.mag_bias.Y = 0.000000e+00f;
+    data.mag_bias.Z = 0.000000e+00f;
+    data.mag_transform.r0c0 = 1.000000e+00f;
+    data.mag_transform.r0c1 = 0.000000e+00f;
+    data.mag_transform.r0c2 = 0.000000e+00f;
+    data.mag_transform.r1c0 = 0.000000e+00f;
+    data.mag_transform.r1c1 = 1.000000e+00f;
+    data.mag_transform.r1c2 = 0.000000e+00f;
+    data.mag_transform.r2c0 = 0.000000e+00f;
+    data.mag_transform.r2c1 = 0.000000e+00f;
+    data.mag_transform.r2c2 = 1.000000e+00f;
+    data.MagBiasNullingRate = 0.000000e+00f;
+    data.BoardRotation.Roll = 0;
+    data.BoardRotation.Pitch = 0;
+    data.BoardRotation.Yaw = 0;
+    data.Type = 0;
+    data.Usage = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AuxMagSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AuxMagSettingsmag_biasSet( AuxMagSettingsmag_biasData *Newmag_bias )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)Newmag_bias, offsetof(AuxMagSettingsData, mag_bias), 3*sizeof(float));
+}
+void AuxMagSettingsmag_biasGet( AuxMagSettingsmag_biasData *Newmag_bias )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)Newmag_bias, offsetof(AuxMagSettingsData, mag_bias), 3*sizeof(float));
+}
+void AuxMagSettingsmag_biasArraySet( float *Newmag_bias )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)Newmag_bias, offsetof(AuxMagSettingsData, mag_bias), 3*sizeof(float));
+}
+void AuxMagSettingsmag_biasArrayGet( float *Newmag_bias )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)Newmag_bias, offsetof(AuxMagSettingsData, mag_bias), 3*sizeof(float));
+}
+void AuxMagSettingsmag_transformSet( AuxMagSettingsmag_transformData *Newmag_transform )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)Newmag_transform, offsetof(AuxMagSettingsData, mag_transform), 9*sizeof(float));
+}
+void AuxMagSettingsmag_transformGet( AuxMagSettingsmag_transformData *Newmag_transform )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)Newmag_transform, offsetof(AuxMagSettingsData, mag_transform), 9*sizeof(float));
+}
+void AuxMagSettingsmag_transformArraySet( float *Newmag_transform )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)Newmag_transform, offsetof(AuxMagSettingsData, mag_transform), 9*sizeof(float));
+}
+void AuxMagSettingsmag_transformArrayGet( float *Newmag_transform )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)Newmag_transform, offsetof(AuxMagSettingsData, mag_transform), 9*sizeof(float));
+}
+void AuxMagSettingsMagBiasNullingRateSet(float *NewMagBiasNullingRate)
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)NewMagBiasNullingRate, offsetof(AuxMagSettingsData, MagBiasNullingRate), sizeof(float));
+}
+void AuxMagSettingsMagBiasNullingRateGet(float *NewMagBiasNullingRate)
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)NewMagBiasNullingRate, offsetof(AuxMagSettingsData, MagBiasNullingRate), sizeof(float));
+}
+void AuxMagSettingsBoardRotationSet( AuxMagSettingsBoardRotationData *NewBoardRotation )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)NewBoardRotation, offsetof(AuxMagSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AuxMagSettingsBoardRotationGet( AuxMagSettingsBoardRotationData *NewBoardRotation )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)NewBoardRotation, offsetof(AuxMagSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AuxMagSettingsBoardRotationArraySet( int16_t *NewBoardRotation )
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)NewBoardRotation, offsetof(AuxMagSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AuxMagSettingsBoardRotationArrayGet( int16_t *NewBoardRotation )
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)NewBoardRotation, offsetof(AuxMagSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AuxMagSettingsTypeSet(AuxMagSettingsTypeOptions *NewType)
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)NewType, offsetof(AuxMagSettingsData, Type), sizeof(AuxMagSettingsTypeOptions));
+}
+void AuxMagSettingsTypeGet(AuxMagSettingsTypeOptions *NewType)
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)NewType, offsetof(AuxMagSettingsData, Type), sizeof(AuxMagSettingsTypeOptions));
+}
+void AuxMagSettingsUsageSet(AuxMagSettingsUsageOptions *NewUsage)
+{
+    UAVObjSetDataField(AuxMagSettingsHandle(), (void *)NewUsage, offsetof(AuxMagSettingsData, Usage), sizeof(AuxMagSettingsUsageOptions));
+}
+void AuxMagSettingsUsageGet(AuxMagSettingsUsageOptions *NewUsage)
+{
+    UAVObjGetDataField(AuxMagSettingsHandle(), (void *)NewUsage, offsetof(AuxMagSettingsData, Usage), sizeof(AuxMagSettingsUsageOptions));
+}
+
+
+/**
+ * @}
+ */
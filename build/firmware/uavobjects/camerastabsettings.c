@@ -0,0 +1,338 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup CameraStabSettings CameraStabSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for CameraStabSettings Object
+ * @{ 
+ *
+ * @file       camerastabsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the CameraStabSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "camerastabsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CameraStabSettingsInitialize(void)
+{
+    // Compile time assertion that the CameraStabSettingsDataPacked and CameraStabSettingsData structs
+    // have the same size (though instances of CameraStabSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(CameraStabSettingsDataPacked) == sizeof(CameraStabSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(CAMERASTABSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(CAMERASTABSETTINGS_OBJID,
+        CAMERASTABSETTINGS_ISSINGLEINST, CAMERASTABSETTINGS_ISSETTINGS, CAMERASTABSETTINGS_ISPRIORITY, CAMERASTABSETTINGS_NUMBYTES, &CameraStabSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CameraStabSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    CameraStabSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(CameraStabSettingsData));
+    data.MaxAxisLockRate = 1.000000e+00f;
+    data.MaxAccel = 500;
+    data.Input.Roll = 6;
+    data.Input.Pitch = 6;
+    data.Input.Yaw = 6;
+    data.InputRange.Roll = 20;
+    data.InputRange.Pitch = 20;
+    data.InputRange.Yaw = 20;
+    data.InputRate.Roll = 50;
+    data.InputRate.Pitch = 50;
+    data.InputRate.Yaw = 50;
+    data.StabilizationMode.Roll = 0;
+    data.StabilizationMode.Pitch = 0;
+    data.StabilizationMode.Yaw = 0;
+    data.OutputRange.Roll = 20;
+    data.OutputRange.Pitch = 20;
+    data.OutputRange.Yaw = 20;
+    data.ResponseTime.Roll = 0;
+    data.ResponseTime.Pitch = 0;
+    data.ResponseTime.Yaw = 0;
+    data.GimbalType = 0;
+    data.FeedForward.Roll = 0;
+    data.FeedForward.Pitch = 0;
+    data.FeedForward.Yaw = 0;
+    data.AccelTime.Roll = 5;
+    data.AccelTime.Pitch = 5;
+    data.AccelTime.Yaw = 5;
+    data.DecelTime.Roll = 5;
+    data.DecelTime.Pitch = 5;
+    data.DecelTime.Yaw = 5;
+    data.Servo1PitchReverse = 0;
+    data.Servo2PitchReverse = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CameraStabSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void CameraStabSettingsMaxAxisLockRateSet(float *NewMaxAxisLockRate)
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewMaxAxisLockRate, offsetof(CameraStabSettingsData, MaxAxisLockRate), sizeof(float));
+}
+void CameraStabSettingsMaxAxisLockRateGet(float *NewMaxAxisLockRate)
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewMaxAxisLockRate, offsetof(CameraStabSettingsData, MaxAxisLockRate), sizeof(float));
+}
+void CameraStabSettingsMaxAccelSet(uint16_t *NewMaxAccel)
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewMaxAccel, offsetof(CameraStabSettingsData, MaxAccel), sizeof(uint16_t));
+}
+void CameraStabSettingsMaxAccelGet(uint16_t *NewMaxAccel)
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewMaxAccel, offsetof(CameraStabSettingsData, MaxAccel), sizeof(uint16_t));
+}
+void CameraStabSettingsInputSet( CameraStabSettingsInputData *NewInput )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputGet( CameraStabSettingsInputData *NewInput )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputArraySet( CameraStabSettingsInputOptions *NewInput )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputArrayGet( CameraStabSettingsInputOptions *NewInput )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputRangeSet( CameraStabSettingsInputRangeData *NewInputRange )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeGet( CameraStabSettingsInputRangeData *NewInputRange )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeArraySet( uint8_t *NewInputRange )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeArrayGet( uint8_t *NewInputRange )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateSet( CameraStabSettingsInputRateData *NewInputRate )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateGet( CameraStabSettingsInputRateData *NewInputRate )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateArraySet( uint8_t *NewInputRate )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateArrayGet( uint8_t *NewInputRate )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsStabilizationModeSet( CameraStabSettingsStabilizationModeData *NewStabilizationMode )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeGet( CameraStabSettingsStabilizationModeData *NewStabilizationMode )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeArraySet( CameraStabSettingsStabilizationModeOptions *NewStabilizationMode )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeArrayGet( CameraStabSettingsStabilizationModeOptions *NewStabilizationMode )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsOutputRangeSet( CameraStabSettingsOutputRangeData *NewOutputRange )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeGet( CameraStabSettingsOutputRangeData *NewOutputRange )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeArraySet( uint8_t *NewOutputRange )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeArrayGet( uint8_t *NewOutputRange )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeSet( CameraStabSettingsResponseTimeData *NewResponseTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeGet( CameraStabSettingsResponseTimeData *NewResponseTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeArraySet( uint8_t *NewResponseTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeArrayGet( uint8_t *NewResponseTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsGimbalTypeSet(CameraStabSettingsGimbalTypeOptions *NewGimbalType)
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewGimbalType, offsetof(CameraStabSettingsData, GimbalType), sizeof(CameraStabSettingsGimbalTypeOptions));
+}
+void CameraStabSettingsGimbalTypeGet(CameraStabSettingsGimbalTypeOptions *NewGimbalType)
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewGimbalType, offsetof(CameraStabSettingsData, GimbalType), sizeof(CameraStabSettingsGimbalTypeOptions));
+}
+void CameraStabSettingsFeedForwardSet( CameraStabSettingsFeedForwardData *NewFeedForward )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardGet( CameraStabSettingsFeedForwardData *NewFeedForward )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardArraySet( uint8_t *NewFeedForward )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardArrayGet( uint8_t *NewFeedForward )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeSet( CameraStabSettingsAccelTimeData *NewAccelTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeGet( CameraStabSettingsAccelTimeData *NewAccelTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeArraySet( uint8_t *NewAccelTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeArrayGet( uint8_t *NewAccelTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeSet( CameraStabSettingsDecelTimeData *NewDecelTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeGet( CameraStabSettingsDecelTimeData *NewDecelTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeArraySet( uint8_t *NewDecelTime )
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeArrayGet( uint8_t *NewDecelTime )
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsServo1PitchReverseSet(CameraStabSettingsServo1PitchReverseOptions *NewServo1PitchReverse)
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewServo1PitchReverse, offsetof(CameraStabSettingsData, Servo1PitchReverse), sizeof(CameraStabSettingsServo1PitchReverseOptions));
+}
+void CameraStabSettingsServo1PitchReverseGet(CameraStabSettingsServo1PitchReverseOptions *NewServo1PitchReverse)
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewServo1PitchReverse, offsetof(CameraStabSettingsData, Servo1PitchReverse), sizeof(CameraStabSettingsServo1PitchReverseOptions));
+}
+void CameraStabSettingsServo2PitchReverseSet(CameraStabSettingsServo2PitchReverseOptions *NewServo2PitchReverse)
+{
+    UAVObjSetDataField(CameraStabSettingsHandle(), (void *)NewServo2PitchReverse, offsetof(CameraStabSettingsData, Servo2PitchReverse), sizeof(CameraStabSettingsServo2PitchReverseOptions));
+}
+void CameraStabSettingsServo2PitchReverseGet(CameraStabSettingsServo2PitchReverseOptions *NewServo2PitchReverse)
+{
+    UAVObjGetDataField(CameraStabSettingsHandle(), (void *)NewServo2PitchReverse, offsetof(CameraStabSettingsData, Servo2PitchReverse), sizeof(CameraStabSettingsServo2PitchReverseOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup EventTrace EventTrace
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for EventTrace Object
+ * @{ 
+ *
+ * @file       eventtrace.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTrace object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "eventtrace.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t EventTraceInitialize(void)
+{
+    // Compile time assertion that the EventTraceDataPacked and EventTraceData structs
+    // have the same size (though instances of EventTraceData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(EventTraceDataPacked) == sizeof(EventTraceData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(EVENTTRACE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(EVENTTRACE_OBJID,
+        EVENTTRACE_ISSINGLEINST, EVENTTRACE_ISSETTINGS, EVENTTRACE_ISPRIORITY, EVENTTRACE_NUMBYTES, &EventTraceSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void EventTraceSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    EventTraceData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(EventTraceData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle EventTraceHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void EventTraceSequenceSet(uint32_t *NewSequence)
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewSequence, offsetof(EventTraceData, Sequence), sizeof(uint32_t));
+}
+void EventTraceSequenceGet(uint32_t *NewSequence)
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewSequence, offsetof(EventTraceData, Sequence), sizeof(uint32_t));
+}
+void EventTraceLostSet(uint32_t *NewLost)
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewLost, offsetof(EventTraceData, Lost), sizeof(uint32_t));
+}
+void EventTraceLostGet(uint32_t *NewLost)
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewLost, offsetof(EventTraceData, Lost), sizeof(uint32_t));
+}
+void EventTraceTicksPerUsSet(float *NewTicksPerUs)
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewTicksPerUs, offsetof(EventTraceData, TicksPerUs), sizeof(float));
+}
+void EventTraceTicksPerUsGet(float *NewTicksPerUs)
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewTicksPerUs, offsetof(EventTraceData, TicksPerUs), sizeof(float));
+}
+void EventTraceTimeSet( uint32_t *NewTime )
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewTime, offsetof(EventTraceData, Time), 16*sizeof(uint32_t));
+}
+void EventTraceTimeGet( uint32_t *NewTime )
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewTime, offsetof(EventTraceData, Time), 16*sizeof(uint32_t));
+}
+void EventTraceIdSet( uint32_t *NewId )
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewId, offsetof(EventTraceData, Id), 16*sizeof(uint32_t));
+}
+void EventTraceIdGet( uint32_t *NewId )
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewId, offsetof(EventTraceData, Id), 16*sizeof(uint32_t));
+}
+void EventTraceAuxSet( uint16_t *NewAux )
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewAux, offsetof(EventTraceData, Aux), 16*sizeof(uint16_t));
+}
+void EventTraceAuxGet( uint16_t *NewAux )
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewAux, offsetof(EventTraceData, Aux), 16*sizeof(uint16_t));
+}
+void EventTraceCountSet(uint8_t *NewCount)
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewCount, offsetof(EventTraceData, Count), sizeof(uint8_t));
+}
+void EventTraceCountGet(uint8_t *NewCount)
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewCount, offsetof(EventTraceData, Count), sizeof(uint8_t));
+}
+void EventTraceTypeSet( EventTraceTypeOptions *NewType )
+{
+    UAVObjSetDataField(EventTraceHandle(), (void *)NewType, offsetof(EventTraceData, Type), 16*sizeof(EventTraceTypeOptions));
+}
+void EventTraceTypeGet( EventTraceTypeOptions *NewType )
+{
+    UAVObjGetDataField(EventTraceHandle(), (void *)NewType, offsetof(EventTraceData, Type), 16*sizeof(EventTraceTypeOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,199 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup EventTrace EventTrace
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for EventTrace Object
+ *
+ * @{
+ *
+ * @file       eventtrace.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTrace object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACE_H
+#define EVENTTRACE_H
+#include <stdbool.h>
+/* Object constants */
+#define EVENTTRACE_OBJID 0xAC052C3E
+#define EVENTTRACE_ISSINGLEINST 1
+#define EVENTTRACE_ISSETTINGS 0
+#define EVENTTRACE_ISPRIORITY 0
+#define EVENTTRACE_NUMBYTES sizeof(EventTraceData)
+
+/* Generic interface functions */
+int32_t EventTraceInitialize();
+UAVObjHandle EventTraceHandle();
+void EventTraceSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Sequence information */
+
+/* Field Lost information */
+
+/* Field TicksPerUs information */
+
+/* Field Time information */
+
+// Number of elements for field Time
+#define EVENTTRACE_TIME_NUMELEM 16
+
+/* Field Id information */
+
+// Number of elements for field Id
+#define EVENTTRACE_ID_NUMELEM 16
+
+/* Field Aux information */
+
+// Number of elements for field Aux
+#define EVENTTRACE_AUX_NUMELEM 16
+
+/* Field Count information */
+
+/* Field Type information */
+
+// Enumeration options for field Type
+typedef enum __attribute__ ((__packed__)) {
+    EVENTTRACE_TYPE_TASKSWITCH=0,
+    EVENTTRACE_TYPE_CALLBACKSTART=1,
+    EVENTTRACE_TYPE_CALLBACKEND=2,
+    EVENTTRACE_TYPE_OBJECTSEND=3,
+    EVENTTRACE_TYPE_OBJECTRECEIVE=4,
+    EVENTTRACE_TYPE_ISRENTER=5,
+    EVENTTRACE_TYPE_ISREXIT=6,
+    EVENTTRACE_TYPE_TRIGGER=7
+} EventTraceTypeOptions;
+
+// Number of elements for field Type
+#define EVENTTRACE_TYPE_NUMELEM 16
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint32_t Sequence;
+    uint32_t Lost;
+    float TicksPerUs;
+    uint32_t Time[16];
+    uint32_t Id[16];
+    uint16_t Aux[16];
+    uint8_t Count;
+    EventTraceTypeOptions Type[16];
+
+} __attribute__((packed)) EventTraceDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef EventTraceDataPacked __attribute__((aligned(4))) EventTraceData;
+
+/* Typesafe Object access functions */
+static inline int32_t EventTraceGet(EventTraceData * dataOut) {
+    return UAVObjGetData(EventTraceHandle(), dataOut);
+}
+static inline int32_t EventTraceSet(const EventTraceData * dataIn) {
+    return UAVObjSetData(EventTraceHandle(), dataIn);
+}
+static inline int32_t EventTraceInstGet(uint16_t instId, EventTraceData * dataOut) {
+    return UAVObjGetInstanceData(EventTraceHandle(), instId, dataOut);
+}
+static inline int32_t EventTraceInstSet(uint16_t instId, const EventTraceData * dataIn) {
+    return UAVObjSetInstanceData(EventTraceHandle(), instId, dataIn);
+}
+static inline int32_t EventTraceConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(EventTraceHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t EventTraceConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t EventTraceConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t EventTraceCreateInstance() {
+    return UAVObjCreateInstance(EventTraceHandle(), &EventTraceSetDefaults);
+}
+static inline void EventTraceRequestUpdate() {
+    UAVObjRequestUpdate(EventTraceHandle());
+}
+static inline void EventTraceRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(EventTraceHandle(), instId);
+}
+static inline void EventTraceUpdated() {
+    UAVObjUpdated(EventTraceHandle());
+}
+static inline void EventTraceInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(EventTraceHandle(), instId);
+}
+static inline void EventTraceLogging() {
+    UAVObjLogging(EventTraceHandle());
+}
+static inline void EventTraceInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(EventTraceHandle(), instId);
+}
+static inline int32_t EventTraceGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(EventTraceHandle(), dataOut);
+}
+static inline int32_t EventTraceSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(EventTraceHandle(), dataIn);
+}
+static inline int8_t EventTraceReadOnly() {
+    return UAVObjReadOnly(EventTraceHandle());
+}
+
+/* Set/Get functions */
+extern void EventTraceSequenceSet(uint32_t *NewSequence);
+extern void EventTraceSequenceGet(uint32_t *NewSequence);
+extern void EventTraceLostSet(uint32_t *NewLost);
+extern void EventTraceLostGet(uint32_t *NewLost);
+extern void EventTraceTicksPerUsSet(float *NewTicksPerUs);
+extern void EventTraceTicksPerUsGet(float *NewTicksPerUs);
+extern void EventTraceTimeSet(uint32_t *NewTime);
+extern void EventTraceTimeGet(uint32_t *NewTime);
+extern void EventTraceIdSet(uint32_t *NewId);
+extern void EventTraceIdGet(uint32_t *NewId);
+extern void EventTraceAuxSet(uint16_t *NewAux);
+extern void EventTraceAuxGet(uint16_t *NewAux);
+extern void EventTraceCountSet(uint8_t *NewCount);
+extern void EventTraceCountGet(uint8_t *NewCount);
+extern void EventTraceTypeSet(EventTraceTypeOptions *NewType);
+extern void EventTraceTypeGet(EventTraceTypeOptions *NewType);
+
+
+#endif // EVENTTRACE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,140 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup EventTraceSettings EventTraceSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for EventTraceSettings Object
+ * @{ 
+ *
+ * @file       eventtracesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTraceSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "eventtracesettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t EventTraceSettingsInitialize(void)
+{
+    // Compile time assertion that the EventTraceSettingsDataPacked and EventTraceSettingsData structs
+    // have the same size (though instances of EventTraceSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(EventTraceSettingsDataPacked) == sizeof(EventTraceSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(EVENTTRACESETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(EVENTTRACESETTINGS_OBJID,
+        EVENTTRACESETTINGS_ISSINGLEINST, EVENTTRACESETTINGS_ISSETTINGS, EVENTTRACESETTINGS_ISPRIORITY, EVENTTRACESETTINGS_NUMBYTES, &EventTraceSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void EventTraceSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    EventTraceSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(EventTraceSettingsData));
+    data.Mode = 0;
+    data.Destination = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle EventTraceSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void EventTraceSettingsModeSet(EventTraceSettingsModeOptions *NewMode)
+{
+    UAVObjSetDataField(EventTraceSettingsHandle(), (void *)NewMode, offsetof(EventTraceSettingsData, Mode), sizeof(EventTraceSettingsModeOptions));
+}
+void EventTraceSettingsModeGet(EventTraceSettingsModeOptions *NewMode)
+{
+    UAVObjGetDataField(EventTraceSettingsHandle(), (void *)NewMode, offsetof(EventTraceSettingsData, Mode), sizeof(EventTraceSettingsModeOptions));
+}
+void EventTraceSettingsDestinationSet(EventTraceSettingsDestinationOptions *NewDestination)
+{
+    UAVObjSetDataField(EventTraceSettingsHandle(), (void *)NewDestination, offsetof(EventTraceSettingsData, Destination), sizeof(EventTraceSettingsDestinationOptions));
+}
+void EventTraceSettingsDestinationGet(EventTraceSettingsDestinationOptions *NewDestination)
+{
+    UAVObjGetDataField(EventTraceSettingsHandle(), (void *)NewDestination, offsetof(EventTraceSettingsData, Destination), sizeof(EventTraceSettingsDestinationOptions));
+}
+
+
+/**
+ * @}
+ */
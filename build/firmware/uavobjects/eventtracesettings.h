@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup EventTraceSettings EventTraceSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for EventTraceSettings Object
+ *
+ * @{
+ *
+ * @file       eventtracesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTraceSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACESETTINGS_H
+#define EVENTTRACESETTINGS_H
+#include <stdbool.h>
+/* Object constants */
+#define EVENTTRACESETTINGS_OBJID 0xBF7BEB2
+#define EVENTTRACESETTINGS_ISSINGLEINST 1
+#define EVENTTRACESETTINGS_ISSETTINGS 1
+#define EVENTTRACESETTINGS_ISPRIORITY 0
+#define EVENTTRACESETTINGS_NUMBYTES sizeof(EventTraceSettingsData)
+
+/* Generic interface functions */
+int32_t EventTraceSettingsInitialize();
+UAVObjHandle EventTraceSettingsHandle();
+void EventTraceSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Mode information */
+
+// Enumeration options for field Mode
+typedef enum __attribute__ ((__packed__)) {
+    EVENTTRACESETTINGS_MODE_OFF=0,
+    EVENTTRACESETTINGS_MODE_CONTINUOUS=1,
+    EVENTTRACESETTINGS_MODE_SNAPSHOT=2
+} EventTraceSettingsModeOptions;
+
+/* Field Destination information */
+
+// Enumeration options for field Destination
+typedef enum __attribute__ ((__packed__)) {
+    EVENTTRACESETTINGS_DESTINATION_TELEMETRY=0,
+    EVENTTRACESETTINGS_DESTINATION_DEBUGLOG=1
+} EventTraceSettingsDestinationOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        EventTraceSettingsModeOptions Mode;
+    EventTraceSettingsDestinationOptions Destination;
+
+} __attribute__((packed)) EventTraceSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef EventTraceSettingsDataPacked __attribute__((aligned(4))) EventTraceSettingsData;
+
+/* Typesafe Object access functions */
+static inline int32_t EventTraceSettingsGet(EventTraceSettingsData * dataOut) {
+    return UAVObjGetData(EventTraceSettingsHandle(), dataOut);
+}
+static inline int32_t EventTraceSettingsSet(const EventTraceSettingsData * dataIn) {
+    return UAVObjSetData(EventTraceSettingsHandle(), dataIn);
+}
+static inline int32_t EventTraceSettingsInstGet(uint16_t instId, EventTraceSettingsData * dataOut) {
+    return UAVObjGetInstanceData(EventTraceSettingsHandle(), instId, dataOut);
+}
+static inline int32_t EventTraceSettingsInstSet(uint16_t instId, const EventTraceSettingsData * dataIn) {
+    return UAVObjSetInstanceData(EventTraceSettingsHandle(), instId, dataIn);
+}
+static inline int32_t EventTraceSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(EventTraceSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t EventTraceSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t EventTraceSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t EventTraceSettingsCreateInstance() {
+    return UAVObjCreateInstance(EventTraceSettingsHandle(), &EventTraceSettingsSetDefaults);
+}
+static inline void EventTraceSettingsRequestUpdate() {
+    UAVObjRequestUpdate(EventTraceSettingsHandle());
+}
+static inline void EventTraceSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(EventTraceSettingsHandle(), instId);
+}
+static inline void EventTraceSettingsUpdated() {
+    UAVObjUpdated(EventTraceSettingsHandle());
+}
+static inline void EventTraceSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(EventTraceSettingsHandle(), instId);
+}
+static inline void EventTraceSettingsLogging() {
+    UAVObjLogging(EventTraceSettingsHandle());
+}
+static inline void EventTraceSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(EventTraceSettingsHandle(), instId);
+}
+static inline int32_t EventTraceSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(EventTraceSettingsHandle(), dataOut);
+}
+static inline int32_t EventTraceSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(EventTraceSettingsHandle(), dataIn);
+}
+static inline int8_t EventTraceSettingsReadOnly() {
+    return UAVObjReadOnly(EventTraceSettingsHandle());
+}
+
+/* Set/Get functions */
+extern void EventTraceSettingsModeSet(EventTraceSettingsModeOptions *NewMode);
+extern void EventTraceSettingsModeGet(EventTraceSettingsModeOptions *NewMode);
+extern void EventTraceSettingsDestinationSet(EventTraceSettingsDestinationOptions *NewDestination);
+extern void EventTraceSettingsDestinationGet(EventTraceSettingsDestinationOptions *NewDestination);
+
+
+#endif // EVENTTRACESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FlightBatterySettings FlightBatterySettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for FlightBatterySettings Object
+ * @{ 
+ *
+ * @file       flightbatterysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightBatterySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "flightbatterysettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightBatterySettingsInitialize(void)
+{
+    // Compile time assertion that the FlightBatterySettingsDataPacked and FlightBatterySettingsData structs
+    // have the same size (though instances of FlightBatterySettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FlightBatterySettingsDataPacked) == sizeof(FlightBatterySettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FLIGHTBATTERYSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FLIGHTBATTERYSETTINGS_OBJID,
+        FLIGHTBATTERYSETTINGS_ISSINGLEINST, FLIGHTBATTERYSETTINGS_ISSETTINGS, FLIGHTBATTERYSETTINGS_ISPRIORITY, FLIGHTBATTERYSETTINGS_NUMBYTES, &FlightBatterySettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightBatterySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FlightBatterySettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FlightBatterySettingsData));
+    data.Capacity = 2200;
+    data.CellVoltageThresholds.Warning = 3.400000e+00f;
+    data.CellVoltageThresholds.Alarm = 3.100000e+00f;
+    data.SensorCalibrations.VoltageFactor = 1.000000e+00f;
+    data.SensorCalibrations.CurrentFactor = 1.000000e+00f;
+    data.SensorCalibrations.VoltageZero = 0.000000e+00f;
+    data.SensorCalibrations.CurrentZero = 0.000000e+00f;
+    data.Type = 0;
+    data.NbCells = 0;
+    data.ResetConsumedEnergy = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightBatterySettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FlightBatterySettingsCapacitySet(uint32_t *NewCapacity)
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewCapacity, offsetof(FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCapacityGet(uint32_t *NewCapacity)
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewCapacity, offsetof(FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCellVoltageThresholdsSet( FlightBatterySettingsCellVoltageThresholdsData *NewCellVoltageThresholds )
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsGet( FlightBatterySettingsCellVoltageThresholdsData *NewCellVoltageThresholds )
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsArraySet( float *NewCellVoltageThresholds )
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsArrayGet( float *NewCellVoltageThresholds )
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsSet( FlightBatterySettingsSensorCalibrationsData *NewSensorCalibrations )
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsGet( FlightBatterySettingsSensorCalibrationsData *NewSensorCalibrations )
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsArraySet( float *NewSensorCalibrations )
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsArrayGet( float *NewSensorCalibrations )
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsTypeSet(FlightBatterySettingsTypeOptions *NewType)
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewType, offsetof(FlightBatterySettingsData, Type), sizeof(FlightBatterySettingsTypeOptions));
+}
+void FlightBatterySettingsTypeGet(FlightBatterySettingsTypeOptions *NewType)
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewType, offsetof(FlightBatterySettingsData, Type), sizeof(FlightBatterySettingsTypeOptions));
+}
+void FlightBatterySettingsNbCellsSet(uint8_t *NewNbCells)
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewNbCells, offsetof(FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsNbCellsGet(uint8_t *NewNbCells)
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewNbCells, offsetof(FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsResetConsumedEnergySet(FlightBatterySettingsResetConsumedEnergyOptions *NewResetConsumedEnergy)
+{
+    UAVObjSetDataField(FlightBatterySettingsHandle(), (void *)NewResetConsumedEnergy, offsetof(FlightBatterySettingsData, ResetConsumedEnergy), sizeof(FlightBatterySettingsResetConsumedEnergyOptions));
+}
+void FlightBatterySettingsResetConsumedEnergyGet(FlightBatterySettingsResetConsumedEnergyOptions *NewResetConsumedEnergy)
+{
+    UAVObjGetDataField(FlightBatterySettingsHandle(), (void *)NewResetConsumedEnergy, offsetof(FlightBatterySettingsData, ResetConsumedEnergy), sizeof(FlightBatterySettingsResetConsumedEnergyOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,218 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GCSTelemetryStats GCSTelemetryStats
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for GCSTelemetryStats Object
+ * @{ 
+ *
+ * @file       gcstelemetrystats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GCSTelemetryStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gcstelemetrystats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GCSTelemetryStatsInitialize(void)
+{
+    // Compile time assertion that the GCSTelemetryStatsDataPacked and GCSTelemetryStatsData structs
+    // have the same size (though instances of GCSTelemetryStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GCSTelemetryStatsDataPacked) == sizeof(GCSTelemetryStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GCSTELEMETRYSTATS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GCSTELEMETRYSTATS_OBJID,
+        GCSTELEMETRYSTATS_ISSINGLEINST, GCSTELEMETRYSTATS_ISSETTINGS, GCSTELEMETRYSTATS_ISPRIORITY, GCSTELEMETRYSTATS_NUMBYTES, &GCSTelemetryStatsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GCSTelemetryStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GCSTelemetryStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GCSTelemetryStatsData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 5000;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GCSTelemetryStatsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GCSTelemetryStatsTxDataRateSet(float *NewTxDataRate)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewTxDataRate, offsetof(GCSTelemetryStatsData, TxDataRate), sizeof(float));
+}
+void GCSTelemetryStatsTxDataRateGet(float *NewTxDataRate)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewTxDataRate, offsetof(GCSTelemetryStatsData, TxDataRate), sizeof(float));
+}
+void GCSTelemetryStatsTxBytesSet(uint32_t *NewTxBytes)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewTxBytes, offsetof(GCSTelemetryStatsData, TxBytes), sizeof(uint32_t));
+}
+void GCSTelemetryStatsTxBytesGet(uint32_t *NewTxBytes)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewTxBytes, offsetof(GCSTelemetryStatsData, TxBytes), sizeof(uint32_t));
+}
+void GCSTelemetryStatsTxFailuresSet(uint32_t *NewTxFailures)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewTxFailures, offsetof(GCSTelemetryStatsData, TxFailures), sizeof(uint32_t));
+}
+void GCSTelemetryStatsTxFailuresGet(uint32_t *NewTxFailures)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewTxFailures, offsetof(GCSTelemetryStatsData, TxFailures), sizeof(uint32_t));
+}
+void GCSTelemetryStatsTxRetriesSet(uint32_t *NewTxRetries)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewTxRetries, offsetof(GCSTelemetryStatsData, TxRetries), sizeof(uint32_t));
+}
+void GCSTelemetryStatsTxRetriesGet(uint32_t *NewTxRetries)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewTxRetries, offsetof(GCSTelemetryStatsData, TxRetries), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxDataRateSet(float *NewRxDataRate)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewRxDataRate, offsetof(GCSTelemetryStatsData, RxDataRate), sizeof(float));
+}
+void GCSTelemetryStatsRxDataRateGet(float *NewRxDataRate)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewRxDataRate, offsetof(GCSTelemetryStatsData, RxDataRate), sizeof(float));
+}
+void GCSTelemetryStatsRxBytesSet(uint32_t *NewRxBytes)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewRxBytes, offsetof(GCSTelemetryStatsData, RxBytes), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxBytesGet(uint32_t *NewRxBytes)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewRxBytes, offsetof(GCSTelemetryStatsData, RxBytes), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxFailuresSet(uint32_t *NewRxFailures)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewRxFailures, offsetof(GCSTelemetryStatsData, RxFailures), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxFailuresGet(uint32_t *NewRxFailures)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewRxFailures, offsetof(GCSTelemetryStatsData, RxFailures), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxSyncErrorsSet(uint32_t *NewRxSyncErrors)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewRxSyncErrors, offsetof(GCSTelemetryStatsData, RxSyncErrors), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxSyncErrorsGet(uint32_t *NewRxSyncErrors)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewRxSyncErrors, offsetof(GCSTelemetryStatsData, RxSyncErrors), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxCrcErrorsSet(uint32_t *NewRxCrcErrors)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewRxCrcErrors, offsetof(GCSTelemetryStatsData, RxCrcErrors), sizeof(uint32_t));
+}
+void GCSTelemetryStatsRxCrcErrorsGet(uint32_t *NewRxCrcErrors)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewRxCrcErrors, offsetof(GCSTelemetryStatsData, RxCrcErrors), sizeof(uint32_t));
+}
+void GCSTelemetryStatsConnectTimeSet(uint32_t *NewConnectTime)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewConnectTime, offsetof(GCSTelemetryStatsData, ConnectTime), sizeof(uint32_t));
+}
+void GCSTelemetryStatsConnectTimeGet(uint32_t *NewConnectTime)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewConnectTime, offsetof(GCSTelemetryStatsData, ConnectTime), sizeof(uint32_t));
+}
+void GCSTelemetryStatsStatusSet(GCSTelemetryStatsStatusOptions *NewStatus)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewStatus, offsetof(GCSTelemetryStatsData, Status), sizeof(GCSTelemetryStatsStatusOptions));
+}
+void GCSTelemetryStatsStatusGet(GCSTelemetryStatsStatusOptions *NewStatus)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewStatus, offsetof(GCSTelemetryStatsData, Status), sizeof(GCSTelemetryStatsStatusOptions));
+}
+void GCSTelemetryStatsSettingsDumpSet(GCSTelemetryStatsSettingsDumpOptions *NewSettingsDump)
+{
+    UAVObjSetDataField(GCSTelemetryStatsHandle(), (void *)NewSettingsDump, offsetof(GCSTelemetryStatsData, SettingsDump), sizeof(GCSTelemetryStatsSettingsDumpOptions));
+}
+void GCSTelemetryStatsSettingsDumpGet(GCSTelemetryStatsSettingsDumpOptions *NewSettingsDump)
+{
+    UAVObjGetDataField(GCSTelemetryStatsHandle(), (void *)NewSettingsDump, offsetof(GCSTelemetryStatsData, SettingsDump), sizeof(GCSTelemetryStatsSettingsDumpOptions));
+}
+
+
+/**
+ * @}
+ */
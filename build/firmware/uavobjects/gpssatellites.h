@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup GPSSatellites GPSSatellites
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for GPSSatellites Object
+ *
+ * @{
+ *
+ * @file       gpssatellites.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSSatellites object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GPSSATELLITES_H
+#define GPSSATELLITES_H
+#include <stdbool.h>
+/* Object constants */
+#define GPSSATELLITES_OBJID 0xC555B700
+#define GPSSATELLITES_ISSINGLEINST 1
+#define GPSSATELLITES_ISSETTINGS 0
+#define GPSSATELLITES_ISPRIORITY 0
+#define GPSSATELLITES_NUMBYTES sizeof(GPSSatellitesData)
+
+/* Generic interface functions */
+int32_t GPSSatellitesInitialize();
+UAVObjHandle GPSSatellitesHandle();
+void GPSSatellitesSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Azimuth information */
+
+// Number of elements for field Azimuth
+#define GPSSATELLITES_AZIMUTH_NUMELEM 16
+
+/* Field SatsInView information */
+
+/* Field PRN information */
+
+// Number of elements for field PRN
+#define GPSSATELLITES_PRN_NUMELEM 16
+
+/* Field Elevation information */
+
+// Number of elements for field Elevation
+#define GPSSATELLITES_ELEVATION_NUMELEM 16
+
+/* Field SNR information */
+
+// Number of elements for field SNR
+#define GPSSATELLITES_SNR_NUMELEM 16
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        int16_t Azimuth[16];
+    int8_t SatsInView;
+    uint8_t PRN[16];
+    int8_t Elevation[16];
+    int8_t SNR[16];
+
+} __attribute__((packed)) GPSSatellitesDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef GPSSatellitesDataPacked __attribute__((aligned(4))) GPSSatellitesData;
+
+/* Typesafe Object access functions */
+static inline int32_t GPSSatellitesGet(GPSSatellitesData * dataOut) {
+    return UAVObjGetData(GPSSatellitesHandle(), dataOut);
+}
+static inline int32_t GPSSatellitesSet(const GPSSatellitesData * dataIn) {
+    return UAVObjSetData(GPSSatellitesHandle(), dataIn);
+}
+static inline int32_t GPSSatellitesInstGet(uint16_t instId, GPSSatellitesData * dataOut) {
+    return UAVObjGetInstanceData(GPSSatellitesHandle(), instId, dataOut);
+}
+static inline int32_t GPSSatellitesInstSet(uint16_t instId, const GPSSatellitesData * dataIn) {
+    return UAVObjSetInstanceData(GPSSatellitesHandle(), instId, dataIn);
+}
+static inline int32_t GPSSatellitesConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(GPSSatellitesHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t GPSSatellitesConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSSatellitesHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t GPSSatellitesConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSSatellitesHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t GPSSatellitesCreateInstance() {
+    return UAVObjCreateInstance(GPSSatellitesHandle(), &GPSSatellitesSetDefaults);
+}
+static inline void GPSSatellitesRequestUpdate() {
+    UAVObjRequestUpdate(GPSSatellitesHandle());
+}
+static inline void GPSSatellitesRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(GPSSatellitesHandle(), instId);
+}
+static inline void GPSSatellitesUpdated() {
+    UAVObjUpdated(GPSSatellitesHandle());
+}
+static inline void GPSSatellitesInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(GPSSatellitesHandle(), instId);
+}
+static inline void GPSSatellitesLogging() {
+    UAVObjLogging(GPSSatellitesHandle());
+}
+static inline void GPSSatellitesInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(GPSSatellitesHandle(), instId);
+}
+static inline int32_t GPSSatellitesGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(GPSSatellitesHandle(), dataOut);
+}
+static inline int32_t GPSSatellitesSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(GPSSatellitesHandle(), dataIn);
+}
+static inline int8_t GPSSatellitesReadOnly() {
+    return UAVObjReadOnly(GPSSatellitesHandle());
+}
+
+/* Set/Get functions */
+extern void GPSSatellitesAzimuthSet(int16_t *NewAzimuth);
+extern void GPSSatellitesAzimuthGet(int16_t *NewAzimuth);
+extern void GPSSatellitesSatsInViewSet(int8_t *NewSatsInView);
+extern void GPSSatellitesSatsInViewGet(int8_t *NewSatsInView);
+extern void GPSSatellitesPRNSet(uint8_t *NewPRN);
+extern void GPSSatellitesPRNGet(uint8_t *NewPRN);
+extern void GPSSatellitesElevationSet(int8_t *NewElevation);
+extern void GPSSatellitesElevationGet(int8_t *NewElevation);
+extern void GPSSatellitesSNRSet(int8_t *NewSNR);
+extern void GPSSatellitesSNRGet(int8_t *NewSNR);
+
+
+#endif // GPSSATELLITES_H
+
+/**
+ * @}
+ * @}
+ */
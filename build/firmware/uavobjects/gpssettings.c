@@ -0,0 +1,221 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GPSSettings GPSSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for GPSSettings Object
+ * @{ 
+ *
+ * @file       gpssettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gpssettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GPSSettingsInitialize(void)
+{
+    // Compile time assertion that the GPSSettingsDataPacked and GPSSettingsData structs
+    // have the same size (though instances of GPSSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GPSSettingsDataPacked) == sizeof(GPSSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GPSSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GPSSETTINGS_OBJID,
+        GPSSETTINGS_ISSINGLEINST, GPSSETTINGS_ISSETTINGS, GPSSETTINGS_ISPRIORITY, GPSSETTINGS_NUMBYTES, &GPSSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GPSSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GPSSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GPSSettingsData));
+    data.MaxPDOP = 3.500000e+00f;
+    data.DataProtocol = 1;
+    data.MinSatellites = 7;
+    data.UbxAutoConfig = 2;
+    data.UbxRate = 5;
+    data.UbxDynamicModel = 5;
+    data.UbxSBASMode = 1;
+    data.UbxSBASChannelsUsed = 3;
+    data.UbxSBASSats = 0;
+    data.UbxGNSSMode = 0;
+    data.UbxAssistNowAutonomous = 1;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GPSSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GPSSettingsMaxPDOPSet(float *NewMaxPDOP)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewMaxPDOP, offsetof(GPSSettingsData, MaxPDOP), sizeof(float));
+}
+void GPSSettingsMaxPDOPGet(float *NewMaxPDOP)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewMaxPDOP, offsetof(GPSSettingsData, MaxPDOP), sizeof(float));
+}
+void GPSSettingsDataProtocolSet(GPSSettingsDataProtocolOptions *NewDataProtocol)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewDataProtocol, offsetof(GPSSettingsData, DataProtocol), sizeof(GPSSettingsDataProtocolOptions));
+}
+void GPSSettingsDataProtocolGet(GPSSettingsDataProtocolOptions *NewDataProtocol)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewDataProtocol, offsetof(GPSSettingsData, DataProtocol), sizeof(GPSSettingsDataProtocolOptions));
+}
+void GPSSettingsMinSatellitesSet(uint8_t *NewMinSatellites)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewMinSatellites, offsetof(GPSSettingsData, MinSatellites), sizeof(uint8_t));
+}
+void GPSSettingsMinSatellitesGet(uint8_t *NewMinSatellites)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewMinSatellites, offsetof(GPSSettingsData, MinSatellites), sizeof(uint8_t));
+}
+void GPSSettingsUbxAutoConfigSet(GPSSettingsUbxAutoConfigOptions *NewUbxAutoConfig)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxAutoConfig, offsetof(GPSSettingsData, UbxAutoConfig), sizeof(GPSSettingsUbxAutoConfigOptions));
+}
+void GPSSettingsUbxAutoConfigGet(GPSSettingsUbxAutoConfigOptions *NewUbxAutoConfig)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxAutoConfig, offsetof(GPSSettingsData, UbxAutoConfig), sizeof(GPSSettingsUbxAutoConfigOptions));
+}
+void GPSSettingsUbxRateSet(int8_t *NewUbxRate)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxRate, offsetof(GPSSettingsData, UbxRate), sizeof(int8_t));
+}
+void GPSSettingsUbxRateGet(int8_t *NewUbxRate)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxRate, offsetof(GPSSettingsData, UbxRate), sizeof(int8_t));
+}
+void GPSSettingsUbxDynamicModelSet(GPSSettingsUbxDynamicModelOptions *NewUbxDynamicModel)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxDynamicModel, offsetof(GPSSettingsData, UbxDynamicModel), sizeof(GPSSettingsUbxDynamicModelOptions));
+}
+void GPSSettingsUbxDynamicModelGet(GPSSettingsUbxDynamicModelOptions *NewUbxDynamicModel)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxDynamicModel, offsetof(GPSSettingsData, UbxDynamicModel), sizeof(GPSSettingsUbxDynamicModelOptions));
+}
+void GPSSettingsUbxSBASModeSet(GPSSettingsUbxSBASModeOptions *NewUbxSBASMode)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxSBASMode, offsetof(GPSSettingsData, UbxSBASMode), sizeof(GPSSettingsUbxSBASModeOptions));
+}
+void GPSSettingsUbxSBASModeGet(GPSSettingsUbxSBASModeOptions *NewUbxSBASMode)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxSBASMode, offsetof(GPSSettingsData, UbxSBASMode), sizeof(GPSSettingsUbxSBASModeOptions));
+}
+void GPSSettingsUbxSBASChannelsUsedSet(uint8_t *NewUbxSBASChannelsUsed)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxSBASChannelsUsed, offsetof(GPSSettingsData, UbxSBASChannelsUsed), sizeof(uint8_t));
+}
+void GPSSettingsUbxSBASChannelsUsedGet(uint8_t *NewUbxSBASChannelsUsed)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxSBASChannelsUsed, offsetof(GPSSettingsData, UbxSBASChannelsUsed), sizeof(uint8_t));
+}
+void GPSSettingsUbxSBASSatsSet(GPSSettingsUbxSBASSatsOptions *NewUbxSBASSats)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxSBASSats, offsetof(GPSSettingsData, UbxSBASSats), sizeof(GPSSettingsUbxSBASSatsOptions));
+}
+void GPSSettingsUbxSBASSatsGet(GPSSettingsUbxSBASSatsOptions *NewUbxSBASSats)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxSBASSats, offsetof(GPSSettingsData, UbxSBASSats), sizeof(GPSSettingsUbxSBASSatsOptions));
+}
+void GPSSettingsUbxGNSSModeSet(GPSSettingsUbxGNSSModeOptions *NewUbxGNSSMode)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxGNSSMode, offsetof(GPSSettingsData, UbxGNSSMode), sizeof(GPSSettingsUbxGNSSModeOptions));
+}
+void GPSSettingsUbxGNSSModeGet(GPSSettingsUbxGNSSModeOptions *NewUbxGNSSMode)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxGNSSMode, offsetof(GPSSettingsData, UbxGNSSMode), sizeof(GPSSettingsUbxGNSSModeOptions));
+}
+void GPSSettingsUbxAssistNowAutonomousSet(GPSSettingsUbxAssistNowAutonomousOptions *NewUbxAssistNowAutonomous)
+{
+    UAVObjSetDataField(GPSSettingsHandle(), (void *)NewUbxAssistNowAutonomous, offsetof(GPSSettingsData, UbxAssistNowAutonomous), sizeof(GPSSettingsUbxAssistNowAutonomousOptions));
+}
+void GPSSettingsUbxAssistNowAutonomousGet(GPSSettingsUbxAssistNowAutonomousOptions *NewUbxAssistNowAutonomous)
+{
+    UAVObjGetDataField(GPSSettingsHandle(), (void *)NewUbxAssistNowAutonomous, offsetof(GPSSettingsData, UbxAssistNowAutonomous), sizeof(GPSSettingsUbxAssistNowAutonomousOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,221 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup GroundPathFollowerSettings GroundPathFollowerSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for GroundPathFollowerSettings Object
+ *
+ * @{
+ *
+ * @file       groundpathfollowersettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GroundPathFollowerSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GROUNDPATHFOLLOWERSETTINGS_H
+#define GROUNDPATHFOLLOWERSETTINGS_H
+#include <stdbool.h>
+/* Object constants */
+#define GROUNDPATHFOLLOWERSETTINGS_OBJID 0xCD54334C
+#define GROUNDPATHFOLLOWERSETTINGS_ISSINGLEINST 1
+#define GROUNDPATHFOLLOWERSETTINGS_ISSETTINGS 1
+#define GROUNDPATHFOLLOWERSETTINGS_ISPRIORITY 0
+#define GROUNDPATHFOLLOWERSETTINGS_NUMBYTES sizeof(GroundPathFollowerSettingsData)
+
+/* Generic interface functions */
+int32_t GroundPathFollowerSettingsInitialize();
+UAVObjHandle GroundPathFollowerSettingsHandle();
+void GroundPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field HorizontalVelMax information */
+
+/* Field HorizontalVelMin information */
+
+/* Field CourseFeedForward information */
+
+/* Field VelocityFeedForward information */
+
+/* Field HorizontalPosP information */
+
+/* Field SpeedPI information */
+
+// Array element names for field SpeedPI
+typedef enum {
+    GROUNDPATHFOLLOWERSETTINGS_SPEEDPI_KP=0,
+    GROUNDPATHFOLLOWERSETTINGS_SPEEDPI_KI=1,
+    GROUNDPATHFOLLOWERSETTINGS_SPEEDPI_KD=2,
+    GROUNDPATHFOLLOWERSETTINGS_SPEEDPI_BETA=3
+} GroundPathFollowerSettingsSpeedPIElem;
+
+// Number of elements for field SpeedPI
+#define GROUNDPATHFOLLOWERSETTINGS_SPEEDPI_NUMELEM 4
+
+/* Field ThrustLimit information */
+
+// Array element names for field ThrustLimit
+typedef enum {
+    GROUNDPATHFOLLOWERSETTINGS_THRUSTLIMIT_MIN=0,
+    GROUNDPATHFOLLOWERSETTINGS_THRUSTLIMIT_SLOWFORWARD=1,
+    GROUNDPATHFOLLOWERSETTINGS_THRUSTLIMIT_MAX=2
+} GroundPathFollowerSettingsThrustLimitElem;
+
+// Number of elements for field ThrustLimit
+#define GROUNDPATHFOLLOWERSETTINGS_THRUSTLIMIT_NUMELEM 3
+
+/* Field UpdatePeriod information */
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  GroundPathFollowerSettingsSpeedPIData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  GroundPathFollowerSettingsSpeedPIDataArray ;
+#define GroundPathFollowerSettingsSpeedPIToArray( var ) UAVObjectFieldToArray( GroundPathFollowerSettingsSpeedPIData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float SlowForward;
+    float Max;
+}  GroundPathFollowerSettingsThrustLimitData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  GroundPathFollowerSettingsThrustLimitDataArray ;
+#define GroundPathFollowerSettingsThrustLimitToArray( var ) UAVObjectFieldToArray( GroundPathFollowerSettingsThrustLimitData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float HorizontalVelMax;
+    float HorizontalVelMin;
+    float CourseFeedForward;
+    float VelocityFeedForward;
+    float HorizontalPosP;
+    GroundPathFollowerSettingsSpeedPIData SpeedPI;
+    GroundPathFollowerSettingsThrustLimitData ThrustLimit;
+    int32_t UpdatePeriod;
+
+} __attribute__((packed)) GroundPathFollowerSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef GroundPathFollowerSettingsDataPacked __attribute__((aligned(4))) GroundPathFollowerSettingsData;
+
+/* Typesafe Object access functions */
+static inline int32_t GroundPathFollowerSettingsGet(GroundPathFollowerSettingsData * dataOut) {
+    return UAVObjGetData(GroundPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t GroundPathFollowerSettingsSet(const GroundPathFollowerSettingsData * dataIn) {
+    return UAVObjSetData(GroundPathFollowerSettingsHandle(), dataIn);
+}
+static inline int32_t GroundPathFollowerSettingsInstGet(uint16_t instId, GroundPathFollowerSettingsData * dataOut) {
+    return UAVObjGetInstanceData(GroundPathFollowerSettingsHandle(), instId, dataOut);
+}
+static inline int32_t GroundPathFollowerSettingsInstSet(uint16_t instId, const GroundPathFollowerSettingsData * dataIn) {
+    return UAVObjSetInstanceData(GroundPathFollowerSettingsHandle(), instId, dataIn);
+}
+static inline int32_t GroundPathFollowerSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(GroundPathFollowerSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t GroundPathFollowerSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GroundPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t GroundPathFollowerSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GroundPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t GroundPathFollowerSettingsCreateInstance() {
+    return UAVObjCreateInstance(GroundPathFollowerSettingsHandle(), &GroundPathFollowerSettingsSetDefaults);
+}
+static inline void GroundPathFollowerSettingsRequestUpdate() {
+    UAVObjRequestUpdate(GroundPathFollowerSettingsHandle());
+}
+static inline void GroundPathFollowerSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(GroundPathFollowerSettingsHandle(), instId);
+}
+static inline void GroundPathFollowerSettingsUpdated() {
+    UAVObjUpdated(GroundPathFollowerSettingsHandle());
+}
+static inline void GroundPathFollowerSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(GroundPathFollowerSettingsHandle(), instId);
+}
+static inline void GroundPathFollowerSettingsLogging() {
+    UAVObjLogging(GroundPathFollowerSettingsHandle());
+}
+static inline void GroundPathFollowerSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(GroundPathFollowerSettingsHandle(), instId);
+}
+static inline int32_t GroundPathFollowerSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(GroundPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t GroundPathFollowerSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(GroundPathFollowerSettingsHandle(), dataIn);
+}
+static inline int8_t GroundPathFollowerSettingsReadOnly() {
+    return UAVObjReadOnly(GroundPathFollowerSettingsHandle());
+}
+
+/* Set/Get functions */
+extern void GroundPathFollowerSettingsHorizontalVelMaxSet(float *NewHorizontalVelMax);
+extern void GroundPathFollowerSettingsHorizontalVelMaxGet(float *NewHorizontalVelMax);
+extern void GroundPathFollowerSettingsHorizontalVelMinSet(float *NewHorizontalVelMin);
+extern void GroundPathFollowerSettingsHorizontalVelMinGet(float *NewHorizontalVelMin);
+extern void GroundPathFollowerSettingsCourseFeedForwardSet(float *NewCourseFeedForward);
+extern void GroundPathFollowerSettingsCourseFeedForwardGet(float *NewCourseFeedForward);
+extern void GroundPathFollowerSettingsVelocityFeedForwardSet(float *NewVelocityFeedForward);
+extern void GroundPathFollowerSettingsVelocityFeedForwardGet(float *NewVelocityFeedForward);
+extern void GroundPathFollowerSettingsHorizontalPosPSet(float *NewHorizontalPosP);
+extern void GroundPathFollowerSettingsHorizontalPosPGet(float *NewHorizontalPosP);
+extern void GroundPathFollowerSettingsSpeedPISet(GroundPathFollowerSettingsSpeedPIData *NewSpeedPI);
+extern void GroundPathFollowerSettingsSpeedPIGet(GroundPathFollowerSettingsSpeedPIData *NewSpeedPI);
+extern void GroundPathFollowerSettingsSpeedPIArraySet(float *NewSpeedPI);
+extern void GroundPathFollowerSettingsSpeedPIArrayGet(float *NewSpeedPI);
+extern void GroundPathFollowerSettingsThrustLimitSet(GroundPathFollowerSettingsThrustLimitData *NewThrustLimit);
+extern void GroundPathFollowerSettingsThrustLimitGet(GroundPathFollowerSettingsThrustLimitData *NewThrustLimit);
+extern void GroundPathFollowerSettingsThrustLimitArraySet(float *NewThrustLimit);
+extern void GroundPathFollowerSettingsThrustLimitArrayGet(float *NewThrustLimit);
+extern void GroundPathFollowerSettingsUpdatePeriodSet(int32_t *NewUpdatePeriod);
+extern void GroundPathFollowerSettingsUpdatePeriodGet(int32_t *NewUpdatePeriod);
+
+
+#endif // GROUNDPATHFOLLOWERSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
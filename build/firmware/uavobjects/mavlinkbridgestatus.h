@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup MavlinkBridgeStatus MavlinkBridgeStatus
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for MavlinkBridgeStatus Object
+ *
+ * @{
+ *
+ * @file       mavlinkbridgestatus.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the MavlinkBridgeStatus object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MAVLINKBRIDGESTATUS_H
+#define MAVLINKBRIDGESTATUS_H
+#include <stdbool.h>
+/* Object constants */
+#define MAVLINKBRIDGESTATUS_OBJID 0xDF04095E
+#define MAVLINKBRIDGESTATUS_ISSINGLEINST 1
+#define MAVLINKBRIDGESTATUS_ISSETTINGS 0
+#define MAVLINKBRIDGESTATUS_ISPRIORITY 0
+#define MAVLINKBRIDGESTATUS_NUMBYTES sizeof(MavlinkBridgeStatusData)
+
+/* Generic interface functions */
+int32_t MavlinkBridgeStatusInitialize();
+UAVObjHandle MavlinkBridgeStatusHandle();
+void MavlinkBridgeStatusSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field TxSent information */
+
+/* Field TxDropped information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint32_t TxSent;
+    uint32_t TxDropped;
+
+} __attribute__((packed)) MavlinkBridgeStatusDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef MavlinkBridgeStatusDataPacked __attribute__((aligned(4))) MavlinkBridgeStatusData;
+
+/* Typesafe Object access functions */
+static inline int32_t MavlinkBridgeStatusGet(MavlinkBridgeStatusData * dataOut) {
+    return UAVObjGetData(MavlinkBridgeStatusHandle(), dataOut);
+}
+static inline int32_t MavlinkBridgeStatusSet(const MavlinkBridgeStatusData * dataIn) {
+    return UAVObjSetData(MavlinkBridgeStatusHandle(), dataIn);
+}
+static inline int32_t MavlinkBridgeStatusInstGet(uint16_t instId, MavlinkBridgeStatusData * dataOut) {
+    return UAVObjGetInstanceData(MavlinkBridgeStatusHandle(), instId, dataOut);
+}
+static inline int32_t MavlinkBridgeStatusInstSet(uint16_t instId, const MavlinkBridgeStatusData * dataIn) {
+    return UAVObjSetInstanceData(MavlinkBridgeStatusHandle(), instId, dataIn);
+}
+static inline int32_t MavlinkBridgeStatusConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(MavlinkBridgeStatusHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t MavlinkBridgeStatusConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MavlinkBridgeStatusHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t MavlinkBridgeStatusConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MavlinkBridgeStatusHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t MavlinkBridgeStatusCreateInstance() {
+    return UAVObjCreateInstance(MavlinkBridgeStatusHandle(), &MavlinkBridgeStatusSetDefaults);
+}
+static inline void MavlinkBridgeStatusRequestUpdate() {
+    UAVObjRequestUpdate(MavlinkBridgeStatusHandle());
+}
+static inline void MavlinkBridgeStatusRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(MavlinkBridgeStatusHandle(), instId);
+}
+static inline void MavlinkBridgeStatusUpdated() {
+    UAVObjUpdated(MavlinkBridgeStatusHandle());
+}
+static inline void MavlinkBridgeStatusInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(MavlinkBridgeStatusHandle(), instId);
+}
+static inline void MavlinkBridgeStatusLogging() {
+    UAVObjLogging(MavlinkBridgeStatusHandle());
+}
+static inline void MavlinkBridgeStatusInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(MavlinkBridgeStatusHandle(), instId);
+}
+static inline int32_t MavlinkBridgeStatusGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(MavlinkBridgeStatusHandle(), dataOut);
+}
+static inline int32_t MavlinkBridgeStatusSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(MavlinkBridgeStatusHandle(), dataIn);
+}
+static inline int8_t MavlinkBridgeStatusReadOnly() {
+    return UAVObjReadOnly(MavlinkBridgeStatusHandle());
+}
+
+/* Set/Get functions */
+extern void MavlinkBridgeStatusTxSentSet(uint32_t *NewTxSent);
+extern void MavlinkBridgeStatusTxSentGet(uint32_t *NewTxSent);
+extern void MavlinkBridgeStatusTxDroppedSet(uint32_t *NewTxDropped);
+extern void MavlinkBridgeStatusTxDroppedGet(uint32_t *NewTxDropped);
+
+
+#endif // MAVLINKBRIDGESTATUS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,176 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup OptiPositionState OptiPositionState
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OptiPositionState Object
+ *
+ * @{
+ *
+ * @file       optipositionstate.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OptiPositionState object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPTIPOSITIONSTATE_H
+#define OPTIPOSITIONSTATE_H
+#include <stdbool.h>
+/* Object constants */
+#define OPTIPOSITIONSTATE_OBJID 0xC519C8CC
+#define OPTIPOSITIONSTATE_ISSINGLEINST 1
+#define OPTIPOSITIONSTATE_ISSETTINGS 0
+#define OPTIPOSITIONSTATE_ISPRIORITY 0
+#define OPTIPOSITIONSTATE_NUMBYTES sizeof(OptiPositionStateData)
+
+/* Generic interface functions */
+int32_t OptiPositionStateInitialize();
+UAVObjHandle OptiPositionStateHandle();
+void OptiPositionStateSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field North information */
+
+/* Field East information */
+
+/* Field Down information */
+
+/* Field Roll information */
+
+/* Field Pitch information */
+
+/* Field Yaw information */
+
+/* Field OptiDataVaild information */
+
+// Enumeration options for field OptiDataVaild
+typedef enum __attribute__ ((__packed__)) {
+    OPTIPOSITIONSTATE_OPTIDATAVAILD_FALSE=0,
+    OPTIPOSITIONSTATE_OPTIDATAVAILD_TRUE=1
+} OptiPositionStateOptiDataVaildOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float North;
+    float East;
+    float Down;
+    float Roll;
+    float Pitch;
+    float Yaw;
+    OptiPositionStateOptiDataVaildOptions OptiDataVaild;
+
+} __attribute__((packed)) OptiPositionStateDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef OptiPositionStateDataPacked __attribute__((aligned(4))) OptiPositionStateData;
+
+/* Typesafe Object access functions */
+static inline int32_t OptiPositionStateGet(OptiPositionStateData * dataOut) {
+    return UAVObjGetData(OptiPositionStateHandle(), dataOut);
+}
+static inline int32_t OptiPositionStateSet(const OptiPositionStateData * dataIn) {
+    return UAVObjSetData(OptiPositionStateHandle(), dataIn);
+}
+static inline int32_t OptiPositionStateInstGet(uint16_t instId, OptiPositionStateData * dataOut) {
+    return UAVObjGetInstanceData(OptiPositionStateHandle(), instId, dataOut);
+}
+static inline int32_t OptiPositionStateInstSet(uint16_t instId, const OptiPositionStateData * dataIn) {
+    return UAVObjSetInstanceData(OptiPositionStateHandle(), instId, dataIn);
+}
+static inline int32_t OptiPositionStateConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(OptiPositionStateHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t OptiPositionStateConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiPositionStateHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t OptiPositionStateConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiPositionStateHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t OptiPositionStateCreateInstance() {
+    return UAVObjCreateInstance(OptiPositionStateHandle(), &OptiPositionStateSetDefaults);
+}
+static inline void OptiPositionStateRequestUpdate() {
+    UAVObjRequestUpdate(OptiPositionStateHandle());
+}
+static inline void OptiPositionStateRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(OptiPositionStateHandle(), instId);
+}
+static inline void OptiPositionStateUpdated() {
+    UAVObjUpdated(OptiPositionStateHandle());
+}
+static inline void OptiPositionStateInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(OptiPositionStateHandle(), instId);
+}
+static inline void OptiPositionStateLogging() {
+    UAVObjLogging(OptiPositionStateHandle());
+}
+static inline void OptiPositionStateInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(OptiPositionStateHandle(), instId);
+}
+static inline int32_t OptiPositionStateGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(OptiPositionStateHandle(), dataOut);
+}
+static inline int32_t OptiPositionStateSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(OptiPositionStateHandle(), dataIn);
+}
+static inline int8_t OptiPositionStateReadOnly() {
+    return UAVObjReadOnly(OptiPositionStateHandle());
+}
+
+/* Set/Get functions */
+extern void OptiPositionStateNorthSet(float *NewNorth);
+extern void OptiPositionStateNorthGet(float *NewNorth);
+extern void OptiPositionStateEastSet(float *NewEast);
+extern void OptiPositionStateEastGet(float *NewEast);
+extern void OptiPositionStateDownSet(float *NewDown);
+extern void OptiPositionStateDownGet(float *NewDown);
+extern void OptiPositionStateRollSet(float *NewRoll);
+extern void OptiPositionStateRollGet(float *NewRoll);
+extern void OptiPositionStatePitchSet(float *NewPitch);
+extern void OptiPositionStatePitchGet(float *NewPitch);
+extern void OptiPositionStateYawSet(float *NewYaw);
+extern void OptiPositionStateYawGet(float *NewYaw);
+extern void OptiPositionStateOptiDataVaildSet(OptiPositionStateOptiDataVaildOptions *NewOptiDataVaild);
+extern void OptiPositionStateOptiDataVaildGet(OptiPositionStateOptiDataVaildOptions *NewOptiDataVaild);
+
+
+#endif // OPTIPOSITIONSTATE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup OptiSetpoint OptiSetpoint
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OptiSetpoint Object
+ *
+ * @{
+ *
+ * @file       optisetpoint.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OptiSetpoint object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPTISETPOINT_H
+#define OPTISETPOINT_H
+#include <stdbool.h>
+/* Object constants */
+#define OPTISETPOINT_OBJID 0x4D6E83BE
+#define OPTISETPOINT_ISSINGLEINST 1
+#define OPTISETPOINT_ISSETTINGS 0
+#define OPTISETPOINT_ISPRIORITY 0
+#define OPTISETPOINT_NUMBYTES sizeof(OptiSetpointData)
+
+/* Generic interface functions */
+int32_t OptiSetpointInitialize();
+UAVObjHandle OptiSetpointHandle();
+void OptiSetpointSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Position information */
+
+// Array element names for field Position
+typedef enum {
+    OPTISETPOINT_POSITION_NORTH=0,
+    OPTISETPOINT_POSITION_EAST=1,
+    OPTISETPOINT_POSITION_DOWN=2
+} OptiSetpointPositionElem;
+
+// Number of elements for field Position
+#define OPTISETPOINT_POSITION_NUMELEM 3
+
+/* Field Velocity information */
+
+// Array element names for field Velocity
+typedef enum {
+    OPTISETPOINT_VELOCITY_NORTH=0,
+    OPTISETPOINT_VELOCITY_EAST=1,
+    OPTISETPOINT_VELOCITY_DOWN=2
+} OptiSetpointVelocityElem;
+
+// Number of elements for field Velocity
+#define OPTISETPOINT_VELOCITY_NUMELEM 3
+
+/* Field Trust information */
+
+/* Field OptiSetpointMode information */
+
+// Enumeration options for field OptiSetpointMode
+typedef enum __attribute__ ((__packed__)) {
+    OPTISETPOINT_OPTISETPOINTMODE_DISABLE=0,
+    OPTISETPOINT_OPTISETPOINTMODE_MANUAL=1,
+    OPTISETPOINT_OPTISETPOINTMODE_ATTITUDE=2,
+    OPTISETPOINT_OPTISETPOINTMODE_VELOCITY=3,
+    OPTISETPOINT_OPTISETPOINTMODE_POSITION=4,
+    OPTISETPOINT_OPTISETPOINTMODE_TAKEOFF=5,
+    OPTISETPOINT_OPTISETPOINTMODE_LAND=6
+} OptiSetpointOptiSetpointModeOptions;
+
+// Array element names for field OptiSetpointMode
+typedef enum {
+    OPTISETPOINT_OPTISETPOINTMODE_NORTH=0,
+    OPTISETPOINT_OPTISETPOINTMODE_EAST=1,
+    OPTISETPOINT_OPTISETPOINTMODE_DOWN=2
+} OptiSetpointOptiSetpointModeElem;
+
+// Number of elements for field OptiSetpointMode
+#define OPTISETPOINT_OPTISETPOINTMODE_NUMELEM 3
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float North;
+    float East;
+    float Down;
+}  OptiSetpointPositionData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  OptiSetpointPositionDataArray ;
+#define OptiSetpointPositionToArray( var ) UAVObjectFieldToArray( OptiSetpointPositionData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float North;
+    float East;
+    float Down;
+}  OptiSetpointVelocityData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  OptiSetpointVelocityDataArray ;
+#define OptiSetpointVelocityToArray( var ) UAVObjectFieldToArray( OptiSetpointVelocityData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    OptiSetpointOptiSetpointModeOptions North;
+    OptiSetpointOptiSetpointModeOptions East;
+    OptiSetpointOptiSetpointModeOptions Down;
+}  OptiSetpointOptiSetpointModeData ;
+typedef struct __attribute__ ((__packed__)) {
+    OptiSetpointOptiSetpointModeOptions array[3];
+}  OptiSetpointOptiSetpointModeDataArray ;
+#define OptiSetpointOptiSetpointModeToArray( var ) UAVObjectFieldToArray( OptiSetpointOptiSetpointModeData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        OptiSetpointPositionData Position;
+    OptiSetpointVelocityData Velocity;
+    float Trust;
+    OptiSetpointOptiSetpointModeData OptiSetpointMode;
+
+} __attribute__((packed)) OptiSetpointDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef OptiSetpointDataPacked __attribute__((aligned(4))) OptiSetpointData;
+
+/* Typesafe Object access functions */
+static inline int32_t OptiSetpointGet(OptiSetpointData * dataOut) {
+    return UAVObjGetData(OptiSetpointHandle(), dataOut);
+}
+static inline int32_t OptiSetpointSet(const OptiSetpointData * dataIn) {
+    return UAVObjSetData(OptiSetpointHandle(), dataIn);
+}
+static inline int32_t OptiSetpointInstGet(uint16_t instId, OptiSetpointData * dataOut) {
+    return UAVObjGetInstanceData(OptiSetpointHandle(), instId, dataOut);
+}
+static inline int32_t OptiSetpointInstSet(uint16_t instId, const OptiSetpointData * dataIn) {
+    return UAVObjSetInstanceData(OptiSetpointHandle(), instId, dataIn);
+}
+static inline int32_t OptiSetpointConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(OptiSetpointHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t OptiSetpointConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiSetpointHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t OptiSetpointConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiSetpointHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t OptiSetpointCreateInstance() {
+    return UAVObjCreateInstance(OptiSetpointHandle(), &OptiSetpointSetDefaults);
+}
+static inline void OptiSetpointRequestUpdate() {
+    UAVObjRequestUpdate(OptiSetpointHandle());
+}
+static inline void OptiSetpointRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(OptiSetpointHandle(), instId);
+}
+static inline void OptiSetpointUpdated() {
+    UAVObjUpdated(OptiSetpointHandle());
+}
+static inline void OptiSetpointInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(OptiSetpointHandle(), instId);
+}
+static inline void OptiSetpointLogging() {
+    UAVObjLogging(OptiSetpointHandle());
+}
+static inline void OptiSetpointInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(OptiSetpointHandle(), instId);
+}
+static inline int32_t OptiSetpointGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(OptiSetpointHandle(), dataOut);
+}
+static inline int32_t OptiSetpointSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(OptiSetpointHandle(), dataIn);
+}
+static inline int8_t OptiSetpointReadOnly() {
+    return UAVObjReadOnly(OptiSetpointHandle());
+}
+
+/* Set/Get functions */
+extern void OptiSetpointPositionSet(OptiSetpointPositionData *NewPosition);
+extern void OptiSetpointPositionGet(OptiSetpointPositionData *NewPosition);
+extern void OptiSetpointPositionArraySet(float *NewPosition);
+extern void OptiSetpointPositionArrayGet(float *NewPosition);
+extern void OptiSetpointVelocitySet(OptiSetpointVelocityData *NewVelocity);
+extern void OptiSetpointVelocityGet(OptiSetpointVelocityData *NewVelocity);
+extern void OptiSetpointVelocityArraySet(float *NewVelocity);
+extern void OptiSetpointVelocityArrayGet(float *NewVelocity);
+extern void OptiSetpointTrustSet(float *NewTrust);
+extern void OptiSetpointTrustGet(float *NewTrust);
+extern void OptiSetpointOptiSetpointModeSet(OptiSetpointOptiSetpointModeData *NewOptiSetpointMode);
+extern void OptiSetpointOptiSetpointModeGet(OptiSetpointOptiSetpointModeData *NewOptiSetpointMode);
+extern void OptiSetpointOptiSetpointModeArraySet(OptiSetpointOptiSetpointModeOptions *NewOptiSetpointMode);
+extern void OptiSetpointOptiSetpointModeArrayGet(OptiSetpointOptiSetpointModeOptions *NewOptiSetpointMode);
+
+
+#endif // OPTISETPOINT_H
+
+/**
+ * @}
+ * @}
+ */
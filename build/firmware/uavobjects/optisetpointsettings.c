@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OptiSetpointSettings OptiSetpointSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OptiSetpointSettings Object
+ * @{ 
+ *
+ * @file       optisetpointsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OptiSetpointSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "optisetpointsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OptiSetpointSettingsInitialize(void)
+{
+    // Compile time assertion that the OptiSetpointSettingsDataPacked and OptiSetpointSettingsData structs
+    // have the same size (though instances of OptiSetpointSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OptiSetpointSettingsDataPacked) == sizeof(OptiSetpointSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OPTISETPOINTSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OPTISETPOINTSETTINGS_OBJID,
+        OPTISETPOINTSETTINGS_ISSINGLEINST, OPTISETPOINTSETTINGS_ISSETTINGS, OPTISETPOINTSETTINGS_ISPRIORITY, OPTISETPOINTSETTINGS_NUMBYTES, &OptiSetpointSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OptiSetpointSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OptiSetpointSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OptiSetpointSettingsData));
+    data.OptiSpeedMax.North = 1.000000e+00f;
+    data.OptiSpeedMax.East = 1.000000e+00f;
+    data.OptiSpeedMax.Down = 6.000000e-01f;
+    data.OptiPositionMax.North = 3.000000e-01f;
+    data.OptiPositionMax.East = 3.000000e-01f;
+    data.OptiPositionMax.Down = 1.000000e-01f;
+    data.Trust = 5.000000e-01f;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OptiSetpointSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OptiSetpointSettingsOptiSpeedMaxSet( OptiSetpointSettingsOptiSpeedMaxData *NewOptiSpeedMax )
+{
+    UAVObjSetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiSpeedMax, offsetof(OptiSetpointSettingsData, OptiSpeedMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiSpeedMaxGet( OptiSetpointSettingsOptiSpeedMaxData *NewOptiSpeedMax )
+{
+    UAVObjGetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiSpeedMax, offsetof(OptiSetpointSettingsData, OptiSpeedMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiSpeedMaxArraySet( float *NewOptiSpeedMax )
+{
+    UAVObjSetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiSpeedMax, offsetof(OptiSetpointSettingsData, OptiSpeedMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiSpeedMaxArrayGet( float *NewOptiSpeedMax )
+{
+    UAVObjGetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiSpeedMax, offsetof(OptiSetpointSettingsData, OptiSpeedMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiPositionMaxSet( OptiSetpointSettingsOptiPositionMaxData *NewOptiPositionMax )
+{
+    UAVObjSetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiPositionMax, offsetof(OptiSetpointSettingsData, OptiPositionMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiPositionMaxGet( OptiSetpointSettingsOptiPositionMaxData *NewOptiPositionMax )
+{
+    UAVObjGetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiPositionMax, offsetof(OptiSetpointSettingsData, OptiPositionMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiPositionMaxArraySet( float *NewOptiPositionMax )
+{
+    UAVObjSetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiPositionMax, offsetof(OptiSetpointSettingsData, OptiPositionMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsOptiPositionMaxArrayGet( float *NewOptiPositionMax )
+{
+    UAVObjGetDataField(OptiSetpointSettingsHandle(), (void *)NewOptiPositionMax, offsetof(OptiSetpointSettingsData, OptiPositionMax), 3*sizeof(float));
+}
+void OptiSetpointSettingsTrustSet(float *NewTrust)
+{
+    UAVObjSetDataField(OptiSetpointSettingsHandle(), (void *)NewTrust, offsetof(OptiSetpointSettingsData, Trust), sizeof(float));
+}
+void OptiSetpointSettingsTrustGet(float *NewTrust)
+{
+    UAVObjGetDataField(OptiSetpointSettingsHandle(), (void *)NewTrust, offsetof(OptiSetpointSettingsData, Trust), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,194 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup OptiSetpointSettings OptiSetpointSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OptiSetpointSettings Object
+ *
+ * @{
+ *
+ * @file       optisetpointsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OptiSetpointSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPTISETPOINTSETTINGS_H
+#define OPTISETPOINTSETTINGS_H
+#include <stdbool.h>
+/* Object constants */
+#define OPTISETPOINTSETTINGS_OBJID 0x15752CD4
+#define OPTISETPOINTSETTINGS_ISSINGLEINST 1
+#define OPTISETPOINTSETTINGS_ISSETTINGS 1
+#define OPTISETPOINTSETTINGS_ISPRIORITY 0
+#define OPTISETPOINTSETTINGS_NUMBYTES sizeof(OptiSetpointSettingsData)
+
+/* Generic interface functions */
+int32_t OptiSetpointSettingsInitialize();
+UAVObjHandle OptiSetpointSettingsHandle();
+void OptiSetpointSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field OptiSpeedMax information */
+
+// Array element names for field OptiSpeedMax
+typedef enum {
+    OPTISETPOINTSETTINGS_OPTISPEEDMAX_NORTH=0,
+    OPTISETPOINTSETTINGS_OPTISPEEDMAX_EAST=1,
+    OPTISETPOINTSETTINGS_OPTISPEEDMAX_DOWN=2
+} OptiSetpointSettingsOptiSpeedMaxElem;
+
+// Number of elements for field OptiSpeedMax
+#define OPTISETPOINTSETTINGS_OPTISPEEDMAX_NUMELEM 3
+
+/* Field OptiPositionMax information */
+
+// Array element names for field OptiPositionMax
+typedef enum {
+    OPTISETPOINTSETTINGS_OPTIPOSITIONMAX_NORTH=0,
+    OPTISETPOINTSETTINGS_OPTIPOSITIONMAX_EAST=1,
+    OPTISETPOINTSETTINGS_OPTIPOSITIONMAX_DOWN=2
+} OptiSetpointSettingsOptiPositionMaxElem;
+
+// Number of elements for field OptiPositionMax
+#define OPTISETPOINTSETTINGS_OPTIPOSITIONMAX_NUMELEM 3
+
+/* Field Trust information */
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float North;
+    float East;
+    float Down;
+}  OptiSetpointSettingsOptiSpeedMaxData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  OptiSetpointSettingsOptiSpeedMaxDataArray ;
+#define OptiSetpointSettingsOptiSpeedMaxToArray( var ) UAVObjectFieldToArray( OptiSetpointSettingsOptiSpeedMaxData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float North;
+    float East;
+    float Down;
+}  OptiSetpointSettingsOptiPositionMaxData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  OptiSetpointSettingsOptiPositionMaxDataArray ;
+#define OptiSetpointSettingsOptiPositionMaxToArray( var ) UAVObjectFieldToArray( OptiSetpointSettingsOptiPositionMaxData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        OptiSetpointSettingsOptiSpeedMaxData OptiSpeedMax;
+    OptiSetpointSettingsOptiPositionMaxData OptiPositionMax;
+    float Trust;
+
+} __attribute__((packed)) OptiSetpointSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef OptiSetpointSettingsDataPacked __attribute__((aligned(4))) OptiSetpointSettingsData;
+
+/* Typesafe Object access functions */
+static inline int32_t OptiSetpointSettingsGet(OptiSetpointSettingsData * dataOut) {
+    return UAVObjGetData(OptiSetpointSettingsHandle(), dataOut);
+}
+static inline int32_t OptiSetpointSettingsSet(const OptiSetpointSettingsData * dataIn) {
+    return UAVObjSetData(OptiSetpointSettingsHandle(), dataIn);
+}
+static inline int32_t OptiSetpointSettingsInstGet(uint16_t instId, OptiSetpointSettingsData * dataOut) {
+    return UAVObjGetInstanceData(OptiSetpointSettingsHandle(), instId, dataOut);
+}
+static inline int32_t OptiSetpointSettingsInstSet(uint16_t instId, const OptiSetpointSettingsData * dataIn) {
+    return UAVObjSetInstanceData(OptiSetpointSettingsHandle(), instId, dataIn);
+}
+static inline int32_t OptiSetpointSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(OptiSetpointSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t OptiSetpointSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiSetpointSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t OptiSetpointSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiSetpointSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t OptiSetpointSettingsCreateInstance() {
+    return UAVObjCreateInstance(OptiSetpointSettingsHandle(), &OptiSetpointSettingsSetDefaults);
+}
+static inline void OptiSetpointSettingsRequestUpdate() {
+    UAVObjRequestUpdate(OptiSetpointSettingsHandle());
+}
+static inline void OptiSetpointSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(OptiSetpointSettingsHandle(), instId);
+}
+static inline void OptiSetpointSettingsUpdated() {
+    UAVObjUpdated(OptiSetpointSettingsHandle());
+}
+static inline void OptiSetpointSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(OptiSetpointSettingsHandle(), instId);
+}
+static inline void OptiSetpointSettingsLogging() {
+    UAVObjLogging(OptiSetpointSettingsHandle());
+}
+static inline void OptiSetpointSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(OptiSetpointSettingsHandle(), instId);
+}
+static inline int32_t OptiSetpointSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(OptiSetpointSettingsHandle(), dataOut);
+}
+static inline int32_t OptiSetpointSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(OptiSetpointSettingsHandle(), dataIn);
+}
+static inline int8_t OptiSetpointSettingsReadOnly() {
+    return UAVObjReadOnly(OptiSetpointSettingsHandle());
+}
+
+/* Set/Get functions */
+extern void OptiSetpointSettingsOptiSpeedMaxSet(OptiSetpointSettingsOptiSpeedMaxData *NewOptiSpeedMax);
+extern void OptiSetpointSettingsOptiSpeedMaxGet(OptiSetpointSettingsOptiSpeedMaxData *NewOptiSpeedMax);
+extern void OptiSetpointSettingsOptiSpeedMaxArraySet(float *NewOptiSpeedMax);
+extern void OptiSetpointSettingsOptiSpeedMaxArrayGet(float *NewOptiSpeedMax);
+extern void OptiSetpointSettingsOptiPositionMaxSet(OptiSetpointSettingsOptiPositionMaxData *NewOptiPositionMax);
+extern void OptiSetpointSettingsOptiPositionMaxGet(OptiSetpointSettingsOptiPositionMaxData *NewOptiPositionMax);
+extern void OptiSetpointSettingsOptiPositionMaxArraySet(float *NewOptiPositionMax);
+extern void OptiSetpointSettingsOptiPositionMaxArrayGet(float *NewOptiPositionMax);
+extern void OptiSetpointSettingsTrustSet(float *NewTrust);
+extern void OptiSetpointSettingsTrustGet(float *NewTrust);
+
+
+#endif // OPTISETPOINTSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup OptiVelocityState OptiVelocityState
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OptiVelocityState Object
+ *
+ * @{
+ *
+ * @file       optivelocitystate.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OptiVelocityState object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPTIVELOCITYSTATE_H
+#define OPTIVELOCITYSTATE_H
+#include <stdbool.h>
+/* Object constants */
+#define OPTIVELOCITYSTATE_OBJID 0xC4CD5AF4
+#define OPTIVELOCITYSTATE_ISSINGLEINST 1
+#define OPTIVELOCITYSTATE_ISSETTINGS 0
+#define OPTIVELOCITYSTATE_ISPRIORITY 0
+#define OPTIVELOCITYSTATE_NUMBYTES sizeof(OptiVelocityStateData)
+
+/* Generic interface functions */
+int32_t OptiVelocityStateInitialize();
+UAVObjHandle OptiVelocityStateHandle();
+void OptiVelocityStateSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field North information */
+
+/* Field East information */
+
+/* Field Down information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float North;
+    float East;
+    float Down;
+
+} __attribute__((packed)) OptiVelocityStateDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef OptiVelocityStateDataPacked __attribute__((aligned(4))) OptiVelocityStateData;
+
+/* Typesafe Object access functions */
+static inline int32_t OptiVelocityStateGet(OptiVelocityStateData * dataOut) {
+    return UAVObjGetData(OptiVelocityStateHandle(), dataOut);
+}
+static inline int32_t OptiVelocityStateSet(const OptiVelocityStateData * dataIn) {
+    return UAVObjSetData(OptiVelocityStateHandle(), dataIn);
+}
+static inline int32_t OptiVelocityStateInstGet(uint16_t instId, OptiVelocityStateData * dataOut) {
+    return UAVObjGetInstanceData(OptiVelocityStateHandle(), instId, dataOut);
+}
+static inline int32_t OptiVelocityStateInstSet(uint16_t instId, const OptiVelocityStateData * dataIn) {
+    return UAVObjSetInstanceData(OptiVelocityStateHandle(), instId, dataIn);
+}
+static inline int32_t OptiVelocityStateConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(OptiVelocityStateHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t OptiVelocityStateConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiVelocityStateHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t OptiVelocityStateConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OptiVelocityStateHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t OptiVelocityStateCreateInstance() {
+    return UAVObjCreateInstance(OptiVelocityStateHandle(), &OptiVelocityStateSetDefaults);
+}
+static inline void OptiVelocityStateRequestUpdate() {
+    UAVObjRequestUpdate(OptiVelocityStateHandle());
+}
+static inline void OptiVelocityStateRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(OptiVelocityStateHandle(), instId);
+}
+static inline void OptiVelocityStateUpdated() {
+    UAVObjUpdated(OptiVelocityStateHandle());
+}
+static inline void OptiVelocityStateInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(OptiVelocityStateHandle(), instId);
+}
+static inline void OptiVelocityStateLogging() {
+    UAVObjLogging(OptiVelocityStateHandle());
+}
+static inline void OptiVelocityStateInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(OptiVelocityStateHandle(), instId);
+}
+static inline int32_t OptiVelocityStateGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(OptiVelocityStateHandle(), dataOut);
+}
+static inline int32_t OptiVelocityStateSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(OptiVelocityStateHandle(), dataIn);
+}
+static inline int8_t OptiVelocityStateReadOnly() {
+    return UAVObjReadOnly(OptiVelocityStateHandle());
+}
+
+/* Set/Get functions */
+extern void OptiVelocityStateNorthSet(float *NewNorth);
+extern void OptiVelocityStateNorthGet(float *NewNorth);
+extern void OptiVelocityStateEastSet(float *NewEast);
+extern void OptiVelocityStateEastGet(float *NewEast);
+extern void OptiVelocityStateDownSet(float *NewDown);
+extern void OptiVelocityStateDownGet(float *NewDown);
+
+
+#endif // OPTIVELOCITYSTATE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,320 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OsdSettings OsdSettings
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for OsdSettings Object
+ * @{ 
+ *
+ * @file       osdsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OsdSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "osdsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OsdSettingsInitialize(void)
+{
+    // Compile time assertion that the OsdSettingsDataPacked and OsdSettingsData structs
+    // have the same size (though instances of OsdSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OsdSettingsDataPacked) == sizeof(OsdSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OSDSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OSDSETTINGS_OBJID,
+        OSDSETTINGS_ISSINGLEINST, OSDSETTINGS_ISSETTINGS, OSDSETTINGS_ISPRIORITY, OSDSETTINGS_NUMBYTES, &OsdSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OsdSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OsdSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OsdSettingsData));
+    data.AttitudeSetup.X = 168;
+    data.AttitudeSetup.Y = 135;
+    data.TimeSetup.X = 10;
+    data.TimeSetup.Y = 250;
+    data.BatterySetup.X = 316;
+    data.BatterySetup.Y = 210;
+    data.SpeedSetup.X = 2;
+    data.SpeedSetup.Y = 145;
+    data.AltitudeSetup.X = 2;
+    data.AltitudeSetup.Y = 145;
+    data.HeadingSetup.X = 168;
+    data.HeadingSetup.Y = 240;
+    data.Attitude = 1;
+    data.Time = 1;
+    data.Battery = 1;
+    data.Speed = 1;
+    data.Altitude = 1;
+    data.Heading = 1;
+    data.Screen = 0;
+    data.White = 4;
+    data.Black = 1;
+    data.AltitudeSource = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OsdSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OsdSettingsAttitudeSetupSet( OsdSettingsAttitudeSetupData *NewAttitudeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAttitudeSetup, offsetof(OsdSettingsData, AttitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAttitudeSetupGet( OsdSettingsAttitudeSetupData *NewAttitudeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAttitudeSetup, offsetof(OsdSettingsData, AttitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAttitudeSetupArraySet( int16_t *NewAttitudeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAttitudeSetup, offsetof(OsdSettingsData, AttitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAttitudeSetupArrayGet( int16_t *NewAttitudeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAttitudeSetup, offsetof(OsdSettingsData, AttitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsTimeSetupSet( OsdSettingsTimeSetupData *NewTimeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewTimeSetup, offsetof(OsdSettingsData, TimeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsTimeSetupGet( OsdSettingsTimeSetupData *NewTimeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewTimeSetup, offsetof(OsdSettingsData, TimeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsTimeSetupArraySet( int16_t *NewTimeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewTimeSetup, offsetof(OsdSettingsData, TimeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsTimeSetupArrayGet( int16_t *NewTimeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewTimeSetup, offsetof(OsdSettingsData, TimeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsBatterySetupSet( OsdSettingsBatterySetupData *NewBatterySetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewBatterySetup, offsetof(OsdSettingsData, BatterySetup), 2*sizeof(int16_t));
+}
+void OsdSettingsBatterySetupGet( OsdSettingsBatterySetupData *NewBatterySetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewBatterySetup, offsetof(OsdSettingsData, BatterySetup), 2*sizeof(int16_t));
+}
+void OsdSettingsBatterySetupArraySet( int16_t *NewBatterySetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewBatterySetup, offsetof(OsdSettingsData, BatterySetup), 2*sizeof(int16_t));
+}
+void OsdSettingsBatterySetupArrayGet( int16_t *NewBatterySetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewBatterySetup, offsetof(OsdSettingsData, BatterySetup), 2*sizeof(int16_t));
+}
+void OsdSettingsSpeedSetupSet( OsdSettingsSpeedSetupData *NewSpeedSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewSpeedSetup, offsetof(OsdSettingsData, SpeedSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsSpeedSetupGet( OsdSettingsSpeedSetupData *NewSpeedSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewSpeedSetup, offsetof(OsdSettingsData, SpeedSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsSpeedSetupArraySet( int16_t *NewSpeedSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewSpeedSetup, offsetof(OsdSettingsData, SpeedSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsSpeedSetupArrayGet( int16_t *NewSpeedSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewSpeedSetup, offsetof(OsdSettingsData, SpeedSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAltitudeSetupSet( OsdSettingsAltitudeSetupData *NewAltitudeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAltitudeSetup, offsetof(OsdSettingsData, AltitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAltitudeSetupGet( OsdSettingsAltitudeSetupData *NewAltitudeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAltitudeSetup, offsetof(OsdSettingsData, AltitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAltitudeSetupArraySet( int16_t *NewAltitudeSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAltitudeSetup, offsetof(OsdSettingsData, AltitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAltitudeSetupArrayGet( int16_t *NewAltitudeSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAltitudeSetup, offsetof(OsdSettingsData, AltitudeSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsHeadingSetupSet( OsdSettingsHeadingSetupData *NewHeadingSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewHeadingSetup, offsetof(OsdSettingsData, HeadingSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsHeadingSetupGet( OsdSettingsHeadingSetupData *NewHeadingSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewHeadingSetup, offsetof(OsdSettingsData, HeadingSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsHeadingSetupArraySet( int16_t *NewHeadingSetup )
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewHeadingSetup, offsetof(OsdSettingsData, HeadingSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsHeadingSetupArrayGet( int16_t *NewHeadingSetup )
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewHeadingSetup, offsetof(OsdSettingsData, HeadingSetup), 2*sizeof(int16_t));
+}
+void OsdSettingsAttitudeSet(OsdSettingsAttitudeOptions *NewAttitude)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAttitude, offsetof(OsdSettingsData, Attitude), sizeof(OsdSettingsAttitudeOptions));
+}
+void OsdSettingsAttitudeGet(OsdSettingsAttitudeOptions *NewAttitude)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAttitude, offsetof(OsdSettingsData, Attitude), sizeof(OsdSettingsAttitudeOptions));
+}
+void OsdSettingsTimeSet(OsdSettingsTimeOptions *NewTime)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewTime, offsetof(OsdSettingsData, Time), sizeof(OsdSettingsTimeOptions));
+}
+void OsdSettingsTimeGet(OsdSettingsTimeOptions *NewTime)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewTime, offsetof(OsdSettingsData, Time), sizeof(OsdSettingsTimeOptions));
+}
+void OsdSettingsBatterySet(OsdSettingsBatteryOptions *NewBattery)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewBattery, offsetof(OsdSettingsData, Battery), sizeof(OsdSettingsBatteryOptions));
+}
+void OsdSettingsBatteryGet(OsdSettingsBatteryOptions *NewBattery)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewBattery, offsetof(OsdSettingsData, Battery), sizeof(OsdSettingsBatteryOptions));
+}
+void OsdSettingsSpeedSet(OsdSettingsSpeedOptions *NewSpeed)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewSpeed, offsetof(OsdSettingsData, Speed), sizeof(OsdSettingsSpeedOptions));
+}
+void OsdSettingsSpeedGet(OsdSettingsSpeedOptions *NewSpeed)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewSpeed, offsetof(OsdSettingsData, Speed), sizeof(OsdSettingsSpeedOptions));
+}
+void OsdSettingsAltitudeSet(OsdSettingsAltitudeOptions *NewAltitude)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAltitude, offsetof(OsdSettingsData, Altitude), sizeof(OsdSettingsAltitudeOptions));
+}
+void OsdSettingsAltitudeGet(OsdSettingsAltitudeOptions *NewAltitude)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAltitude, offsetof(OsdSettingsData, Altitude), sizeof(OsdSettingsAltitudeOptions));
+}
+void OsdSettingsHeadingSet(OsdSettingsHeadingOptions *NewHeading)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewHeading, offsetof(OsdSettingsData, Heading), sizeof(OsdSettingsHeadingOptions));
+}
+void OsdSettingsHeadingGet(OsdSettingsHeadingOptions *NewHeading)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewHeading, offsetof(OsdSettingsData, Heading), sizeof(OsdSettingsHeadingOptions));
+}
+void OsdSettingsScreenSet(uint8_t *NewScreen)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewScreen, offsetof(OsdSettingsData, Screen), sizeof(uint8_t));
+}
+void OsdSettingsScreenGet(uint8_t *NewScreen)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewScreen, offsetof(OsdSettingsData, Screen), sizeof(uint8_t));
+}
+void OsdSettingsWhiteSet(uint8_t *NewWhite)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewWhite, offsetof(OsdSettingsData, White), sizeof(uint8_t));
+}
+void OsdSettingsWhiteGet(uint8_t *NewWhite)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewWhite, offsetof(OsdSettingsData, White), sizeof(uint8_t));
+}
+void OsdSettingsBlackSet(uint8_t *NewBlack)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewBlack, offsetof(OsdSettingsData, Black), sizeof(uint8_t));
+}
+void OsdSettingsBlackGet(uint8_t *NewBlack)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewBlack, offsetof(OsdSettingsData, Black), sizeof(uint8_t));
+}
+void OsdSettingsAltitudeSourceSet(OsdSettingsAltitudeSourceOptions *NewAltitudeSource)
+{
+    UAVObjSetDataField(OsdSettingsHandle(), (void *)NewAltitudeSource, offsetof(OsdSettingsData, AltitudeSource), sizeof(OsdSettingsAltitudeSourceOptions));
+}
+void OsdSettingsAltitudeSourceGet(OsdSettingsAltitudeSourceOptions *NewAltitudeSource)
+{
+    UAVObjGetDataField(OsdSettingsHandle(), (void *)NewAltitudeSource, offsetof(OsdSettingsData, AltitudeSource), sizeof(OsdSettingsAltitudeSourceOptions));
+}
+
+
+/**
+ * @}
+ */
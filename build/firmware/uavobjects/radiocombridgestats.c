@@ -0,0 +1,234 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup RadioComBridgeStats RadioComBridgeStats
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for RadioComBridgeStats Object
+ * @{ 
+ *
+ * @file       radiocombridgestats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the RadioComBridgeStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "radiocombridgestats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t RadioComBridgeStatsInitialize(void)
+{
+    // Compile time assertion that the RadioComBridgeStatsDataPacked and RadioComBridgeStatsData structs
+    // have the same size (though instances of RadioComBridgeStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(RadioComBridgeStatsDataPacked) == sizeof(RadioComBridgeStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(RADIOCOMBRIDGESTATS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(RADIOCOMBRIDGESTATS_OBJID,
+        RADIOCOMBRIDGESTATS_ISSINGLEINST, RADIOCOMBRIDGESTATS_ISSETTINGS, RADIOCOMBRIDGESTATS_ISPRIORITY, RADIOCOMBRIDGESTATS_NUMBYTES, &RadioComBridgeStatsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void RadioComBridgeStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    RadioComBridgeStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(RadioComBridgeStatsData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 5000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle RadioComBridgeStatsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void RadioComBridgeStatsTelemetryTxBytesSet(uint32_t *NewTelemetryTxBytes)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxBytes, offsetof(RadioComBridgeStatsData, TelemetryTxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryTxBytesGet(uint32_t *NewTelemetryTxBytes)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxBytes, offsetof(RadioComBridgeStatsData, TelemetryTxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryTxFailuresSet(uint32_t *NewTelemetryTxFailures)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxFailures, offsetof(RadioComBridgeStatsData, TelemetryTxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryTxFailuresGet(uint32_t *NewTelemetryTxFailures)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxFailures, offsetof(RadioComBridgeStatsData, TelemetryTxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryTxRetriesSet(uint32_t *NewTelemetryTxRetries)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxRetries, offsetof(RadioComBridgeStatsData, TelemetryTxRetries), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryTxRetriesGet(uint32_t *NewTelemetryTxRetries)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryTxRetries, offsetof(RadioComBridgeStatsData, TelemetryTxRetries), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxBytesSet(uint32_t *NewTelemetryRxBytes)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxBytes, offsetof(RadioComBridgeStatsData, TelemetryRxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxBytesGet(uint32_t *NewTelemetryRxBytes)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxBytes, offsetof(RadioComBridgeStatsData, TelemetryRxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxFailuresSet(uint32_t *NewTelemetryRxFailures)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxFailures, offsetof(RadioComBridgeStatsData, TelemetryRxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxFailuresGet(uint32_t *NewTelemetryRxFailures)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxFailures, offsetof(RadioComBridgeStatsData, TelemetryRxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxSyncErrorsSet(uint32_t *NewTelemetryRxSyncErrors)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxSyncErrors, offsetof(RadioComBridgeStatsData, TelemetryRxSyncErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxSyncErrorsGet(uint32_t *NewTelemetryRxSyncErrors)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxSyncErrors, offsetof(RadioComBridgeStatsData, TelemetryRxSyncErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxCrcErrorsSet(uint32_t *NewTelemetryRxCrcErrors)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxCrcErrors, offsetof(RadioComBridgeStatsData, TelemetryRxCrcErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsTelemetryRxCrcErrorsGet(uint32_t *NewTelemetryRxCrcErrors)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewTelemetryRxCrcErrors, offsetof(RadioComBridgeStatsData, TelemetryRxCrcErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxBytesSet(uint32_t *NewRadioTxBytes)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxBytes, offsetof(RadioComBridgeStatsData, RadioTxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxBytesGet(uint32_t *NewRadioTxBytes)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxBytes, offsetof(RadioComBridgeStatsData, RadioTxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxFailuresSet(uint32_t *NewRadioTxFailures)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxFailures, offsetof(RadioComBridgeStatsData, RadioTxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxFailuresGet(uint32_t *NewRadioTxFailures)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxFailures, offsetof(RadioComBridgeStatsData, RadioTxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxRetriesSet(uint32_t *NewRadioTxRetries)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxRetries, offsetof(RadioComBridgeStatsData, RadioTxRetries), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioTxRetriesGet(uint32_t *NewRadioTxRetries)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioTxRetries, offsetof(RadioComBridgeStatsData, RadioTxRetries), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxBytesSet(uint32_t *NewRadioRxBytes)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxBytes, offsetof(RadioComBridgeStatsData, RadioRxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxBytesGet(uint32_t *NewRadioRxBytes)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxBytes, offsetof(RadioComBridgeStatsData, RadioRxBytes), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxFailuresSet(uint32_t *NewRadioRxFailures)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxFailures, offsetof(RadioComBridgeStatsData, RadioRxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxFailuresGet(uint32_t *NewRadioRxFailures)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxFailures, offsetof(RadioComBridgeStatsData, RadioRxFailures), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxSyncErrorsSet(uint32_t *NewRadioRxSyncErrors)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxSyncErrors, offsetof(RadioComBridgeStatsData, RadioRxSyncErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxSyncErrorsGet(uint32_t *NewRadioRxSyncErrors)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxSyncErrors, offsetof(RadioComBridgeStatsData, RadioRxSyncErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxCrcErrorsSet(uint32_t *NewRadioRxCrcErrors)
+{
+    UAVObjSetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxCrcErrors, offsetof(RadioComBridgeStatsData, RadioRxCrcErrors), sizeof(uint32_t));
+}
+void RadioComBridgeStatsRadioRxCrcErrorsGet(uint32_t *NewRadioRxCrcErrors)
+{
+    UAVObjGetDataField(RadioComBridgeStatsHandle(), (void *)NewRadioRxCrcErrors, offsetof(RadioComBridgeStatsData, RadioRxCrcErrors), sizeof(uint32_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup ReceiverActivity ReceiverActivity
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for ReceiverActivity Object
+ *
+ * @{
+ *
+ * @file       receiveractivity.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ReceiverActivity object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: $(XMLFILE).
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef RECEIVERACTIVITY_H
+#define RECEIVERACTIVITY_H
+#include <stdbool.h>
+/* Object constants */
+#define RECEIVERACTIVITY_OBJID 0xA00CB4AA
+#define RECEIVERACTIVITY_ISSINGLEINST 1
+#define RECEIVERACTIVITY_ISSETTINGS 0
+#define RECEIVERACTIVITY_ISPRIORITY 0
+#define RECEIVERACTIVITY_NUMBYTES sizeof(ReceiverActivityData)
+
+/* Generic interface functions */
+int32_t ReceiverActivityInitialize();
+UAVObjHandle ReceiverActivityHandle();
+void ReceiverActivitySetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field ActiveGroup information */
+
+// Enumeration options for field ActiveGroup
+typedef enum __attribute__ ((__packed__)) {
+    RECEIVERACTIVITY_ACTIVEGROUP_PWM=0,
+    RECEIVERACTIVITY_ACTIVEGROUP_PPM=1,
+    RECEIVERACTIVITY_ACTIVEGROUP_DSMMAINPORT=2,
+    RECEIVERACTIVITY_ACTIVEGROUP_DSMFLEXIPORT=3,
+    RECEIVERACTIVITY_ACTIVEGROUP_DSMRCVRPORT=4,
+    RECEIVERACTIVITY_ACTIVEGROUP_SBUS=5,
+    RECEIVERACTIVITY_ACTIVEGROUP_EXBUS=6,
+    RECEIVERACTIVITY_ACTIVEGROUP_HOTT=7,
+    RECEIVERACTIVITY_ACTIVEGROUP_SRXL=8,
+    RECEIVERACTIVITY_ACTIVEGROUP_IBUS=9,
+    RECEIVERACTIVITY_ACTIVEGROUP_GCS=10,
+    RECEIVERACTIVITY_ACTIVEGROUP_OPLINK=11,
+    RECEIVERACTIVITY_ACTIVEGROUP_OPENLRS=12,
+    RECEIVERACTIVITY_ACTIVEGROUP_NONE=13
+} ReceiverActivityActiveGroupOptions;
+
+/* Field ActiveChannel information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        ReceiverActivityActiveGroupOptions ActiveGroup;
+    uint8_t ActiveChannel;
+
+} __attribute__((packed)) ReceiverActivityDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef ReceiverActivityDataPacked __attribute__((aligned(4))) ReceiverActivityData;
+
+/* Typesafe Object access functions */
+static inline int32_t ReceiverActivityGet(ReceiverActivityData * dataOut) {
+    return UAVObjGetData(ReceiverActivityHandle(), dataOut);
+}
+static inline int32_t ReceiverActivitySet(const ReceiverActivityData * dataIn) {
+    return UAVObjSetData(ReceiverActivityHandle(), dataIn);
+}
+static inline int32_t ReceiverActivityInstGet(uint16_t instId, ReceiverActivityData * dataOut) {
+    return UAVObjGetInstanceData(ReceiverActivityHandle(), instId, dataOut);
+}
+static inline int32_t ReceiverActivityInstSet(uint16_t instId, const ReceiverActivityData * dataIn) {
+    return UAVObjSetInstanceData(ReceiverActivityHandle(), instId, dataIn);
+}
+static inline int32_t ReceiverActivityConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(ReceiverActivityHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t ReceiverActivityConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ReceiverActivityHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t ReceiverActivityConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ReceiverActivityHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t ReceiverActivityCreateInstance() {
+    return UAVObjCreateInstance(ReceiverActivityHandle(), &ReceiverActivitySetDefaults);
+}
+static inline void ReceiverActivityRequestUpdate() {
+    UAVObjRequestUpdate(ReceiverActivityHandle());
+}
+static inline void ReceiverActivityRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(ReceiverActivityHandle(), instId);
+}
+static inline void ReceiverActivityUpdated() {
+    UAVObjUpdated(ReceiverActivityHandle());
+}
+static inline void ReceiverActivityInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(ReceiverActivityHandle(), instId);
+}
+static inline void ReceiverActivityLogging() {
+    UAVObjLogging(ReceiverActivityHandle());
+}
+static inline void ReceiverActivityInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(ReceiverActivityHandle(), instId);
+}
+static inline int32_t ReceiverActivityGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(ReceiverActivityHandle(), dataOut);
+}
+static inline int32_t ReceiverActivitySetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(ReceiverActivityHandle(), dataIn);
+}
+static inline int8_t ReceiverActivityReadOnly() {
+    return UAVObjReadOnly(ReceiverActivityHandle());
+}
+
+/* Set/Get functions */
+extern void ReceiverActivityActiveGroupSet(ReceiverActivityActiveGroupOptions *NewActiveGroup);
+extern void ReceiverActivityActiveGroupGet(ReceiverActivityActiveGroupOptions *NewActiveGroup);
+extern void ReceiverActivityActiveChannelSet(uint8_t *NewActiveChannel);
+extern void ReceiverActivityActiveChannelGet(uint8_t *NewActiveChannel);
+
+
+#endif // RECEIVERACTIVITY_H
+
+/**
+ * @}
+ * @}
+ */
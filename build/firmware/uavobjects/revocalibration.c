@@ -0,0 +1,184 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup RevoCalibration RevoCalibration
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for RevoCalibration Object
+ * @{ 
+ *
+ * @file       revocalibration.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the RevoCalibration object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "revocalibration.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t RevoCalibrationInitialize(void)
+{
+    // Compile time assertion that the RevoCalibrationDataPacked and RevoCalibrationData structs
+    // have the same size (though instances of RevoCalibrationData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(RevoCalibrationDataPacked) == sizeof(RevoCalibrationData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(REVOCALIBRATION_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(REVOCALIBRATION_OBJID,
+        REVOCALIBRATION_ISSINGLEINST, REVOCALIBRATION_ISSETTINGS, REVOCALIBRATION_ISPRIORITY, REVOCALIBRATION_NUMBYTES, &RevoCalibrationSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void RevoCalibrationSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    RevoCalibrationData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(RevoCalibrationData));
+    data.mag_bias.X = 0.000000e+00f;
+    data.mag_bias.Y = 0.000000e+00f;
+    data.mag_bias.Z = 0.000000e+00f;
+    data.mag_transform.r0c0 = 1.000000e+00f;
+    data.mag_transform.r0c1 = 0.000000e+00f;
+    data.mag_transform.r0c2 = 0.000000e+00f;
+    data.mag_transform.r1c0 = 0.000000e+00f;
+    data.mag_transform.r1c1 = 1.000000e+00f;
+    data.mag_transform.r1c2 = 0.000000e+00f;
+    data.mag_transform.r2c0 = 0.000000e+00f;
+    data.mag_transform.r2c1 = 0.000000e+00f;
+    data.mag_transform.r2c2 = 1.000000e+00f;
+    data.MagBiasNullingRate = 0.000000e+00f;
+    data.BiasCorrectedRaw = 1;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle RevoCalibrationHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void RevoCalibrationmag_biasSet( RevoCalibrationmag_biasData *Newmag_bias )
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)Newmag_bias, offsetof(RevoCalibrationData, mag_bias), 3*sizeof(float));
+}
+void RevoCalibrationmag_biasGet( RevoCalibrationmag_biasData *Newmag_bias )
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)Newmag_bias, offsetof(RevoCalibrationData, mag_bias), 3*sizeof(float));
+}
+void RevoCalibrationmag_biasArraySet( float *Newmag_bias )
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)Newmag_bias, offsetof(RevoCalibrationData, mag_bias), 3*sizeof(float));
+}
+void RevoCalibrationmag_biasArrayGet( float *Newmag_bias )
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)Newmag_bias, offsetof(RevoCalibrationData, mag_bias), 3*sizeof(float));
+}
+void RevoCalibrationmag_transformSet( RevoCalibrationmag_transformData *Newmag_transform )
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)Newmag_transform, offsetof(RevoCalibrationData, mag_transform), 9*sizeof(float));
+}
+void RevoCalibrationmag_transformGet( RevoCalibrationmag_transformData *Newmag_transform )
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)Newmag_transform, offsetof(RevoCalibrationData, mag_transform), 9*sizeof(float));
+}
+void RevoCalibrationmag_transformArraySet( float *Newmag_transform )
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)Newmag_transform, offsetof(RevoCalibrationData, mag_transform), 9*sizeof(float));
+}
+void RevoCalibrationmag_transformArrayGet( float *Newmag_transform )
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)Newmag_transform, offsetof(RevoCalibrationData, mag_transform), 9*sizeof(float));
+}
+void RevoCalibrationMagBiasNullingRateSet(float *NewMagBiasNullingRate)
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)NewMagBiasNullingRate, offsetof(RevoCalibrationData, MagBiasNullingRate), sizeof(float));
+}
+void RevoCalibrationMagBiasNullingRateGet(float *NewMagBiasNullingRate)
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)NewMagBiasNullingRate, offsetof(RevoCalibrationData, MagBiasNullingRate), sizeof(float));
+}
+void RevoCalibrationBiasCorrectedRawSet(RevoCalibrationBiasCorrectedRawOptions *NewBiasCorrectedRaw)
+{
+    UAVObjSetDataField(RevoCalibrationHandle(), (void *)NewBiasCorrectedRaw, offsetof(RevoCalibrationData, BiasCorrectedRaw), sizeof(RevoCalibrationBiasCorrectedRawOptions));
+}
+void RevoCalibrationBiasCorrectedRawGet(RevoCalibrationBiasCorrectedRawOptions *NewBiasCorrectedRaw)
+{
+    UAVObjGetDataField(RevoCalibrationHandle(), (void *)NewBiasCorrectedRaw, offsetof(RevoCalibrationData, BiasCorrectedRaw), sizeof(RevoCalibrationBiasCorrectedRawOptions));
+}
+
+
+/**
+ * @}
+ */
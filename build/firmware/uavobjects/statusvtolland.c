@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup StatusVtolLand StatusVtolLand
+ * @brief $(DESCRIPTION)
+ *
+ * Autogenerated files and functions for StatusVtolLand Object
+ * @{ 
+ *
+ * @file       statusvtolland.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the StatusVtolLand object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: $(XMLFILE). 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "statusvtolland.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t StatusVtolLandInitialize(void)
+{
+    // Compile time assertion that the StatusVtolLandDataPacked and StatusVtolLandData structs
+    // have the same size (though instances of StatusVtolLandData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(StatusVtolLandDataPacked) == sizeof(StatusVtolLandData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(STATUSVTOLLAND_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(STATUSVTOLLAND_OBJID,
+        STATUSVTOLLAND_ISSINGLEINST, STATUSVTOLLAND_ISSETTINGS, STATUSVTOLLAND_ISPRIORITY, STATUSVTOLLAND_NUMBYTES, &StatusVtolLandSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void StatusVtolLandSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    StatusVtolLandData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(StatusVtolLandData));
+    data.WtgForGroundEffect.BounceVelocity = 0.000000e+00f;
+    data.WtgForGroundEffect.BounceAccel = 0.000000e+00f;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 100;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle StatusVtolLandHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void StatusVtolLandAltitudeAtStateSet( float *NewAltitudeAtState )
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewAltitudeAtState, offsetof(StatusVtolLandData, AltitudeAtState), 10*sizeof(float));
+}
+void StatusVtolLandAltitudeAtStateGet( float *NewAltitudeAtState )
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewAltitudeAtState, offsetof(StatusVtolLandData, AltitudeAtState), 10*sizeof(float));
+}
+void StatusVtolLandtargetDescentRateSet(float *NewtargetDescentRate)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewtargetDescentRate, offsetof(StatusVtolLandData, targetDescentRate), sizeof(float));
+}
+void StatusVtolLandtargetDescentRateGet(float *NewtargetDescentRate)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewtargetDescentRate, offsetof(StatusVtolLandData, targetDescentRate), sizeof(float));
+}
+void StatusVtolLandaverageDescentRateSet(float *NewaverageDescentRate)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewaverageDescentRate, offsetof(StatusVtolLandData, averageDescentRate), sizeof(float));
+}
+void StatusVtolLandaverageDescentRateGet(float *NewaverageDescentRate)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewaverageDescentRate, offsetof(StatusVtolLandData, averageDescentRate), sizeof(float));
+}
+void StatusVtolLandaverageDescentThrustSet(float *NewaverageDescentThrust)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewaverageDescentThrust, offsetof(StatusVtolLandData, averageDescentThrust), sizeof(float));
+}
+void StatusVtolLandaverageDescentThrustGet(float *NewaverageDescentThrust)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewaverageDescentThrust, offsetof(StatusVtolLandData, averageDescentThrust), sizeof(float));
+}
+void StatusVtolLandcalculatedNeutralThrustSet(float *NewcalculatedNeutralThrust)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewcalculatedNeutralThrust, offsetof(StatusVtolLandData, calculatedNeutralThrust), sizeof(float));
+}
+void StatusVtolLandcalculatedNeutralThrustGet(float *NewcalculatedNeutralThrust)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewcalculatedNeutralThrust, offsetof(StatusVtolLandData, calculatedNeutralThrust), sizeof(float));
+}
+void StatusVtolLandWtgForGroundEffectSet( StatusVtolLandWtgForGroundEffectData *NewWtgForGroundEffect )
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewWtgForGroundEffect, offsetof(StatusVtolLandData, WtgForGroundEffect), 2*sizeof(float));
+}
+void StatusVtolLandWtgForGroundEffectGet( StatusVtolLandWtgForGroundEffectData *NewWtgForGroundEffect )
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewWtgForGroundEffect, offsetof(StatusVtolLandData, WtgForGroundEffect), 2*sizeof(float));
+}
+void StatusVtolLandWtgForGroundEffectArraySet( float *NewWtgForGroundEffect )
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewWtgForGroundEffect, offsetof(StatusVtolLandData, WtgForGroundEffect), 2*sizeof(float));
+}
+void StatusVtolLandWtgForGroundEffectArrayGet( float *NewWtgForGroundEffect )
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewWtgForGroundEffect, offsetof(StatusVtolLandData, WtgForGroundEffect), 2*sizeof(float));
+}
+void StatusVtolLandStateSet(StatusVtolLandStateOptions *NewState)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewState, offsetof(StatusVtolLandData, State), sizeof(StatusVtolLandStateOptions));
+}
+void StatusVtolLandStateGet(StatusVtolLandStateOptions *NewState)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewState, offsetof(StatusVtolLandData, State), sizeof(StatusVtolLandStateOptions));
+}
+void StatusVtolLandStateExitReasonSet( StatusVtolLandStateExitReasonOptions *NewStateExitReason )
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewStateExitReason, offsetof(StatusVtolLandData, StateExitReason), 10*sizeof(StatusVtolLandStateExitReasonOptions));
+}
+void StatusVtolLandStateExitReasonGet( StatusVtolLandStateExitReasonOptions *NewStateExitReason )
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewStateExitReason, offsetof(StatusVtolLandData, StateExitReason), 10*sizeof(StatusVtolLandStateExitReasonOptions));
+}
+void StatusVtolLandAltitudeStateSet(StatusVtolLandAltitudeStateOptions *NewAltitudeState)
+{
+    UAVObjSetDataField(StatusVtolLandHandle(), (void *)NewAltitudeState, offsetof(StatusVtolLandData, AltitudeState), sizeof(StatusVtolLandAltitudeStateOptions));
+}
+void StatusVtolLandAltitudeStateGet(StatusVtolLandAltitudeStateOptions *NewAltitudeState)
+{
+    UAVObjGetDataField(StatusVtolLandHandle(), (void *)NewAltitudeState, offsetof(StatusVtolLandData, AltitudeState), sizeof(StatusVtolLandAltitudeStateOptions));
+}
+
+
+/**
+ * @}
+ */
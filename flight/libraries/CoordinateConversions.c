@@ -30,6 +30,7 @@
 #include <math.h>
 #include <stdint.h>
 #include <pios_math.h>
+#include <sin_lookup.h>
 #include "CoordinateConversions.h"
 
 #define MIN_ALLOWABLE_MAGNITUDE 1e-30f
@@ -141,9 +142,9 @@ void Quaternion2RPY(const float q[4], float rpy[3])
     R23    = 2.0f * (q[2] * q[3] + q[0] * q[1]);
     R33    = q0s - q1s - q2s + q3s;
 
-    rpy[1] = RAD2DEG(asinf(-R13)); // pitch always between -pi/2 to pi/2
-    rpy[2] = RAD2DEG(atan2f(R12, R11));
-    rpy[0] = RAD2DEG(atan2f(R23, R33));
+    rpy[1] = RAD2DEG(asin_approx(-R13)); // pitch always between -pi/2 to pi/2
+    rpy[2] = RAD2DEG(atan2_approx(R12, R11));
+    rpy[0] = RAD2DEG(atan2_approx(R23, R33));
 
     // TODO: consider the cases where |R13| ~= 1, |pitch| ~= pi/2
 }
@@ -151,18 +152,11 @@ void Quaternion2RPY(const float q[4], float rpy[3])
 // ****** find quaternion from roll, pitch, yaw ********
 void RPY2Quaternion(const float rpy[3], float q[4])
 {
-    float phi, theta, psi;
     float cphi, sphi, ctheta, stheta, cpsi, spsi;
 
-    phi    = DEG2RAD(rpy[0] / 2);
-    theta  = DEG2RAD(rpy[1] / 2);
-    psi    = DEG2RAD(rpy[2] / 2);
-    cphi   = cosf(phi);
-    sphi   = sinf(phi);
-    ctheta = cosf(theta);
-    stheta = sinf(theta);
-    cpsi   = cosf(psi);
-    spsi   = sinf(psi);
+    sincos_lookup_deg(rpy[0] / 2, &sphi, &cphi);
+    sincos_lookup_deg(rpy[1] / 2, &stheta, &ctheta);
+    sincos_lookup_deg(rpy[2] / 2, &spsi, &cpsi);
 
     q[0]   = cphi * ctheta * cpsi + sphi * stheta * spsi;
     q[1]   = sphi * ctheta * cpsi - cphi * stheta * spsi;
@@ -421,8 +415,9 @@ void Rv2Rot(float Rv[3], float R[3][3])
         q[3] = 0.5f * Rv[2];
         // This prevents division by zero, while retaining full accuracy
     } else {
-        q[0] = cosf(angle * 0.5f);
-        float scale = sinf(angle * 0.5f) / angle;
+        float s;
+        sincos_lookup_rad(angle * 0.5f, &s, &q[0]);
+        float scale = s / angle;
         q[1] = scale * Rv[0];
         q[2] = scale * Rv[1];
         q[3] = scale * Rv[2];
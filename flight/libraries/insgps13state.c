@@ -76,11 +76,12 @@ static void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX]);
 // b.............  ......oXo
 // c.............  ......ooX
 
-static int8_t FrowMin[NUMX] = { 3, 4, 5, 6, 6, 6, 5, 5, 5, 5, 13, 13, 13 };
-static int8_t FrowMax[NUMX] = { 3, 4, 5, 9, 9, 9, 12, 12, 12, 12, -1, -1, -1 };
-
-static int8_t GrowMin[NUMX] = { 9, 9, 9, 3, 3, 3, 0, 0, 0, 0, 6, 7, 8 };
-static int8_t GrowMax[NUMX] = { -1, -1, -1, 5, 5, 5, 2, 2, 2, 2, 6, 7, 8 };
+// first state of each block of F and G, CovariancePrediction() is
+// written out for this block structure
+#define XPOS 0 // position, F is the identity towards velocity
+#define XVEL 3 // velocity, F depends on attitude, G on accel noise
+#define XQ   6 // attitude, F depends on attitude and gyro bias, G on gyro noise
+#define XGB  10 // gyro bias, no F, G is the identity on bias noise
 
 static int8_t HrowMin[NUMV] = { 0, 1, 2, 3, 4, 5, 6, 6, 6, 2 };
 static int8_t HrowMax[NUMV] = { 0, 1, 2, 3, 4, 5, 9, 9, 9, 2 };
@@ -432,8 +433,10 @@ void INSCorrection(float mag_data[3], float Pos[3], float Vel[3],
 // Q is the discrete time covariance of process noise
 // Q is vector of the diagonal for a square matrix with
 // dimensions equal to the number of disturbance noise variables
-// The General Method is very inefficient,not taking advantage of the sparse F and G
-// The first Method is very specific to this implementation
+// The products are written out for the block structure of F and G
+// produced by LinearizeFG() (see XPOS..XGB and the usage chart above),
+// so every inner loop has a fixed trip count and touches no zero block.
+// F[XPOS+i][XVEL+i] is assumed to be 1 and F[XQ+i][XQ+i] to be 0.
 // ************************************************
 
 void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
@@ -446,72 +449,74 @@ void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
 
     float Dummy[NUMX][NUMX];
     int8_t i;
+    int8_t j;
     int8_t k;
 
-    for (i = 0; i < NUMX; i++) { // Calculate Dummy = (P/T +F*P)
-        float *Firow = F[i];
-        float *Pirow = P[i];
+    // Calculate Dummy = (P/T +F*P)
+    // Row i is only needed from column min(i, XVEL) on: the upper triangle
+    // below and the columns that F' reaches are all at or after it.
+    for (i = 0; i < NUMX; i++) {
         float *Dirow = Dummy[i];
-        const int8_t Fistart = FrowMin[i];
-        const int8_t Fiend   = FrowMax[i];
-        int8_t j;
+        const float *Pirow = P[i];
+        const float *Firow = F[i];
 
-        for (j = 0; j < NUMX; j++) {
-            Dirow[j] = Pirow[j] * dT1; // Dummy = P / T ...
-        }
-        for (k = Fistart; k <= Fiend; k++) {
-            for (j = 0; j < NUMX; j++) {
-                Dirow[j] += Firow[k] * P[k][j]; // [] + F * P
+        if (i < XVEL) {
+            const float *Pvrow = P[i + XVEL];
+            for (j = i; j < NUMX; j++) {
+                Dirow[j] = Pirow[j] * dT1 + Pvrow[j]; // Dummy = P / T + F * P
+            }
+        } else if (i < XQ) {
+            const float F0 = Firow[XQ], F1 = Firow[XQ + 1], F2 = Firow[XQ + 2], F3 = Firow[XQ + 3];
+            for (j = XVEL; j < NUMX; j++) {
+                Dirow[j] = Pirow[j] * dT1 + F0 * P[XQ][j] + F1 * P[XQ + 1][j] + F2 * P[XQ + 2][j] + F3 * P[XQ + 3][j];
+            }
+        } else if (i < XGB) {
+            for (j = XVEL; j < NUMX; j++) {
+                float Dtmp = Pirow[j] * dT1;
+                for (k = XQ; k < NUMX; k++) {
+                    Dtmp += Firow[k] * P[k][j];
+                }
+                Dirow[j] = Dtmp;
+            }
+        } else {
+            for (j = XVEL; j < NUMX; j++) {
+                Dirow[j] = Pirow[j] * dT1;
             }
         }
     }
-    for (i = 0; i < NUMX; i++) { // Calculate Pnew = (T^2) [Dummy/T + Dummy*F' + G*Qw*G']
-        float *Dirow = Dummy[i];
-        float *Girow = G[i];
-        float *Pirow = P[i];
-        const int8_t Gistart = GrowMin[i];
-        const int8_t Giend   = GrowMax[i];
-        int8_t j;
 
+    for (i = 0; i < NUMX; i++) { // Calculate Pnew = (T^2) [Dummy/T + Dummy*F' + G*Qw*G']
+        const float *Dirow = Dummy[i];
+        const float *Girow = G[i];
 
         for (j = i; j < NUMX; j++) { // Use symmetry, ie only find upper triangular
-            float Ptmp         = Dirow[j] * dT1; // Pnew = Dummy / T ...
-
+            float Ptmp = Dirow[j] * dT1; // Pnew = Dummy / T ...
             const float *Fjrow = F[j];
-            int8_t Fjstart     = FrowMin[j];
-            int8_t Fjend       = FrowMax[j];
-            k = Fjstart;
-
-            while (k <= Fjend - 3) {
-                Ptmp += Dirow[k] * Fjrow[k]; // [] + Dummy*F' ...
-                Ptmp += Dirow[k + 1] * Fjrow[k + 1];
-                Ptmp += Dirow[k + 2] * Fjrow[k + 2];
-                Ptmp += Dirow[k + 3] * Fjrow[k + 3];
-                k    += 4;
-            }
-            while (k <= Fjend) {
-                Ptmp += Dirow[k] * Fjrow[k];
-                k++;
-            }
 
-            float *Gjrow = G[j];
-            const int8_t Gjstart = MAX(Gistart, GrowMin[j]);
-            const int8_t Gjend   = MIN(Giend, GrowMax[j]);
-            k = Gjstart;
-            while (k <= Gjend - 2) {
-                Ptmp += Q[k] * Girow[k] * Gjrow[k]; // [] + G*Q*G' ...
-                Ptmp += Q[k + 1] * Girow[k + 1] * Gjrow[k + 1];
-                Ptmp += Q[k + 2] * Girow[k + 2] * Gjrow[k + 2];
-                k    += 3;
+            // [] + Dummy*F' ...
+            if (j < XVEL) {
+                Ptmp += Dirow[j + XVEL];
+            } else if (j < XQ) {
+                Ptmp += Dirow[XQ] * Fjrow[XQ] + Dirow[XQ + 1] * Fjrow[XQ + 1] +
+                        Dirow[XQ + 2] * Fjrow[XQ + 2] + Dirow[XQ + 3] * Fjrow[XQ + 3];
+            } else if (j < XGB) {
+                for (k = XQ; k < NUMX; k++) {
+                    Ptmp += Dirow[k] * Fjrow[k];
+                }
             }
-            if (k <= Gjend) {
+
+            // [] + G*Q*G', noise inputs only couple states of the same block
+            const float *Gjrow = G[j];
+            if (i >= XVEL && j < XQ) {
+                Ptmp += Q[3] * Girow[3] * Gjrow[3] + Q[4] * Girow[4] * Gjrow[4] + Q[5] * Girow[5] * Gjrow[5];
+            } else if (i >= XQ && j < XGB) {
+                Ptmp += Q[0] * Girow[0] * Gjrow[0] + Q[1] * Girow[1] * Gjrow[1] + Q[2] * Girow[2] * Gjrow[2];
+            } else if (i >= XGB && i == j) {
+                k     = i - XGB + 6;
                 Ptmp += Q[k] * Girow[k] * Gjrow[k];
-                if (k <= Gjend - 1) {
-                    Ptmp += Q[k + 1] * Girow[k + 1] * Gjrow[k + 1];
-                }
             }
 
-            P[j][i] = Pirow[j] = Ptmp * dTsq; // [] * (T^2)
+            P[j][i] = P[i][j] = Ptmp * dTsq; // [] * (T^2)
         }
     }
 }
@@ -53,10 +53,25 @@ void counterCallback(const pios_perf_counter_t *counter, const int8_t index, __a
         PerfCounterCreateInstance();
         publishedCountersInstances++;
     }
+
     PerfCounterData data;
     data.Id = counter->id;
     data.Counter.Max   = counter->max;
     data.Counter.Min   = counter->min;
     data.Counter.Value = counter->value;
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+    uint32_t histogram[PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS];
+    uint32_t samples = PIOS_Instrumentation_TakeHistogram((pios_counter_t)counter, histogram);
+    data.Percentile.P50  = PIOS_Instrumentation_HistogramPercentile(histogram, samples, 500);
+    data.Percentile.P99  = PIOS_Instrumentation_HistogramPercentile(histogram, samples, 990);
+    data.Percentile.P999 = PIOS_Instrumentation_HistogramPercentile(histogram, samples, 999);
+    data.Samples = samples;
+#else
+    // no histogram on this board
+    data.Percentile.P50  = 0;
+    data.Percentile.P99  = 0;
+    data.Percentile.P999 = 0;
+    data.Samples = 0;
+#endif
     PerfCounterInstSet(index, &data);
 }
@@ -7,7 +7,8 @@
  *
  * @file       sin_lookup.c
  * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
- * @brief      Sine lookup table from flash with 1 degree resolution
+ *             The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Interpolated sine lookup table from flash and fast inverse trig
  *
  * @see        The GNU Public License (GPL) Version 3
  *
@@ -33,31 +34,53 @@
 #include "stdbool.h"
 #include "stdint.h"
 #include <pios_math.h>
+#include "sin_lookup.h"
+
+// The table holds one quarter wave in SIN_LOOKUP_SEGMENTS segments, plus
+// one entry past 90 degrees so that interpolation never needs a bounds check
+#define SIN_LOOKUP_SEGMENT_BITS 8
+#define SIN_LOOKUP_SEGMENTS     (1 << SIN_LOOKUP_SEGMENT_BITS)
+#define SIN_LOOKUP_FRAC_BITS    (30 - SIN_LOOKUP_SEGMENT_BITS)
 
 #define FLASH_TABLE
 #ifdef FLASH_TABLE
 /** Version of the code which precomputes the lookup table in flash **/
 
-// This is a precomputed sin lookup table over 90 degrees that
-const float sin_table[] = {
-    0.000000f, 0.017452f, 0.034899f, 0.052336f, 0.069756f, 0.087156f, 0.104528f, 0.121869f, 0.139173f, 0.156434f,
-    0.173648f, 0.190809f, 0.207912f, 0.224951f, 0.241922f, 0.258819f, 0.275637f, 0.292372f, 0.309017f, 0.325568f,
-    0.342020f, 0.358368f, 0.374607f, 0.390731f, 0.406737f, 0.422618f, 0.438371f, 0.453990f, 0.469472f, 0.484810f,
-    0.500000f, 0.515038f, 0.529919f, 0.544639f, 0.559193f, 0.573576f, 0.587785f, 0.601815f, 0.615661f, 0.629320f,
-    0.642788f, 0.656059f, 0.669131f, 0.681998f, 0.694658f, 0.707107f, 0.719340f, 0.731354f, 0.743145f, 0.754710f,
-    0.766044f, 0.777146f, 0.788011f, 0.798636f, 0.809017f, 0.819152f, 0.829038f, 0.838671f, 0.848048f, 0.857167f,
-    0.866025f, 0.874620f, 0.882948f, 0.891007f, 0.898794f, 0.906308f, 0.913545f, 0.920505f, 0.927184f, 0.933580f,
-    0.939693f, 0.945519f, 0.951057f, 0.956305f, 0.961262f, 0.965926f, 0.970296f, 0.974370f, 0.978148f, 0.981627f,
-    0.984808f, 0.987688f, 0.990268f, 0.992546f, 0.994522f, 0.996195f, 0.997564f, 0.998630f, 0.999391f, 0.999848f,
-    1.000000f, 0.999848f, 0.999391f, 0.998630f, 0.997564f, 0.996195f, 0.994522f, 0.992546f, 0.990268f, 0.987688f,
-    0.984808f, 0.981627f, 0.978148f, 0.974370f, 0.970296f, 0.965926f, 0.961262f, 0.956305f, 0.951057f, 0.945519f,
-    0.939693f, 0.933580f, 0.927184f, 0.920505f, 0.913545f, 0.906308f, 0.898794f, 0.891007f, 0.882948f, 0.874620f,
-    0.866025f, 0.857167f, 0.848048f, 0.838671f, 0.829038f, 0.819152f, 0.809017f, 0.798636f, 0.788011f, 0.777146f,
-    0.766044f, 0.754710f, 0.743145f, 0.731354f, 0.719340f, 0.707107f, 0.694658f, 0.681998f, 0.669131f, 0.656059f,
-    0.642788f, 0.629320f, 0.615661f, 0.601815f, 0.587785f, 0.573576f, 0.559193f, 0.544639f, 0.529919f, 0.515038f,
-    0.500000f, 0.484810f, 0.469472f, 0.453990f, 0.438371f, 0.422618f, 0.406737f, 0.390731f, 0.374607f, 0.358368f,
-    0.342020f, 0.325568f, 0.309017f, 0.292372f, 0.275637f, 0.258819f, 0.241922f, 0.224951f, 0.207912f, 0.190809f,
-    0.173648f, 0.156434f, 0.139173f, 0.121869f, 0.104528f, 0.087156f, 0.069756f, 0.052336f, 0.034899f, 0.017452f
+// This is a precomputed sin lookup table, sin_table[i] = sin(i * pi / 512)
+const float sin_table[SIN_LOOKUP_SEGMENTS + 2] = {
+    0.00000000f, 0.00613588f, 0.01227154f, 0.01840673f, 0.02454123f, 0.03067480f, 0.03680722f, 0.04293826f,
+    0.04906767f, 0.05519524f, 0.06132074f, 0.06744392f, 0.07356456f, 0.07968244f, 0.08579731f, 0.09190896f,
+    0.09801714f, 0.10412163f, 0.11022221f, 0.11631863f, 0.12241068f, 0.12849811f, 0.13458071f, 0.14065824f,
+    0.14673047f, 0.15279719f, 0.15885814f, 0.16491312f, 0.17096189f, 0.17700422f, 0.18303989f, 0.18906866f,
+    0.19509032f, 0.20110463f, 0.20711138f, 0.21311032f, 0.21910124f, 0.22508391f, 0.23105811f, 0.23702361f,
+    0.24298018f, 0.24892761f, 0.25486566f, 0.26079412f, 0.26671276f, 0.27262136f, 0.27851969f, 0.28440754f,
+    0.29028468f, 0.29615089f, 0.30200595f, 0.30784964f, 0.31368174f, 0.31950203f, 0.32531029f, 0.33110631f,
+    0.33688985f, 0.34266072f, 0.34841868f, 0.35416353f, 0.35989504f, 0.36561300f, 0.37131719f, 0.37700741f,
+    0.38268343f, 0.38834505f, 0.39399204f, 0.39962420f, 0.40524131f, 0.41084317f, 0.41642956f, 0.42200027f,
+    0.42755509f, 0.43309382f, 0.43861624f, 0.44412214f, 0.44961133f, 0.45508359f, 0.46053871f, 0.46597650f,
+    0.47139674f, 0.47679923f, 0.48218377f, 0.48755016f, 0.49289819f, 0.49822767f, 0.50353838f, 0.50883014f,
+    0.51410274f, 0.51935599f, 0.52458968f, 0.52980362f, 0.53499762f, 0.54017147f, 0.54532499f, 0.55045797f,
+    0.55557023f, 0.56066158f, 0.56573181f, 0.57078075f, 0.57580819f, 0.58081396f, 0.58579786f, 0.59075970f,
+    0.59569930f, 0.60061648f, 0.60551104f, 0.61038281f, 0.61523159f, 0.62005721f, 0.62485949f, 0.62963824f,
+    0.63439328f, 0.63912444f, 0.64383154f, 0.64851440f, 0.65317284f, 0.65780669f, 0.66241578f, 0.66699992f,
+    0.67155895f, 0.67609270f, 0.68060100f, 0.68508367f, 0.68954054f, 0.69397146f, 0.69837625f, 0.70275474f,
+    0.70710678f, 0.71143220f, 0.71573083f, 0.72000251f, 0.72424708f, 0.72846439f, 0.73265427f, 0.73681657f,
+    0.74095113f, 0.74505779f, 0.74913639f, 0.75318680f, 0.75720885f, 0.76120239f, 0.76516727f, 0.76910334f,
+    0.77301045f, 0.77688847f, 0.78073723f, 0.78455660f, 0.78834643f, 0.79210658f, 0.79583690f, 0.79953727f,
+    0.80320753f, 0.80684755f, 0.81045720f, 0.81403633f, 0.81758481f, 0.82110251f, 0.82458930f, 0.82804505f,
+    0.83146961f, 0.83486287f, 0.83822471f, 0.84155498f, 0.84485357f, 0.84812034f, 0.85135519f, 0.85455799f,
+    0.85772861f, 0.86086694f, 0.86397286f, 0.86704625f, 0.87008699f, 0.87309498f, 0.87607009f, 0.87901223f,
+    0.88192126f, 0.88479710f, 0.88763962f, 0.89044872f, 0.89322430f, 0.89596625f, 0.89867447f, 0.90134885f,
+    0.90398929f, 0.90659570f, 0.90916798f, 0.91170603f, 0.91420976f, 0.91667906f, 0.91911385f, 0.92151404f,
+    0.92387953f, 0.92621024f, 0.92850608f, 0.93076696f, 0.93299280f, 0.93518351f, 0.93733901f, 0.93945922f,
+    0.94154407f, 0.94359346f, 0.94560733f, 0.94758559f, 0.94952818f, 0.95143502f, 0.95330604f, 0.95514117f,
+    0.95694034f, 0.95870347f, 0.96043052f, 0.96212140f, 0.96377607f, 0.96539444f, 0.96697647f, 0.96852209f,
+    0.97003125f, 0.97150389f, 0.97293995f, 0.97433938f, 0.97570213f, 0.97702814f, 0.97831737f, 0.97956977f,
+    0.98078528f, 0.98196387f, 0.98310549f, 0.98421009f, 0.98527764f, 0.98630810f, 0.98730142f, 0.98825757f,
+    0.98917651f, 0.99005821f, 0.99090264f, 0.99170975f, 0.99247953f, 0.99321195f, 0.99390697f, 0.99456457f,
+    0.99518473f, 0.99576741f, 0.99631261f, 0.99682030f, 0.99729046f, 0.99772307f, 0.99811811f, 0.99847558f,
+    0.99879546f, 0.99907773f, 0.99932238f, 0.99952942f, 0.99969882f, 0.99983058f, 0.99992470f, 0.99998118f,
+    1.00000000f, 0.99998118f
 };
 
 int sin_lookup_initalize()
@@ -68,8 +91,6 @@ int sin_lookup_initalize()
 #else /* ifdef FLASH_TABLE */
 /** Version of the code which allocates the lookup table in heap **/
 
-const int SIN_RESOLUTION = 180;
-
 static float *sin_table;
 int sin_lookup_initalize()
 {
@@ -78,13 +99,13 @@ int sin_lookup_initalize()
         return 0;
     }
 
-    sin_table = (float *)pios_malloc(sizeof(float) * SIN_RESOLUTION);
+    sin_table = (float *)pios_malloc(sizeof(float) * (SIN_LOOKUP_SEGMENTS + 2));
     if (sin_table == NULL) {
         return -1;
     }
 
-    for (uint32_t i = 0; i < 180; i++) {
-        sin_table[i] = sinf(DEG2RAD((float)i));
+    for (uint32_t i = 0; i < SIN_LOOKUP_SEGMENTS + 2; i++) {
+        sin_table[i] = sinf(i * (M_PI_F / 2.0f) / SIN_LOOKUP_SEGMENTS);
     }
 
     return 0;
@@ -93,33 +114,71 @@ int sin_lookup_initalize()
 #endif /* ifdef FLASH_TABLE */
 
 /**
- * Use the lookup table to return sine(angle) where angle is in radians
- * to save flash this cheats and uses trig functions to only save
- * 90 values
- * @param[in] angle Angle in degrees
- * @returns sin(angle)
+ * Convert an angle in turns to a phase, dropping whole turns first so that
+ * the conversion to integer can not overflow
  */
-float sin_lookup_deg(float angle)
+static inline uint32_t turns_to_phase(float turns)
+{
+    turns -= (float)(int32_t)turns;
+    return ((uint32_t)(int32_t)(turns * 2147483648.0f)) << 1;
+}
+
+uint32_t sin_lookup_phase_deg(float angle)
+{
+    return turns_to_phase(angle * (1.0f / 360.0f));
+}
+
+uint32_t sin_lookup_phase_rad(float angle)
+{
+    return turns_to_phase(angle * (1.0f / (2.0f * M_PI_F)));
+}
+
+/**
+ * Use the lookup table to return sine(phase), interpolating linearly
+ * between table entries. Absolute error is below 5e-6.
+ * @param[in] phase Angle as phase, a full turn is 2^32
+ * @returns sin(phase)
+ */
+float sin_lookup_phase(uint32_t phase)
 {
+#ifndef FLASH_TABLE
     if (sin_table == NULL) {
         return 0;
     }
+#endif
 
-    // <bug, was> int i_ang = ((int32_t)angle) % 360;
-    // 1073741760 is a multiple of 360 that is close to 0x3fffffff
-    // so angle can be a very large number of positive or negative rotations
-    // this is the fastest fix (no tests, one integer addition)
-    // and has the largest range since float mantissas are 23-4 bit
-    // we could halve the lookup table size
-    // we could interpolate for greater accuracy
-    int i_ang = ((int32_t)(angle + 0.5f) + (int32_t)1073741760) % 360;
-    if (i_ang >= 180) { // for 180 to 360 deg
-        return -sin_table[i_ang - 180];
-    } else { // for 0 to 179 deg
-        return sin_table[i_ang];
+    // the second and fourth quadrant mirror the first and third
+    uint32_t x = phase & 0x3FFFFFFF;
+    if (phase & 0x40000000) {
+        x = 0x40000000 - x;
     }
 
-    return 0;
+    uint32_t i    = x >> SIN_LOOKUP_FRAC_BITS;
+    float frac    = (float)(x & ((1 << SIN_LOOKUP_FRAC_BITS) - 1)) * (1.0f / (1 << SIN_LOOKUP_FRAC_BITS));
+    float sin_abs = sin_table[i] + (sin_table[i + 1] - sin_table[i]) * frac;
+
+    // the third and fourth quadrant are negative
+    return (phase & 0x80000000) ? -sin_abs : sin_abs;
+}
+
+/**
+ * Get cos(phase) using the sine lookup table
+ * @param[in] phase Angle as phase, a full turn is 2^32
+ * @returns cos(phase)
+ */
+float cos_lookup_phase(uint32_t phase)
+{
+    return sin_lookup_phase(phase + 0x40000000);
+}
+
+/**
+ * Use the lookup table to return sine(angle) where angle is in degrees
+ * @param[in] angle Angle in degrees
+ * @returns sin(angle)
+ */
+float sin_lookup_deg(float angle)
+{
+    return sin_lookup_phase(sin_lookup_phase_deg(angle));
 }
 
 /**
@@ -129,7 +188,7 @@ float sin_lookup_deg(float angle)
  */
 float cos_lookup_deg(float angle)
 {
-    return sin_lookup_deg(angle + 90);
+    return cos_lookup_phase(sin_lookup_phase_deg(angle));
 }
 
 /**
@@ -139,19 +198,92 @@ float cos_lookup_deg(float angle)
  */
 float sin_lookup_rad(float angle)
 {
-    int degrees = RAD2DEG(angle);
-
-    return sin_lookup_deg(degrees);
+    return sin_lookup_phase(sin_lookup_phase_rad(angle));
 }
 
 /**
- * Use the lookup table to return sine(angle) where angle is in radians
+ * Use the lookup table to return cosine(angle) where angle is in radians
  * @param[in] angle Angle in radians
  * @returns cos(angle)
  */
 float cos_lookup_rad(float angle)
 {
-    int degrees = RAD2DEG(angle);
+    return cos_lookup_phase(sin_lookup_phase_rad(angle));
+}
+
+/**
+ * Get sin(angle) and cos(angle) with a single angle reduction
+ * @param[in] angle Angle in degrees
+ * @param[out] s sin(angle)
+ * @param[out] c cos(angle)
+ */
+void sincos_lookup_deg(float angle, float *s, float *c)
+{
+    uint32_t phase = sin_lookup_phase_deg(angle);
+
+    *s = sin_lookup_phase(phase);
+    *c = cos_lookup_phase(phase);
+}
+
+/**
+ * Get sin(angle) and cos(angle) with a single angle reduction
+ * @param[in] angle Angle in radians
+ * @param[out] s sin(angle)
+ * @param[out] c cos(angle)
+ */
+void sincos_lookup_rad(float angle, float *s, float *c)
+{
+    uint32_t phase = sin_lookup_phase_rad(angle);
+
+    *s = sin_lookup_phase(phase);
+    *c = cos_lookup_phase(phase);
+}
+
+/**
+ * Polynomial approximation of atan2f(y, x), the arctangent of the smaller
+ * over the larger of |x| and |y| is placed into the right octant.
+ * Absolute error is below 2e-6 rad.
+ * @returns angle in radians between -pi and pi, 0 for x = y = 0
+ */
+float atan2_approx(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+
+    if (ax == 0.0f && ay == 0.0f) {
+        return 0.0f;
+    }
+
+    float z  = (ay <= ax) ? ay / ax : ax / ay;
+    float z2 = z * z;
+    float a  = z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f - 0.01172120f * z2)))));
+
+    if (ay > ax) {
+        a = (M_PI_F / 2.0f) - a;
+    }
+    if (x < 0.0f) {
+        a = M_PI_F - a;
+    }
+    return (y < 0.0f) ? -a : a;
+}
+
+/**
+ * Approximation of asinf(x) (Abramowitz and Stegun 4.4.46), arguments
+ * outside of [-1, 1] are clamped instead of returning NaN.
+ * Absolute error is below 5e-7 rad in single precision.
+ * @returns angle in radians between -pi/2 and pi/2
+ */
+float asin_approx(float x)
+{
+    float ax = fabsf(x);
+
+    if (ax >= 1.0f) {
+        return (x < 0.0f) ? -(M_PI_F / 2.0f) : (M_PI_F / 2.0f);
+    }
+
+    float p = 1.5707963050f + ax * (-0.2145988016f + ax * (0.0889789874f + ax * (-0.0501743046f
+                                                                             + ax * (0.0308918810f + ax * (-0.0170881256f + ax * (0.0066700901f - 0.0012624911f * ax))))));
+    float a = (M_PI_F / 2.0f) - sqrtf(1.0f - ax) * p;
 
-    return cos_lookup_deg(degrees);
+    return (x < 0.0f) ? -a : a;
 }
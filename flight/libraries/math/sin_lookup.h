@@ -7,7 +7,8 @@
  *
  * @file       sin_lookup.h
  * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
- * @brief      Sine lookup table from flash with 1 degree resolution
+ *             The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Interpolated sine lookup table from flash and fast inverse trig
  *
  * @see        The GNU Public License (GPL) Version 3
  *
@@ -31,10 +32,23 @@
 #ifndef SIN_LOOKUP_H
 #define SIN_LOOKUP_H
 
+#include <stdint.h>
+
 int sin_lookup_initalize();
 float sin_lookup_deg(float angle);
 float cos_lookup_deg(float angle);
 float sin_lookup_rad(float angle);
 float cos_lookup_rad(float angle);
+void sincos_lookup_deg(float angle, float *s, float *c);
+void sincos_lookup_rad(float angle, float *s, float *c);
+
+// Angles as fixed point phase, a full turn is 2^32 so that wrapping is free
+uint32_t sin_lookup_phase_deg(float angle);
+uint32_t sin_lookup_phase_rad(float angle);
+float sin_lookup_phase(uint32_t phase);
+float cos_lookup_phase(uint32_t phase);
+
+float atan2_approx(float y, float x);
+float asin_approx(float x);
 
 #endif
@@ -36,6 +36,7 @@
 
 #include "accessorydesired.h"
 #include "actuator.h"
+#include "actuatormixer.h"
 #include "actuatorsettings.h"
 #include "systemsettings.h"
 #include "actuatordesired.h"
@@ -97,7 +98,7 @@ static bool spinWhileArmed;
 
 // used to inform the actuator thread that mixer settings are changed
 static MixerSettingsData mixerSettings;
-static int mixer_settings_count = 2;
+static ActuatorMixer_t actuatorMixer;
 
 // Private functions
 static void actuatorTask(void *parameters);
@@ -111,15 +112,6 @@ static void actuator_update_rate_if_changed(bool force_update);
 static void MixerSettingsUpdatedCb(UAVObjEvent *ev);
 static void ActuatorSettingsUpdatedCb(UAVObjEvent *ev);
 static void SettingsUpdatedCb(UAVObjEvent *ev);
-float ProcessMixer(const int index, const float curve1, const float curve2,
-                   ActuatorDesiredData *desired,
-                   bool multirotor, bool fixedwing);
-
-// this structure is equivalent to the UAVObjects for one mixer.
-typedef struct {
-    uint8_t type;
-    int8_t  matrix[5];
-} __attribute__((packed)) Mixer_t;
 
 /**
  * @brief Module initialization
@@ -194,8 +186,7 @@ MODULE_INITCALL(ActuatorInitialize, ActuatorStart);
  *
  * Because of how the Throttle ranges from 0 to 1, the motors should too!
  *
- * Note this code depends on the UAVObjects for the mixers being all being the same
- * and in sequence. If you change the object definition, make sure you check the code!
+ * The mixer matrix itself is compiled from MixerSettings by ActuatorMixerCompile().
  *
  * @return -1 if error, 0 if success
  */
@@ -223,6 +214,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
 
     /* Read initial values of MixerSettings */
     MixerSettingsGet(&mixerSettings);
+    ActuatorMixerCompile(&actuatorMixer, &mixerSettings);
 
     /* Force an initial configuration of the actuator update rates */
     actuator_update_rate_if_changed(true);
@@ -311,7 +303,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
         MixerStatusGet(&mixerStatus);
 #endif
 
-        if ((mixer_settings_count < 2) && !ActuatorCommandReadOnly()) { // Nothing can fly with less than two mixers.
+        if ((actuatorMixer.count < 2) && !ActuatorCommandReadOnly()) { // Nothing can fly with less than two mixers.
             setFailsafe();
             continue;
         }
@@ -384,9 +376,12 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
         }
 
         float *status   = (float *)&mixerStatus; // access status objects as an array of floats
-        Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
         float maxMotor  = -1.0f; // highest motor value. Addition method needs this to be -1.0f, division method needs this to be 1.0f
         float minMotor  = 1.0f; // lowest motor value Addition method needs this to be 1.0f, division method needs this to be -1.0f
+        float mixed[MAX_MIX_ACTUATORS];
+
+        // Mix all motors and servos in one go, the loop below only applies the per type rules
+        ActuatorMixerProcess(&actuatorMixer, curve1, curve2, &desired, multirotor, fixedwing, mixed);
 
         for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
             // During boot all camera actuators should be completely disabled (PWM pulse = 0).
@@ -395,7 +390,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
             // Setting it to 1 by default means "Rescale this channel and enable PWM on its output".
             command.Channel[ct] = 1;
 
-            uint8_t mixer_type = mixers[ct].type;
+            uint8_t mixer_type = actuatorMixer.type[ct];
 
             if (mixer_type == MIXERSETTINGS_MIXER1TYPE_DISABLED) {
                 // Set to minimum if disabled.  This is not the same as saying PWM pulse = 0 us
@@ -404,17 +399,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
             }
 
             if ((mixer_type == MIXERSETTINGS_MIXER1TYPE_MOTOR)) {
-                float nonreversible_curve1 = curve1;
-                float nonreversible_curve2 = curve2;
-                if (nonreversible_curve1 < 0.0f) {
-                    nonreversible_curve1 = 0.0f;
-                }
-                if (nonreversible_curve2 < 0.0f) {
-                    if (!multirotor) { // allow negative throttle if multirotor. function scaleMotors handles the sanity checks.
-                        nonreversible_curve2 = 0.0f;
-                    }
-                }
-                status[ct] = ProcessMixer(ct, nonreversible_curve1, nonreversible_curve2, &desired, multirotor, fixedwing);
+                status[ct] = mixed[ct];
                 // If not armed or motors aren't meant to spin all the time
                 if (!armed ||
                     (!spinWhileArmed && !positiveThrottle)) {
@@ -430,14 +415,14 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
                     }
                 }
             } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR) {
-                status[ct] = ProcessMixer(ct, curve1, curve2, &desired, multirotor, fixedwing);
+                status[ct] = mixed[ct];
                 // Reversable Motors are like Motors but go to neutral instead of minimum
                 // If not armed or motor is inactive - no "spinwhilearmed" for this engine type
                 if (!armed || !activeThrottle) {
                     status[ct] = 0; // force neutral throttle
                 }
             } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_SERVO) {
-                status[ct] = ProcessMixer(ct, curve1, curve2, &desired, multirotor, fixedwing);
+                status[ct] = mixed[ct];
             } else {
                 status[ct] = -1;
 
@@ -487,7 +472,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
 
             // If mixer type is motor we need to find which motor has the highest value and which motor has the lowest value.
             // For use in function scaleMotor
-            if (mixers[ct].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+            if (mixer_type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
                 if (maxMotor < status[ct]) {
                     maxMotor = status[ct];
                 }
@@ -501,7 +486,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
         // will be set except explicitly disabled (which will have PWM pulse = 0).
         for (int i = 0; i < MAX_MIX_ACTUATORS; i++) {
             if (command.Channel[i]) {
-                if (mixers[i].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) { // If mixer is for a motor we need to find the highest value of all motors
+                if (actuatorMixer.type[i] == MIXERSETTINGS_MIXER1TYPE_MOTOR) { // If mixer is for a motor we need to find the highest value of all motors
                     command.Channel[i] = scaleMotor(status[i],
                                                     actuatorSettings.ChannelMax[i],
                                                     actuatorSettings.ChannelMin[i],
@@ -556,53 +541,6 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
 }
 
 
-/**
- * Process mixing for one actuator
- */
-float ProcessMixer(const int index, const float curve1, const float curve2,
-                   ActuatorDesiredData *desired, bool multirotor, bool fixedwing)
-{
-    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type; // pointer to array of mixers in UAVObjects
-    const Mixer_t *mixer  = &mixers[index];
-    float differential    = 1.0f;
-
-    // Apply differential only for fixedwing and Roll servos
-    if (fixedwing && (mixerSettings.FirstRollServo > 0) &&
-        (mixer->type == MIXERSETTINGS_MIXER1TYPE_SERVO) &&
-        (mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] != 0)) {
-        // Positive differential
-        if (mixerSettings.RollDifferential > 0) {
-            // Check for first Roll servo (should be left aileron or elevon) and Roll desired (positive/negative)
-            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))
-                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))) {
-                differential -= (mixerSettings.RollDifferential * 0.01f);
-            }
-        } else if (mixerSettings.RollDifferential < 0) {
-            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))
-                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))) {
-                differential -= (-mixerSettings.RollDifferential * 0.01f);
-            }
-        }
-    }
-
-    float result = ((((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1]) * curve1) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2]) * curve2) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL]) * desired->Roll * differential) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_PITCH]) * desired->Pitch) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_YAW]) * desired->Yaw)) / 128.0f;
-
-    if (mixer->type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
-        if (!multirotor) { // we allow negative throttle with a multirotor
-            if (result < 0.0f) { // zero throttle
-                result = 0.0f;
-            }
-        }
-    }
-
-    return result;
-}
-
-
 /**
  * Interpolate a throttle curve
  * Full range input (-1 to 1) for yaw, roll, pitch
@@ -798,13 +736,13 @@ static void setFailsafe()
 
     ActuatorCommandChannelGet(Channel);
 
-    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type; // pointer to array of mixers in UAVObjects
+    const uint8_t *types = actuatorMixer.type;
 
     // Reset ActuatorCommand to safe values
     for (int n = 0; n < ACTUATORCOMMAND_CHANNEL_NUMELEM; ++n) {
-        if (mixers[n].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+        if (types[n] == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
             Channel[n] = actuatorSettings.ChannelMin[n];
-        } else if (mixers[n].type == MIXERSETTINGS_MIXER1TYPE_SERVO || mixers[n].type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR) {
+        } else if (types[n] == MIXERSETTINGS_MIXER1TYPE_SERVO || types[n] == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR) {
             // reversible motors need calibration wizard that allows channel neutral to be the 0 velocity point
             Channel[n] = actuatorSettings.ChannelNeutral[n];
         } else {
@@ -1047,13 +985,7 @@ static void ActuatorSettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 static void MixerSettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 {
     MixerSettingsGet(&mixerSettings);
-    mixer_settings_count = 0;
-    Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
-    for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
-        if (mixers[ct].type != MIXERSETTINGS_MIXER1TYPE_DISABLED) {
-            mixer_settings_count++;
-        }
-    }
+    ActuatorMixerCompile(&actuatorMixer, &mixerSettings);
 }
 static void SettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 {
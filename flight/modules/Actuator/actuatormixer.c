@@ -0,0 +1,141 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup ActuatorModule Actuator Module
+ * @{
+ *
+ * @file       actuatormixer.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Mixer matrix compiled from MixerSettings.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+
+#include "actuatormixer.h"
+
+// this structure is equivalent to the UAVObjects for one mixer.
+typedef struct {
+    uint8_t type;
+    int8_t  matrix[5];
+} __attribute__((packed)) Mixer_t;
+
+/**
+ * Compile the mixer settings. Called whenever MixerSettings change, so that
+ * the actuator task does not have to walk the UAVObject layout every cycle.
+ *
+ * Note this code depends on the UAVObjects for the mixers being all being the same
+ * and in sequence. If you change the object definition, make sure you check the code!
+ */
+void ActuatorMixerCompile(ActuatorMixer_t *mixer, const MixerSettingsData *settings)
+{
+    const Mixer_t *mixers = (const Mixer_t *)&settings->Mixer1Type;
+
+    mixer->count = 0;
+    for (int ct = 0; ct < ACTUATORMIXER_NUMELEM; ct++) {
+        mixer->type[ct] = mixers[ct].type;
+        if (mixers[ct].type != MIXERSETTINGS_MIXER1TYPE_DISABLED) {
+            mixer->count++;
+        }
+
+        for (int i = 0; i < MIXERSETTINGS_MIXER1VECTOR_NUMELEM; i++) {
+            mixer->matrix[ct][i] = (float)mixers[ct].matrix[i];
+        }
+
+        // Differential is only applied to Roll servos, and only for fixedwing (see ActuatorMixerProcess)
+        mixer->differentialPositive[ct] = 1.0f;
+        mixer->differentialNegative[ct] = 1.0f;
+        if ((settings->FirstRollServo > 0) &&
+            (mixers[ct].type == MIXERSETTINGS_MIXER1TYPE_SERVO) &&
+            (mixers[ct].matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] != 0)) {
+            // The first Roll servo should be left aileron or elevon
+            bool first = (ct == settings->FirstRollServo - 1);
+            if (settings->RollDifferential > 0) {
+                float differential = 1.0f - (settings->RollDifferential * 0.01f);
+                if (first) {
+                    mixer->differentialPositive[ct] = differential;
+                } else {
+                    mixer->differentialNegative[ct] = differential;
+                }
+            } else if (settings->RollDifferential < 0) {
+                float differential = 1.0f - (-settings->RollDifferential * 0.01f);
+                if (first) {
+                    mixer->differentialNegative[ct] = differential;
+                } else {
+                    mixer->differentialPositive[ct] = differential;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Process mixing for all motor and servo actuators: one row of the mixer
+ * matrix times the vector of throttle curves and desired roll, pitch, yaw.
+ * Channels of any other mixer type are left untouched in result.
+ */
+void ActuatorMixerProcess(const ActuatorMixer_t *mixer, float curve1, float curve2,
+                          const ActuatorDesiredData *desired, bool multirotor, bool fixedwing,
+                          float result[ACTUATORMIXER_NUMELEM])
+{
+    // Motors are not reversible, except that multirotors may go below zero on curve2.
+    // function scaleMotors handles the sanity checks.
+    const float motorCurve1 = (curve1 < 0.0f) ? 0.0f : curve1;
+    const float motorCurve2 = (curve2 < 0.0f && !multirotor) ? 0.0f : curve2;
+
+    for (int ct = 0; ct < ACTUATORMIXER_NUMELEM; ct++) {
+        const uint8_t type = mixer->type[ct];
+        const bool motor   = (type == MIXERSETTINGS_MIXER1TYPE_MOTOR);
+
+        if (!motor && type != MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR && type != MIXERSETTINGS_MIXER1TYPE_SERVO) {
+            continue;
+        }
+
+        float differential = 1.0f;
+        if (fixedwing) {
+            if (desired->Roll > 0.0f) {
+                differential = mixer->differentialPositive[ct];
+            } else if (desired->Roll < 0.0f) {
+                differential = mixer->differentialNegative[ct];
+            }
+        }
+
+        const float *row = mixer->matrix[ct];
+        float value = ((row[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1] * (motor ? motorCurve1 : curve1)) +
+                       (row[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2] * (motor ? motorCurve2 : curve2)) +
+                       (row[MIXERSETTINGS_MIXER1VECTOR_ROLL] * desired->Roll * differential) +
+                       (row[MIXERSETTINGS_MIXER1VECTOR_PITCH] * desired->Pitch) +
+                       (row[MIXERSETTINGS_MIXER1VECTOR_YAW] * desired->Yaw)) / 128.0f;
+
+        if (motor && !multirotor) { // we allow negative throttle with a multirotor
+            if (value < 0.0f) { // zero throttle
+                value = 0.0f;
+            }
+        }
+
+        result[ct] = value;
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
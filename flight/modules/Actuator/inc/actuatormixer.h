@@ -0,0 +1,65 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup ActuatorModule Actuator Module
+ * @{
+ *
+ * @file       actuatormixer.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Mixer matrix compiled from MixerSettings.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef ACTUATORMIXER_H
+#define ACTUATORMIXER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mixersettings.h"
+#include "actuatordesired.h"
+#include "actuatorcommand.h"
+
+#define ACTUATORMIXER_NUMELEM ACTUATORCOMMAND_CHANNEL_NUMELEM
+
+/**
+ * MixerSettings in the form the mixer is evaluated in every cycle.
+ * Rows of the matrix are the mixer vectors converted to float, the roll
+ * differential is resolved per channel for either sign of roll.
+ */
+typedef struct {
+    float   matrix[ACTUATORMIXER_NUMELEM][MIXERSETTINGS_MIXER1VECTOR_NUMELEM];
+    float   differentialPositive[ACTUATORMIXER_NUMELEM]; // roll differential for desired Roll > 0
+    float   differentialNegative[ACTUATORMIXER_NUMELEM]; // roll differential for desired Roll < 0
+    uint8_t type[ACTUATORMIXER_NUMELEM];
+    uint8_t count; // number of mixers that are not disabled
+} ActuatorMixer_t;
+
+void ActuatorMixerCompile(ActuatorMixer_t *mixer, const MixerSettingsData *settings);
+void ActuatorMixerProcess(const ActuatorMixer_t *mixer, float curve1, float curve2,
+                          const ActuatorDesiredData *desired, bool multirotor, bool fixedwing,
+                          float result[ACTUATORMIXER_NUMELEM]);
+
+#endif // ACTUATORMIXER_H
+
+/**
+ * @}
+ * @}
+ */
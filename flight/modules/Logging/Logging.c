@@ -37,6 +37,9 @@
 #include "debuglogentry.h"
 #include "flightstatus.h"
 
+// private constants
+#define MAX_RETRIEVE_COUNT 16 // DebugLogEntry instances used by a retrieve of several entries
+
 // private variables
 static DebugLogSettingsData settings;
 static DebugLogControlData control;
@@ -125,14 +128,31 @@ static void ControlUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 {
     DebugLogControlGet(&control);
     if (control.Operation == DEBUGLOGCONTROL_OPERATION_RETRIEVE) {
-        memset(entry, 0, sizeof(DebugLogEntryData));
-        if (PIOS_DEBUGLOG_Read(entry, control.Flight, control.Entry) != 0) {
-            // reading from log failed, mark as non existent in output
-            entry->Flight = control.Flight;
-            entry->Entry  = control.Entry;
-            entry->Type   = DEBUGLOGENTRY_TYPE_EMPTY;
-        }
-        DebugLogEntrySet(entry);
+        // a single entry is loaded into instance 0 and requested by the GCS,
+        // several entries are sent right away in one instance each
+        uint16_t count = (control.Count > MAX_RETRIEVE_COUNT) ? MAX_RETRIEVE_COUNT : control.Count;
+        uint16_t n     = 0;
+        do {
+            // instances are only created once a GCS retrieves several entries
+            if (n >= UAVObjGetNumInstances(DebugLogEntryHandle())) {
+                DebugLogEntryCreateInstance();
+                if (n >= UAVObjGetNumInstances(DebugLogEntryHandle())) {
+                    break; // out of memory, the GCS will retry the missing entries
+                }
+            }
+            memset(entry, 0, sizeof(DebugLogEntryData));
+            if (PIOS_DEBUGLOG_Read(entry, control.Flight, control.Entry + n) != 0) {
+                // reading from log failed, mark as non existent in output
+                entry->Flight = control.Flight;
+                entry->Entry  = control.Entry + n;
+                entry->Type   = DEBUGLOGENTRY_TYPE_EMPTY;
+            }
+            DebugLogEntryInstSet(n, entry);
+            if (count > 1) {
+                DebugLogEntryInstUpdated(n);
+            }
+            n++;
+        } while (n < count && entry->Type != DEBUGLOGENTRY_TYPE_EMPTY);
     } else if (control.Operation == DEBUGLOGCONTROL_OPERATION_FORMATFLASH) {
         FlightStatusArmedOptions armed;
         FlightStatusArmedGet(&armed);
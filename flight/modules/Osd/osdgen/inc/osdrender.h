@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup OSDgenModule osdgen Module
+ * @{
+ *
+ * @file       osdrender.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      OSD drawing primitives, HUD elements and the dirty region renderer.
+ *             Parts from CL-OSD and SUPEROSD projects
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OSDRENDER_H_
+#define OSDRENDER_H_
+
+/*
+ * Nothing in here knows about UAVObjects, so that the renderer also builds
+ * for the host (see flight/tests/osdrender).
+ */
+#include "pios.h"
+#include "fonts.h"
+
+// The draw buffers, swapped by the video driver at the end of each frame.
+extern uint8_t *draw_buffer_level;
+extern uint8_t *draw_buffer_mask;
+
+// Size of an array (num items.)
+#define SIZEOF_ARRAY(x) (sizeof(x) / sizeof((x)[0]))
+
+#define HUD_VSCALE_FLAG_CLEAR       1
+#define HUD_VSCALE_FLAG_NO_NEGATIVE 2
+
+// Nothing is drawn right of this column: the last half-word of a line keeps
+// being clocked out by the SPI.
+#define OSD_CLIP_RIGHT              (GRAPHICS_WIDTH_REAL - 9)
+
+// Line endcaps (for horizontal and vertical lines.)
+#define ENDCAP_NONE                 0
+#define ENDCAP_ROUND                1
+#define ENDCAP_FLAT                 2
+
+// Font flags.
+#define FONT_BOLD                   1  // bold text (no outline)
+#define FONT_INVERT                 2  // invert: border white, inside black
+// Text alignments.
+#define TEXT_VA_TOP                 0
+#define TEXT_VA_MIDDLE              1
+#define TEXT_VA_BOTTOM              2
+#define TEXT_HA_LEFT                0
+#define TEXT_HA_CENTER              1
+#define TEXT_HA_RIGHT               2
+
+// Text dimension structures.
+struct FontDimensions {
+    int width, height;
+};
+
+// Max/Min macros.
+#define MAX(a, b)                   ((a) > (b) ? (a) : (b))
+#define MIN(a, b)                   ((a) < (b) ? (a) : (b))
+#define MAX3(a, b, c)               MAX(a, MAX(b, c))
+#define MIN3(a, b, c)               MIN(a, MIN(b, c))
+
+// Apply DeadBand
+#define APPLY_DEADBAND(x, y)        { x = (x) + GRAPHICS_HDEADBAND; y = (y) + GRAPHICS_VDEADBAND; }
+#define APPLY_VDEADBAND(y)          ((y) + GRAPHICS_VDEADBAND)
+#define APPLY_HDEADBAND(x)          ((x) + GRAPHICS_HDEADBAND)
+
+// Macro to swap two variables using XOR swap.
+#define SWAP(a, b)                  { a ^= b; b ^= a; a ^= b; }
+
+/*
+ * Drawing primitives. Coordinates are pixels of the whole buffer, anything
+ * outside of it is clipped. Lines include both end points, rectangles are
+ * width by height pixels. The _lm variants draw to both draw buffers.
+ */
+void write_pixel(uint8_t *buff, unsigned int x, unsigned int y, int mode);
+void write_pixel_lm(unsigned int x, unsigned int y, int mmode, int lmode);
+void write_hline(uint8_t *buff, unsigned int x0, unsigned int x1, unsigned int y, int mode);
+void write_hline_lm(unsigned int x0, unsigned int x1, unsigned int y, int lmode, int mmode);
+void write_hline_outlined(unsigned int x0, unsigned int x1, unsigned int y, int endcap0, int endcap1, int mode, int mmode);
+void write_vline(uint8_t *buff, unsigned int x, unsigned int y0, unsigned int y1, int mode);
+void write_vline_lm(unsigned int x, unsigned int y0, unsigned int y1, int lmode, int mmode);
+void write_vline_outlined(unsigned int x, unsigned int y0, unsigned int y1, int endcap0, int endcap1, int mode, int mmode);
+void write_filled_rectangle(uint8_t *buff, unsigned int x, unsigned int y, unsigned int width, unsigned int height, int mode);
+void write_filled_rectangle_lm(unsigned int x, unsigned int y, unsigned int width, unsigned int height, int lmode, int mmode);
+void write_rectangle_outlined(unsigned int x, unsigned int y, int width, int height, int mode, int mmode);
+void write_circle(uint8_t *buff, unsigned int cx, unsigned int cy, unsigned int r, unsigned int dashp, int mode);
+void write_circle_outlined(unsigned int cx, unsigned int cy, unsigned int r, unsigned int dashp, int bmode, int mode, int mmode);
+void write_circle_filled(uint8_t *buff, unsigned int cx, unsigned int cy, unsigned int r, int mode);
+void write_line(uint8_t *buff, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, int mode);
+void write_line_lm(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, int mmode, int lmode);
+void write_line_outlined(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, int endcap0, int endcap1, int mode, int mmode);
+int fetch_font_info(uint8_t ch, int font, struct FontEntry *font_info, char *lookup);
+void write_char16(char ch, unsigned int x, unsigned int y, int font);
+void write_char(char ch, unsigned int x, unsigned int y, int flags, int font);
+void calc_text_dimensions(char *str, struct FontEntry font, int xs, int ys, struct FontDimensions *dim);
+void write_string(char *str, unsigned int x, unsigned int y, unsigned int xs, unsigned int ys, int va, int ha, int flags, int font);
+void write_string_formatted(char *str, unsigned int x, unsigned int y, unsigned int xs, unsigned int ys, int va, int ha, int flags);
+
+// HUD elements
+void drawCircle(uint16_t x0, uint16_t y0, uint16_t radius);
+void ellipse(int centerX, int centerY, int horizontalRadius, int verticalRadius);
+void drawBox(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void drawArrow(uint16_t x, uint16_t y, uint16_t angle, uint16_t size);
+void drawAttitude(uint16_t x, uint16_t y, int16_t pitch, int16_t roll, uint16_t size);
+void drawBattery(uint16_t x, uint16_t y, uint8_t battery, uint16_t size);
+void hud_draw_vertical_scale(int v, int range, int halign, int x, int y, int height, int mintick_step, int majtick_step, int mintick_len, int majtick_len,
+                             int boundtick_len, int max_val, int flags);
+void hud_draw_linear_compass(int v, int range, int width, int x, int y, int mintick_step, int majtick_step, int mintick_len, int majtick_len, int flags);
+void draw_artificial_horizon(float angle, float pitch, int16_t l_x, int16_t l_y, int16_t size);
+
+/*
+ * Dirty region rendering
+ *
+ * A screen is a list of widgets. Each frame only the widgets that look
+ * different from what the draw buffer shows are cleared and drawn again.
+ * The widgets that overlap what was cleared or drawn are drawn again too,
+ * clipped to those areas. Widgets are drawn in list order, later ones on
+ * top, and must only set or clear pixels (no toggle mode) so that drawing a
+ * widget twice changes nothing.
+ */
+#define OSD_DRAW_BUFFERS 2
+
+// Pixels a widget drew to, inclusive. Empty when right < left.
+struct osd_rect {
+    int16_t left, top, right, bottom;
+};
+
+struct osd_widget;
+
+/**
+ * Reads what the widget shows from its sources.
+ * @return true if the widget now looks different
+ */
+typedef bool (*osd_widget_update_t)(struct osd_widget *widget);
+
+// Draws the widget as the last update read it, with the primitives above.
+typedef void (*osd_widget_draw_t)(struct osd_widget *widget);
+
+struct osd_widget {
+    uint32_t sources;           // bits of the sources the widget shows, given to osd_render_frame() when they change
+    osd_widget_update_t update; // NULL if the widget looks different whenever one of its sources changes
+    osd_widget_draw_t   draw;
+
+    // Kept by the renderer
+    struct osd_rect     bounds[OSD_DRAW_BUFFERS]; // what the widget covers in each draw buffer
+    uint8_t current;            // draw buffers that show the widget as it looks now
+    bool    redraw;
+};
+
+struct osd_render_stats {
+    uint16_t updated; // widgets that look different
+    uint16_t drawn;   // widgets drawn, whole or where they were cleared or drawn over
+    uint32_t cleared; // pixels cleared
+};
+
+void osd_render_frame(struct osd_widget *const *widgets, uint8_t count, uint32_t changed, struct osd_render_stats *stats);
+void osd_render_invalidate(void);
+void osd_render_touch(int left, int top, int right, int bottom);
+
+#endif /* OSDRENDER_H_ */
+
+/**
+ * @}
+ * @}
+ */
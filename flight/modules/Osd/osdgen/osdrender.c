@@ -0,0 +1,1978 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup OSDgenModule osdgen Module
+ * @{
+ *
+ * @file       osdrender.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ *             The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      OSD drawing primitives, HUD elements and the dirty region renderer.
+ *             Parts from CL-OSD and SUPEROSD projects
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pios_math.h>
+
+#include "osdrender.h"
+#include "sin_lookup.h"
+
+#include "font12x18.h"
+#include "font8x10.h"
+
+// Macros for computing addresses and bit positions.
+#define CALC_BUFF_ADDR(x, y) (((x) / 8) + ((y) * (GRAPHICS_WIDTH_REAL / 8)))
+#define CALC_BIT_IN_WORD(x)  ((x) & 7)
+// Macro for writing a byte with a mode (NAND = clear, OR = set, XOR = toggle)
+// at a given position
+#define WRITE_WORD_MODE(buff, addr, mask, mode) \
+    switch (mode) { \
+    case 0: buff[addr] &= ~mask; break; \
+    case 1: buff[addr] |= mask; break; \
+    case 2: buff[addr] ^= mask; break; }
+
+// Macro for initializing stroke/fill modes. Add new modes here
+// if necessary.
+#define SETUP_STROKE_FILL(stroke, fill, mode) \
+    stroke = 0; fill = 0; \
+    if (mode == 0) { stroke = 0; fill = 1; } \
+    if (mode == 1) { stroke = 1; fill = 0; } \
+
+#define DRAW_ENDCAP_HLINE(e, x, y, s, f, l) \
+    if ((e) == ENDCAP_ROUND) /* single pixel endcap */ \
+    { write_pixel_lm(x, y, l, f); } \
+    else if ((e) == ENDCAP_FLAT) /* flat endcap */ \
+    { write_vline_lm(x, y - 1, y + 1, s, l); }
+
+#define DRAW_ENDCAP_VLINE(e, x, y, s, f, l) \
+    if ((e) == ENDCAP_ROUND) /* single pixel endcap */ \
+    { write_pixel_lm(x, y, l, f); } \
+    else if ((e) == ENDCAP_FLAT) /* flat endcap */ \
+    { write_hline_lm(x - 1, x + 1, y, s, l); }
+
+// Macros for writing pixels in a midpoint circle algorithm.
+#define CIRCLE_PLOT_8(buff, cx, cy, x, y, mode) \
+    CIRCLE_PLOT_4(buff, cx, cy, x, y, mode); \
+    if ((x) != (y)) { CIRCLE_PLOT_4(buff, cx, cy, y, x, mode); }
+
+#define CIRCLE_PLOT_4(buff, cx, cy, x, y, mode) \
+    write_pixel(buff, (cx) + (x), (cy) + (y), mode); \
+    write_pixel(buff, (cx) - (x), (cy) + (y), mode); \
+    write_pixel(buff, (cx) + (x), (cy) - (y), mode); \
+    write_pixel(buff, (cx) - (x), (cy) - (y), mode);
+
+// Check if coordinates are valid. If not, return. Assumes unsigned coordinate
+#define CHECK_COORDS(x, y) if (x > OSD_CLIP_RIGHT || y >= GRAPHICS_HEIGHT_REAL) { return; }
+
+/*
+ * The buffers are a stream of pixels, one bit each, line after line with
+ * the leftmost pixel in bit 7 of each byte. Spans and glyphs are written
+ * as aligned 32 bit words of that stream: a span costs one read, modify
+ * and write at each end and one store for each 32 pixels between them.
+ * Read as big endian, the leftmost pixel of a word is bit 31.
+ */
+typedef uint32_t __attribute__((may_alias)) osd_word_t;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define PIXEL_ORDER(w) __builtin_bswap32(w)
+#else
+#define PIXEL_ORDER(w) (w)
+#endif
+
+#define PIXEL_POS(x, y) ((uint32_t)(y) * GRAPHICS_WIDTH_REAL + (uint32_t)(x))
+#define WORDS(buff)     ((osd_word_t *)(void *)(buff))
+
+// What to draw to with which mode, a NULL buffer is left alone.
+struct pen {
+    uint8_t *level;
+    uint8_t *mask;
+    int     lmode;
+    int     mmode;
+};
+
+#define EMPTY_RECT ((struct osd_rect) { INT16_MAX, INT16_MAX, -1, -1 })
+
+// Extended by everything drawn while a widget is drawn
+static struct osd_rect *drawn;
+
+// Nothing is drawn outside of this
+#define SCREEN_RECT ((struct osd_rect) { 0, 0, OSD_CLIP_RIGHT, GRAPHICS_HEIGHT_REAL - 1 })
+static struct osd_rect clip = SCREEN_RECT;
+
+#define CLIPPED(x, y) ((x) < clip.left || (x) > clip.right || (y) < clip.top || (y) > clip.bottom)
+
+static inline void touch(int left, int top, int right, int bottom)
+{
+    if (drawn) {
+        drawn->left   = MIN(drawn->left, left);
+        drawn->top    = MIN(drawn->top, top);
+        drawn->right  = MAX(drawn->right, right);
+        drawn->bottom = MAX(drawn->bottom, bottom);
+    }
+}
+
+/**
+ * osd_render_touch: add to what the widget being drawn covers, for drawing
+ * code that writes to the draw buffers itself. That code is not clipped, so
+ * no other widget may be drawn over its widget.
+ */
+void osd_render_touch(int left, int top, int right, int bottom)
+{
+    touch(left, top, right, bottom);
+}
+
+static inline void write_bits(osd_word_t *word, uint32_t bits, int mode)
+{
+    switch (mode) {
+    case 0:
+        *word &= ~bits;
+        break;
+    case 1:
+        *word |= bits;
+        break;
+    case 2:
+        *word ^= bits;
+        break;
+    }
+}
+
+/**
+ * fill_pixels: clear, set or toggle the pixels from first to last.
+ *
+ * @param       buff    buffer to write in, word aligned
+ * @param       first   PIXEL_POS of the first pixel
+ * @param       last    PIXEL_POS of the last pixel
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+static void fill_pixels(uint8_t *buff, uint32_t first, uint32_t last, int mode)
+{
+    osd_word_t *word = WORDS(buff) + (first >> 5);
+    osd_word_t *end  = WORDS(buff) + (last >> 5);
+    uint32_t head    = PIXEL_ORDER(0xffffffffu >> (first & 31));
+    uint32_t tail    = PIXEL_ORDER(0xffffffffu << (31 - (last & 31)));
+
+    if (word == end) {
+        write_bits(word, head & tail, mode);
+        return;
+    }
+    write_bits(word++, head, mode);
+    switch (mode) {
+    case 0:
+        while (word < end) {
+            *word++ = 0;
+        }
+        break;
+    case 1:
+        while (word < end) {
+            *word++ = 0xffffffffu;
+        }
+        break;
+    case 2:
+        while (word < end) {
+            *word++ ^= 0xffffffffu;
+        }
+        break;
+    }
+    write_bits(end, tail, mode);
+}
+
+// Pixels x0 to x1 of line y, clipped
+static void span(const struct pen *pen, int x0, int x1, int y)
+{
+    if (x0 > x1) {
+        SWAP(x0, x1);
+    }
+    if (y < clip.top || y > clip.bottom || x1 < clip.left || x0 > clip.right) {
+        return;
+    }
+    x0 = MAX(x0, clip.left);
+    x1 = MIN(x1, clip.right);
+    if (pen->level) {
+        fill_pixels(pen->level, PIXEL_POS(x0, y), PIXEL_POS(x1, y), pen->lmode);
+    }
+    if (pen->mask) {
+        fill_pixels(pen->mask, PIXEL_POS(x0, y), PIXEL_POS(x1, y), pen->mmode);
+    }
+    touch(x0, y, x1, y);
+}
+
+// Pixels y0 to y1 of column x, clipped
+static void column(const struct pen *pen, int x, int y0, int y1)
+{
+    if (y0 > y1) {
+        SWAP(y0, y1);
+    }
+    if (x < clip.left || x > clip.right || y1 < clip.top || y0 > clip.bottom) {
+        return;
+    }
+    y0 = MAX(y0, clip.top);
+    y1 = MIN(y1, clip.bottom);
+    uint8_t bit = 0x80 >> CALC_BIT_IN_WORD(x);
+    unsigned int addr = CALC_BUFF_ADDR(x, y0);
+    for (int y = y0; y <= y1; y++, addr += GRAPHICS_WIDTH_REAL / 8) {
+        if (pen->level) {
+            WRITE_WORD_MODE(pen->level, addr, bit, pen->lmode);
+        }
+        if (pen->mask) {
+            WRITE_WORD_MODE(pen->mask, addr, bit, pen->mmode);
+        }
+    }
+    touch(x, y0, x, y1);
+}
+
+// width by height pixels from x, y, clipped
+static void rectangle(const struct pen *pen, int x, int y, int width, int height)
+{
+    int x1 = MIN(x + width - 1, clip.right);
+    int y1 = MIN(y + height - 1, clip.bottom);
+
+    x = MAX(x, clip.left);
+    y = MAX(y, clip.top);
+    if (x > x1 || y > y1) {
+        return;
+    }
+    for (int yy = y; yy <= y1; yy++) {
+        if (pen->level) {
+            fill_pixels(pen->level, PIXEL_POS(x, yy), PIXEL_POS(x1, yy), pen->lmode);
+        }
+        if (pen->mask) {
+            fill_pixels(pen->mask, PIXEL_POS(x, yy), PIXEL_POS(x1, yy), pen->mmode);
+        }
+    }
+    touch(x, y, x1, y1);
+}
+
+/*
+ * Lines are drawn as runs along their major axis, the pixels a Bresenham
+ * walk puts on the same line or column, so that a shallow line costs one
+ * span per line it crosses. The outline of a run is the run one pixel
+ * longer at each end plus the run next to it on either side.
+ */
+static void line_run(const struct pen *pen, bool steep, int from, int to, int at, bool outline)
+{
+    if (steep) {
+        column(pen, at, from - outline, to + outline);
+        if (outline) {
+            column(pen, at - 1, from, to);
+            column(pen, at + 1, from, to);
+        }
+    } else {
+        span(pen, from - outline, to + outline, at);
+        if (outline) {
+            span(pen, from, to, at - 1);
+            span(pen, from, to, at + 1);
+        }
+    }
+}
+
+static void line_runs(const struct pen *pen, int x0, int y0, int x1, int y1, bool outline)
+{
+    // Based on http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+
+    if (steep) {
+        SWAP(x0, y0);
+        SWAP(x1, y1);
+    }
+    if (x0 > x1) {
+        SWAP(x0, x1);
+        SWAP(y0, y1);
+    }
+    int deltax = x1 - x0;
+    int deltay = abs(y1 - y0);
+    int error  = deltax / 2;
+    int ystep  = (y0 < y1) ? 1 : -1;
+    int y      = y0;
+    int start  = x0;
+    // The end point is not drawn.
+    for (int x = x0; x < x1; x++) {
+        error -= deltay;
+        if (error < 0) {
+            line_run(pen, steep, start, x, y, outline);
+            start  = x + 1;
+            y     += ystep;
+            error += deltax;
+        }
+    }
+    if (start < x1) {
+        line_run(pen, steep, start, x1 - 1, y, outline);
+    }
+}
+
+// simple routines
+
+// SUPEROSD routines, modified
+
+/**
+ * write_pixel: Write a pixel at an x,y position to a given surface.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       x               x coordinate
+ * @param       y               y coordinate
+ * @param       mode    0 = clear bit, 1 = set bit, 2 = toggle bit
+ */
+void write_pixel(uint8_t *buff, unsigned int x, unsigned int y, int mode)
+{
+    if (CLIPPED((int)x, (int)y)) {
+        return;
+    }
+    uint8_t mask = 0x80 >> CALC_BIT_IN_WORD(x);
+    WRITE_WORD_MODE(buff, CALC_BUFF_ADDR(x, y), mask, mode);
+    touch(x, y, x, y);
+}
+
+/**
+ * write_pixel_lm: write the pixel on both surfaces (level and mask.)
+ * Uses current draw buffer.
+ *
+ * @param       x               x coordinate
+ * @param       y               y coordinate
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ * @param       lmode   0 = black, 1 = white, 2 = toggle
+ */
+void write_pixel_lm(unsigned int x, unsigned int y, int mmode, int lmode)
+{
+    if (CLIPPED((int)x, (int)y)) {
+        return;
+    }
+    unsigned int addr = CALC_BUFF_ADDR(x, y);
+    uint8_t mask = 0x80 >> CALC_BIT_IN_WORD(x);
+    WRITE_WORD_MODE(draw_buffer_mask, addr, mask, mmode);
+    WRITE_WORD_MODE(draw_buffer_level, addr, mask, lmode);
+    touch(x, y, x, y);
+}
+
+/**
+ * write_hline: horizontal line, written a word at a time
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       x0              x0 coordinate
+ * @param       x1              x1 coordinate
+ * @param       y               y coordinate
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_hline(uint8_t *buff, unsigned int x0, unsigned int x1, unsigned int y, int mode)
+{
+    struct pen pen = { buff, NULL, mode, 0 };
+
+    span(&pen, x0, x1, y);
+}
+
+/**
+ * write_hline_lm: write both level and mask buffers.
+ *
+ * @param       x0              x0 coordinate
+ * @param       x1              x1 coordinate
+ * @param       y               y coordinate
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_hline_lm(unsigned int x0, unsigned int x1, unsigned int y, int lmode, int mmode)
+{
+    struct pen pen = { draw_buffer_level, draw_buffer_mask, lmode, mmode };
+
+    span(&pen, x0, x1, y);
+}
+
+/**
+ * write_hline_outlined: outlined horizontal line with varying endcaps
+ * Always uses draw buffer.
+ *
+ * @param       x0                      x0 coordinate
+ * @param       x1                      x1 coordinate
+ * @param       y                       y coordinate
+ * @param       endcap0         0 = none, 1 = single pixel, 2 = full cap
+ * @param       endcap1         0 = none, 1 = single pixel, 2 = full cap
+ * @param       mode            0 = black outline, white body, 1 = white outline, black body
+ * @param       mmode           0 = clear, 1 = set, 2 = toggle
+ */
+void write_hline_outlined(unsigned int x0, unsigned int x1, unsigned int y, int endcap0, int endcap1, int mode, int mmode)
+{
+    int stroke, fill;
+
+    SETUP_STROKE_FILL(stroke, fill, mode)
+    if ((int)x0 > (int)x1) {
+        SWAP(x0, x1);
+    }
+    // Draw the main body of the line.
+    write_hline_lm(x0 + 1, x1 - 1, y - 1, stroke, mmode);
+    write_hline_lm(x0 + 1, x1 - 1, y + 1, stroke, mmode);
+    write_hline_lm(x0 + 1, x1 - 1, y, fill, mmode);
+    // Draw the endcaps, if any.
+    DRAW_ENDCAP_HLINE(endcap0, x0, y, stroke, fill, mmode);
+    DRAW_ENDCAP_HLINE(endcap1, x1, y, stroke, fill, mmode);
+}
+
+/**
+ * write_vline: vertical line
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       x               x coordinate
+ * @param       y0              y0 coordinate
+ * @param       y1              y1 coordinate
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_vline(uint8_t *buff, unsigned int x, unsigned int y0, unsigned int y1, int mode)
+{
+    struct pen pen = { buff, NULL, mode, 0 };
+
+    column(&pen, x, y0, y1);
+}
+
+/**
+ * write_vline_lm: write both level and mask buffers.
+ *
+ * @param       x               x coordinate
+ * @param       y0              y0 coordinate
+ * @param       y1              y1 coordinate
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_vline_lm(unsigned int x, unsigned int y0, unsigned int y1, int lmode, int mmode)
+{
+    struct pen pen = { draw_buffer_level, draw_buffer_mask, lmode, mmode };
+
+    column(&pen, x, y0, y1);
+}
+
+/**
+ * write_vline_outlined: outlined vertical line with varying endcaps
+ * Always uses draw buffer.
+ *
+ * @param       x                       x coordinate
+ * @param       y0                      y0 coordinate
+ * @param       y1                      y1 coordinate
+ * @param       endcap0         0 = none, 1 = single pixel, 2 = full cap
+ * @param       endcap1         0 = none, 1 = single pixel, 2 = full cap
+ * @param       mode            0 = black outline, white body, 1 = white outline, black body
+ * @param       mmode           0 = clear, 1 = set, 2 = toggle
+ */
+void write_vline_outlined(unsigned int x, unsigned int y0, unsigned int y1, int endcap0, int endcap1, int mode, int mmode)
+{
+    int stroke, fill;
+
+    if ((int)y0 > (int)y1) {
+        SWAP(y0, y1);
+    }
+    SETUP_STROKE_FILL(stroke, fill, mode);
+    // Draw the main body of the line.
+    write_vline_lm(x - 1, y0 + 1, y1 - 1, stroke, mmode);
+    write_vline_lm(x + 1, y0 + 1, y1 - 1, stroke, mmode);
+    write_vline_lm(x, y0 + 1, y1 - 1, fill, mmode);
+    // Draw the endcaps, if any.
+    DRAW_ENDCAP_VLINE(endcap0, x, y0, stroke, fill, mmode);
+    DRAW_ENDCAP_VLINE(endcap1, x, y1, stroke, fill, mmode);
+}
+
+/**
+ * write_filled_rectangle: draw a filled rectangle, every line written
+ * a word at a time.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       x               x coordinate (left)
+ * @param       y               y coordinate (top)
+ * @param       width   rectangle width
+ * @param       height  rectangle height
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_filled_rectangle(uint8_t *buff, unsigned int x, unsigned int y, unsigned int width, unsigned int height, int mode)
+{
+    struct pen pen = { buff, NULL, mode, 0 };
+
+    rectangle(&pen, x, y, width, height);
+}
+
+/**
+ * write_filled_rectangle_lm: draw a filled rectangle on both draw buffers.
+ *
+ * @param       x               x coordinate (left)
+ * @param       y               y coordinate (top)
+ * @param       width   rectangle width
+ * @param       height  rectangle height
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_filled_rectangle_lm(unsigned int x, unsigned int y, unsigned int width, unsigned int height, int lmode, int mmode)
+{
+    struct pen pen = { draw_buffer_level, draw_buffer_mask, lmode, mmode };
+
+    rectangle(&pen, x, y, width, height);
+}
+
+/**
+ * write_rectangle_outlined: draw an outline of a rectangle. Essentially
+ * a convenience wrapper for draw_hline_outlined and draw_vline_outlined.
+ *
+ * @param       x               x coordinate (left)
+ * @param       y               y coordinate (top)
+ * @param       width   rectangle width
+ * @param       height  rectangle height
+ * @param       mode    0 = black outline, white body, 1 = white outline, black body
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_rectangle_outlined(unsigned int x, unsigned int y, int width, int height, int mode, int mmode)
+{
+    write_hline_outlined(x, x + width, y, ENDCAP_ROUND, ENDCAP_ROUND, mode, mmode);
+    write_hline_outlined(x, x + width, y + height, ENDCAP_ROUND, ENDCAP_ROUND, mode, mmode);
+    write_vline_outlined(x, y, y + height, ENDCAP_ROUND, ENDCAP_ROUND, mode, mmode);
+    write_vline_outlined(x + width, y, y + height, ENDCAP_ROUND, ENDCAP_ROUND, mode, mmode);
+}
+
+/**
+ * write_circle: draw the outline of a circle on a given buffer,
+ * with an optional dash pattern for the line instead of a normal line.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       cx              origin x coordinate
+ * @param       cy              origin y coordinate
+ * @param       r               radius
+ * @param       dashp   dash period (pixels) - zero for no dash
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_circle(uint8_t *buff, unsigned int cx, unsigned int cy, unsigned int r, unsigned int dashp, int mode)
+{
+    CHECK_COORDS(cx, cy);
+    int error = -r, x = r, y = 0;
+    while (x >= y) {
+        if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+            CIRCLE_PLOT_8(buff, cx, cy, x, y, mode);
+        }
+        error += (y * 2) + 1;
+        y++;
+        if (error >= 0) {
+            --x;
+            error -= x * 2;
+        }
+    }
+}
+
+/**
+ * write_circle_outlined: draw an outlined circle on the draw buffer.
+ *
+ * @param       cx              origin x coordinate
+ * @param       cy              origin y coordinate
+ * @param       r               radius
+ * @param       dashp   dash period (pixels) - zero for no dash
+ * @param       bmode   0 = 4-neighbour border, 1 = 8-neighbour border
+ * @param       mode    0 = black outline, white body, 1 = white outline, black body
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_circle_outlined(unsigned int cx, unsigned int cy, unsigned int r, unsigned int dashp, int bmode, int mode, int mmode)
+{
+    int stroke, fill;
+
+    CHECK_COORDS(cx, cy);
+    SETUP_STROKE_FILL(stroke, fill, mode);
+    // This is a two step procedure. First, we draw the outline of the
+    // circle, then we draw the inner part.
+    int error = -r, x = r, y = 0;
+    while (x >= y) {
+        if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+            CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y, mmode);
+            CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y, stroke);
+            CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y + 1, mmode);
+            CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y + 1, stroke);
+            CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y, mmode);
+            CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y, stroke);
+            CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y - 1, mmode);
+            CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y - 1, stroke);
+            if (bmode == 1) {
+                CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y + 1, mmode);
+                CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y + 1, stroke);
+                CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y - 1, mmode);
+                CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y - 1, stroke);
+            }
+        }
+        error += (y * 2) + 1;
+        y++;
+        if (error >= 0) {
+            --x;
+            error -= x * 2;
+        }
+    }
+    error = -r;
+    x     = r;
+    y     = 0;
+    while (x >= y) {
+        if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+            CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y, mmode);
+            CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y, fill);
+        }
+        error += (y * 2) + 1;
+        y++;
+        if (error >= 0) {
+            --x;
+            error -= x * 2;
+        }
+    }
+}
+
+/**
+ * write_circle_filled: fill a circle on a given buffer.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       cx              origin x coordinate
+ * @param       cy              origin y coordinate
+ * @param       r               radius
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_circle_filled(uint8_t *buff, unsigned int cx, unsigned int cy, unsigned int r, int mode)
+{
+    CHECK_COORDS(cx, cy);
+    int error = -r, x = r, y = 0, xch = 0;
+    // It turns out that filled circles can take advantage of the midpoint
+    // circle algorithm. We simply draw very fast horizontal lines across each
+    // pair of X,Y coordinates. In some cases, this can even be faster than
+    // drawing an outlined circle!
+    //
+    // Due to multiple writes to each set of pixels, we have a special exception
+    // for when using the toggling draw mode.
+    while (x >= y) {
+        if (y != 0) {
+            write_hline(buff, cx - x, cx + x, cy + y, mode);
+            write_hline(buff, cx - x, cx + x, cy - y, mode);
+            if (mode != 2 || (mode == 2 && xch && (cx - x) != (cx - y))) {
+                write_hline(buff, cx - y, cx + y, cy + x, mode);
+                write_hline(buff, cx - y, cx + y, cy - x, mode);
+                xch = 0;
+            }
+        }
+        error += (y * 2) + 1;
+        y++;
+        if (error >= 0) {
+            --x;
+            xch    = 1;
+            error -= x * 2;
+        }
+    }
+    // Handle toggle mode.
+    if (mode == 2) {
+        write_hline(buff, cx - r, cx + r, cy, mode);
+    }
+}
+
+/**
+ * write_line: Draw a line of arbitrary angle.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       x0              first x coordinate
+ * @param       y0              first y coordinate
+ * @param       x1              second x coordinate
+ * @param       y1              second y coordinate
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+void write_line(uint8_t *buff, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, int mode)
+{
+    struct pen pen = { buff, NULL, mode, 0 };
+
+    line_runs(&pen, x0, y0, x1, y1, false);
+}
+
+/**
+ * write_line_lm: Draw a line of arbitrary angle.
+ *
+ * @param       x0              first x coordinate
+ * @param       y0              first y coordinate
+ * @param       x1              second x coordinate
+ * @param       y1              second y coordinate
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ */
+void write_line_lm(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, int mmode, int lmode)
+{
+    struct pen pen = { draw_buffer_level, draw_buffer_mask, lmode, mmode };
+
+    line_runs(&pen, x0, y0, x1, y1, false);
+}
+
+/**
+ * write_line_outlined: Draw a line of arbitrary angle, with an outline.
+ *
+ * @param       buff            pointer to buffer to write in
+ * @param       x0                      first x coordinate
+ * @param       y0                      first y coordinate
+ * @param       x1                      second x coordinate
+ * @param       y1                      second y coordinate
+ * @param       endcap0         0 = none, 1 = single pixel, 2 = full cap
+ * @param       endcap1         0 = none, 1 = single pixel, 2 = full cap
+ * @param       mode            0 = black outline, white body, 1 = white outline, black body
+ * @param       mmode           0 = clear, 1 = set, 2 = toggle
+ */
+void write_line_outlined(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                         __attribute__((unused)) int endcap0, __attribute__((unused)) int endcap1,
+                         int mode, int mmode)
+{
+    struct pen outline = { draw_buffer_level, draw_buffer_mask, (mode == 0) ? 0 : 1, mmode };
+    struct pen inner   = { draw_buffer_level, draw_buffer_mask, (mode == 0) ? 1 : 0, mmode };
+
+    // This is a two step procedure. First, we draw the outline of the
+    // line, then we draw the inner part.
+    line_runs(&outline, x0, y0, x1, y1, true);
+    line_runs(&inner, x0, y0, x1, y1, false);
+}
+
+/**
+ * fetch_font_info: Fetch font info structs.
+ *
+ * @param       ch              character
+ * @param       font    font id
+ */
+int fetch_font_info(uint8_t ch, int font, struct FontEntry *font_info, char *lookup)
+{
+    // First locate the font struct.
+    if ((unsigned int)font > SIZEOF_ARRAY(fonts)) {
+        return 0; // font does not exist, exit.
+    }
+    // Load the font info; IDs are always sequential.
+    *font_info = fonts[font];
+    // Locate character in font lookup table. (If required.)
+    if (lookup != NULL) {
+        *lookup = font_info->lookup[ch];
+        if ((uint8_t)*lookup == 0xff) {
+            return 0; // character doesn't exist, don't bother writing it.
+        }
+    }
+    return 1;
+}
+
+/*
+ * A glyph is drawn a line at a time, the 16 pixels of the line written
+ * as one word or two. The mask is set where the glyph has its mask, and
+ * there the level is set to the level of the glyph: one read, modify
+ * and write per word of each buffer.
+ */
+struct glyph_clip {
+    uint32_t pos; // PIXEL_POS of the first line drawn
+    int      first, end; // glyph lines to draw
+    uint16_t columns; // glyph columns that are on screen
+};
+
+// Glyphs left of the screen are not drawn at all, like before
+static bool glyph_clip(int x, int y, int width, int height, struct glyph_clip *glyph)
+{
+    if (x < 0 || x > clip.right || x + width <= clip.left || y > clip.bottom || y + height <= clip.top) {
+        return false;
+    }
+    glyph->first   = MAX(0, clip.top - y);
+    glyph->end     = MIN(height, clip.bottom + 1 - y);
+    glyph->pos     = PIXEL_POS(x, y + glyph->first);
+    glyph->columns = 0xffff;
+    if (x < clip.left) {
+        glyph->columns >>= clip.left - x;
+    }
+    if (x + 15 > clip.right) {
+        glyph->columns &= 0xffff << (x + 15 - clip.right);
+    }
+    touch(MAX(x, clip.left), y + glyph->first, MIN(x + width - 1, clip.right), y + glyph->end - 1);
+    return true;
+}
+
+// 16 pixels from pos, mask and level with the leftmost pixel in bit 15
+static inline void glyph_line(uint32_t pos, uint16_t mask, uint16_t level)
+{
+    uint32_t shift = pos & 31;
+    osd_word_t *m  = WORDS(draw_buffer_mask) + (pos >> 5);
+    osd_word_t *l  = WORDS(draw_buffer_level) + (pos >> 5);
+    uint32_t bits  = PIXEL_ORDER(((uint32_t)mask << 16) >> shift);
+
+    m[0] |= bits;
+    l[0]  = (l[0] & ~bits) | PIXEL_ORDER(((uint32_t)level << 16) >> shift);
+    // the rest goes to the next word, which may be past the end of the buffer if there is no rest
+    if (shift > 16 && (uint16_t)(mask << (32 - shift)) != 0) {
+        bits  = PIXEL_ORDER((uint32_t)mask << (48 - shift));
+        m[1] |= bits;
+        l[1]  = (l[1] & ~bits) | PIXEL_ORDER((uint32_t)level << (48 - shift));
+    }
+}
+
+/**
+ * write_char16: Draw a character of the 8x10 or 12x18 font on the
+ * current draw buffer.
+ *
+ * @param       ch              character to write
+ * @param       x               x coordinate (left)
+ * @param       y               y coordinate (top)
+ * @param       font    font to use
+ */
+void write_char16(char ch, unsigned int x, unsigned int y, int font)
+{
+    struct FontEntry font_info;
+    struct glyph_clip glyph;
+
+    if (!fetch_font_info(0, font, &font_info, NULL) || !glyph_clip(x, y, font_info.width, font_info.height, &glyph)) {
+        return;
+    }
+    // The glyph data is left aligned.
+    unsigned int xshift = 16 - font_info.width;
+    unsigned int row    = (uint8_t)ch * font_info.height + glyph.first;
+    for (int yy = glyph.first; yy < glyph.end; yy++, row++, glyph.pos += GRAPHICS_WIDTH_REAL) {
+        uint16_t mask, levels;
+        if (font == 3) {
+            mask   = font_mask12x18[row] << xshift;
+            levels = font_frame12x18[row] << xshift;
+        } else {
+            mask   = font_mask8x10[row] << xshift;
+            levels = font_frame8x10[row] << xshift;
+        }
+        mask &= glyph.columns;
+        glyph_line(glyph.pos, mask, levels & mask);
+    }
+}
+
+/**
+ * write_char: Draw a character on the current draw buffer.
+ * Currently supports outlined characters and characters with
+ * a width of up to 8 pixels.
+ *
+ * @param       ch              character to write
+ * @param       x               x coordinate (left)
+ * @param       y               y coordinate (top)
+ * @param       flags   flags to write with (see gfx.h)
+ * @param       font    font to use
+ */
+void write_char(char ch, unsigned int x, unsigned int y, int flags, int font)
+{
+    struct FontEntry font_info;
+    struct glyph_clip glyph;
+    char lookup = 0;
+
+    // How big is the character? We handle characters up to 8 pixels
+    // wide for now. Support for large characters may be added in future.
+    if (!fetch_font_info(ch, font, &font_info, &lookup) || font_info.width > 8 || !glyph_clip(x, y, font_info.width, font_info.height, &glyph)) {
+        return;
+    }
+    // Each character has its mask lines, then its level lines.
+    const uint8_t *data   = (const uint8_t *)font_info.data + (uint8_t)lookup * font_info.height * 2;
+    unsigned int xshift   = 16 - font_info.width;
+    // The level data is normally inverted.
+    uint16_t invert = (flags & FONT_INVERT) ? 0xffff : 0;
+    for (int yy = glyph.first; yy < glyph.end; yy++, glyph.pos += GRAPHICS_WIDTH_REAL) {
+        uint16_t mask   = (data[yy] << xshift) & glyph.columns;
+        uint16_t levels = (data[yy + font_info.height] << xshift) ^ invert;
+        glyph_line(glyph.pos, mask, levels & mask);
+    }
+}
+
+/**
+ * calc_text_dimensions: Calculate the dimensions of a
+ * string in a given font. Supports new lines and
+ * carriage returns in text.
+ *
+ * @param       str                     string to calculate dimensions of
+ * @param       font_info       font info structure
+ * @param       xs                      horizontal spacing
+ * @param       ys                      vertical spacing
+ * @param       dim                     return result: struct FontDimensions
+ */
+void calc_text_dimensions(char *str, struct FontEntry font, int xs, int ys, struct FontDimensions *dim)
+{
+    int max_length = 0, line_length = 0, lines = 1;
+
+    while (*str != 0) {
+        line_length++;
+        if (*str == '\n' || *str == '\r') {
+            if (line_length > max_length) {
+                max_length = line_length;
+            }
+            line_length = 0;
+            lines++;
+        }
+        str++;
+    }
+    if (line_length > max_length) {
+        max_length = line_length;
+    }
+    dim->width  = max_length * (font.width + xs);
+    dim->height = lines * (font.height + ys);
+}
+
+/**
+ * write_string: Draw a string on the screen with certain
+ * alignment parameters.
+ *
+ * @param       str             string to write
+ * @param       x               x coordinate
+ * @param       y               y coordinate
+ * @param       xs              horizontal spacing
+ * @param       ys              horizontal spacing
+ * @param       va              vertical align
+ * @param       ha              horizontal align
+ * @param       flags   flags (passed to write_char)
+ * @param       font    font
+ */
+void write_string(char *str, unsigned int x, unsigned int y, unsigned int xs, unsigned int ys, int va, int ha, int flags, int font)
+{
+    int xx = 0, yy = 0, xx_original = 0;
+    struct FontEntry font_info;
+    struct FontDimensions dim;
+
+    // Determine font info and dimensions/position of the string.
+    fetch_font_info(0, font, &font_info, NULL);
+    calc_text_dimensions(str, font_info, xs, ys, &dim);
+    switch (va) {
+    case TEXT_VA_TOP:
+        yy = y;
+        break;
+    case TEXT_VA_MIDDLE:
+        yy = y - (dim.height / 2);
+        break;
+    case TEXT_VA_BOTTOM:
+        yy = y - dim.height;
+        break;
+    }
+    switch (ha) {
+    case TEXT_HA_LEFT:
+        xx = x;
+        break;
+    case TEXT_HA_CENTER:
+        xx = x - (dim.width / 2);
+        break;
+    case TEXT_HA_RIGHT:
+        xx = x - dim.width;
+        break;
+    }
+    // Then write each character.
+    xx_original = xx;
+    while (*str != 0) {
+        if (*str == '\n' || *str == '\r') {
+            yy += ys + font_info.height;
+            xx  = xx_original;
+        } else {
+            if (xx >= 0 && xx < GRAPHICS_WIDTH_REAL) {
+                if (font_info.id < 2) {
+                    write_char(*str, xx, yy, flags, font);
+                } else {
+                    write_char16(*str, xx, yy, font);
+                }
+            }
+            xx += font_info.width + xs;
+        }
+        str++;
+    }
+}
+
+/**
+ * write_string_formatted: Draw a string with format escape
+ * sequences in it. Allows for complex text effects.
+ *
+ * @param       str             string to write (with format data)
+ * @param       x               x coordinate
+ * @param       y               y coordinate
+ * @param       xs              default horizontal spacing
+ * @param       ys              default horizontal spacing
+ * @param       va              vertical align
+ * @param       ha              horizontal align
+ * @param       flags   flags (passed to write_char)
+ */
+void write_string_formatted(char *str, unsigned int x, unsigned int y, unsigned int xs, unsigned int ys,
+                            __attribute__((unused)) int va, __attribute__((unused)) int ha, int flags)
+{
+    int fcode = 0, fptr = 0, font = 0, fwidth = 0, fheight = 0, xx = x, yy = y, max_xx = 0, max_height = 0;
+    struct FontEntry font_info;
+
+    // Retrieve sizes of the fonts: bigfont and smallfont.
+    fetch_font_info(0, 0, &font_info, NULL);
+    int smallfontwidth = font_info.width, smallfontheight = font_info.height;
+    fetch_font_info(0, 1, &font_info, NULL);
+    int bigfontwidth   = font_info.width, bigfontheight = font_info.height;
+    // 11 byte stack with last byte as NUL.
+    char fstack[11];
+    fstack[10] = '\0';
+    // First, we need to parse the string for format characters and
+    // work out a bounding box. We'll parse again for the final output.
+    // This is a simple state machine parser.
+    char *ostr = str;
+    while (*str) {
+        if (*str == '<' && fcode == 1) {
+            // escape code: skip
+            fcode = 0;
+        }
+        if (*str == '<' && fcode == 0) {
+            // begin format code?
+            fcode = 1;
+            fptr  = 0;
+        }
+        if (*str == '>' && fcode == 1) {
+            fcode = 0;
+            if (strcmp(fstack, "B")) {
+                // switch to "big" font (font #1)
+                fwidth  = bigfontwidth;
+                fheight = bigfontheight;
+            } else if (strcmp(fstack, "S")) {
+                // switch to "small" font (font #0)
+                fwidth  = smallfontwidth;
+                fheight = smallfontheight;
+            }
+            if (fheight > max_height) {
+                max_height = fheight;
+            }
+            // Skip over this byte. Go to next byte.
+            str++;
+            continue;
+        }
+        if (*str != '<' && *str != '>' && fcode == 1) {
+            // Add to the format stack (up to 10 bytes.)
+            if (fptr > 10) {
+                // stop adding bytes
+                str++; // go to next byte
+                continue;
+            }
+            fstack[fptr++] = *str;
+            fstack[fptr]   = '\0'; // clear next byte (ready for next char or to terminate string.)
+        }
+        if (fcode == 0) {
+            // Not a format code, raw text.
+            xx += fwidth + xs;
+            if (*str == '\n') {
+                if (xx > max_xx) {
+                    max_xx = xx;
+                }
+                xx  = x;
+                yy += fheight + ys;
+            }
+        }
+        str++;
+    }
+    // Reset string pointer.
+    str = ostr;
+    // Now we've parsed it and got a bbox, we need to work out the dimensions of it
+    // and how to align it.
+    /*int width = max_xx - x;
+       int height = yy - y;
+       int ay, ax;
+       switch(va)
+       {
+       case TEXT_VA_TOP:               ay = yy; break;
+       case TEXT_VA_MIDDLE:    ay = yy - (height / 2); break;
+       case TEXT_VA_BOTTOM:    ay = yy - height; break;
+       }
+       switch(ha)
+       {
+       case TEXT_HA_LEFT:              ax = x; break;
+       case TEXT_HA_CENTER:    ax = x - (width / 2); break;
+       case TEXT_HA_RIGHT:             ax = x - width; break;
+       }*/
+    // So ax,ay is our new text origin. Parse the text format again and paint
+    // the text on the display.
+    fcode = 0;
+    fptr  = 0;
+    font  = 0;
+    xx    = 0;
+    yy    = 0;
+    while (*str) {
+        if (*str == '<' && fcode == 1) {
+            // escape code: skip
+            fcode = 0;
+        }
+        if (*str == '<' && fcode == 0) {
+            // begin format code?
+            fcode = 1;
+            fptr  = 0;
+        }
+        if (*str == '>' && fcode == 1) {
+            fcode = 0;
+            if (strcmp(fstack, "B")) {
+                // switch to "big" font (font #1)
+                fwidth  = bigfontwidth;
+                fheight = bigfontheight;
+                font    = 1;
+            } else if (strcmp(fstack, "S")) {
+                // switch to "small" font (font #0)
+                fwidth  = smallfontwidth;
+                fheight = smallfontheight;
+                font    = 0;
+            }
+            // Skip over this byte. Go to next byte.
+            str++;
+            continue;
+        }
+        if (*str != '<' && *str != '>' && fcode == 1) {
+            // Add to the format stack (up to 10 bytes.)
+            if (fptr > 10) {
+                // stop adding bytes
+                str++; // go to next byte
+                continue;
+            }
+            fstack[fptr++] = *str;
+            fstack[fptr]   = '\0'; // clear next byte (ready for next char or to terminate string.)
+        }
+        if (fcode == 0) {
+            // Not a format code, raw text. So we draw it.
+            // TODO - different font sizes.
+            write_char(*str, xx, yy + (max_height - fheight), flags, font);
+            xx += fwidth + xs;
+            if (*str == '\n') {
+                if (xx > max_xx) {
+                    max_xx = xx;
+                }
+                xx  = x;
+                yy += fheight + ys;
+            }
+        }
+        str++;
+    }
+}
+
+// Credit for this one goes to wikipedia! :-)
+void drawCircle(uint16_t x0, uint16_t y0, uint16_t radius)
+{
+    int f     = 1 - radius;
+    int ddF_x = 1;
+    int ddF_y = -2 * radius;
+    int x     = 0;
+    int y     = radius;
+
+    write_pixel_lm(x0, y0 + radius, 1, 1);
+    write_pixel_lm(x0, y0 - radius, 1, 1);
+    write_pixel_lm(x0 + radius, y0, 1, 1);
+    write_pixel_lm(x0 - radius, y0, 1, 1);
+
+    while (x < y) {
+        // ddF_x == 2 * x + 1;
+        // ddF_y == -2 * y;
+        // f == x*x + y*y - radius*radius + 2*x - y + 1;
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+        write_pixel_lm(x0 + x, y0 + y, 1, 1);
+        write_pixel_lm(x0 - x, y0 + y, 1, 1);
+        write_pixel_lm(x0 + x, y0 - y, 1, 1);
+        write_pixel_lm(x0 - x, y0 - y, 1, 1);
+        write_pixel_lm(x0 + y, y0 + x, 1, 1);
+        write_pixel_lm(x0 - y, y0 + x, 1, 1);
+        write_pixel_lm(x0 + y, y0 - x, 1, 1);
+        write_pixel_lm(x0 - y, y0 - x, 1, 1);
+    }
+}
+
+/// Draws four points relative to the given center point.
+///
+/// \li centerX + X, centerY + Y
+/// \li centerX + X, centerY - Y
+/// \li centerX - X, centerY + Y
+/// \li centerX - X, centerY - Y
+///
+/// \param centerX the x coordinate of the center point
+/// \param centerY the y coordinate of the center point
+/// \param deltaX the difference between the centerX coordinate and each pixel drawn
+/// \param deltaY the difference between the centerY coordinate and each pixel drawn
+/// \param color the color to draw the pixels with.
+void plotFourQuadrants(int32_t centerX, int32_t centerY, int32_t deltaX, int32_t deltaY)
+{
+    write_pixel_lm(centerX + deltaX, centerY + deltaY, 1, 1); // Ist      Quadrant
+    write_pixel_lm(centerX - deltaX, centerY + deltaY, 1, 1); // IInd     Quadrant
+    write_pixel_lm(centerX - deltaX, centerY - deltaY, 1, 1); // IIIrd    Quadrant
+    write_pixel_lm(centerX + deltaX, centerY - deltaY, 1, 1); // IVth     Quadrant
+}
+
+/// Implements the midpoint ellipse drawing algorithm which is a bresenham
+/// style DDF.
+///
+/// \param centerX the x coordinate of the center of the ellipse
+/// \param centerY the y coordinate of the center of the ellipse
+/// \param horizontalRadius the horizontal radius of the ellipse
+/// \param verticalRadius the vertical radius of the ellipse
+/// \param color the color of the ellipse border
+void ellipse(int centerX, int centerY, int horizontalRadius, int verticalRadius)
+{
+    int64_t doubleHorizontalRadius = horizontalRadius * horizontalRadius;
+    int64_t doubleVerticalRadius   = verticalRadius * verticalRadius;
+
+    int64_t error = doubleVerticalRadius - doubleHorizontalRadius * verticalRadius + (doubleVerticalRadius >> 2);
+
+    int x = 0;
+    int y = verticalRadius;
+    int deltaX = 0;
+    int deltaY = (doubleHorizontalRadius << 1) * y;
+
+    plotFourQuadrants(centerX, centerY, x, y);
+
+    while (deltaY >= deltaX) {
+        x++;
+        deltaX += (doubleVerticalRadius << 1);
+
+        error  += deltaX + doubleVerticalRadius;
+
+        if (error >= 0) {
+            y--;
+            deltaY -= (doubleHorizontalRadius << 1);
+
+            error  -= deltaY;
+        }
+        plotFourQuadrants(centerX, centerY, x, y);
+    }
+
+    error = (int64_t)(doubleVerticalRadius * (x + 1 / 2.0f) * (x + 1 / 2.0f) + doubleHorizontalRadius * (y - 1) * (y - 1) - doubleHorizontalRadius * doubleVerticalRadius);
+
+    while (y >= 0) {
+        error  += doubleHorizontalRadius;
+        y--;
+        deltaY -= (doubleHorizontalRadius << 1);
+        error  -= deltaY;
+
+        if (error <= 0) {
+            x++;
+            deltaX += (doubleVerticalRadius << 1);
+            error  += deltaX;
+        }
+
+        plotFourQuadrants(centerX, centerY, x, y);
+    }
+}
+
+void drawArrow(uint16_t x, uint16_t y, uint16_t angle, uint16_t size)
+{
+    float sin_angle, cos_angle;
+
+    sincos_lookup_deg(angle, &sin_angle, &cos_angle);
+    int16_t a = cos_angle * (size / 2);
+    int16_t b = sin_angle * (size / 2);
+
+    write_line_lm((x) - 1 - b, (y) - 1 + a, (x) - 1 + b, (y) - 1 - a, 1, 1); // Direction line
+    // write_line_lm((GRAPHICS_SIZE/2)-1 + a/2, (GRAPHICS_SIZE/2)-1 + b/2, (GRAPHICS_SIZE/2)-1 - a/2, (GRAPHICS_SIZE/2)-1 - b/2, 1, 1); //Arrow bottom line
+    write_line_lm((x) - 1 + b, (y) - 1 - a, (x) - 1 - a / 2, (y) - 1 - b / 2, 1, 1); // Arrow "wings"
+    write_line_lm((x) - 1 + b, (y) - 1 - a, (x) - 1 + a / 2, (y) - 1 + b / 2, 1, 1);
+}
+
+void drawBox(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    write_line_lm(x1, y1, x2, y1, 1, 1); // top
+    write_line_lm(x1, y1, x1, y2, 1, 1); // left
+    write_line_lm(x2, y1, x2, y2, 1, 1); // right
+    write_line_lm(x1, y2, x2, y2, 1, 1); // bottom
+}
+
+// SUPEROSD-
+
+// graphics
+
+void drawAttitude(uint16_t x, uint16_t y, int16_t pitch, int16_t roll, uint16_t size)
+{
+    float sin_roll, cos_roll;
+
+    sincos_lookup_deg(roll, &sin_roll, &cos_roll);
+    int16_t a = sin_roll * (size / 2);
+    int16_t b = cos_roll * (size / 2);
+    int16_t c = cos_roll * 5; // sin(roll + 90)
+    int16_t d = -sin_roll * 5; // cos(roll + 90)
+
+    int16_t k;
+    int16_t l;
+
+    const float sin30 = 0.5f, cos30 = 0.8660254f;
+    int16_t indi30x1  = cos30 * (size / 2 + 1);
+    int16_t indi30y1  = sin30 * (size / 2 + 1);
+
+    int16_t indi30x2  = cos30 * (size / 2 + 4);
+    int16_t indi30y2  = sin30 * (size / 2 + 4);
+
+    int16_t indi60x1  = sin30 * (size / 2 + 1);
+    int16_t indi60y1  = cos30 * (size / 2 + 1);
+
+    int16_t indi60x2  = sin30 * (size / 2 + 4);
+    int16_t indi60y2  = cos30 * (size / 2 + 4);
+
+    pitch = pitch % 90;
+    if (pitch > 90) {
+        pitch = pitch - 90;
+    }
+    if (pitch < -90) {
+        pitch = pitch + 90;
+    }
+    if (roll < -90 || roll > 90) {
+        pitch = pitch * -1;
+    }
+    k = a * pitch / 90;
+    l = b * pitch / 90;
+
+    // scale
+    // 0
+    // drawLine((x)-1-(size/2+4), (y)-1, (x)-1 - (size/2+1), (y)-1);
+    // drawLine((x)-1+(size/2+4), (y)-1, (x)-1 + (size/2+1), (y)-1);
+    write_line_outlined((x) - 1 - (size / 2 + 4), (y) - 1, (x) - 1 - (size / 2 + 1), (y) - 1, 0, 0, 0, 1);
+    write_line_outlined((x) - 1 + (size / 2 + 4), (y) - 1, (x) - 1 + (size / 2 + 1), (y) - 1, 0, 0, 0, 1);
+
+    // 30
+    // drawLine((x)-1+indi30x1, (y)-1-indi30y1, (x)-1 + indi30x2, (y)-1 - indi30y2);
+    // drawLine((x)-1-indi30x1, (y)-1-indi30y1, (x)-1 - indi30x2, (y)-1 - indi30y2);
+    write_line_outlined((x) - 1 + indi30x1, (y) - 1 - indi30y1, (x) - 1 + indi30x2, (y) - 1 - indi30y2, 0, 0, 0, 1);
+    write_line_outlined((x) - 1 - indi30x1, (y) - 1 - indi30y1, (x) - 1 - indi30x2, (y) - 1 - indi30y2, 0, 0, 0, 1);
+    // 60
+    // drawLine((x)-1+indi60x1, (y)-1-indi60y1, (x)-1 + indi60x2, (y)-1 - indi60y2);
+    // drawLine((x)-1-indi60x1, (y)-1-indi60y1, (x)-1 - indi60x2, (y)-1 - indi60y2);
+    write_line_outlined((x) - 1 + indi60x1, (y) - 1 - indi60y1, (x) - 1 + indi60x2, (y) - 1 - indi60y2, 0, 0, 0, 1);
+    write_line_outlined((x) - 1 - indi60x1, (y) - 1 - indi60y1, (x) - 1 - indi60x2, (y) - 1 - indi60y2, 0, 0, 0, 1);
+    // 90
+    // drawLine((x)-1, (y)-1-(size/2+4), (x)-1, (y)-1 - (size/2+1));
+    write_line_outlined((x) - 1, (y) - 1 - (size / 2 + 4), (x) - 1, (y) - 1 - (size / 2 + 1), 0, 0, 0, 1);
+
+    // roll
+    // drawLine((x)-1 - b, (y)-1 + a, (x)-1 + b, (y)-1 - a); //Direction line
+    write_line_outlined((x) - 1 - b, (y) - 1 + a, (x) - 1 + b, (y) - 1 - a, 0, 0, 0, 1); // Direction line
+    // "wingtips"
+    // drawLine((x)-1 - b, (y)-1 + a, (x)-1 - b + d, (y)-1 + a - c);
+    // drawLine((x)-1 + b + d, (y)-1 - a - c, (x)-1 + b, (y)-1 - a);
+    write_line_outlined((x) - 1 - b, (y) - 1 + a, (x) - 1 - b + d, (y) - 1 + a - c, 0, 0, 0, 1);
+    write_line_outlined((x) - 1 + b + d, (y) - 1 - a - c, (x) - 1 + b, (y) - 1 - a, 0, 0, 0, 1);
+
+    // pitch
+    // drawLine((x)-1, (y)-1, (x)-1 - k, (y)-1 - l);
+    write_line_outlined((x) - 1, (y) - 1, (x) - 1 - k, (y) - 1 - l, 0, 0, 0, 1);
+
+    // drawCircle(x-1, y-1, 5);
+    // write_circle_outlined(x-1, y-1, 5,0,0,0,1);
+    // drawCircle(x-1, y-1, size/2+4);
+    // write_circle_outlined(x-1, y-1, size/2+4,0,0,0,1);
+}
+
+void drawBattery(uint16_t x, uint16_t y, uint8_t battery, uint16_t size)
+{
+    int i = 0;
+    int batteryLines;
+
+    // top
+    /*drawLine((x)-1+(size/2-size/4), (y)-1, (x)-1 + (size/2+size/4), (y)-1);
+       drawLine((x)-1+(size/2-size/4), (y)-1+1, (x)-1 + (size/2+size/4), (y)-1+1);
+
+       drawLine((x)-1, (y)-1+2, (x)-1 + size, (y)-1+2);
+       //bottom
+       drawLine((x)-1, (y)-1+size*3, (x)-1 + size, (y)-1+size*3);
+       //left
+       drawLine((x)-1, (y)-1+2, (x)-1, (y)-1+size*3);
+
+       //right
+       drawLine((x)-1+size, (y)-1+2, (x)-1+size, (y)-1+size*3);*/
+
+    write_rectangle_outlined((x) - 1, (y) - 1 + 2, size, size * 3, 0, 1);
+    write_vline_lm((x) - 1 + (size / 2 + size / 4) + 1, (y) - 2, (y) - 1 + 1, 0, 1);
+    write_vline_lm((x) - 1 + (size / 2 - size / 4) - 1, (y) - 2, (y) - 1 + 1, 0, 1);
+    write_hline_lm((x) - 1 + (size / 2 - size / 4), (x) - 1 + (size / 2 + size / 4), (y) - 2, 0, 1);
+    write_hline_lm((x) - 1 + (size / 2 - size / 4), (x) - 1 + (size / 2 + size / 4), (y) - 1, 1, 1);
+    write_hline_lm((x) - 1 + (size / 2 - size / 4), (x) - 1 + (size / 2 + size / 4), (y) - 1 + 1, 1, 1);
+
+    batteryLines = battery * (size * 3 - 2) / 100;
+    for (i = 0; i < batteryLines; i++) {
+        write_hline_lm((x) - 1, (x) - 1 + size, (y) - 1 + size * 3 - i, 1, 1);
+    }
+}
+
+/**
+ * hud_draw_vertical_scale: Draw a vertical scale.
+ *
+ * @param       v                               value to display as an integer
+ * @param       range                   range about value to display (+/- range/2 each direction)
+ * @param       halign                  horizontal alignment: -1 = left, +1 = right.
+ * @param       x                       x displacement (typ. 0)
+ * @param       y                       y displacement (typ. half display height)
+ * @param       height                  height of scale
+ * @param       mintick_step                    how often a minor tick is shown
+ * @param       majtick_step                    how often a major tick is shown
+ * @param       mintick_len             minor tick length
+ * @param       majtick_len             major tick length
+ * @param       boundtick_len           boundary tick length
+ * @param       max_val                 maximum expected value (used to compute size of arrow ticker)
+ * @param       flags                   special flags (see hud.h.)
+ */
+void hud_draw_vertical_scale(int v, int range, int halign, int x, int y, int height, int mintick_step, int majtick_step, int mintick_len, int majtick_len,
+                             int boundtick_len, __attribute__((unused)) int max_val, int flags)
+{
+    char temp[15]; // , temp2[15];
+    struct FontEntry font_info;
+    struct FontDimensions dim;
+    // Halign should be in a small span.
+    // MY_ASSERT(halign >= -1 && halign <= 1);
+    // Compute the position of the elements.
+    int majtick_start = 0, majtick_end = 0, mintick_start = 0, mintick_end = 0, boundtick_start = 0, boundtick_end = 0;
+
+    if (halign == -1) {
+        majtick_start   = x;
+        majtick_end     = x + majtick_len;
+        mintick_start   = x;
+        mintick_end     = x + mintick_len;
+        boundtick_start = x;
+        boundtick_end   = x + boundtick_len;
+    } else if (halign == +1) {
+        x = x - GRAPHICS_HDEADBAND;
+        majtick_start   = GRAPHICS_WIDTH_REAL - x - 1;
+        majtick_end     = GRAPHICS_WIDTH_REAL - x - majtick_len - 1;
+        mintick_start   = GRAPHICS_WIDTH_REAL - x - 1;
+        mintick_end     = GRAPHICS_WIDTH_REAL - x - mintick_len - 1;
+        boundtick_start = GRAPHICS_WIDTH_REAL - x - 1;
+        boundtick_end   = GRAPHICS_WIDTH_REAL - x - boundtick_len - 1;
+    }
+    // Retrieve width of large font (font #0); from this calculate the x spacing.
+    fetch_font_info(0, 0, &font_info, NULL);
+    int arrow_len      = (font_info.height / 2) + 1;             // FIXME, font info being loaded correctly??
+    int text_x_spacing = arrow_len;
+    int max_text_y     = 0, text_length = 0;
+    int small_font_char_width = font_info.width + 1; // +1 for horizontal spacing = 1
+    // For -(range / 2) to +(range / 2), draw the scale.
+    int range_2 = range / 2; // , height_2 = height / 2;
+    int r = 0, rr = 0, rv = 0, ys = 0, style = 0; // calc_ys = 0,
+    // Iterate through each step.
+    for (r = -range_2; r <= +range_2; r++) {
+        style = 0;
+        rr    = r + range_2 - v; // normalise range for modulo, subtract value to move ticker tape
+        rv    = -rr + range_2; // for number display
+        if (flags & HUD_VSCALE_FLAG_NO_NEGATIVE) {
+            rr += majtick_step / 2;
+        }
+        if (rr % majtick_step == 0) {
+            style = 1; // major tick
+        } else if (rr % mintick_step == 0) {
+            style = 2; // minor tick
+        } else {
+            style = 0;
+        }
+        if (flags & HUD_VSCALE_FLAG_NO_NEGATIVE && rv < 0) {
+            continue;
+        }
+        if (style) {
+            // Calculate y position.
+            ys = ((long int)(r * height) / (long int)range) + y;
+            // sprintf(temp, "ys=%d", ys);
+            // con_puts(temp, 0);
+            // Depending on style, draw a minor or a major tick.
+            if (style == 1) {
+                write_hline_outlined(majtick_start, majtick_end, ys, 2, 2, 0, 1);
+                memset(temp, ' ', 10);
+                // my_itoa(rv, temp);
+                sprintf(temp, "%d", rv);
+                text_length = (strlen(temp) + 1) * small_font_char_width; // add 1 for margin
+                if (text_length > max_text_y) {
+                    max_text_y = text_length;
+                }
+                if (halign == -1) {
+                    write_string(temp, majtick_end + text_x_spacing, ys, 1, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, 1);
+                } else {
+                    write_string(temp, majtick_end - text_x_spacing + 1, ys, 1, 0, TEXT_VA_MIDDLE, TEXT_HA_RIGHT, 0, 1);
+                }
+            } else if (style == 2) {
+                write_hline_outlined(mintick_start, mintick_end, ys, 2, 2, 0, 1);
+            }
+        }
+    }
+    // Generate the string for the value, as well as calculating its dimensions.
+    memset(temp, ' ', 10);
+    // my_itoa(v, temp);
+    sprintf(temp, "%d", v);
+    // TODO: add auto-sizing.
+    calc_text_dimensions(temp, font_info, 1, 0, &dim);
+    int xx = 0, i = 0;
+    if (halign == -1) {
+        xx = majtick_end + text_x_spacing;
+    } else {
+        xx = majtick_end - text_x_spacing;
+    }
+    // Draw an arrow from the number to the point.
+    for (i = 0; i < arrow_len; i++) {
+        if (halign == -1) {
+            write_pixel_lm(xx - arrow_len + i, y - i - 1, 1, 1);
+            write_pixel_lm(xx - arrow_len + i, y + i - 1, 1, 1);
+            write_hline_lm(xx + dim.width - 1, xx - arrow_len + i + 1, y - i - 1, 0, 1);
+            write_hline_lm(xx + dim.width - 1, xx - arrow_len + i + 1, y + i - 1, 0, 1);
+        } else {
+            write_pixel_lm(xx + arrow_len - i, y - i - 1, 1, 1);
+            write_pixel_lm(xx + arrow_len - i, y + i - 1, 1, 1);
+            write_hline_lm(xx - dim.width - 1, xx + arrow_len - i - 1, y - i - 1, 0, 1);
+            write_hline_lm(xx - dim.width - 1, xx + arrow_len - i - 1, y + i - 1, 0, 1);
+        }
+        // FIXME
+        // write_hline_lm(xx - dim.width - 1, xx + (arrow_len - i), y - i - 1, 1, 1);
+        // write_hline_lm(xx - dim.width - 1, xx + (arrow_len - i), y + i - 1, 1, 1);
+    }
+    if (halign == -1) {
+        write_hline_lm(xx, xx + dim.width - 1, y - arrow_len, 1, 1);
+        write_hline_lm(xx, xx + dim.width - 1, y + arrow_len - 2, 1, 1);
+        write_vline_lm(xx + dim.width - 1, y - arrow_len, y + arrow_len - 2, 1, 1);
+    } else {
+        write_hline_lm(xx, xx - dim.width - 1, y - arrow_len, 1, 1);
+        write_hline_lm(xx, xx - dim.width - 1, y + arrow_len - 2, 1, 1);
+        write_vline_lm(xx - dim.width - 1, y - arrow_len, y + arrow_len - 2, 1, 1);
+    }
+    // Draw the text.
+    if (halign == -1) {
+        write_string(temp, xx, y, 1, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, 0);
+    } else {
+        write_string(temp, xx, y, 1, 0, TEXT_VA_MIDDLE, TEXT_HA_RIGHT, 0, 0);
+    }
+    // Then, add a slow cut off on the edges, so the text doesn't sharply
+    // disappear. We simply clear the areas above and below the ticker, and we
+    // use little markers on the edges.
+    if (halign == -1) {
+        write_filled_rectangle_lm(majtick_end + text_x_spacing, y + (height / 2) - (font_info.height / 2), max_text_y - boundtick_start, font_info.height, 0,
+                                  0);
+        write_filled_rectangle_lm(majtick_end + text_x_spacing, y - (height / 2) - (font_info.height / 2), max_text_y - boundtick_start, font_info.height, 0,
+                                  0);
+    } else {
+        write_filled_rectangle_lm(majtick_end - text_x_spacing - max_text_y, y + (height / 2) - (font_info.height / 2), max_text_y, font_info.height, 0, 0);
+        write_filled_rectangle_lm(majtick_end - text_x_spacing - max_text_y, y - (height / 2) - (font_info.height / 2), max_text_y, font_info.height, 0, 0);
+    }
+    write_hline_outlined(boundtick_start, boundtick_end, y + (height / 2), 2, 2, 0, 1);
+    write_hline_outlined(boundtick_start, boundtick_end, y - (height / 2), 2, 2, 0, 1);
+}
+
+/**
+ * hud_draw_compass: Draw a compass.
+ *
+ * @param       v                               value for the compass
+ * @param       range                   range about value to display (+/- range/2 each direction)
+ * @param       width                   length in pixels
+ * @param       x                               x displacement (typ. half display width)
+ * @param       y                               y displacement (typ. bottom of display)
+ * @param       mintick_step    how often a minor tick is shown
+ * @param       majtick_step    how often a major tick (heading "xx") is shown
+ * @param       mintick_len             minor tick length
+ * @param       majtick_len             major tick length
+ * @param       flags                   special flags (see hud.h.)
+ */
+void hud_draw_linear_compass(int v, int range, int width, int x, int y, int mintick_step, int majtick_step, int mintick_len, int majtick_len, __attribute__((unused)) int flags)
+{
+    v %= 360; // wrap, just in case.
+    struct FontEntry font_info;
+    int majtick_start = 0, majtick_end = 0, mintick_start = 0, mintick_end = 0, textoffset = 0;
+    char headingstr[4];
+    majtick_start = y;
+    majtick_end   = y - majtick_len;
+    mintick_start = y;
+    mintick_end   = y - mintick_len;
+    textoffset    = 8;
+    int r, style, rr, xs; // rv,
+    int range_2 = range / 2;
+    for (r = -range_2; r <= +range_2; r++) {
+        style = 0;
+        rr    = (v + r + 360) % 360; // normalise range for modulo, add to move compass track
+        // rv = -rr + range_2; // for number display
+        if (rr % majtick_step == 0) {
+            style = 1; // major tick
+        } else if (rr % mintick_step == 0) {
+            style = 2; // minor tick
+        }
+        if (style) {
+            // Calculate x position.
+            xs = ((long int)(r * width) / (long int)range) + x;
+            // Draw it.
+            if (style == 1) {
+                write_vline_outlined(xs, majtick_start, majtick_end, 2, 2, 0, 1);
+                // Draw heading above this tick.
+                // If it's not one of north, south, east, west, draw the heading.
+                // Otherwise, draw one of the identifiers.
+                if (rr % 90 != 0) {
+                    // We abbreviate heading to two digits. This has the side effect of being easy to compute.
+                    headingstr[0] = '0' + (rr / 100);
+                    headingstr[1] = '0' + ((rr / 10) % 10);
+                    headingstr[2] = 0;
+                    headingstr[3] = 0; // nul to terminate
+                } else {
+                    switch (rr) {
+                    case 0:
+                        headingstr[0] = 'N';
+                        break;
+                    case 90:
+                        headingstr[0] = 'E';
+                        break;
+                    case 180:
+                        headingstr[0] = 'S';
+                        break;
+                    case 270:
+                        headingstr[0] = 'W';
+                        break;
+                    }
+                    headingstr[1] = 0;
+                    headingstr[2] = 0;
+                    headingstr[3] = 0;
+                }
+                // +1 fudge...!
+                write_string(headingstr, xs + 1, majtick_start + textoffset, 1, 0, TEXT_VA_MIDDLE, TEXT_HA_CENTER, 0, 1);
+            } else if (style == 2) {
+                write_vline_outlined(xs, mintick_start, mintick_end, 2, 2, 0, 1);
+            }
+        }
+    }
+    // Then, draw a rectangle with the present heading in it.
+    // We want to cover up any other markers on the bottom.
+    // First compute font size.
+    fetch_font_info(0, 3, &font_info, NULL);
+    int text_width = (font_info.width + 1) * 3;
+    int rect_width = text_width + 2;
+    write_filled_rectangle_lm(x - (rect_width / 2), majtick_start + 2, rect_width, font_info.height + 2, 0, 1);
+    write_rectangle_outlined(x - (rect_width / 2), majtick_start + 2, rect_width, font_info.height + 2, 0, 1);
+    headingstr[0] = '0' + (v / 100);
+    headingstr[1] = '0' + ((v / 10) % 10);
+    headingstr[2] = '0' + (v % 10);
+    headingstr[3] = 0;
+    write_string(headingstr, x + 1, majtick_start + textoffset + 2, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_CENTER, 1, 3);
+}
+// CORE draw routines end here
+
+void draw_artificial_horizon(float angle, float pitch, int16_t l_x, int16_t l_y, int16_t size)
+{
+    float alpha;
+    uint8_t vertical = 0, horizontal = 0;
+    int16_t x1, x2;
+    int16_t y1, y2;
+    int16_t refx, refy;
+
+    alpha = DEG2RAD(angle);
+    refx  = l_x + size / 2;
+    refy  = l_y + size / 2;
+
+    //
+    float k    = 0;
+    float dx   = sinf(alpha) * (pitch / 90.0f * (size / 2));
+    float dy   = cosf(alpha) * (pitch / 90.0f * (size / 2));
+    int16_t x0 = (size / 2) - dx;
+    int16_t y0 = (size / 2) + dy;
+    // calculate the line function
+    if ((angle < 90.0f) && (angle > -90)) {
+        vertical = 0;
+        if (fabsf(angle) < 1e-5f) {
+            horizontal = 1;
+        } else {
+            k = tanf(alpha);
+        }
+    } else {
+        vertical = 1;
+    }
+
+    // crossing point of line
+    if (!vertical && !horizontal) {
+        // y-y0=k(x-x0)
+        int16_t x = 0;
+        int16_t y = k * (x - x0) + y0;
+        // find right crossing point
+        x1 = x;
+        y1 = y;
+        if (y < 0) {
+            y1 = 0;
+            x1 = ((y1 - y0) + k * x0) / k;
+        }
+        if (y > size) {
+            y1 = size;
+            x1 = ((y1 - y0) + k * x0) / k;
+        }
+        // left crossing point
+        x  = size;
+        y  = k * (x - x0) + y0;
+        x2 = x;
+        y2 = y;
+        if (y < 0) {
+            y2 = 0;
+            x2 = ((y2 - y0) + k * x0) / k;
+        }
+        if (y > size) {
+            y2 = size;
+            x2 = ((y2 - y0) + k * x0) / k;
+        }
+        // move to location
+        // horizon line
+        write_line_outlined(x1 + l_x, y1 + l_y, x2 + l_x, y2 + l_y, 0, 0, 0, 1);
+        // fill
+        if (angle <= 0.0f && angle > -90.0f) {
+            // write_string("1", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = y2; i < size; i++) {
+                x2 = ((i - y0) + k * x0) / k;
+                if (x2 > size) {
+                    x2 = size;
+                }
+                if (x2 < 0) {
+                    x2 = 0;
+                }
+                write_hline_lm(x2 + l_x, size + l_x, i + l_y, 1, 1);
+            }
+        } else if (angle < -90.0f) {
+            // write_string("2", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = 0; i < y2; i++) {
+                x2 = ((i - y0) + k * x0) / k;
+                if (x2 > size) {
+                    x2 = size;
+                }
+                if (x2 < 0) {
+                    x2 = 0;
+                }
+                write_hline_lm(size + l_x, x2 + l_x, i + l_y, 1, 1);
+            }
+        } else if (angle > 0.0f && angle < 90.0f) {
+            // write_string("3", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = y1; i < size; i++) {
+                x2 = ((i - y0) + k * x0) / k;
+                if (x2 > size) {
+                    x2 = size;
+                }
+                if (x2 < 0) {
+                    x2 = 0;
+                }
+                write_hline_lm(0 + l_x, x2 + l_x, i + l_y, 1, 1);
+            }
+        } else if (angle > 90.0f) {
+            // write_string("4", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = 0; i < y1; i++) {
+                x2 = ((i - y0) + k * x0) / k;
+                if (x2 > size) {
+                    x2 = size;
+                }
+                if (x2 < 0) {
+                    x2 = 0;
+                }
+                write_hline_lm(x2 + l_x, 0 + l_x, i + l_y, 1, 1);
+            }
+        }
+    } else if (vertical) {
+        // horizon line
+        write_line_outlined(x0 + l_x, 0 + l_y, x0 + l_x, size + l_y, 0, 0, 0, 1);
+        if (angle >= 90.0f) {
+            // write_string("5", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = 0; i < size; i++) {
+                write_hline_lm(0 + l_x, x0 + l_x, i + l_y, 1, 1);
+            }
+        } else {
+            // write_string("6", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = 0; i < size; i++) {
+                write_hline_lm(size + l_x, x0 + l_x, i + l_y, 1, 1);
+            }
+        }
+    } else if (horizontal) {
+        // horizon line
+        write_hline_outlined(0 + l_x, size + l_x, y0 + l_y, 0, 0, 0, 1);
+        if (angle < 0) {
+            // write_string("7", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = 0; i < y0; i++) {
+                write_hline_lm(0 + l_x, size + l_x, i + l_y, 1, 1);
+            }
+        } else {
+            // write_string("8", APPLY_HDEADBAND((GRAPHICS_RIGHT/2)),APPLY_VDEADBAND(GRAPHICS_BOTTOM-10), 0, 0, TEXT_VA_BOTTOM, TEXT_HA_CENTER, 0, 3);
+            for (int i = y0; i < size; i++) {
+                write_hline_lm(0 + l_x, size + l_x, i + l_y, 1, 1);
+            }
+        }
+    }
+
+    // sides
+    write_line_outlined(l_x, l_y, l_x, l_y + size, 0, 0, 0, 1);
+    write_line_outlined(l_x + size, l_y, l_x + size, l_y + size, 0, 0, 0, 1);
+    // plane
+    write_line_outlined(refx - 5, refy, refx + 6, refy, 0, 0, 0, 1);
+    write_line_outlined(refx, refy, refx, refy - 3, 0, 0, 0, 1);
+}
+
+
+/*
+ * Dirty region rendering
+ *
+ * Each draw buffer is drawn every other frame. For each buffer the
+ * renderer remembers which widgets it shows as they look now (the current
+ * bits of the widgets) and what each of them covers. A frame clears what
+ * the widgets that look different covered, then draws, in list order,
+ * those widgets plus every widget that overlaps something cleared or
+ * drawn before it. A widget drawn again over itself does not change, and
+ * a later widget drawn over an earlier one is what a full redraw does too,
+ * so the buffer ends up as if it had been cleared and drawn from scratch.
+ */
+
+// What was cleared or drawn this frame, more rects are merged into the last one
+#define DAMAGE_RECTS 16
+struct damage {
+    struct osd_rect rect[DAMAGE_RECTS];
+    uint8_t count;
+};
+
+static uint8_t *slotBuffer[OSD_DRAW_BUFFERS];
+static struct osd_widget *const *slotWidgets[OSD_DRAW_BUFFERS];
+static uint8_t stale = (1 << OSD_DRAW_BUFFERS) - 1;
+
+static inline bool rect_empty(const struct osd_rect *rect)
+{
+    return rect->right < rect->left;
+}
+
+static inline bool rect_overlaps(const struct osd_rect *a, const struct osd_rect *b)
+{
+    return a->left <= b->right && b->left <= a->right && a->top <= b->bottom && b->top <= a->bottom;
+}
+
+static void damage_add(struct damage *damage, const struct osd_rect *rect)
+{
+    if (rect_empty(rect)) {
+        return;
+    }
+    if (damage->count < DAMAGE_RECTS) {
+        damage->rect[damage->count++] = *rect;
+        return;
+    }
+    struct osd_rect *last = &damage->rect[DAMAGE_RECTS - 1];
+    last->left   = MIN(last->left, rect->left);
+    last->top    = MIN(last->top, rect->top);
+    last->right  = MAX(last->right, rect->right);
+    last->bottom = MAX(last->bottom, rect->bottom);
+}
+
+static bool damage_overlaps(const struct damage *damage, const struct osd_rect *rect)
+{
+    if (rect_empty(rect)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < damage->count; i++) {
+        if (rect_overlaps(&damage->rect[i], rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Which of the draw buffers is drawn now
+static uint8_t draw_slot(void)
+{
+    uint8_t slot;
+
+    for (slot = 0; slot < OSD_DRAW_BUFFERS; slot++) {
+        if (slotBuffer[slot] == draw_buffer_level) {
+            return slot;
+        }
+    }
+    for (slot = 0; slot < OSD_DRAW_BUFFERS; slot++) {
+        if (slotBuffer[slot] == NULL) {
+            slotBuffer[slot] = draw_buffer_level;
+            return slot;
+        }
+    }
+    // Different buffers, start over
+    memset(slotBuffer, 0, sizeof(slotBuffer));
+    osd_render_invalidate();
+    slotBuffer[0] = draw_buffer_level;
+    return 0;
+}
+
+/**
+ * osd_render_frame: bring the draw buffer up to date with a screen.
+ *
+ * @param       widgets the widgets of the screen, bottom first
+ * @param       count   number of widgets
+ * @param       changed bits of the widget sources that changed since the last frame
+ * @param       stats   what was done, may be NULL
+ */
+void osd_render_frame(struct osd_widget *const *widgets, uint8_t count, uint32_t changed, struct osd_render_stats *stats)
+{
+    struct osd_render_stats done = { 0, 0, 0 };
+    struct damage damage;
+    uint8_t slot = draw_slot();
+    uint8_t bit  = 1 << slot;
+    uint8_t i;
+
+    damage.count = 0;
+
+    // Start from a clear buffer when it showed something else
+    if ((stale & bit) || slotWidgets[slot] != widgets) {
+        memset(draw_buffer_level, 0, GRAPHICS_WIDTH * GRAPHICS_HEIGHT);
+        memset(draw_buffer_mask, 0, GRAPHICS_WIDTH * GRAPHICS_HEIGHT);
+        done.cleared += GRAPHICS_WIDTH_REAL * GRAPHICS_HEIGHT_REAL;
+        for (i = 0; i < count; i++) {
+            widgets[i]->current     &= ~bit;
+            widgets[i]->bounds[slot] = EMPTY_RECT;
+        }
+        slotWidgets[slot] = widgets;
+        stale &= ~bit;
+    }
+
+    // Find the widgets that look different and clear what they covered
+    for (i = 0; i < count; i++) {
+        struct osd_widget *widget = widgets[i];
+        bool different;
+        if (!widget->update) {
+            different = (widget->sources & changed) != 0;
+        } else if ((widget->sources & changed) || !(widget->current & bit)) {
+            // A widget that is drawn anyway reads its sources, they may have
+            // changed while it was not on screen.
+            different = widget->update(widget);
+        } else {
+            different = false;
+        }
+        if (different) {
+            widget->current = 0;
+            done.updated++;
+        }
+        widget->redraw = !(widget->current & bit);
+        if (widget->redraw && !rect_empty(&widget->bounds[slot])) {
+            const struct osd_rect *rect = &widget->bounds[slot];
+            struct pen clear = { draw_buffer_level, draw_buffer_mask, 0, 0 };
+            rectangle(&clear, rect->left, rect->top, rect->right - rect->left + 1, rect->bottom - rect->top + 1);
+            done.cleared += (rect->right - rect->left + 1) * (rect->bottom - rect->top + 1);
+            damage_add(&damage, rect);
+        }
+    }
+
+    // Draw them, and restore the others where they were cleared or drawn
+    // over. Widgets are drawn in list order, so each is drawn over the ones
+    // before it.
+    for (i = 0; i < count; i++) {
+        struct osd_widget *widget = widgets[i];
+        struct osd_rect *bounds   = &widget->bounds[slot];
+        if (widget->redraw) {
+            *bounds = EMPTY_RECT;
+            drawn   = bounds;
+            widget->draw(widget);
+            drawn   = NULL;
+            widget->current |= bit;
+            done.drawn++;
+            damage_add(&damage, bounds);
+        } else if (damage_overlaps(&damage, bounds)) {
+            // The widget draws what it drew before, only the pixels in the
+            // damage are drawn so that the damage does not grow.
+            for (uint8_t d = 0; d < damage.count; d++) {
+                if (rect_overlaps(&damage.rect[d], bounds)) {
+                    clip.left   = MAX(damage.rect[d].left, bounds->left);
+                    clip.top    = MAX(damage.rect[d].top, bounds->top);
+                    clip.right  = MIN(damage.rect[d].right, bounds->right);
+                    clip.bottom = MIN(damage.rect[d].bottom, bounds->bottom);
+                    widget->draw(widget);
+                }
+            }
+            clip = SCREEN_RECT;
+            done.drawn++;
+        }
+    }
+
+    if (stats) {
+        *stats = done;
+    }
+}
+
+/**
+ * osd_render_invalidate: clear and draw everything on the next frame of
+ * each draw buffer, after something else drew to them.
+ */
+void osd_render_invalidate(void)
+{
+    stale = (1 << OSD_DRAW_BUFFERS) - 1;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -234,8 +234,8 @@ uint8_t GroundDriveController::updateGroundDesiredAttitude()
 
     // Get current vehicle orientation
     float angle_radians  = DEG2RAD(attitudeState.Yaw); // (+-pi)
-    float cos_angle      = cosf(angle_radians);
-    float sine_angle     = sinf(angle_radians);
+    float cos_angle, sine_angle;
+    sincos_lookup_rad(angle_radians, &sine_angle, &cos_angle);
 
     float courseCommand  = 0.0f;
     float speedCommand   = 0.0f;
@@ -292,8 +292,8 @@ int8_t VtolAutoTakeoffController::UpdateStabilizationDesired()
     }
 
     float angle_radians = DEG2RAD(attitudeState.Yaw);
-    float cos_angle     = cosf(angle_radians);
-    float sine_angle    = sinf(angle_radians);
+    float cos_angle, sine_angle;
+    sincos_lookup_rad(angle_radians, &sine_angle, &cos_angle);
     float maxPitch = vtolPathFollowerSettings->MaxRollPitch;
     stabDesired.StabilizationMode.Pitch = STABILIZATIONDESIRED_STABILIZATIONMODE_ATTITUDE;
     stabDesired.Pitch = boundf(-northCommand * cos_angle - eastCommand * sine_angle, -maxPitch, maxPitch);
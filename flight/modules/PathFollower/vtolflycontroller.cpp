@@ -233,8 +233,8 @@ int8_t VtolFlyController::UpdateStabilizationDesired(bool yaw_attitude, float ya
     controlNE.GetNECommand(&northCommand, &eastCommand);
 
     float angle_radians = DEG2RAD(attitudeState.Yaw);
-    float cos_angle     = cosf(angle_radians);
-    float sine_angle    = sinf(angle_radians);
+    float cos_angle, sine_angle;
+    sincos_lookup_rad(angle_radians, &sine_angle, &cos_angle);
     float maxPitch = vtolPathFollowerSettings->MaxRollPitch;
     stabDesired.StabilizationMode.Pitch = STABILIZATIONDESIRED_STABILIZATIONMODE_ATTITUDE;
     stabDesired.Pitch = boundf(-northCommand * cos_angle - eastCommand * sine_angle, -maxPitch, maxPitch); // this should be in the controller
@@ -316,7 +316,7 @@ void VtolFlyController::UpdateDesiredAttitudeEmergencyFallback()
     ManualControlCommandData manualControlData;
     ManualControlCommandGet(&manualControlData);
 
-    courseError = RAD2DEG(atan2f(velocityDesired.East, velocityDesired.North) - atan2f(velocityState.East, velocityState.North));
+    courseError = RAD2DEG(atan2_approx(velocityDesired.East, velocityDesired.North) - atan2_approx(velocityState.East, velocityState.North));
 
     if (courseError < -180.0f) {
         courseError += 360.0f;
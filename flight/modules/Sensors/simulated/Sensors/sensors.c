@@ -127,7 +127,7 @@ int32_t SensorsInitialize(void)
 int32_t SensorsStart(void)
 {
     // Start main task
-    xTaskCreate(SensorsTask, (signed char *)"Sensors", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &sensorsTaskHandle);
+    xTaskCreate(SensorsTask, (const char *)"Sensors", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &sensorsTaskHandle);
     PIOS_TASK_MONITOR_RegisterTask(TASKINFO_RUNNING_SENSORS, sensorsTaskHandle);
     PIOS_WDG_RegisterFlag(PIOS_WDG_SENSORS);
 
@@ -142,8 +142,6 @@ MODULE_INITCALL(SensorsInitialize, SensorsStart);
 int sensors_count;
 static void SensorsTask(__attribute__((unused)) void *parameters)
 {
-    portTickType lastSysTime;
-
     AlarmsClear(SYSTEMALARMS_ALARM_SENSORS);
 
 // HomeLocationData homeLocation;
@@ -159,8 +157,6 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
 
 
     // Main task loop
-    lastSysTime = xTaskGetTickCount();
-    uint32_t last_time = PIOS_DELAY_GetRaw();
     while (1) {
         PIOS_WDG_UpdateFlag(PIOS_WDG_SENSORS);
 
@@ -184,14 +180,6 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
             sensor_sim_type = MODEL_AGNOSTIC;
         }
 
-        static int i;
-        i++;
-        if (i % 5000 == 0) {
-            // float dT = PIOS_DELAY_DiffuS(last_time) / 10.0e6;
-            // fprintf(stderr, "Sensor relative timing: %f\n", dT);
-            last_time = PIOS_DELAY_GetRaw();
-        }
-
         sensors_count++;
 
         switch (sensor_sim_type) {
@@ -354,7 +342,7 @@ static void simulateModelQuadcopter()
     ActuatorDesiredData actuatorDesired;
     ActuatorDesiredGet(&actuatorDesired);
 
-    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Throttle * MAX_THRUST : 0;
+    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Thrust * MAX_THRUST : 0;
     if (thrust < 0) {
         thrust = 0;
     }
@@ -543,13 +531,17 @@ static void simulateModelQuadcopter()
     attitudeSimulated.q2 = q[1];
     attitudeSimulated.q3 = q[2];
     attitudeSimulated.q4 = q[3];
-    Quaternion2RPY(q, &attitudeSimulated.Roll);
-    attitudeSimulated.Position[0] = pos[0];
-    attitudeSimulated.Position[1] = pos[1];
-    attitudeSimulated.Position[2] = pos[2];
-    attitudeSimulated.Velocity[0] = vel[0];
-    attitudeSimulated.Velocity[1] = vel[1];
-    attitudeSimulated.Velocity[2] = vel[2];
+    float attitudeRPY[3];
+    Quaternion2RPY(q, attitudeRPY);
+    attitudeSimulated.Roll  = attitudeRPY[0];
+    attitudeSimulated.Pitch = attitudeRPY[1];
+    attitudeSimulated.Yaw   = attitudeRPY[2];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[0] = pos[0];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[1] = pos[1];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[2] = pos[2];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[0] = vel[0];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[1] = vel[1];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[2] = vel[2];
     AttitudeSimulatedSet(&attitudeSimulated);
 }
 
@@ -597,7 +589,7 @@ static void simulateModelAirplane()
     ActuatorDesiredData actuatorDesired;
     ActuatorDesiredGet(&actuatorDesired);
 
-    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Throttle * MAX_THRUST : 0;
+    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Thrust * MAX_THRUST : 0;
     if (thrust < 0) {
         thrust = 0;
     }
@@ -825,13 +817,17 @@ static void simulateModelAirplane()
     attitudeSimulated.q2 = q[1];
     attitudeSimulated.q3 = q[2];
     attitudeSimulated.q4 = q[3];
-    Quaternion2RPY(q, &attitudeSimulated.Roll);
-    attitudeSimulated.Position[0] = pos[0];
-    attitudeSimulated.Position[1] = pos[1];
-    attitudeSimulated.Position[2] = pos[2];
-    attitudeSimulated.Velocity[0] = vel[0];
-    attitudeSimulated.Velocity[1] = vel[1];
-    attitudeSimulated.Velocity[2] = vel[2];
+    float attitudeRPY[3];
+    Quaternion2RPY(q, attitudeRPY);
+    attitudeSimulated.Roll  = attitudeRPY[0];
+    attitudeSimulated.Pitch = attitudeRPY[1];
+    attitudeSimulated.Yaw   = attitudeRPY[2];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[0] = pos[0];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[1] = pos[1];
+    AttitudeSimulatedPositionToArray(attitudeSimulated.Position)[2] = pos[2];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[0] = vel[0];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[1] = vel[1];
+    AttitudeSimulatedVelocityToArray(attitudeSimulated.Velocity)[2] = vel[2];
     AttitudeSimulatedSet(&attitudeSimulated);
 }
 
@@ -244,6 +244,10 @@ static void stabilizationInnerloopTask()
         }
         stabSettings.monitor.gyroupdates = 0;
 
+        if (warn || error || crit) {
+            // a deadline was missed, keep the events that led to it
+            PIOS_EVENTTRACE_TRIGGER(SYSTEMALARMS_ALARM_STABILIZATION);
+        }
         if (crit) {
             AlarmsSet(SYSTEMALARMS_ALARM_STABILIZATION, SYSTEMALARMS_ALARM_CRITICAL);
         } else if (error) {
@@ -69,6 +69,11 @@
 #include <pios_instrumentation.h>
 #endif
 
+#ifdef PIOS_INCLUDE_EVENTTRACE
+#include <eventtrace.h>
+#include <eventtracesettings.h>
+#endif
+
 #if defined(PIOS_INCLUDE_RFM22B)
 #include <oplinkstatus.h>
 #endif
@@ -87,6 +92,10 @@
 
 // Private constants
 #define SYSTEM_UPDATE_PERIOD_MS 250
+#define LATENCY_REPORT_PERIOD_MS 30000
+#define EVENTTRACE_PERIOD_MS    10
+#define EVENTTRACE_BACKLOG_MS   2 // between telemetry chunks while events are waiting
+#define EVENTTRACE_MAX_CHUNKS   4 // per run to the debug log
 
 #if defined(PIOS_SYSTEM_STACK_SIZE)
 #define STACK_SIZE_BYTES        PIOS_SYSTEM_STACK_SIZE
@@ -105,6 +114,9 @@ static enum { STACKOVERFLOW_NONE = 0, STACKOVERFLOW_WARNING = 1, STACKOVERFLOW_C
 static bool mallocFailed;
 static HwSettingsData bootHwSettings;
 static FrameType_t bootFrameType;
+#ifdef PIOS_INCLUDE_EVENTTRACE
+static DelayedCallbackInfo *eventTraceCallback;
+#endif
 
 volatile int initTaskDone = 0;
 
@@ -114,6 +126,9 @@ static void checkSettingsUpdatedCb(UAVObjEvent *ev);
 #ifdef DIAG_TASKS
 static void taskMonitorForEachCallback(uint16_t task_id, const struct pios_task_info *task_info, void *context);
 static void callbackSchedulerForEachCallback(int16_t callback_id, const struct pios_callback_info *callback_info, void *context);
+#ifdef DIAG_CALLBACK_LATENCY
+static void callbackLatencyReport(int16_t callback_id, const struct pios_callback_info *callback_info, void *context);
+#endif
 #endif
 static void updateStats();
 static void updateSystemAlarms();
@@ -122,6 +137,10 @@ static void updateI2Cstats();
 #ifdef DIAG_I2C_WDG_STATS
 static void updateWDGstats();
 #endif
+#ifdef PIOS_INCLUDE_EVENTTRACE
+static void eventTraceSettingsUpdatedCb(UAVObjEvent *ev);
+static void eventTraceTask();
+#endif
 
 #ifdef PIOS_INCLUDE_I2C
 #define I2C_ERROR_ACTIVITY_TIMEOUT_SECONDS 2
@@ -171,6 +190,12 @@ int32_t SystemModInitialize(void)
     InstrumentationInit();
 #endif
 
+#ifdef PIOS_INCLUDE_EVENTTRACE
+    EventTraceInitialize();
+    EventTraceSettingsInitialize();
+    PIOS_EVENTTRACE_Init();
+#endif
+
     objectPersistenceQueue = xQueueCreate(1, sizeof(UAVObjEvent));
     if (objectPersistenceQueue == NULL) {
         return -1;
@@ -204,6 +229,11 @@ static void systemTask(__attribute__((unused)) void *parameters)
     /* create all modules thread */
     MODULE_TASKCREATE_ALL;
 
+#ifdef PIOS_INCLUDE_EVENTTRACE
+    // before the callback scheduler starts, which creates the task it runs in
+    eventTraceCallback = PIOS_CALLBACKSCHEDULER_Create(&eventTraceTask, CALLBACK_PRIORITY_LOW, CALLBACK_TASK_AUXILIARY, -1, STACK_SIZE_BYTES);
+#endif
+
     /* start the delayed callback scheduler */
     PIOS_CALLBACKSCHEDULER_Start();
 
@@ -231,6 +261,11 @@ static void systemTask(__attribute__((unused)) void *parameters)
     HwSettingsConnectCallback(checkSettingsUpdatedCb);
     SystemSettingsConnectCallback(checkSettingsUpdatedCb);
 
+#ifdef PIOS_INCLUDE_EVENTTRACE
+    EventTraceSettingsConnectCallback(eventTraceSettingsUpdatedCb);
+    PIOS_CALLBACKSCHEDULER_Dispatch(eventTraceCallback);
+#endif
+
 #ifdef DIAG_TASKS
     TaskInfoData taskInfoData;
     CallbackInfoData callbackInfoData;
@@ -263,6 +298,14 @@ static void systemTask(__attribute__((unused)) void *parameters)
         PIOS_CALLBACKSCHEDULER_ForEachCallback(callbackSchedulerForEachCallback, &callbackInfoData);
         CallbackInfoSet(&callbackInfoData);
 // }
+#ifdef DIAG_CALLBACK_LATENCY
+        static uint16_t latencyReportCount = 0;
+        if (++latencyReportCount >= LATENCY_REPORT_PERIOD_MS / SYSTEM_UPDATE_PERIOD_MS) {
+            latencyReportCount = 0;
+            printf("Callback latencies, runs per bucket 0us 1us 2us 4us ... %dus:\n", 1 << (PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS - 2));
+            PIOS_CALLBACKSCHEDULER_ForEachCallback(callbackLatencyReport, NULL);
+        }
+#endif
 #endif
 // }
 
@@ -486,8 +529,97 @@ static void callbackSchedulerForEachCallback(int16_t callback_id, const struct p
     ((uint32_t *)&callbackData->RunningTime)[callback_id]   = callback_info->running_time_count;
     ((int16_t *)&callbackData->StackRemaining)[callback_id] = callback_info->stack_remaining;
 }
+
+#ifdef DIAG_CALLBACK_LATENCY
+static void callbackLatencyReport(int16_t callback_id, const struct pios_callback_info *callback_info, __attribute__((unused)) void *context)
+{
+    printf("  %3d:", callback_id);
+    for (uint8_t n = 0; n < PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS; n++) {
+        printf(" %u", (unsigned int)callback_info->latency_histogram[n]);
+    }
+    printf("\n");
+}
+#endif
 #endif /* ifdef DIAG_TASKS */
 
+#ifdef PIOS_INCLUDE_EVENTTRACE
+static void eventTraceSettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    PIOS_CALLBACKSCHEDULER_Dispatch(eventTraceCallback);
+}
+
+/**
+ * Sends the events recorded since the last run in EventTrace chunks, over
+ * telemetry or to the debug log. Runs every EVENTTRACE_PERIOD_MS while the
+ * trace is on, and when the settings change.
+ * Telemetry packs EventTrace when it sends it, so a single chunk goes out per
+ * run: the telemetry tasks run at a higher priority and have sent it by the
+ * next run, which comes after EVENTTRACE_BACKLOG_MS while events are waiting.
+ */
+static void eventTraceTask()
+{
+    static uint32_t next;
+    static uint32_t lost;
+    EventTraceSettingsData settings;
+
+    EventTraceSettingsGet(&settings);
+
+    enum pios_eventtrace_mode mode = PIOS_EVENTTRACE_MODE_OFF;
+    if (settings.Mode == EVENTTRACESETTINGS_MODE_CONTINUOUS) {
+        mode = PIOS_EVENTTRACE_MODE_CONTINUOUS;
+    } else if (settings.Mode == EVENTTRACESETTINGS_MODE_SNAPSHOT) {
+        mode = PIOS_EVENTTRACE_MODE_SNAPSHOT;
+    }
+    if (mode != PIOS_EVENTTRACE_GetMode()) {
+        PIOS_EVENTTRACE_SetMode(mode);
+        next = PIOS_EVENTTRACE_GetRecorded();
+        lost = 0;
+    }
+    if (mode == PIOS_EVENTTRACE_MODE_OFF) {
+        return;
+    }
+
+    EventTraceData trace;
+    struct pios_eventtrace_event events[EVENTTRACE_TIME_NUMELEM];
+    trace.TicksPerUs = 100000000.0f / PIOS_DELAY_DiffuS2(0, 100000000);
+
+    bool toDebugLog   = settings.Destination == EVENTTRACESETTINGS_DESTINATION_DEBUGLOG;
+    uint8_t maxChunks = toDebugLog ? EVENTTRACE_MAX_CHUNKS : 1;
+    uint16_t count    = 0;
+    for (uint8_t chunk = 0; chunk < maxChunks; chunk++) {
+        count = PIOS_EVENTTRACE_Read(&next, events, EVENTTRACE_TIME_NUMELEM, &lost);
+        if (count == 0) {
+            if (PIOS_EVENTTRACE_IsFrozen()) {
+                // the whole snapshot went out, wait for the next one
+                PIOS_EVENTTRACE_Rearm();
+            }
+            break;
+        }
+
+        trace.Sequence = next;
+        trace.Lost     = lost;
+        trace.Count    = count;
+        for (uint16_t i = 0; i < EVENTTRACE_TIME_NUMELEM; i++) {
+            bool used = i < count;
+            trace.Time[i] = used ? events[i].time : 0;
+            trace.Id[i]   = used ? events[i].id : 0;
+            trace.Aux[i]  = used ? events[i].aux : 0;
+            trace.Type[i] = used ? events[i].type : 0;
+        }
+
+        if (toDebugLog) {
+            PIOS_DEBUGLOG_UAVObject(EVENTTRACE_OBJID, 0, sizeof(trace), (uint8_t *)&trace);
+        } else {
+            EventTraceSet(&trace);
+            EventTraceUpdated();
+        }
+    }
+
+    // a full chunk means more events are probably waiting
+    PIOS_CALLBACKSCHEDULER_Schedule(eventTraceCallback, (count == EVENTTRACE_TIME_NUMELEM) ? EVENTTRACE_BACKLOG_MS : EVENTTRACE_PERIOD_MS, CALLBACK_UPDATEMODE_SOONER);
+}
+#endif /* PIOS_INCLUDE_EVENTTRACE */
+
 /**
  * Called periodically (every SYSTEM_UPDATE_PERIOD_MS milliseconds) to update the I2C statistics
  */
@@ -727,6 +859,10 @@ void vApplicationIdleHook(void)
 #ifdef PIOS_INCLUDE_WS2811
     LedNotificationExtLedsRun();
 #endif
+#if defined(ARCH_POSIX)
+    // simulated time advances here in lockstep mode
+    vPortLockstepIdle();
+#endif
 }
 /**
  * Called by the RTOS when a stack overflow is detected.
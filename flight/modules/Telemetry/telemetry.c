@@ -58,6 +58,18 @@
  * passes each event to the UAVTalk library which results in the appropriate
  * transmit routine being called to send the data back to the recipient on
  * the "local" or "radio" link.
+ *
+ * When TelemetryBatching is enabled in HwSettings, unacked periodic updates
+ * are packed into multi object packets which are sent once the queues have
+ * been emptied, saving the per packet overhead on slow links. Any other
+ * packet sent on the channel flushes them first, so that updates keep their
+ * order.
+ *
+ * When the GCS sets SettingsDump in GCSTelemetryStats on connection, all
+ * settings objects are streamed back-to-back on each channel once, so that
+ * the GCS does not have to request them one by one. The dump is closed by
+ * FlightTelemetryStats with SettingsDump set to Done and the number of
+ * settings objects sent in SettingsDumpCount.
  */
 
 #include <openpilot.h>
@@ -118,6 +130,15 @@ typedef struct {
     xTaskHandle rxTaskHandle;
     // Telemetry stream
     UAVTalkConnection uavTalkCon;
+    // Pack periodic updates in multi object packets
+    bool batchPeriodic;
+    // Settings have been streamed to the GCS on this connection
+    bool settingsDumped;
+    // Settings objects to stream, collected under the object manager lock
+    // and sent once it is released
+    UAVObjHandle *settingsObjs;
+    uint16_t settingsCount;
+    uint16_t settingsCollected;
 } channelContext;
 
 #ifdef HAS_RADIO
@@ -125,6 +146,7 @@ typedef struct {
 static channelContext localChannel;
 static int32_t transmitLocalData(uint8_t *data, int32_t length);
 static void registerLocalObject(UAVObjHandle obj);
+static void collectLocalSettingsObject(UAVObjHandle obj);
 static uint32_t localPort();
 #endif /* ifdef HAS_RADIO */
 
@@ -134,6 +156,7 @@ static void updateSettings(channelContext *channel);
 static channelContext radioChannel;
 static int32_t transmitRadioData(uint8_t *data, int32_t length);
 static void registerRadioObject(UAVObjHandle obj);
+static void collectRadioSettingsObject(UAVObjHandle obj);
 static uint32_t radioPort();
 static uint32_t radio_port;
 
@@ -161,7 +184,10 @@ static int32_t setLoggingPeriod(
     UAVObjHandle obj,
     int32_t updatePeriodMs);
 static void updateTelemetryStats();
-static void gcsTelemetryStatsUpdated();
+static void gcsTelemetryStatsUpdated(channelContext *channel);
+static void allocateSettingsDump(channelContext *channel);
+static void collectSettingsObject(channelContext *channel, UAVObjHandle obj);
+static void dumpSettings(channelContext *channel);
 
 /**
  * Initialise the telemetry module
@@ -174,6 +200,7 @@ int32_t TelemetryStart(void)
     // Only start the local telemetry tasks if needed
     if (localPort()) {
         UAVObjIterate(&registerLocalObject);
+        allocateSettingsDump(&localChannel);
 
         // Listen to objects of interest
 #ifdef PIOS_TELEM_PRIORITY_QUEUE
@@ -203,6 +230,7 @@ int32_t TelemetryStart(void)
 
     // Start the telemetry tasks associated with Radio/USB
     UAVObjIterate(&registerRadioObject);
+    allocateSettingsDump(&radioChannel);
 
     // Listen to objects of interest
 #ifdef PIOS_TELEM_PRIORITY_QUEUE
@@ -340,6 +368,9 @@ static void registerLocalObject(UAVObjHandle obj)
         UAVObjConnectQueue(obj, localChannel.queue, EV_MASK_ALL_UPDATES);
 #endif /* PIOS_TELEM_PRIORITY_QUEUE */
     } else {
+        if (UAVObjIsSettings(obj)) {
+            ++localChannel.settingsCount;
+        }
         // Setup object for periodic updates
         updateObject(
             &localChannel,
@@ -359,6 +390,9 @@ static void registerRadioObject(UAVObjHandle obj)
         UAVObjConnectQueue(obj, radioChannel.queue, EV_MASK_ALL_UPDATES);
 #endif /* PIOS_TELEM_PRIORITY_QUEUE */
     } else {
+        if (UAVObjIsSettings(obj)) {
+            ++radioChannel.settingsCount;
+        }
         // Setup object for periodic updates
         updateObject(
             &radioChannel,
@@ -494,7 +528,7 @@ static void processObjEvent(
     if (ev->obj == 0) {
         updateTelemetryStats();
     } else if (ev->obj == GCSTelemetryStatsHandle()) {
-        gcsTelemetryStatsUpdated();
+        gcsTelemetryStatsUpdated(channel);
     } else {
         // Get object metadata
         UAVObjGetMetadata(ev->obj, &metadata);
@@ -506,15 +540,20 @@ static void processObjEvent(
         if ((ev->event == EV_UPDATED && (updateMode == UPDATEMODE_ONCHANGE || updateMode == UPDATEMODE_THROTTLED))
             || ev->event == EV_UPDATED_MANUAL
             || (ev->event == EV_UPDATED_PERIODIC && updateMode != UPDATEMODE_THROTTLED)) {
-            // Send update to GCS (with retries)
-            while (retries < MAX_RETRIES && success == -1) {
-                // call blocks until ack is received or timeout
-                success = UAVTalkSendObject(channel->uavTalkCon,
-                                            ev->obj,
-                                            ev->instId,
-                                            UAVObjGetTelemetryAcked(&metadata), REQ_TIMEOUT_MS);
-                if (success == -1) {
-                    ++retries;
+            if (channel->batchPeriodic && ev->event == EV_UPDATED_PERIODIC && !UAVObjGetTelemetryAcked(&metadata)) {
+                // Queue the update, it is sent along with the other updates due in this tick
+                success = UAVTalkSendObjectBatched(channel->uavTalkCon, ev->obj, ev->instId);
+            } else {
+                // Send update to GCS (with retries)
+                while (retries < MAX_RETRIES && success == -1) {
+                    // call blocks until ack is received or timeout
+                    success = UAVTalkSendObject(channel->uavTalkCon,
+                                                ev->obj,
+                                                ev->instId,
+                                                UAVObjGetTelemetryAcked(&metadata), REQ_TIMEOUT_MS);
+                    if (success == -1) {
+                        ++retries;
+                    }
                 }
             }
             // Update stats
@@ -611,8 +650,25 @@ static void telemetryTxTask(void *parameters)
         if (xQueueReceive(channel->queue, &ev, 0) == pdTRUE) {
             // Process event
             processObjEvent(channel, &ev);
-            // if both queues are empty, wait on priority queue for updates (1 tick) then repeat cycle
-        } else if (xQueueReceive(channel->priorityQueue, &ev, 1) == pdTRUE) {
+            continue;
+        }
+#else
+        // check queue and process update - non-blocking
+        if (xQueueReceive(channel->queue, &ev, 0) == pdTRUE) {
+            // Process event
+            processObjEvent(channel, &ev);
+            continue;
+        }
+#endif /* PIOS_TELEM_PRIORITY_QUEUE */
+
+        // nothing else is due, send the batched updates before waiting
+        if (channel->batchPeriodic) {
+            UAVTalkFlushBatch(channel->uavTalkCon);
+        }
+
+#ifdef PIOS_TELEM_PRIORITY_QUEUE
+        // if both queues are empty, wait on priority queue for updates (1 tick) then repeat cycle
+        if (xQueueReceive(channel->priorityQueue, &ev, 1) == pdTRUE) {
             // Process event
             processObjEvent(channel, &ev);
         }
@@ -801,9 +857,10 @@ static int32_t setLoggingPeriod(
 /**
  * Called each time the GCS telemetry stats object is updated.
  * Trigger a flight telemetry stats update if a connection is not
- * yet established.
+ * yet established, and stream the settings once the connection is
+ * up if the GCS asked for them.
  */
-static void gcsTelemetryStatsUpdated()
+static void gcsTelemetryStatsUpdated(channelContext *channel)
 {
     FlightTelemetryStatsData flightStats;
     GCSTelemetryStatsData gcsStats;
@@ -812,9 +869,87 @@ static void gcsTelemetryStatsUpdated()
     GCSTelemetryStatsGet(&gcsStats);
     if (flightStats.Status != FLIGHTTELEMETRYSTATS_STATUS_CONNECTED || gcsStats.Status != GCSTELEMETRYSTATS_STATUS_CONNECTED) {
         updateTelemetryStats();
+        FlightTelemetryStatsStatusGet(&flightStats.Status);
+    }
+
+    if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_CONNECTED && gcsStats.Status == GCSTELEMETRYSTATS_STATUS_CONNECTED
+        && gcsStats.SettingsDump == GCSTELEMETRYSTATS_SETTINGSDUMP_REQUEST && !channel->settingsDumped) {
+        channel->settingsDumped = true;
+        dumpSettings(channel);
     }
 }
 
+/**
+ * Allocate the list used to collect the settings objects of a settings dump,
+ * sized by the number of settings objects counted while registering the objects
+ * \param[in] channel telemetry channel context
+ */
+static void allocateSettingsDump(channelContext *channel)
+{
+    channel->settingsObjs = pios_malloc(channel->settingsCount * sizeof(UAVObjHandle));
+    if (!channel->settingsObjs) {
+        channel->settingsCount = 0;
+    }
+}
+
+/**
+ * Stream all settings objects to the GCS without waiting for acks.
+ * The objects are collected while iterating under the object manager lock
+ * and sent after it has been released: sending blocks on the port and would
+ * otherwise stall every task accessing an object. FlightTelemetryStats is sent
+ * last on the same channel to tell the GCS that the dump is complete, settings
+ * missing from it are requested by the GCS.
+ * \param[in] channel telemetry channel context
+ */
+static void dumpSettings(channelContext *channel)
+{
+    channel->settingsCollected = 0;
+#ifdef HAS_RADIO
+    if (channel == &localChannel) {
+        UAVObjIterate(&collectLocalSettingsObject);
+    } else
+#endif
+    UAVObjIterate(&collectRadioSettingsObject);
+
+    for (uint16_t n = 0; n < channel->settingsCollected; ++n) {
+        if (UAVTalkSendObject(channel->uavTalkCon, channel->settingsObjs[n], UAVOBJ_ALL_INSTANCES, false, 0) == -1) {
+            ++txErrors;
+        }
+    }
+
+    // Close the dump on this channel, behind the last settings object
+    FlightTelemetryStatsSettingsDumpOptions settingsDump = FLIGHTTELEMETRYSTATS_SETTINGSDUMP_DONE;
+    FlightTelemetryStatsSettingsDumpCountSet(&channel->settingsCollected);
+    FlightTelemetryStatsSettingsDumpSet(&settingsDump);
+    if (UAVTalkSendObject(channel->uavTalkCon, FlightTelemetryStatsHandle(), 0, false, 0) == -1) {
+        ++txErrors;
+    }
+}
+
+/**
+ * Add a settings object to the channel's settings dump, called by UAVObjIterate()
+ * \param[in] channel telemetry channel context
+ * \param[in] obj Object to add
+ */
+static void collectSettingsObject(channelContext *channel, UAVObjHandle obj)
+{
+    if (UAVObjIsSettings(obj) && channel->settingsCollected < channel->settingsCount) {
+        channel->settingsObjs[channel->settingsCollected++] = obj;
+    }
+}
+
+#ifdef HAS_RADIO
+static void collectLocalSettingsObject(UAVObjHandle obj)
+{
+    collectSettingsObject(&localChannel, obj);
+}
+#endif
+
+static void collectRadioSettingsObject(UAVObjHandle obj)
+{
+    collectSettingsObject(&radioChannel, obj);
+}
+
 /**
  * Update telemetry statistics and handle connection handshake
  */
@@ -841,6 +976,7 @@ static void updateTelemetryStats()
     // Update stats object
     if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_CONNECTED) {
         flightStats.TxDataRate    = (float)utalkStats.txBytes / ((float)STATS_UPDATE_PERIOD_MS / 1000.0f);
+        flightStats.TxPayloadRate = (float)utalkStats.txObjectBytes / ((float)STATS_UPDATE_PERIOD_MS / 1000.0f);
         flightStats.TxBytes      += utalkStats.txBytes;
         flightStats.TxFailures   += txErrors;
         flightStats.TxRetries    += txRetries;
@@ -851,16 +987,17 @@ static void updateTelemetryStats()
         flightStats.RxSyncErrors += utalkStats.rxSyncErrors;
         flightStats.RxCrcErrors  += utalkStats.rxCrcErrors;
     } else {
-        flightStats.TxDataRate   = 0;
-        flightStats.TxBytes      = 0;
-        flightStats.TxFailures   = 0;
-        flightStats.TxRetries    = 0;
-
-        flightStats.RxDataRate   = 0;
-        flightStats.RxBytes      = 0;
-        flightStats.RxFailures   = 0;
-        flightStats.RxSyncErrors = 0;
-        flightStats.RxCrcErrors  = 0;
+        flightStats.TxDataRate    = 0;
+        flightStats.TxPayloadRate = 0;
+        flightStats.TxBytes       = 0;
+        flightStats.TxFailures    = 0;
+        flightStats.TxRetries     = 0;
+
+        flightStats.RxDataRate    = 0;
+        flightStats.RxBytes       = 0;
+        flightStats.RxFailures    = 0;
+        flightStats.RxSyncErrors  = 0;
+        flightStats.RxCrcErrors   = 0;
     }
     txErrors  = 0;
     txRetries = 0;
@@ -900,6 +1037,16 @@ static void updateTelemetryStats()
         flightStats.Status = FLIGHTTELEMETRYSTATS_STATUS_DISCONNECTED;
     }
 
+    // A new connection gets a new settings dump
+    if (flightStats.Status != FLIGHTTELEMETRYSTATS_STATUS_CONNECTED) {
+        flightStats.SettingsDump      = FLIGHTTELEMETRYSTATS_SETTINGSDUMP_NONE;
+        flightStats.SettingsDumpCount = 0;
+        radioChannel.settingsDumped = false;
+#ifdef HAS_RADIO
+        localChannel.settingsDumped = false;
+#endif
+    }
+
     // TODO: check whether is there any error condition worth raising an alarm
     // Disconnection is actually a normal (non)working status so it is not raising alarms anymore.
     if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_CONNECTED) {
@@ -926,6 +1073,11 @@ static void updateSettings(channelContext *channel)
 {
     uint32_t port = channel->getPort();
 
+    HwSettingsTelemetryBatchingOptions batching;
+
+    HwSettingsTelemetryBatchingGet(&batching);
+    channel->batchPeriodic = (batching == HWSETTINGS_TELEMETRYBATCHING_ENABLED);
+
     if (port) {
         // Retrieve settings
         HwSettingsTelemetrySpeedOptions speed;
@@ -50,8 +50,22 @@
 #include "positionstate.h"
 #include "optipositionstate.h"
 #include "optivelocitystate.h"
+#include "mavlinkbridgestatus.h"
 #include "velocitystate.h"
 #include "taskinfo.h"
+
+/* Messages are serialized straight into the COM transmit buffer, see mavlink_tx_begin() */
+#define MAVLINK_USE_CONVENIENCE_FUNCTIONS
+#define MAVLINK_START_UART_SEND(chan, length)   mavlink_tx_begin(length)
+#define MAVLINK_SEND_UART_BYTES(chan, buf, len) mavlink_tx_append(buf, len)
+#define MAVLINK_END_UART_SEND(chan, length)     mavlink_tx_end()
+
+#include "../mavlink_types.h"
+static mavlink_system_t mavlink_system = { .sysid = 0, .compid = 200 };
+static void mavlink_tx_begin(uint16_t length);
+static void mavlink_tx_append(const uint8_t *buf, uint16_t len);
+static void mavlink_tx_end();
+
 #include "mavlink.h"
 #include "hwsettings.h"
 #include "oplinkstatus.h"
@@ -97,7 +111,12 @@ static void uavoMavlinkRxBridgeTask(void *parameters);
 #endif
 
 #define TASK_PRIORITY    (tskIDLE_PRIORITY)
-#define TASK_RATE_HZ     1
+
+// Longest sleep of the transmit task when no stream is enabled
+#define TASK_IDLE_DELAY_MS 1000
+
+// Period of the transmit statistics in MavlinkBridgeStatus
+#define STATUS_PERIOD_MS   1000
 
 #define RX_TASK_PRIORITY (tskIDLE_PRIORITY+2)
 #define RX_TASK_RATE_HZ  	 40
@@ -113,28 +132,29 @@ static void mavlink_send_extra2();
 static void handleMessage(mavlink_message_t *msg);
 
 
+// Default rate of each stream, a ground station can change it with REQUEST_DATA_STREAM
 static const struct {
     uint8_t rate;
     void    (*handler)();
 } mav_rates[] = {
     [MAV_DATA_STREAM_EXTENDED_STATUS] = {
-        .rate    = 0, // Hz
+        .rate    = 2, // Hz
         .handler = mavlink_send_extended_status,
     },
     [MAV_DATA_STREAM_RC_CHANNELS] =     {
-        .rate    = 0, // Hz
+        .rate    = 5, // Hz
         .handler = mavlink_send_rc_channels,
     },
     [MAV_DATA_STREAM_POSITION] =        {
-        .rate    = 0, // Hz
+        .rate    = 2, // Hz
         .handler = mavlink_send_position,
     },
     [MAV_DATA_STREAM_EXTRA1] =          {
-        .rate    = 0, // Hz
+        .rate    = 10, // Hz
         .handler = mavlink_send_extra1,
     },
     [MAV_DATA_STREAM_EXTRA2] =          {
-        .rate    = 0, // Hz
+        .rate    = 2, // Hz
         .handler = mavlink_send_extra2,
     },
 };
@@ -149,9 +169,16 @@ static const struct {
 
 static bool module_enabled = false;
 
-static uint8_t *stream_ticks;
+// Current rate of each stream, written by the receive task
+static uint8_t *stream_rates;
+
+// Tick at which each stream is due next
+static portTickType *stream_deadlines;
 
-static mavlink_message_t *mav_msg;
+// Transmit accounting, messages that did not fit the COM buffer are dropped instead of waited for
+static bool tx_reserved;
+static uint32_t tx_sent;
+static uint32_t tx_dropped;
 
 //static uint8_t *rx_stream_ticks;
 static mavlink_message_t *mav_rx_msg;
@@ -190,6 +217,7 @@ static int32_t uavoMavlinkBridgeStart(void)
 static int32_t uavoMavlinkBridgeInitialize(void)
 {
 	OptiPositionStateInitialize();
+    MavlinkBridgeStatusInitialize();
     if (PIOS_COM_MAVLINK) {
         updateSettings();
 
@@ -197,16 +225,15 @@ static int32_t uavoMavlinkBridgeInitialize(void)
 		//PIOS_DELTATIME_Init(&timeval, UPDATE_EXPECTED, UPDATE_MIN, UPDATE_MAX, UPDATE_ALPHA);
 		time_last = PIOS_DELAY_GetRaw();
 		
-        mav_msg = pios_malloc(sizeof(*mav_msg));
-        stream_ticks = pios_malloc(MAXSTREAMS);
+        stream_rates     = pios_malloc(MAXSTREAMS);
+        stream_deadlines = pios_malloc(MAXSTREAMS * sizeof(*stream_deadlines));
 
 		mav_rx_msg = pios_malloc(sizeof(*mav_rx_msg));
 
-        if (mav_msg && stream_ticks && mav_rx_msg ) {
-            for (unsigned x = 0; x < MAXSTREAMS; ++x) {
-                stream_ticks[x] = (TASK_RATE_HZ / mav_rates[x].rate);
+        if (stream_rates && stream_deadlines && mav_rx_msg) {
+            for (unsigned i = 0; i < MAXSTREAMS; ++i) {
+                stream_rates[i] = mav_rates[i].rate;
             }
-			
             module_enabled = true;
         }
     }
@@ -215,12 +242,32 @@ static int32_t uavoMavlinkBridgeInitialize(void)
 }
 MODULE_INITCALL(uavoMavlinkBridgeInitialize, uavoMavlinkBridgeStart);
 
-static void send_message()
+/**
+ * Reserve room for a whole message in the COM transmit buffer.
+ * The message is dropped if it does not fit, a slow link must not stall the task.
+ */
+static void mavlink_tx_begin(uint16_t length)
 {
-    uint16_t msg_length = MAVLINK_NUM_NON_PAYLOAD_BYTES +
-                          mav_msg->len;
+    tx_reserved = (PIOS_COM_SendBufferBegin(PIOS_COM_MAVLINK, length) == 0);
+    if (!tx_reserved) {
+        tx_dropped++;
+    }
+}
 
-    PIOS_COM_SendBuffer(PIOS_COM_MAVLINK, &mav_msg->magic, msg_length);
+static void mavlink_tx_append(const uint8_t *buf, uint16_t len)
+{
+    if (tx_reserved) {
+        PIOS_COM_SendBufferAppend(PIOS_COM_MAVLINK, buf, len);
+    }
+}
+
+static void mavlink_tx_end()
+{
+    if (tx_reserved) {
+        PIOS_COM_SendBufferEnd(PIOS_COM_MAVLINK);
+        tx_reserved = false;
+        tx_sent++;
+    }
 }
 
 static void mavlink_send_extended_status()
@@ -247,7 +294,7 @@ static void mavlink_send_extended_status()
         }
     }
 
-    mavlink_msg_sys_status_pack(0, 200, mav_msg,
+    mavlink_msg_sys_status_send(MAVLINK_COMM_0,
                                 // onboard_control_sensors_present Bitmask showing which onboard controllers and sensors are present. Value of 0: not present. Value of 1: present. Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure, 4: differential pressure, 5: GPS, 6: optical flow, 7: computer vision position, 8: laser based position, 9: external ground-truth (Vicon or Leica). Controllers: 10: 3D angular rate control 11: attitude stabilization, 12: yaw position, 13: z/altitude control, 14: x/y position control, 15: motor outputs / control
                                 0,
                                 // onboard_control_sensors_enabled Bitmask showing which onboard controllers and sensors are enabled:  Value of 0: not enabled. Value of 1: enabled. Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure, 4: differential pressure, 5: GPS, 6: optical flow, 7: computer vision position, 8: laser based position, 9: external ground-truth (Vicon or Leica). Controllers: 10: 3D angular rate control 11: attitude stabilization, 12: yaw position, 13: z/altitude control, 14: x/y position control, 15: motor outputs / control
@@ -274,8 +321,6 @@ static void mavlink_send_extended_status()
                                 0,
                                 // errors_count4 Autopilot-specific errors
                                 0);
-
-    send_message();
 #endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
 }
 
@@ -317,7 +362,7 @@ static void mavlink_send_rc_channels()
 }
 #endif
 
-    mavlink_msg_rc_channels_raw_pack(0, 200, mav_msg,
+    mavlink_msg_rc_channels_raw_send(MAVLINK_COMM_0,
                                      // time_boot_ms Timestamp (milliseconds since system boot)
                                      systemStats.FlightTime,
                                      // port Servo output port (set of 8 outputs = 1 port). Most MAVs will just use one, but this allows to encode more than 8 servos.
@@ -340,8 +385,6 @@ static void mavlink_send_rc_channels()
                                      manualState.Channel[7],
                                      // rssi Receive signal strength indicator, 0: 0%, 255: 100%
                                      mavlinkRssi);
-
-    send_message();
 }
 
 static void mavlink_send_position()
@@ -371,7 +414,7 @@ static void mavlink_send_position()
             break;
         }
 
-        mavlink_msg_gps_raw_int_pack(0, 200, mav_msg,
+        mavlink_msg_gps_raw_int_send(MAVLINK_COMM_0,
                                      // time_usec Timestamp (microseconds since UNIX epoch or microseconds since system boot)
                                      (uint64_t)systemStats.FlightTime * 1000,
                                      // fix_type 0-1: no fix, 2: 2D fix, 3: 3D fix. Some applications will not use the value of this field unless it is at least two, so always correctly fill in the fix.
@@ -392,8 +435,6 @@ static void mavlink_send_position()
                                      gpsPosData.Heading * 100,
                                      // satellites_visible Number of satellites visible. If unknown, set to 255
                                      gpsPosData.Satellites);
-
-        send_message();
     }
 
 #ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
@@ -401,15 +442,13 @@ static void mavlink_send_position()
         HomeLocationData homeLocation;
         HomeLocationGet(&homeLocation);
 
-        mavlink_msg_gps_global_origin_pack(0, 200, mav_msg,
+        mavlink_msg_gps_global_origin_send(MAVLINK_COMM_0,
                                            // latitude Latitude (WGS84), expressed as * 1E7
                                            homeLocation.Latitude,
                                            // longitude Longitude (WGS84), expressed as * 1E7
                                            homeLocation.Longitude,
                                            // altitude Altitude(WGS84), expressed as * 1000
                                            homeLocation.Altitude * 1000);
-
-        send_message();
     }
 #endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
 
@@ -426,15 +465,13 @@ static void mavlink_send_position()
 
 static void mavlink_send_extra1()
 {
-
-  /*
     AttitudeStateData attState;
     SystemStatsData systemStats;
 
     AttitudeStateGet(&attState);
     SystemStatsGet(&systemStats);
 
-    mavlink_msg_attitude_pack(0, 200, mav_msg,
+    mavlink_msg_attitude_send(MAVLINK_COMM_0,
                               // time_boot_ms Timestamp (milliseconds since system boot)
                               systemStats.FlightTime,
                               // roll Roll angle (rad)
@@ -449,21 +486,6 @@ static void mavlink_send_extra1()
                               0,
                               // yawspeed Yaw angular speed (rad/s)
                               0);
-                              */
-    
-  mavlink_msg_heartbeat_pack(0, 200, mav_msg,
-								 // type Type of the MAV (quadrotor, helicopter, etc., up to 15 types, defined in MAV_TYPE ENUM)
-								 MAV_TYPE_GENERIC,
-								 // autopilot Autopilot type / class. defined in MAV_AUTOPILOT ENUM
-								 MAV_AUTOPILOT_GENERIC, // or MAV_AUTOPILOT_OPENPILOT
-								 // base_mode System mode bitfield, see MAV_MODE_FLAGS ENUM in mavlink/include/mavlink_types.h
-								 1,
-								 // custom_mode A bitfield for use for autopilot-specific flags.
-								 2,
-								 // system_status System status flag, see MAV_STATE ENUM
-								 0);
-
-    send_message();
 }
 
 static inline float Sq(float x)
@@ -513,7 +535,7 @@ static void mavlink_send_extra2()
     float thrust;
     ActuatorDesiredThrustGet(&thrust);
 
-    mavlink_msg_vfr_hud_pack(0, 200, mav_msg,
+    mavlink_msg_vfr_hud_send(MAVLINK_COMM_0,
                              // airspeed Current airspeed in m/s
                              airspeed,
                              // groundspeed Current ground speed in m/s
@@ -527,8 +549,6 @@ static void mavlink_send_extra2()
                              // climb Current climb rate in meters/second
                              climbrate);
 
-    send_message();
-
     FlightStatusData flightStatus;
     FlightStatusGet(&flightStatus);
 
@@ -599,7 +619,7 @@ static void mavlink_send_extra2()
         break;
     }
 
-    mavlink_msg_heartbeat_pack(0, 200, mav_msg,
+    mavlink_msg_heartbeat_send(MAVLINK_COMM_0,
                                // type Type of the MAV (quadrotor, helicopter, etc., up to 15 types, defined in MAV_TYPE ENUM)
                                MAV_TYPE_GENERIC,
                                // autopilot Autopilot type / class. defined in MAV_AUTOPILOT ENUM
@@ -610,44 +630,66 @@ static void mavlink_send_extra2()
                                custom_mode,
                                // system_status System status flag, see MAV_STATE ENUM
                                0);
-
-    send_message();
 }
 
 /**
  * Main task. It does not return.
+ * Every stream of mav_rates has its own deadline, the task runs the handlers
+ * that are due and then sleeps until the earliest next deadline. A stream
+ * that a ground station enables waits for the next wakeup, at most
+ * TASK_IDLE_DELAY_MS.
  */
 
 static void uavoMavlinkBridgeTask(__attribute__((unused)) void *parameters)
 {
-	
-	uint32_t lastSysTime;
+    portTickType now = xTaskGetTickCount();
+    portTickType statusDeadline = now;
 
-    // Main task loop
-    lastSysTime = xTaskGetTickCount(); // portTICK_RATE_MS;
+    for (unsigned i = 0; i < MAXSTREAMS; ++i) {
+        stream_deadlines[i] = now;
+    }
 
     while (1) {
-        vTaskDelayUntil(&lastSysTime, (1000 / TASK_RATE_HZ) / portTICK_RATE_MS);
-		//DEBUG_PRINTF(2,"tX");
-        for (unsigned i = 0; i < MAXSTREAMS; ++i) {
+        portTickType nextWakeup = now + TASK_IDLE_DELAY_MS / portTICK_RATE_MS;
 
-			if(i != MAV_DATA_STREAM_EXTRA1)continue;
-            if (!mav_rates[i].rate || !mav_rates[i].handler) {
+        for (unsigned i = 0; i < MAXSTREAMS; ++i) {
+            uint8_t rate = stream_rates[i];
+            if (!rate || !mav_rates[i].handler) {
                 continue;
             }
 
-            if (stream_ticks[i] == 0) {
-                // trigger now
-                uint8_t rate = mav_rates[i].rate;
-                if (rate > TASK_RATE_HZ) {
-                    rate = TASK_RATE_HZ;
+            if ((int32_t)(now - stream_deadlines[i]) >= 0) {
+                portTickType period = (1000 / rate) / portTICK_RATE_MS;
+                if (period == 0) {
+                    period = 1;
                 }
-                stream_ticks[i] = TASK_RATE_HZ / rate;
 
                 mav_rates[i].handler();
+
+                // Keep the stream on its own grid, but skip the slots that were missed instead of bursting
+                stream_deadlines[i] += period;
+                if ((int32_t)(now - stream_deadlines[i]) >= 0) {
+                    stream_deadlines[i] = now + period;
+                }
             }
 
-            --stream_ticks[i];
+            if ((int32_t)(stream_deadlines[i] - nextWakeup) < 0) {
+                nextWakeup = stream_deadlines[i];
+            }
+        }
+
+        if ((int32_t)(now - statusDeadline) >= 0) {
+            MavlinkBridgeStatusData status;
+            status.TxSent    = tx_sent;
+            status.TxDropped = tx_dropped;
+            MavlinkBridgeStatusSet(&status);
+            statusDeadline   = now + STATUS_PERIOD_MS / portTICK_RATE_MS;
+        }
+
+        now = xTaskGetTickCount();
+        if ((int32_t)(nextWakeup - now) > 0) {
+            vTaskDelay(nextWakeup - now);
+            now = xTaskGetTickCount();
         }
     }
 }
@@ -712,6 +754,22 @@ static void handleMessage(mavlink_message_t *msg)
             
             //DEBUG_PRINTF(2,"HeartBeat");
             
+            break;
+        }
+        case MAVLINK_MSG_ID_REQUEST_DATA_STREAM: {
+            mavlink_request_data_stream_t request;
+            mavlink_msg_request_data_stream_decode(msg, &request);
+
+            // The rate is in Hz, stopping a stream sets it to 0 until it is requested again
+            uint16_t rate = request.start_stop ? request.req_message_rate : 0;
+            if (rate > UINT8_MAX) {
+                rate = UINT8_MAX;
+            }
+            for (unsigned i = 0; i < MAXSTREAMS; ++i) {
+                if (mav_rates[i].handler && (request.req_stream_id == MAV_DATA_STREAM_ALL || request.req_stream_id == i)) {
+                    stream_rates[i] = rate;
+                }
+            }
             break;
         }
 		case MAVLINK_MSG_ID_VICON_POSITION_ESTIMATE: {
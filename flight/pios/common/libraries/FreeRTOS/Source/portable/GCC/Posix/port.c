@@ -85,6 +85,16 @@ Preemption is done by the main scheduler thread which attempts to run a tick
 handler at accurate intervals using nanosleep and gettimeofday, which allows
 more accurate high frequency ticks than a timer signal handler.
 
+In lockstep mode (vPortSetLockstep) the tick does not follow the wall clock.
+The idle task advances it from the idle hook (vPortLockstepIdle), which only
+runs when every other task is blocked. Simulated time therefore passes as fast
+as the tasks get their work done, and since the tick is processed like a
+pended tick within the idle task, without signalling any thread, the order in
+which the tasks run is reproducible. The main scheduler thread only watches
+over the idle task: if no tick happened for portLOCKSTEP_WATCHDOG_MS of real
+time because a task never blocks, it runs the tick handler as usual and counts
+a late tick.
+
 All public functions in this port are protected by a safeguard mutex which
 assures priority access on all data objects
 
@@ -158,6 +168,9 @@ static volatile portBASE_TYPE xInterruptsEnabled = pdFALSE;
 static volatile portBASE_TYPE xSchedulerNesting = 0;
 static volatile portBASE_TYPE xPendYield = pdFALSE;
 static volatile portLONG lIndexOfLastAddedTask = 0;
+static volatile portBASE_TYPE xLockstep = pdFALSE;
+static volatile unsigned long ulTicksHandled = 0;
+static volatile unsigned long ulLockstepLateTicks = 0;
 /*-----------------------------------------------------------*/
 
 /*
@@ -172,6 +185,7 @@ static xThreadState* prvGetThreadHandleByThread( pthread_t hThread );
 static portLONG prvGetFreeThreadState( void );
 static void prvDeleteThread( void *xThreadId );
 static void prvPortYield();
+static void prvLockstepWatchdog( void );
 /*-----------------------------------------------------------*/
 
 /*
@@ -300,7 +314,12 @@ portBASE_TYPE xPortStartScheduler( void )
 	struct timeval lastTime,currentTime;
 	gettimeofday( &lastTime, NULL );
 	struct timespec wait;
-	
+
+	while ( pdTRUE == xLockstep && pdTRUE != xSchedulerEnd )
+	{
+		prvLockstepWatchdog();
+	}
+
 	while ( pdTRUE != xSchedulerEnd )
 	{
 		/* wait for the specified wait time */
@@ -647,6 +666,7 @@ void vPortSystemTickHandler()
 	 * call tick handler
 	 */
 	xTaskIncrementTick();
+	ulTicksHandled++;
 
 	
 #if ( configUSE_PREEMPTION == 1 )
@@ -673,6 +693,84 @@ void vPortSystemTickHandler()
 }
 /*-----------------------------------------------------------*/
 
+/**
+ * lockstep mode: make sure time goes on when the idle task does not get to
+ * run, the idle task does the ticks otherwise
+ */
+void prvLockstepWatchdog( void )
+{
+	const unsigned long ulTicks = ulTicksHandled;
+	struct timespec wait;
+
+	wait.tv_sec = portLOCKSTEP_WATCHDOG_MS / 1000;
+	wait.tv_nsec = 1000000 * ( portLOCKSTEP_WATCHDOG_MS % 1000 );
+	nanosleep( &wait, NULL );
+
+	if ( ulTicks == ulTicksHandled && pdTRUE != xSchedulerEnd )
+	{
+		vPortSystemTickHandler();
+		ulLockstepLateTicks++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * called from the idle hook, advances the tick in lockstep mode
+ * the tick is pended while the scheduler is suspended and processed when it
+ * resumes, which also switches to any task that was woken up
+ */
+void vPortLockstepIdle( void )
+{
+	if ( pdTRUE != xLockstep )
+	{
+		return;
+	}
+
+	vTaskSuspendAll();
+	portENTER_CRITICAL();
+	xTaskIncrementTick();
+	ulTicksHandled++;
+	portEXIT_CRITICAL();
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Enable lockstep mode, must be called before the scheduler is started.
+ */
+void vPortSetLockstep( portBASE_TYPE xEnable )
+{
+	PORT_ASSERT( pdFALSE == xSchedulerStarted );
+	xLockstep = xEnable;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortIsLockstep( void )
+{
+	return xLockstep;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * the simulated clock in lockstep mode, in ticks. Unlike xTaskGetTickCount()
+ * it takes no lock, so it can be read from the trace hooks in the scheduler.
+ */
+unsigned long ulPortGetLockstepTicks( void )
+{
+	return ulTicksHandled;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * number of ticks in lockstep mode that the watchdog had to force because a
+ * task did not block, if this is not 0 a run is not reproducible
+ */
+unsigned long ulPortGetLockstepLateTicks( void )
+{
+	return ulLockstepLateTicks;
+}
+/*-----------------------------------------------------------*/
+
 /**
  * thread kill implementation
  */
@@ -1043,6 +1141,11 @@ void vPortAddTaskHandle( void *pxTaskHandle )
 portLONG lIndex;
 
 	pxThreads[ lIndexOfLastAddedTask ].hTask = ( xTaskHandle )pxTaskHandle;
+#if ( configUSE_TRACE_FACILITY == 1 )
+	/* The TCB is not cleared, this hook takes traceTASK_CREATE from the
+	application, which would start the task without a number otherwise. */
+	vTaskSetTaskNumber( ( xTaskHandle )pxTaskHandle, 0 );
+#endif
 	for ( lIndex = 0; lIndex < MAX_NUMBER_OF_TASKS; lIndex++ )
 	{
 		if ( pxThreads[ lIndex ].hThread == pxThreads[ lIndexOfLastAddedTask ].hThread )
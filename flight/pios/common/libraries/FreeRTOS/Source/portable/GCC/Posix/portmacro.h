@@ -158,6 +158,14 @@ extern void vPortForciblyEndThread( void *pxTaskToDelete );
 extern void vPortAddTaskHandle( void *pxTaskHandle );
 #define traceTASK_CREATE( pxNewTCB )			vPortAddTaskHandle( pxNewTCB )
 
+/* Lockstep simulation, the tick follows the tasks instead of the wall clock. */
+extern void vPortSetLockstep( portBASE_TYPE xEnable );
+extern portBASE_TYPE xPortIsLockstep( void );
+extern unsigned long ulPortGetLockstepTicks( void );
+extern unsigned long ulPortGetLockstepLateTicks( void );
+extern void vPortLockstepIdle( void );
+#define portLOCKSTEP_WATCHDOG_MS				100
+
 /* Posix Signal definitions that can be changed or read as appropriate. */
 #define SIG_SUSPEND					SIGUSR1
 
@@ -36,14 +36,28 @@
 #define STACK_SIZE        (300 + STACK_SAFETYSIZE)
 #define STACK_SAFETYSIZE  8
 #define MAX_SLEEP         1000
+#define DELAY_HEAP_GROWTH 8
 
 // Private types
 /**
  * task information
+ * Callbacks that want to run are kept in one FIFO per priority, a bit in readyPriorities
+ * is set for every priority with a non empty FIFO. The FIFOs are only modified inside
+ * critical sections since they are appended to by the dispatch functions, including from ISRs.
+ * Callbacks with a schedule are kept in a min-heap ordered by scheduletime, protected by the mutex.
  */
 struct DelayedCallbackTaskStruct {
     DelayedCallbackInfo *callbackQueue[CALLBACK_PRIORITY_LOW + 1];
-    DelayedCallbackInfo *queueCursor[CALLBACK_PRIORITY_LOW + 1];
+    DelayedCallbackInfo *readyHead[CALLBACK_PRIORITY_LOW + 1];
+    DelayedCallbackInfo *readyTail[CALLBACK_PRIORITY_LOW + 1];
+    uint16_t volatile   readyCount[CALLBACK_PRIORITY_LOW + 1];
+    uint16_t roundRemaining[CALLBACK_PRIORITY_LOW + 1]; // callbacks left to run before the lower priority gets its slot
+    bool     lowerTurn[CALLBACK_PRIORITY_LOW + 1]; // the lower priority has not had its slot in the current round
+    uint8_t volatile    readyPriorities;
+    DelayedCallbackInfo **delayHeap;
+    uint16_t delayHeapSize;
+    uint16_t delayHeapCapacity;
+    uint16_t numCallbacks;
     xTaskHandle callbackSchedulerTaskHandle;
     char name[3];
     uint32_t    stackSize;
@@ -58,16 +72,23 @@ struct DelayedCallbackTaskStruct {
 struct DelayedCallbackInfoStruct {
     DelayedCallback   cb;
     int16_t callbackID;
-    bool volatile     waiting;
+    DelayedCallbackPriority priority;
+    bool volatile     waiting; // queued in the ready FIFO of its priority
     uint32_t volatile scheduletime;
+    int16_t  heapIndex; // position in the delay heap, -1 if not scheduled
     uint32_t stackSize;
     int32_t  stackFree;
     int32_t  stackNotFree;
     uint16_t stackSafetyCount;
     uint16_t currentSafetyCount;
     uint32_t runCount;
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+    uint32_t volatile readyTime; // PIOS_DELAY raw time at which the callback became ready
+    uint32_t latencyHistogram[PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS];
+#endif
     struct DelayedCallbackTaskStruct *task;
     struct DelayedCallbackInfoStruct *next;
+    struct DelayedCallbackInfoStruct *readyNext;
 };
 
 
@@ -78,7 +99,10 @@ static bool schedulerStarted;
 
 // Private functions
 static void CallbackSchedulerTask(void *task);
-static int32_t runNextCallback(struct DelayedCallbackTaskStruct *task, DelayedCallbackPriority priority);
+static bool runNextCallback(struct DelayedCallbackTaskStruct *task, DelayedCallbackPriority priority);
+static int32_t readyDueCallbacks(struct DelayedCallbackTaskStruct *task);
+static void delayHeapRemove(struct DelayedCallbackTaskStruct *task, DelayedCallbackInfo *cbinfo);
+static void delayHeapUpdate(struct DelayedCallbackTaskStruct *task, DelayedCallbackInfo *cbinfo);
 
 /**
  * Initialize the scheduler
@@ -187,6 +211,7 @@ int32_t PIOS_CALLBACKSCHEDULER_Schedule(
             result = 2;
         }
         cbinfo->scheduletime = new;
+        delayHeapUpdate(cbinfo->task, cbinfo);
 
         // scheduler needs to be notified to adapt sleep times
         xSemaphoreGive(cbinfo->task->signal);
@@ -197,6 +222,33 @@ int32_t PIOS_CALLBACKSCHEDULER_Schedule(
     return result;
 }
 
+/**
+ * Append a callback to the ready FIFO of its priority, unless it is already waiting there
+ * Must be called inside a critical section
+ * \param[in] cbinfo the callback handle
+ */
+static inline void makeReady(DelayedCallbackInfo *cbinfo)
+{
+    struct DelayedCallbackTaskStruct *task = cbinfo->task;
+
+    if (cbinfo->waiting) {
+        return;
+    }
+    cbinfo->waiting   = true;
+    cbinfo->readyNext = NULL;
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+    cbinfo->readyTime = PIOS_DELAY_GetRaw();
+#endif
+    if (task->readyTail[cbinfo->priority]) {
+        task->readyTail[cbinfo->priority]->readyNext = cbinfo;
+    } else {
+        task->readyHead[cbinfo->priority] = cbinfo;
+    }
+    task->readyTail[cbinfo->priority] = cbinfo;
+    task->readyCount[cbinfo->priority]++;
+    task->readyPriorities |= (1 << cbinfo->priority);
+}
+
 /**
  * Dispatch an event by invoking the supplied callback. The function
  * returns immediately, the callback is invoked from the event task.
@@ -208,7 +260,9 @@ int32_t PIOS_CALLBACKSCHEDULER_Dispatch(DelayedCallbackInfo *cbinfo)
     PIOS_Assert(cbinfo);
 
     // no semaphore needed for the callback
-    cbinfo->waiting = true;
+    portENTER_CRITICAL();
+    makeReady(cbinfo);
+    portEXIT_CRITICAL();
     // but the scheduler as a whole needs to be notified
     return xSemaphoreGive(cbinfo->task->signal);
 }
@@ -232,7 +286,9 @@ int32_t PIOS_CALLBACKSCHEDULER_DispatchFromISR(DelayedCallbackInfo *cbinfo, long
     PIOS_Assert(cbinfo);
 
     // no semaphore needed for the callback
-    cbinfo->waiting = true;
+    portBASE_TYPE mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    makeReady(cbinfo);
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
     // but the scheduler as a whole needs to be notified
     return xSemaphoreGiveFromISR(cbinfo->task->signal, pxHigherPriorityTaskWoken);
 }
@@ -281,9 +337,18 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
 
         // initialize structure
         for (DelayedCallbackPriority p = 0; p <= CALLBACK_PRIORITY_LOW; p++) {
-            task->callbackQueue[p] = NULL;
-            task->queueCursor[p]   = NULL;
+            task->callbackQueue[p]  = NULL;
+            task->readyHead[p]      = NULL;
+            task->readyTail[p]      = NULL;
+            task->readyCount[p]     = 0;
+            task->roundRemaining[p] = 0;
+            task->lowerTurn[p]      = false;
         }
+        task->readyPriorities   = 0;
+        task->delayHeap         = NULL;
+        task->delayHeapSize     = 0;
+        task->delayHeapCapacity = 0;
+        task->numCallbacks      = 0;
         task->name[0]      = 'C';
         task->name[1]      = 'a' + t;
         task->name[2]      = 0;
@@ -328,6 +393,21 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
         return NULL; // error - not enough memory
     }
 
+    // every callback of the task must fit into the delay heap
+    if (task->delayHeapCapacity == task->numCallbacks) {
+        DelayedCallbackInfo **heap = (DelayedCallbackInfo **)pios_malloc((task->delayHeapCapacity + DELAY_HEAP_GROWTH) * sizeof(DelayedCallbackInfo *));
+        if (!heap) {
+            xSemaphoreGiveRecursive(mutex);
+            return NULL; // error - not enough memory
+        }
+        if (task->delayHeap) {
+            memcpy(heap, task->delayHeap, task->delayHeapSize * sizeof(DelayedCallbackInfo *));
+            pios_free(task->delayHeap);
+        }
+        task->delayHeap = heap;
+        task->delayHeapCapacity += DELAY_HEAP_GROWTH;
+    }
+
     // initialize callback scheduling info
     DelayedCallbackInfo *info = (DelayedCallbackInfo *)pios_malloc(sizeof(DelayedCallbackInfo));
     if (!info) {
@@ -335,10 +415,13 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
         return NULL; // error - not enough memory
     }
     info->next               = NULL;
+    info->readyNext          = NULL;
     info->waiting            = false;
     info->scheduletime       = 0;
+    info->heapIndex          = -1;
     info->task               = task;
     info->cb = cb;
+    info->priority           = priority;
     info->callbackID         = callbackID;
     info->runCount           = 0;
     info->stackSize          = stacksize - STACK_SIZE;
@@ -346,9 +429,14 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
     info->stackFree          = 0;
     info->stackSafetyCount   = STACK_SAFETYCOUNT;
     info->currentSafetyCount = 0;
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+    info->readyTime          = 0;
+    memset(info->latencyHistogram, 0, sizeof(info->latencyHistogram));
+#endif
 
     // add to scheduling queue
     LL_APPEND(task->callbackQueue[priority], info);
+    task->numCallbacks++;
 
     xSemaphoreGiveRecursive(mutex);
 
@@ -380,6 +468,9 @@ void PIOS_CALLBACKSCHEDULER_ForEachCallback(CallbackSchedulerCallbackInfoCallbac
                 info.is_running = true;
                 info.stack_remaining    = cbinfo->stackNotFree;
                 info.running_time_count = cbinfo->runCount;
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+                memcpy(info.latency_histogram, cbinfo->latencyHistogram, sizeof(info.latency_histogram));
+#endif
                 xSemaphoreGiveRecursive(mutex);
                 callback(cbinfo->callbackID, &info, context);
             }
@@ -458,75 +549,205 @@ static void checkStack(DelayedCallbackInfo *current)
 }
 
 /**
- * Scheduler subtask
- * \param[in] task The scheduler task in question
- * \param[in] priority The scheduling priority of the callback to search for
- * \return wait time until next scheduled callback is due - 0 if a callback has just been executed
+ * Delay heap helpers, must be called while holding the mutex
+ * The heap is ordered by scheduletime, compared such that the uint32_t wraparound is handled
  */
-static int32_t runNextCallback(struct DelayedCallbackTaskStruct *task, DelayedCallbackPriority priority)
+static inline bool delayHeapBefore(const DelayedCallbackInfo *a, const DelayedCallbackInfo *b)
 {
-    int32_t result = MAX_SLEEP;
-    int32_t diff   = 0;
+    return (int32_t)(a->scheduletime - b->scheduletime) < 0;
+}
 
-    // no such queue
-    if (priority > CALLBACK_PRIORITY_LOW) {
-        return result;
+static inline void delayHeapPlace(struct DelayedCallbackTaskStruct *task, DelayedCallbackInfo *cbinfo, uint16_t index)
+{
+    task->delayHeap[index] = cbinfo;
+    cbinfo->heapIndex = index;
+}
+
+static void delayHeapSiftUp(struct DelayedCallbackTaskStruct *task, uint16_t index)
+{
+    DelayedCallbackInfo *cbinfo = task->delayHeap[index];
+
+    while (index > 0) {
+        uint16_t parent = (index - 1) / 2;
+        if (!delayHeapBefore(cbinfo, task->delayHeap[parent])) {
+            break;
+        }
+        delayHeapPlace(task, task->delayHeap[parent], index);
+        index = parent;
     }
+    delayHeapPlace(task, cbinfo, index);
+}
+
+static void delayHeapSiftDown(struct DelayedCallbackTaskStruct *task, uint16_t index)
+{
+    DelayedCallbackInfo *cbinfo = task->delayHeap[index];
 
-    // queue is empty, search a lower priority queue
-    if (task->callbackQueue[priority] == NULL) {
-        return runNextCallback(task, priority + 1);
+    while (true) {
+        uint16_t child = 2 * index + 1;
+        if (child >= task->delayHeapSize) {
+            break;
+        }
+        if (child + 1 < task->delayHeapSize && delayHeapBefore(task->delayHeap[child + 1], task->delayHeap[child])) {
+            child++;
+        }
+        if (!delayHeapBefore(task->delayHeap[child], cbinfo)) {
+            break;
+        }
+        delayHeapPlace(task, task->delayHeap[child], index);
+        index = child;
     }
+    delayHeapPlace(task, cbinfo, index);
+}
 
-    DelayedCallbackInfo *current = task->queueCursor[priority];
-    DelayedCallbackInfo *next;
-    do {
-        if (current == NULL) {
-            next = task->callbackQueue[priority]; // loop around the end of the list
-            // also attempt to run a callback that has lower priority
-            // every time the queue is completely traversed
-            diff = runNextCallback(task, priority + 1);
-            if (!diff) {
-                task->queueCursor[priority] = next; // the recursive call has executed a callback
-                return 0;
-            }
+/**
+ * Insert a callback into the delay heap or move it to the position matching its new scheduletime
+ */
+static void delayHeapUpdate(struct DelayedCallbackTaskStruct *task, DelayedCallbackInfo *cbinfo)
+{
+    if (cbinfo->heapIndex < 0) {
+        PIOS_Assert(task->delayHeapSize < task->delayHeapCapacity);
+        delayHeapPlace(task, cbinfo, task->delayHeapSize++);
+    }
+    delayHeapSiftUp(task, cbinfo->heapIndex);
+    delayHeapSiftDown(task, cbinfo->heapIndex);
+}
+
+/**
+ * Remove a callback from the delay heap
+ */
+static void delayHeapRemove(struct DelayedCallbackTaskStruct *task, DelayedCallbackInfo *cbinfo)
+{
+    uint16_t index = cbinfo->heapIndex;
+
+    cbinfo->heapIndex = -1;
+    task->delayHeapSize--;
+    if (index < task->delayHeapSize) {
+        delayHeapPlace(task, task->delayHeap[task->delayHeapSize], index);
+        delayHeapSiftUp(task, index);
+        delayHeapSiftDown(task, task->delayHeap[index]->heapIndex);
+    }
+}
+
+/**
+ * Move all callbacks whose schedule is due to the ready FIFOs
+ * \param[in] task The scheduler task in question
+ * \return wait time until the next scheduled callback is due
+ */
+static int32_t readyDueCallbacks(struct DelayedCallbackTaskStruct *task)
+{
+    int32_t result = MAX_SLEEP;
+
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY); // access to scheduletime should be mutex protected
+    while (task->delayHeapSize) {
+        DelayedCallbackInfo *current = task->delayHeap[0];
+        int32_t diff = current->scheduletime - xTaskGetTickCount();
+        if (diff > 0) {
             if (diff < result) {
                 result = diff; // adjust sleep time
             }
-        } else {
-            next = current->next;
-            xSemaphoreTakeRecursive(mutex, portMAX_DELAY); // access to scheduletime should be mutex protected
-            if (current->scheduletime) {
-                diff = current->scheduletime - xTaskGetTickCount();
-                if (diff <= 0) {
-                    current->waiting = true;
-                } else if (diff < result) {
-                    result = diff; // adjust sleep time
-                }
-            }
-            if (current->waiting) {
-                task->queueCursor[priority] = next;
-                current->scheduletime = 0; // any schedules are reset
-                current->waiting = false; // the flag is reset just before execution.
-                xSemaphoreGiveRecursive(mutex);
+            break;
+        }
+        delayHeapRemove(task, current);
+        current->scheduletime = 0; // any schedules are reset
+        portENTER_CRITICAL();
+        makeReady(current);
+        portEXIT_CRITICAL();
+    }
+    xSemaphoreGiveRecursive(mutex);
 
-                /* callback gets invoked here - check stack sizes */
-                markStack(current);
+    return result;
+}
 
-                current->cb(); // call the callback
+/**
+ * Take the oldest callback from the ready FIFO of a priority
+ */
+static DelayedCallbackInfo *takeReady(struct DelayedCallbackTaskStruct *task, DelayedCallbackPriority priority)
+{
+    portENTER_CRITICAL();
+    DelayedCallbackInfo *current = task->readyHead[priority];
+    task->readyHead[priority] = current->readyNext;
+    if (!task->readyHead[priority]) {
+        task->readyTail[priority] = NULL;
+        task->readyPriorities    &= ~(1 << priority);
+    }
+    task->readyCount[priority]--;
+    current->waiting = false; // the flag is reset just before execution.
+    portEXIT_CRITICAL();
 
-                checkStack(current);
+    return current;
+}
 
-                current->runCount++;
+/**
+ * Scheduler subtask
+ * Callbacks of one priority run in rounds, each callback that was ready at the start of a
+ * round runs once, after which a callback of the next lower priority gets one slot.
+ * \param[in] task The scheduler task in question
+ * \param[in] priority The scheduling priority of the callback to search for
+ * \return true if a callback has just been executed
+ */
+static bool runNextCallback(struct DelayedCallbackTaskStruct *task, DelayedCallbackPriority priority)
+{
+    // no such queue
+    if (priority > CALLBACK_PRIORITY_LOW) {
+        return false;
+    }
+
+    // nothing ready at this or any lower priority
+    if (!(task->readyPriorities >> priority)) {
+        return false;
+    }
 
-                return 0;
+    if (!task->roundRemaining[priority]) {
+        // the round is complete, attempt to run a callback that has lower priority
+        if (task->lowerTurn[priority]) {
+            task->lowerTurn[priority] = false;
+            if (runNextCallback(task, priority + 1)) {
+                return true;
             }
-            xSemaphoreGiveRecursive(mutex);
         }
-        current = next;
-    } while (current != task->queueCursor[priority]);
-    // once the list has been traversed entirely without finding any to be executed task, abort (nothing to do)
-    return result;
+        // start a new round with all callbacks that are ready now
+        task->roundRemaining[priority] = task->readyCount[priority];
+        if (!task->roundRemaining[priority]) {
+            // queue is empty, search a lower priority queue
+            return runNextCallback(task, priority + 1);
+        }
+        task->lowerTurn[priority] = true;
+    }
+    task->roundRemaining[priority]--;
+
+    DelayedCallbackInfo *current = takeReady(task, priority);
+
+    if (current->scheduletime) {
+        xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+        if (current->scheduletime) {
+            delayHeapRemove(task, current);
+            current->scheduletime = 0; // any schedules are reset
+        }
+        xSemaphoreGiveRecursive(mutex);
+    }
+
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+    // bucket n counts latencies below 2^n us
+    uint32_t latency = PIOS_DELAY_DiffuS(current->readyTime);
+    uint8_t bucket   = latency ? 32 - __builtin_clz(latency) : 0;
+    if (bucket >= PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS) {
+        bucket = PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS - 1;
+    }
+    current->latencyHistogram[bucket]++;
+#endif
+
+    /* callback gets invoked here - check stack sizes */
+    markStack(current);
+
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_CALLBACK_START, current->callbackID, current->priority);
+    current->cb(); // call the callback
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_CALLBACK_END, current->callbackID, current->priority);
+
+    checkStack(current);
+
+    current->runCount++;
+
+    return true;
 }
 
 /**
@@ -538,8 +759,8 @@ static void CallbackSchedulerTask(void *task)
     uint32_t delay = 0;
 
     while (1) {
-        delay = runNextCallback((struct DelayedCallbackTaskStruct *)task, CALLBACK_PRIORITY_CRITICAL);
-        if (delay) {
+        delay = readyDueCallbacks((struct DelayedCallbackTaskStruct *)task);
+        if (!runNextCallback((struct DelayedCallbackTaskStruct *)task, CALLBACK_PRIORITY_CRITICAL)) {
             // nothing to do but sleep
             xSemaphoreTake(((struct DelayedCallbackTaskStruct *)task)->signal, delay);
         }
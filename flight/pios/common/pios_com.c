@@ -424,6 +424,84 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
 }
 
 
+/**
+ * Starts a package that is written into the transmit buffer in pieces,
+ * without staging it in an intermediate buffer first
+ * (non-blocking function)
+ * On success the caller owns the port until it calls PIOS_COM_SendBufferEnd(),
+ * and must append exactly len bytes with PIOS_COM_SendBufferAppend().
+ * \param[in] port COM port
+ * \param[in] len total length of the package
+ * \return -1 if port not available
+ * \return -2 buffer cannot hold the whole package, nothing has been sent
+ * \return -3 another thread is already sending
+ * \return 0 on success
+ */
+int32_t PIOS_COM_SendBufferBegin(uint32_t com_id, uint16_t len)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xSemaphoreTake(com_dev->sendbuffer_sem, 0) != pdTRUE) {
+        return -3;
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+    if (com_dev->driver->available && !(com_dev->driver->available(com_dev->lower_id) & COM_AVAILABLE_TX)) {
+        /* Underlying device is down/unconnected, drop stale data like PIOS_COM_SendBufferNonBlocking() does */
+        fifoBuf_clearData(&com_dev->tx);
+    }
+
+    if (len > fifoBuf_getFree(&com_dev->tx)) {
+#if defined(PIOS_INCLUDE_FREERTOS)
+        xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+        return -2;
+    }
+    return 0;
+}
+
+/**
+ * Appends a piece of the package started with PIOS_COM_SendBufferBegin()
+ * \param[in] port COM port
+ * \param[in] buffer character buffer
+ * \param[in] len buffer length
+ */
+void PIOS_COM_SendBufferAppend(uint32_t com_id, const uint8_t *buffer, uint16_t len)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    PIOS_Assert(PIOS_COM_validate(com_dev));
+
+    /* Space has been checked when the package was started */
+    fifoBuf_putData(&com_dev->tx, buffer, len);
+}
+
+/**
+ * Completes the package started with PIOS_COM_SendBufferBegin(),
+ * starts the transmitter and releases the port
+ * \param[in] port COM port
+ */
+void PIOS_COM_SendBufferEnd(uint32_t com_id)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    PIOS_Assert(PIOS_COM_validate(com_dev));
+
+    if (com_dev->driver->tx_start) {
+        com_dev->driver->tx_start(com_dev->lower_id,
+                                  fifoBuf_getUsed(&com_dev->tx));
+    }
+#if defined(PIOS_INCLUDE_FREERTOS)
+    xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+}
+
+
 /**
  * Sends a package over given port
  * (blocking function)
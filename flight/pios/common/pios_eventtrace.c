@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_eventtrace.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      PiOS event trace
+ *             Records task switches, callbacks, UAVObject events and interrupts
+ *             with their time in a RAM ring
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_EVENTTRACE
+
+#include <pios_eventtrace.h>
+
+#if (PIOS_EVENTTRACE_SIZE & (PIOS_EVENTTRACE_SIZE - 1)) != 0
+#error PIOS_EVENTTRACE_SIZE must be a power of two
+#endif
+#define MASK (PIOS_EVENTTRACE_SIZE - 1)
+
+/*
+ * Events are recorded from tasks, the scheduler and interrupts, without a lock.
+ * Every event gets the next sequence number from head and goes to the slot at
+ * sequence modulo the ring size. The slot sequence tells the reader whether the
+ * slot holds that event: it is the complement of the sequence while the event
+ * is written, and the sequence once it is complete, like a sequence lock.
+ * Neither value is congruent to another event in the same slot.
+ */
+struct slot {
+    uint32_t sequence;
+    struct pios_eventtrace_event event;
+};
+
+static struct slot ring[PIOS_EVENTTRACE_SIZE];
+static uint32_t head;
+static uint8_t mode;
+
+// Snapshot mode, recording stops at stopAt once triggered
+static uint8_t triggerClaimed;
+static bool triggered;
+static uint32_t stopAt;
+static bool frozen;
+
+/**
+ * Initialise the ring, nothing is recorded until a mode is set
+ */
+void PIOS_EVENTTRACE_Init(void)
+{
+    mode = PIOS_EVENTTRACE_MODE_OFF;
+    head = 0;
+    for (uint32_t i = 0; i < PIOS_EVENTTRACE_SIZE; i++) {
+        // as if the previous round had been written
+        ring[i].sequence = i - PIOS_EVENTTRACE_SIZE;
+    }
+    PIOS_EVENTTRACE_Rearm();
+}
+
+/**
+ * Start or stop recording
+ * @param newMode the new mode, switching rearms the snapshot
+ */
+void PIOS_EVENTTRACE_SetMode(enum pios_eventtrace_mode newMode)
+{
+    __atomic_store_n(&mode, PIOS_EVENTTRACE_MODE_OFF, __ATOMIC_SEQ_CST);
+    PIOS_EVENTTRACE_Rearm();
+    __atomic_store_n(&mode, newMode, __ATOMIC_SEQ_CST);
+}
+
+enum pios_eventtrace_mode PIOS_EVENTTRACE_GetMode(void)
+{
+    return __atomic_load_n(&mode, __ATOMIC_RELAXED);
+}
+
+/**
+ * Record an event, from any context including interrupts and the scheduler.
+ * @param type one of pios_eventtrace_type
+ * @param id what the event is about, depends on the type
+ * @param aux more about the event, depends on the type
+ */
+void PIOS_EVENTTRACE_Record(uint8_t type, uint32_t id, uint16_t aux)
+{
+    if (__atomic_load_n(&mode, __ATOMIC_RELAXED) == PIOS_EVENTTRACE_MODE_OFF || __atomic_load_n(&frozen, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    uint32_t time     = PIOS_DELAY_GetRaw();
+    uint32_t sequence = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+
+    if (__atomic_load_n(&triggered, __ATOMIC_ACQUIRE) && (int32_t)(sequence - stopAt) >= 0) {
+        // the snapshot is complete
+        __atomic_store_n(&frozen, true, __ATOMIC_RELAXED);
+        return;
+    }
+
+    struct slot *s = &ring[sequence & MASK];
+    __atomic_store_n(&s->sequence, ~sequence, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    s->event.time = time;
+    s->event.id   = id;
+    s->event.aux  = aux;
+    s->event.type = type;
+
+    __atomic_store_n(&s->sequence, sequence, __ATOMIC_RELEASE);
+}
+
+/**
+ * Mark something worth looking at, e.g. a missed deadline. In snapshot mode the
+ * first trigger lets half a ring more be recorded, then recording stops until
+ * PIOS_EVENTTRACE_Rearm() so that the reader gets what led to the trigger and
+ * what followed.
+ * @param reason recorded as the id of the trigger event
+ */
+void PIOS_EVENTTRACE_Trigger(uint32_t reason)
+{
+    if (__atomic_load_n(&mode, __ATOMIC_RELAXED) == PIOS_EVENTTRACE_MODE_SNAPSHOT
+        && __atomic_exchange_n(&triggerClaimed, 1, __ATOMIC_ACQ_REL) == 0) {
+        stopAt = __atomic_load_n(&head, __ATOMIC_RELAXED) + PIOS_EVENTTRACE_SIZE / 2;
+        __atomic_store_n(&triggered, true, __ATOMIC_RELEASE);
+    }
+    PIOS_EVENTTRACE_Record(PIOS_EVENTTRACE_TRIGGER, reason, 0);
+}
+
+/**
+ * @return true if a snapshot is complete and waits to be read
+ */
+bool PIOS_EVENTTRACE_IsFrozen(void)
+{
+    return __atomic_load_n(&frozen, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * Wait for the next trigger, after a snapshot has been read
+ */
+void PIOS_EVENTTRACE_Rearm(void)
+{
+    __atomic_store_n(&triggered, false, __ATOMIC_RELAXED);
+    __atomic_store_n(&frozen, false, __ATOMIC_RELAXED);
+    __atomic_store_n(&triggerClaimed, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * Copy events out of the ring, oldest first. There must only be one reader.
+ * In continuous mode the reader follows the writers, in snapshot mode nothing
+ * is read until the snapshot is complete, then the whole snapshot.
+ * @param[in,out] next sequence of the next event to read, updated
+ * @param[out] events where to copy the events
+ * @param[in] max room in events
+ * @param[in,out] lost incremented by the number of events that were overwritten before they were read
+ * @return the number of events copied
+ */
+uint16_t PIOS_EVENTTRACE_Read(uint32_t *next, struct pios_eventtrace_event *events, uint16_t max, uint32_t *lost)
+{
+    uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+
+    if (__atomic_load_n(&mode, __ATOMIC_RELAXED) == PIOS_EVENTTRACE_MODE_SNAPSHOT) {
+        if (!PIOS_EVENTTRACE_IsFrozen()) {
+            return 0;
+        }
+        if ((int32_t)(end - stopAt) > 0) {
+            end = stopAt;
+        }
+        if ((int32_t)(end - *next) > PIOS_EVENTTRACE_SIZE) {
+            // events from before the snapshot are not lost, they were never meant to be read
+            *next = end - PIOS_EVENTTRACE_SIZE;
+        }
+    }
+
+    uint16_t count = 0;
+    while (count < max && (int32_t)(end - *next) > 0) {
+        if ((int32_t)(end - *next) > PIOS_EVENTTRACE_SIZE) {
+            // Too far behind, the oldest events are gone
+            *lost += end - PIOS_EVENTTRACE_SIZE - *next;
+            *next  = end - PIOS_EVENTTRACE_SIZE;
+        }
+
+        struct slot *s    = &ring[*next & MASK];
+        uint32_t sequence = __atomic_load_n(&s->sequence, __ATOMIC_ACQUIRE);
+        if (sequence != *next) {
+            if (sequence == ~*next || sequence == *next - PIOS_EVENTTRACE_SIZE) {
+                // a writer that was interrupted did not finish yet, come back later
+                break;
+            }
+            // overwritten by a later round
+            (*lost)++;
+            (*next)++;
+            continue;
+        }
+
+        events[count] = s->event;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&s->sequence, __ATOMIC_RELAXED) == sequence) {
+            count++;
+        } else {
+            // overwritten while it was copied
+            (*lost)++;
+        }
+        (*next)++;
+    }
+
+    return count;
+}
+
+/**
+ * @return the number of events recorded since the start, wraps around
+ */
+uint32_t PIOS_EVENTTRACE_GetRecorded(void)
+{
+    return __atomic_load_n(&head, __ATOMIC_RELAXED);
+}
+
+#endif /* PIOS_INCLUDE_EVENTTRACE */
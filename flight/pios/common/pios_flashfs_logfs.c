@@ -35,6 +35,17 @@
 #include <pios_wdg.h>
 #include "pios_flashfs_logfs_priv.h"
 
+/*
+ * Filesystems with up to this many slots per arena keep an index of their
+ * active slots in RAM (one byte per slot), larger ones are searched in flash
+ */
+#ifndef PIOS_FLASHFS_LOGFS_INDEX_MAX_SLOTS
+#define PIOS_FLASHFS_LOGFS_INDEX_MAX_SLOTS 1024
+#endif
+
+/* Index value of a slot that does not hold an active object */
+#define LOGFS_SLOT_KEY_INACTIVE 0xFF
+
 /*
  * Filesystem state data tracked in RAM
  */
@@ -56,6 +67,11 @@ struct logfs_state {
     uint16_t num_free_slots; /* slots in free state */
     uint16_t num_active_slots; /* slots in active state */
 
+    /* Short hash of the object held by each active slot of the active arena,
+     * LOGFS_SLOT_KEY_INACTIVE for all other slots. NULL if the filesystem is not indexed.
+     */
+    uint8_t *slot_keys;
+
     /* Underlying flash driver glue */
     const struct pios_flash_driver *driver;
     uintptr_t flash_id;
@@ -79,6 +95,17 @@ static uintptr_t logfs_get_addr(const struct logfs_state *logfs, uint8_t arena_i
            (slot_id * logfs->cfg->slot_size);
 }
 
+/**
+ * @brief Return the index key of an object instance
+ * @return key, never LOGFS_SLOT_KEY_INACTIVE
+ */
+static uint8_t logfs_slot_key(uint32_t obj_id, uint16_t obj_inst_id)
+{
+    uint8_t key = (uint8_t)(obj_id ^ (obj_id >> 8) ^ (obj_id >> 16) ^ (obj_id >> 24) ^ obj_inst_id ^ (obj_inst_id >> 8));
+
+    return (key == LOGFS_SLOT_KEY_INACTIVE) ? key - 1 : key;
+}
+
 /*
  * The bits within these enum values must progress ONLY
  * from 1 -> 0 so that we can write later ones on top
@@ -461,6 +488,11 @@ static int32_t logfs_mount_log(struct logfs_state *logfs, uint8_t arena_id)
             return -2;
         }
 
+        if (logfs->slot_keys) {
+            logfs->slot_keys[slot_id] = (slot_hdr.state == SLOT_STATE_ACTIVE) ?
+                                        logfs_slot_key(slot_hdr.obj_id, slot_hdr.obj_inst_id) : LOGFS_SLOT_KEY_INACTIVE;
+        }
+
         switch (slot_hdr.state) {
         case SLOT_STATE_EMPTY:
             logfs->num_free_slots++;
@@ -493,7 +525,7 @@ static bool PIOS_FLASHFS_Logfs_validate(const struct logfs_state *logfs)
 }
 
 #if defined(PIOS_INCLUDE_FREERTOS)
-static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(void)
+static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(const struct flashfs_logfs_cfg *cfg)
 {
     struct logfs_state *logfs;
 
@@ -502,6 +534,13 @@ static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(void)
         return NULL;
     }
 
+    /* The index is an optimization, the filesystem works without it */
+    uint32_t num_slots = cfg->arena_size / cfg->slot_size;
+    logfs->slot_keys = NULL;
+    if (num_slots <= PIOS_FLASHFS_LOGFS_INDEX_MAX_SLOTS) {
+        logfs->slot_keys = (uint8_t *)pios_malloc(num_slots);
+    }
+
     logfs->magic = PIOS_FLASHFS_LOGFS_DEV_MAGIC;
     return logfs;
 }
@@ -509,12 +548,15 @@ static void PIOS_FLASHFS_Logfs_free(struct logfs_state *logfs)
 {
     /* Invalidate the magic */
     logfs->magic = ~PIOS_FLASHFS_LOGFS_DEV_MAGIC;
+    if (logfs->slot_keys) {
+        vPortFree(logfs->slot_keys);
+    }
     vPortFree(logfs);
 }
 #else
 static struct logfs_state pios_flashfs_logfs_devs[PIOS_FLASHFS_LOGFS_MAX_DEVS];
 static uint8_t pios_flashfs_logfs_num_devs;
-static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(void)
+static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(__attribute__((unused)) const struct flashfs_logfs_cfg *cfg)
 {
     struct logfs_state *logfs;
 
@@ -525,6 +567,9 @@ static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(void)
     logfs = &pios_flashfs_logfs_devs[pios_flashfs_logfs_num_devs++];
     logfs->magic = PIOS_FLASHFS_LOGFS_DEV_MAGIC;
 
+    /* No heap, search the slots in flash */
+    logfs->slot_keys = NULL;
+
     return logfs;
 }
 static void PIOS_FLASHFS_Logfs_free(struct logfs_state *logfs)
@@ -565,7 +610,7 @@ int32_t PIOS_FLASHFS_Logfs_Init(uintptr_t *fs_id, const struct flashfs_logfs_cfg
 
     struct logfs_state *logfs;
 
-    logfs = (struct logfs_state *)PIOS_FLASHFS_Logfs_alloc();
+    logfs = (struct logfs_state *)PIOS_FLASHFS_Logfs_alloc(cfg);
     if (logfs) {
         while (rc && count++ < 2) {
             /* Bind configuration parameters to this filesystem instance */
@@ -725,6 +770,36 @@ static int16_t logfs_object_find_next(const struct logfs_state *logfs, struct sl
         *curr_slot = 1;
     }
 
+    if (logfs->slot_keys) {
+        /* Only read the headers of the active slots whose key matches */
+        uint8_t key = logfs_slot_key(obj_id, obj_inst_id);
+        for (uint16_t slot_id = *curr_slot;
+             slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
+             slot_id++) {
+            if (logfs->slot_keys[slot_id] != key) {
+                continue;
+            }
+
+            uintptr_t slot_addr = logfs_get_addr(logfs, logfs->active_arena_id, slot_id);
+            if (logfs->driver->read_data(logfs->flash_id,
+                                         slot_addr,
+                                         (uint8_t *)slot_hdr,
+                                         sizeof(*slot_hdr)) != 0) {
+                return -2;
+            }
+            if (slot_hdr->state == SLOT_STATE_ACTIVE &&
+                slot_hdr->obj_id == obj_id &&
+                slot_hdr->obj_inst_id == obj_inst_id) {
+                /* Found what we were looking for */
+                *curr_slot = slot_id;
+                return 0;
+            }
+        }
+
+        /* No matching entry was found */
+        return -1;
+    }
+
     for (uint16_t slot_id = *curr_slot;
          slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
          slot_id++) {
@@ -757,7 +832,7 @@ static int16_t logfs_object_find_next(const struct logfs_state *logfs, struct sl
 }
 
 /* NOTE: Must be called while holding the flash transaction lock */
-/* OPTIMIZE: could trust that there is at most one active version of every object and terminate the search when we find one */
+/* NOTE: with the slot index, searching past the active version only costs RAM reads */
 static int8_t logfs_delete_object(struct logfs_state *logfs, uint32_t obj_id, uint16_t obj_inst_id)
 {
     int8_t rc;
@@ -782,6 +857,9 @@ static int8_t logfs_delete_object(struct logfs_state *logfs, uint32_t obj_id, ui
             }
             /* Object has been successfully obsoleted and is no longer active */
             logfs->num_active_slots--;
+            if (logfs->slot_keys) {
+                logfs->slot_keys[curr_slot_id] = LOGFS_SLOT_KEY_INACTIVE;
+            }
             break;
         case -1:
             /* Search completed, object not found */
@@ -902,6 +980,9 @@ static int8_t logfs_append_to_log(struct logfs_state *logfs, uint32_t obj_id, ui
 
     /* Object has been successfully written to the slot */
     logfs->num_active_slots++;
+    if (logfs->slot_keys) {
+        logfs->slot_keys[free_slot_id] = logfs_slot_key(obj_id, obj_inst_id);
+    }
     return 0;
 }
 
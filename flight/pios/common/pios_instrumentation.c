@@ -80,3 +80,59 @@ void PIOS_Instrumentation_ForEachCounter(InstrumentationCounterCallback callback
         callback(counter, index, context);
     }
 }
+
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+uint32_t PIOS_Instrumentation_TakeHistogram(pios_counter_t counter_handle, uint32_t *histogram)
+{
+    PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
+    pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
+
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    memcpy(histogram, counter->histogram, sizeof(counter->histogram));
+    memset(counter->histogram, 0, sizeof(counter->histogram));
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+
+    uint32_t count = 0;
+    for (uint8_t bucket = 0; bucket < PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS; bucket++) {
+        count += histogram[bucket];
+    }
+    return count;
+}
+
+// lowest value counted in a bucket @see PIOS_Instrumentation_HistogramBucket
+static int32_t bucketStart(uint8_t bucket)
+{
+    if (bucket < 2) {
+        return bucket;
+    }
+    return (2 + (bucket & 1)) << (bucket / 2 - 1);
+}
+
+int32_t PIOS_Instrumentation_HistogramPercentile(const uint32_t *histogram, uint32_t count, uint16_t permille)
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    // rank of the percentile, counted from 1
+    uint32_t rank = ((uint64_t)count * permille + 999) / 1000;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t below = 0;
+    uint8_t bucket = 0;
+    while (bucket < PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1 && below + histogram[bucket] < rank) {
+        below += histogram[bucket++];
+    }
+
+    // the values are assumed to be spread evenly over the bucket, each in the middle of its
+    // share of it, the last bucket is open ended and has no width
+    int32_t start = bucketStart(bucket);
+    int32_t width = bucket < PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1 ? bucketStart(bucket + 1) - start : 0;
+    if (histogram[bucket] == 0) {
+        return start;
+    }
+    return start + (int32_t)(((uint64_t)width * (2 * (rank - below) - 1)) / (2 * histogram[bucket]));
+}
+#endif /* PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0 */
@@ -75,6 +75,10 @@ int32_t PIOS_TASK_MONITOR_RegisterTask(uint16_t task_id, xTaskHandle handle)
     if (mTaskHandles && task_id < mMaxTasks) {
         xSemaphoreTakeRecursive(mLock, portMAX_DELAY);
         mTaskHandles[task_id] = handle;
+#ifdef PIOS_INCLUDE_EVENTTRACE
+        // the event trace tells tasks apart by their number, 0 is for tasks without a task_id
+        vTaskSetTaskNumber(handle, task_id + 1);
+#endif
         xSemaphoreGiveRecursive(mLock);
         return 0;
     } else {
@@ -89,6 +93,11 @@ int32_t PIOS_TASK_MONITOR_UnregisterTask(uint16_t task_id)
 {
     if (mTaskHandles && task_id < mMaxTasks) {
         xSemaphoreTakeRecursive(mLock, portMAX_DELAY);
+#ifdef PIOS_INCLUDE_EVENTTRACE
+        if (mTaskHandles[task_id]) {
+            vTaskSetTaskNumber(mTaskHandles[task_id], 0);
+        }
+#endif
         mTaskHandles[task_id] = 0;
         xSemaphoreGiveRecursive(mLock);
         return 0;
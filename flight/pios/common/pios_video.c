@@ -51,11 +51,12 @@ static const struct pios_video_cfg *dev_cfg;
 // For 192x128 pixel mode, allocations are as the names are written.
 // divide by 8 because two bytes to a word.
 // Must be allocated in one block, so it is in a struct.
+// Word aligned, the OSD renderer fills them a word at a time.
 struct _buffers {
-    uint8_t buffer0_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
-    uint8_t buffer0_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
-    uint8_t buffer1_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
-    uint8_t buffer1_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
+    uint8_t buffer0_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH] __attribute__((aligned(4)));
+    uint8_t buffer0_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH] __attribute__((aligned(4)));
+    uint8_t buffer1_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH] __attribute__((aligned(4)));
+    uint8_t buffer1_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH] __attribute__((aligned(4)));
 } buffers;
 
 // Remove the struct definition (makes it easier to write for.)
@@ -26,6 +26,13 @@
 #ifndef PIOS_CALLBACKSCHEDULER_H
 #define PIOS_CALLBACKSCHEDULER_H
 
+// Number of buckets of the dispatch to run latency histogram, bucket n counts latencies
+// below 2^n us, the last one all longer latencies. Define PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+// in pios_config.h to collect the histogram.
+#ifndef PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS
+#define PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS 16
+#endif
+
 // Public types
 typedef enum {
     CALLBACK_PRIORITY_CRITICAL = 0,
@@ -197,6 +204,10 @@ struct pios_callback_info {
     bool     is_running;
     /** Count of executions of the callback since system start */
     uint32_t running_time_count;
+#ifdef PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+    /** Count of executions by latency between dispatch and execution */
+    uint32_t latency_histogram[PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS];
+#endif
 };
 
 /**
@@ -0,0 +1,93 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_eventtrace.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      PiOS event trace
+ *             Records task switches, callbacks, UAVObject events and interrupts
+ *             with their time in a RAM ring
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef PIOS_EVENTTRACE_H
+#define PIOS_EVENTTRACE_H
+
+/*
+ * This header is also included by FreeRTOSConfig.h to hook the task switches,
+ * so it must not include pios.h or FreeRTOS.h.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+// Number of events in the ring, a power of two. Each event takes 16 bytes.
+#ifndef PIOS_EVENTTRACE_SIZE
+#define PIOS_EVENTTRACE_SIZE 512
+#endif
+
+/* Event types, in the order of the Type options of the EventTrace UAVObject */
+enum pios_eventtrace_type {
+    PIOS_EVENTTRACE_TASK_SWITCH    = 0, /* id: task number, TaskInfo element + 1, 0 for tasks without one */
+    PIOS_EVENTTRACE_CALLBACK_START = 1, /* id: CallbackInfo element, aux: callback priority */
+    PIOS_EVENTTRACE_CALLBACK_END   = 2, /* id: CallbackInfo element, aux: callback priority */
+    PIOS_EVENTTRACE_OBJECT_SEND    = 3, /* id: object id, aux: event */
+    PIOS_EVENTTRACE_OBJECT_RECEIVE = 4, /* id: object id, aux: event */
+    PIOS_EVENTTRACE_ISR_ENTER      = 5, /* id: interrupt number (IRQn) */
+    PIOS_EVENTTRACE_ISR_EXIT       = 6, /* id: interrupt number (IRQn) */
+    PIOS_EVENTTRACE_TRIGGER        = 7, /* id: reason, the SystemAlarms Alarm element of the check that failed */
+};
+
+enum pios_eventtrace_mode {
+    PIOS_EVENTTRACE_MODE_OFF        = 0, /* nothing is recorded */
+    PIOS_EVENTTRACE_MODE_CONTINUOUS = 1, /* the ring is read while it is written */
+    PIOS_EVENTTRACE_MODE_SNAPSHOT   = 2, /* recording stops half a ring after a trigger, until rearmed */
+};
+
+struct pios_eventtrace_event {
+    uint32_t time; /* PIOS_DELAY_GetRaw() */
+    uint32_t id;
+    uint16_t aux;
+    uint8_t  type;
+};
+
+#ifdef PIOS_INCLUDE_EVENTTRACE
+
+extern void PIOS_EVENTTRACE_Init(void);
+extern void PIOS_EVENTTRACE_SetMode(enum pios_eventtrace_mode mode);
+extern enum pios_eventtrace_mode PIOS_EVENTTRACE_GetMode(void);
+extern void PIOS_EVENTTRACE_Record(uint8_t type, uint32_t id, uint16_t aux);
+extern void PIOS_EVENTTRACE_Trigger(uint32_t reason);
+extern bool PIOS_EVENTTRACE_IsFrozen(void);
+extern void PIOS_EVENTTRACE_Rearm(void);
+extern uint16_t PIOS_EVENTTRACE_Read(uint32_t *next, struct pios_eventtrace_event *events, uint16_t max, uint32_t *lost);
+extern uint32_t PIOS_EVENTTRACE_GetRecorded(void);
+
+#define PIOS_EVENTTRACE(type, id, aux) PIOS_EVENTTRACE_Record((type), (id), (aux))
+#define PIOS_EVENTTRACE_TRIGGER(reason) PIOS_EVENTTRACE_Trigger(reason)
+
+#else /* PIOS_INCLUDE_EVENTTRACE */
+
+#define PIOS_EVENTTRACE(type, id, aux)
+#define PIOS_EVENTTRACE_TRIGGER(reason)
+
+#endif /* PIOS_INCLUDE_EVENTTRACE */
+
+/* Interrupt handlers that matter for the timing of the control loop are wrapped with these */
+#define PIOS_EVENTTRACE_IRQ_ENTER(irq)  PIOS_EVENTTRACE(PIOS_EVENTTRACE_ISR_ENTER, (irq), 0)
+#define PIOS_EVENTTRACE_IRQ_EXIT(irq)   PIOS_EVENTTRACE(PIOS_EVENTTRACE_ISR_EXIT, (irq), 0)
+
+#endif /* PIOS_EVENTTRACE_H */
@@ -29,12 +29,25 @@
 #include <pios_debug.h>
 #include <pios_delay.h>
 #include <FreeRTOS.h>
+
+// Number of buckets of the histogram kept for each counter. There are two buckets per
+// power of two, bucket 2n counts values from 2^n to 1.5 * 2^n, bucket 2n + 1 from
+// 1.5 * 2^n to 2^(n + 1). Values below 2 have a bucket each, the last bucket also
+// counts all larger values. The histogram costs 4 bytes of RAM per bucket and counter,
+// boards opt in by defining it in pios_config.h, 32 covers values up to 2^16.
+#ifndef PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS
+#define PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS 0
+#endif
+
 typedef struct {
     uint32_t id;
     int32_t  max;
     int32_t  min;
     int32_t  value;
     uint32_t lastUpdateTS;
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+    uint32_t histogram[PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS];
+#endif
 } pios_perf_counter_t;
 
 typedef void *pios_counter_t;
@@ -42,6 +55,35 @@ typedef void *pios_counter_t;
 extern pios_perf_counter_t *pios_instrumentation_perf_counters;
 extern int8_t pios_instrumentation_last_used_counter;
 
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+/**
+ * Histogram bucket of a value @see PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS
+ * @param value the value
+ * @return the bucket index
+ */
+static inline uint8_t PIOS_Instrumentation_HistogramBucket(int32_t value)
+{
+    if (value < 2) {
+        return value > 0 ? value : 0;
+    }
+    uint8_t msb    = 31 - __builtin_clz(value);
+    uint8_t bucket = 2 * msb + ((value >> (msb - 1)) & 1);
+    return bucket < PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS ? bucket : PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1;
+}
+#endif /* PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0 */
+
+/**
+ * Count a value in the histogram of a counter, if the board keeps one
+ * @param counter the counter
+ * @param value the value
+ */
+static inline void PIOS_Instrumentation_countValue(__attribute__((unused)) pios_perf_counter_t *counter, __attribute__((unused)) int32_t value)
+{
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+    counter->histogram[PIOS_Instrumentation_HistogramBucket(value)]++;
+#endif
+}
+
 /**
  * Update a counter with a new value
  * @param counter_handle handle of the counter to update @see PIOS_Instrumentation_SearchCounter @see PIOS_Instrumentation_CreateCounter
@@ -50,9 +92,10 @@ extern int8_t pios_instrumentation_last_used_counter;
 static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_handle, int32_t newValue)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
     counter->value = newValue;
+    PIOS_Instrumentation_countValue(counter, newValue);
     counter->max--;
     if (counter->value > counter->max) {
         counter->max = counter->value;
@@ -62,7 +105,7 @@ static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_han
         counter->min = counter->value;
     }
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
 }
 
 /**
@@ -72,11 +115,11 @@ static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_han
 static inline void PIOS_Instrumentation_TimeStart(pios_counter_t counter_handle)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
 
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
 }
 
 /**
@@ -86,10 +129,11 @@ static inline void PIOS_Instrumentation_TimeStart(pios_counter_t counter_handle)
 static inline void PIOS_Instrumentation_TimeEnd(pios_counter_t counter_handle)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
 
     counter->value = PIOS_DELAY_DiffuS(counter->lastUpdateTS);
+    PIOS_Instrumentation_countValue(counter, counter->value);
     counter->max--;
     if (counter->value > counter->max) {
         counter->max = counter->value;
@@ -99,7 +143,7 @@ static inline void PIOS_Instrumentation_TimeEnd(pios_counter_t counter_handle)
         counter->min = counter->value;
     }
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
 }
 
 /**
@@ -111,9 +155,10 @@ static inline void PIOS_Instrumentation_TrackPeriod(pios_counter_t counter_handl
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
     if (counter->lastUpdateTS != 0) {
-        vPortEnterCritical();
+        UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
         uint32_t period = PIOS_DELAY_DiffuS(counter->lastUpdateTS);
         counter->value = (counter->value * 15 + period) / 16;
+        PIOS_Instrumentation_countValue(counter, period);
         counter->max--;
         if ((int32_t)period > counter->max) {
             counter->max = period;
@@ -122,7 +167,7 @@ static inline void PIOS_Instrumentation_TrackPeriod(pios_counter_t counter_handl
         if ((int32_t)period < counter->min) {
             counter->min = period;
         }
-        vPortExitCritical();
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
     }
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
 }
@@ -135,9 +180,10 @@ static inline void PIOS_Instrumentation_TrackPeriod(pios_counter_t counter_handl
 static inline void PIOS_Instrumentation_incrementCounter(pios_counter_t counter_handle, int32_t increment)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
     counter->value += increment;
+    PIOS_Instrumentation_countValue(counter, counter->value);
     counter->max--;
     if (counter->value > counter->max) {
         counter->max = counter->value;
@@ -147,7 +193,7 @@ static inline void PIOS_Instrumentation_incrementCounter(pios_counter_t counter_
         counter->min = counter->value;
     }
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
 }
 
 /**
@@ -171,6 +217,25 @@ pios_counter_t PIOS_Instrumentation_CreateCounter(uint32_t id);
  */
 pios_counter_t PIOS_Instrumentation_SearchCounter(uint32_t id);
 
+#if PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0
+/**
+ * Copy the histogram of a counter and start a new one
+ * @param counter_handle handle of the counter @see PIOS_Instrumentation_SearchCounter @see PIOS_Instrumentation_CreateCounter
+ * @param histogram receives the PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS buckets of the counter
+ * @return the number of values in the histogram
+ */
+uint32_t PIOS_Instrumentation_TakeHistogram(pios_counter_t counter_handle, uint32_t *histogram);
+
+/**
+ * Estimate a percentile of the values in a histogram
+ * @param histogram the PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS buckets @see PIOS_Instrumentation_TakeHistogram
+ * @param count the number of values in the histogram
+ * @param permille the percentile in tenths of a percent, 500 for the median, 999 for p99.9
+ * @return the estimate, interpolated within the bucket it falls in, 0 if the histogram is empty
+ */
+int32_t PIOS_Instrumentation_HistogramPercentile(const uint32_t *histogram, uint32_t count, uint16_t permille);
+#endif /* PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS > 0 */
+
 typedef void (*InstrumentationCounterCallback)(const pios_perf_counter_t *counter, const int8_t index, void *context);
 /**
  * Retrieve and execute the passed callback for each counter
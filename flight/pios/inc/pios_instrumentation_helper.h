@@ -79,6 +79,10 @@
  * <pre>PERF_TRACK_VALUE(counterAccelSamples, i);</pre>
  * the counter is then updated with the value of i.
  *
+ * Each counter also keeps a histogram of the section times, periods or values. The System module
+ * publishes its P50, P99 and P99.9 with the counter and starts a new histogram every time.
+ * All the macros above can be used from interrupt handlers too.
+ *
  * \par
  */
 
@@ -63,6 +63,13 @@ int32_t PIOS_DELAY_WaituS(uint32_t uS)
 {
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortIsLockstep()) {
+        // simulated time does not pass while a task is running
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = 0;
     wait.tv_nsec = 1000 * uS;
     while (nanosleep(&wait, &rest) != 0) {
@@ -90,6 +97,12 @@ int32_t PIOS_DELAY_WaitmS(uint32_t mS)
     // PIOS_DELAY_WaituS(1000);
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortIsLockstep()) {
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = mS / 1000;
     wait.tv_nsec = (mS % 1000) * 1000000;
     while (nanosleep(&wait, &rest) != 0) {
@@ -103,12 +116,21 @@ int32_t PIOS_DELAY_WaitmS(uint32_t mS)
 
 /**
  * @brief Query the Delay timer for the current uS
+ * In lockstep simulation this is the simulated time, see port.c
  * @return A microsecond value
  */
 uint32_t PIOS_DELAY_GetuS()
 {
     static struct timespec current;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortIsLockstep()) {
+        // the simulated clock, it only advances with the tick. Not xTaskGetTickCount(),
+        // the event trace reads the time from within the scheduler
+        return ulPortGetLockstepTicks() * portTICK_RATE_MICROSECONDS;
+    }
+#endif
+
     clock_gettime(CLOCK_REALTIME, &current);
     return (current.tv_sec * 1000000) + (current.tv_nsec / 1000);
 }
@@ -141,5 +163,14 @@ uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
     return PIOS_DELAY_GetuS() - raw;
 }
 
+/**
+ * @brief Subtract two raw times and convert to us.
+ * @return Interval between raw times in microseconds
+ */
+uint32_t PIOS_DELAY_DiffuS2(uint32_t raw, uint32_t later)
+{
+    return later - raw;
+}
+
 
 #endif /* if defined(PIOS_INCLUDE_DELAY) */
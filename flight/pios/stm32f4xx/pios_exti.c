@@ -220,7 +220,9 @@ static void PIOS_EXTI_0_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI0_IRQn);
     PIOS_EXTI_HANDLE_LINE(0, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI0_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -234,7 +236,9 @@ static void PIOS_EXTI_1_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI1_IRQn);
     PIOS_EXTI_HANDLE_LINE(1, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI1_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -248,7 +252,9 @@ static void PIOS_EXTI_2_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI2_IRQn);
     PIOS_EXTI_HANDLE_LINE(2, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI2_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -262,7 +268,9 @@ static void PIOS_EXTI_3_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI3_IRQn);
     PIOS_EXTI_HANDLE_LINE(3, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI3_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -276,7 +284,9 @@ static void PIOS_EXTI_4_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI4_IRQn);
     PIOS_EXTI_HANDLE_LINE(4, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI4_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -290,11 +300,13 @@ static void PIOS_EXTI_9_5_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI9_5_IRQn);
     PIOS_EXTI_HANDLE_LINE(5, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(6, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(7, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(8, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(9, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI9_5_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
@@ -308,12 +320,14 @@ static void PIOS_EXTI_15_10_irq_handler(void)
 #else
     bool xHigherPriorityTaskWoken;
 #endif
+    PIOS_EVENTTRACE_IRQ_ENTER(EXTI15_10_IRQn);
     PIOS_EXTI_HANDLE_LINE(10, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(11, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(12, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(13, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(14, xHigherPriorityTaskWoken);
     PIOS_EXTI_HANDLE_LINE(15, xHigherPriorityTaskWoken);
+    PIOS_EVENTTRACE_IRQ_EXIT(EXTI15_10_IRQn);
 #ifdef PIOS_INCLUDE_FREERTOS
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 #endif
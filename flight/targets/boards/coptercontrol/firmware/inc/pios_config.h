@@ -59,6 +59,7 @@
 #define PIOS_INCLUDE_TASK_MONITOR
 // #define PIOS_INCLUDE_INSTRUMENTATION
 #define PIOS_INSTRUMENTATION_MAX_COUNTERS 5
+// #define PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS 32
 
 /* PIOS hardware peripherals */
 #define PIOS_INCLUDE_IRQ
@@ -58,6 +58,7 @@
 #define PIOS_INCLUDE_TASK_MONITOR
 
 #define PIOS_INSTRUMENTATION_MAX_COUNTERS 10
+#define PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS 32
 #define PIOS_INCLUDE_INSTRUMENTATION
 
 /* PIOS hardware peripherals */
@@ -32,7 +32,6 @@
 #define configUSE_PREEMPTION                         1
 #define configUSE_IDLE_HOOK                          1
 #define configUSE_TICK_HOOK                          0
-#define configUSE_TRACE_FACILITY                     0
 #define configUSE_16_BIT_TICKS                       0
 #define configIDLE_SHOULD_YIELD                      0
 #define configUSE_MUTEXES                            1
@@ -97,6 +96,19 @@
 #define portGET_RUN_TIME_COUNTER_VALUE() (*(unsigned long *)0xe0001004) /* DWT_CYCCNT */
 
 
+/* Task switches go to the event trace when it is enabled, see pios_eventtrace.h.
+   The task number is 1 + the TaskInfo element of the task, set by the task monitor. The
+   TCB is not cleared, traceTASK_CREATE starts every task with 0. */
+#include "pios_config.h"
+#ifdef PIOS_INCLUDE_EVENTTRACE
+#include "pios_eventtrace.h"
+#define configUSE_TRACE_FACILITY                     1
+#define traceTASK_CREATE(pxNewTCB)                   (pxNewTCB)->uxTaskNumber = 0
+#define traceTASK_SWITCHED_IN()                      PIOS_EVENTTRACE_Record(PIOS_EVENTTRACE_TASK_SWITCH, pxCurrentTCB->uxTaskNumber, 0)
+#else
+#define configUSE_TRACE_FACILITY                     0
+#endif
+
 /**
  * @}
  */
@@ -59,6 +59,7 @@
 
 #define PIOS_INCLUDE_INSTRUMENTATION
 #define PIOS_INSTRUMENTATION_MAX_COUNTERS 10
+#define PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS 32
 
 /* PIOS hardware peripherals */
 #define PIOS_INCLUDE_IRQ
@@ -131,6 +132,8 @@
 /* #define PIOS_INCLUDE_FLASH_EEPROM */
 
 #define PIOS_INCLUDE_DEBUGLOG
+/* #define PIOS_INCLUDE_EVENTTRACE */
+/* #define PIOS_EVENTTRACE_SIZE 512 */
 
 /* PIOS radio modules */
 #define PIOS_INCLUDE_RFM22B
@@ -59,7 +59,6 @@
 #define configMINIMAL_STACK_SIZE                     ((unsigned short)256)
 #define configTOTAL_HEAP_SIZE                        ((size_t)(45 * 1024))
 #define configMAX_TASK_NAME_LEN                      (16)
-#define configUSE_TRACE_FACILITY                     0
 #define configUSE_16_BIT_TICKS                       0
 #define configUSE_MUTEXES                            1
 #define configUSE_RECURSIVE_MUTEXES                  1
@@ -88,6 +87,18 @@
 #define INCLUDE_uxTaskGetStackHighWaterMark          0
 
 
+/* Task switches go to the event trace when it is enabled, see pios_eventtrace.h.
+   The task number is 1 + the TaskInfo element of the task, set by the task monitor,
+   the port starts all tasks with 0 from traceTASK_CREATE. */
+#include "pios_config.h"
+#ifdef PIOS_INCLUDE_EVENTTRACE
+#include "pios_eventtrace.h"
+#define configUSE_TRACE_FACILITY                     1
+#define traceTASK_SWITCHED_IN()                      PIOS_EVENTTRACE_Record(PIOS_EVENTTRACE_TASK_SWITCH, pxCurrentTCB->uxTaskNumber, 0)
+#else
+#define configUSE_TRACE_FACILITY                     0
+#endif
+
 /* This is the raw value as per the Cortex-M3 NVIC.  Values can be 255
    (lowest) to 1 (highest maskable) to 0 (highest non-maskable). */
 #define configKERNEL_INTERRUPT_PRIORITY              15 << 4 /* equivalent to NVIC priority 15 */
@@ -37,6 +37,9 @@
 /* Major features */
 #define PIOS_INCLUDE_FREERTOS
 #define PIOS_INCLUDE_CALLBACKSCHEDULER
+#ifdef DIAG_CALLBACK_LATENCY
+#define PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM /* printed by the System module */
+#endif
 #define PIOS_INCLUDE_BL_HELPER
 
 /* Enable/Disable PiOS Modules */
@@ -100,6 +103,8 @@
 // #define PIOS_INCLUDE_FLASH_LOGFS_SETTINGS
 
 #define PIOS_INCLUDE_DEBUGLOG
+#define PIOS_INCLUDE_EVENTTRACE
+#define PIOS_EVENTTRACE_SIZE 4096
 
 /* Other Interfaces */
 // #define PIOS_INCLUDE_I2C_ESC
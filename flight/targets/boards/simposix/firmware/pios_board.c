@@ -149,6 +149,12 @@ void PIOS_Board_Init(void)
     /* Initialize the alarms library */
     AlarmsInitialize();
 
+    /* A lockstep simulation runs on its own clock, nothing outside could keep
+     * up with it, and a run must not depend on anything outside either */
+    if (xPortIsLockstep()) {
+        return;
+    }
+
     /* Configure IO ports */
 
     /* Configure Telemetry port */
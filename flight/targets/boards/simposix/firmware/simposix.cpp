@@ -37,6 +37,98 @@ extern "C" {
 #include <systemmod.h>
 #include <uavobjectsinit.h>
 #include <systemmod.h>
+#include <attitudestate.h>
+#include <flightstatus.h>
+#include <positionstate.h>
+}
+
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_REPORT_STACK_SIZE_BYTES 4096
+#define SIM_REPORT_TASK_PRIORITY    (configMAX_PRIORITIES - 1)
+#define SIM_REPORT_PERIOD_MS        100
+
+static unsigned int simSeed = 1;
+static unsigned int simDuration; // simulated seconds, 0 runs forever
+static struct timespec simStart;
+static xTaskHandle simReportTaskHandle;
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [--lockstep] [--seed N] [--duration SECONDS]\n", name);
+    fprintf(stderr, "  --lockstep          run on a simulated clock as fast as possible instead of in real time\n");
+    fprintf(stderr, "  --seed N            seed of the simulated sensor noise, default 1\n");
+    fprintf(stderr, "  --duration SECONDS  exit with a report after SECONDS of simulated time\n");
+}
+
+static double secondsSince(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Watches the flight for --duration simulated seconds, then prints one line
+ * for the run and exits. Runs at the highest priority, so it samples at the
+ * same simulated times in every run.
+ */
+static void simReportTask(__attribute__((unused)) void *parameters)
+{
+    const portTickType period = SIM_REPORT_PERIOD_MS / portTICK_RATE_MS;
+    const portTickType end    = xTaskGetTickCount() + simDuration * configTICK_RATE_HZ;
+    portTickType lastSysTime  = xTaskGetTickCount();
+    float maxRoll  = 0.0f;
+    float maxPitch = 0.0f;
+    AttitudeStateData attitude;
+    PositionStateData position;
+    FlightStatusData flightStatus;
+
+    memset(&attitude, 0, sizeof(attitude));
+    memset(&position, 0, sizeof(position));
+    memset(&flightStatus, 0, sizeof(flightStatus));
+
+    while ((int32_t)(end - xTaskGetTickCount()) > 0) {
+        vTaskDelayUntil(&lastSysTime, period);
+
+        // the objects are only there once the System task has initialised the modules
+        if (AttitudeStateHandle()) {
+            AttitudeStateGet(&attitude);
+            maxRoll  = fmaxf(maxRoll, fabsf(attitude.Roll));
+            maxPitch = fmaxf(maxPitch, fabsf(attitude.Pitch));
+        }
+    }
+
+    if (AttitudeStateHandle()) {
+        AttitudeStateGet(&attitude);
+    }
+    if (PositionStateHandle()) {
+        PositionStateGet(&position);
+    }
+    if (FlightStatusHandle()) {
+        FlightStatusGet(&flightStatus);
+    }
+
+    double wall = secondsSince(&simStart);
+#ifdef PIOS_INCLUDE_EVENTTRACE
+    unsigned int traceEvents = PIOS_EVENTTRACE_GetRecorded();
+#else
+    unsigned int traceEvents = 0;
+#endif
+    printf("simposix: seed=%u simulated=%us wall=%.2fs speedup=%.1f late_ticks=%lu trace_events=%u"
+           " armed=%u mode=%u north=%.2f east=%.2f down=%.2f roll=%.2f pitch=%.2f yaw=%.2f max_roll=%.2f max_pitch=%.2f\n",
+           simSeed, simDuration, wall, simDuration / wall, ulPortGetLockstepLateTicks(), traceEvents,
+           flightStatus.Armed, flightStatus.FlightMode, (double)position.North, (double)position.East, (double)position.Down,
+           (double)attitude.Roll, (double)attitude.Pitch, (double)attitude.Yaw, (double)maxRoll, (double)maxPitch);
+    fflush(stdout);
+
+    exit(0);
 }
 
 /**
@@ -48,13 +140,50 @@ extern "C" {
  * If something goes wrong, blink LED1 and LED2 every 100ms
  *
  */
-int main()
+int main(int argc, char *argv[])
 {
+    static const struct option options[] = {
+        { "lockstep", no_argument,       NULL, 'l' },
+        { "seed",     required_argument, NULL, 's' },
+        { "duration", required_argument, NULL, 'd' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL,       0,                 NULL, 0   }
+    };
+    int option;
+
+    while ((option = getopt_long(argc, argv, "ls:d:h", options, NULL)) != -1) {
+        switch (option) {
+        case 'l':
+            vPortSetLockstep(pdTRUE);
+            break;
+        case 's':
+            simSeed = strtoul(optarg, NULL, 0);
+            break;
+        case 'd':
+            simDuration = strtoul(optarg, NULL, 0);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // all noise of the simulated sensors comes from rand()
+    srand(simSeed);
+    clock_gettime(CLOCK_MONOTONIC, &simStart);
+
     /* Brings up System using CMSIS functions, enables the LEDs. */
     PIOS_SYS_Init();
 
     SystemModStart();
 
+    if (simDuration > 0) {
+        xTaskCreate(simReportTask, "SimReport", SIM_REPORT_STACK_SIZE_BYTES / 4, NULL, SIM_REPORT_TASK_PRIORITY, &simReportTaskHandle);
+    }
+
     /* Start the FreeRTOS scheduler */
     vTaskStartScheduler();
 
@@ -0,0 +1,6 @@
+#ifndef ACTUATORCOMMAND_H
+#define ACTUATORCOMMAND_H
+
+#define ACTUATORCOMMAND_CHANNEL_NUMELEM 12
+
+#endif /* ACTUATORCOMMAND_H */
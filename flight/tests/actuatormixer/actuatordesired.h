@@ -0,0 +1,13 @@
+#ifndef ACTUATORDESIRED_H
+#define ACTUATORDESIRED_H
+
+typedef struct {
+    float Roll;
+    float Pitch;
+    float Yaw;
+    float Thrust;
+    float UpdateTime;
+    float NumLongUpdates;
+} __attribute__((packed)) ActuatorDesiredData;
+
+#endif /* ACTUATORDESIRED_H */
@@ -0,0 +1,70 @@
+#ifndef MIXERSETTINGS_H
+#define MIXERSETTINGS_H
+
+#include <stdint.h>
+
+typedef enum {
+    MIXERSETTINGS_MIXER1TYPE_DISABLED = 0,
+    MIXERSETTINGS_MIXER1TYPE_MOTOR = 1,
+    MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR = 2,
+    MIXERSETTINGS_MIXER1TYPE_SERVO = 3,
+    MIXERSETTINGS_MIXER1TYPE_CAMERAROLLORSERVO1 = 4,
+    MIXERSETTINGS_MIXER1TYPE_CAMERAPITCHORSERVO2 = 5,
+    MIXERSETTINGS_MIXER1TYPE_CAMERAYAW = 6,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY0 = 7,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY1 = 8,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY2 = 9,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY3 = 10,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY4 = 11,
+    MIXERSETTINGS_MIXER1TYPE_ACCESSORY5 = 12
+} MixerSettingsMixer1TypeOptions;
+
+typedef enum {
+    MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1 = 0,
+    MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2 = 1,
+    MIXERSETTINGS_MIXER1VECTOR_ROLL = 2,
+    MIXERSETTINGS_MIXER1VECTOR_PITCH = 3,
+    MIXERSETTINGS_MIXER1VECTOR_YAW = 4
+} MixerSettingsMixer1VectorElem;
+
+#define MIXERSETTINGS_MIXER1VECTOR_NUMELEM 5
+#define MIXERSETTINGS_THROTTLECURVE1_NUMELEM 5
+#define MIXERSETTINGS_THROTTLECURVE2_NUMELEM 5
+
+/* Layout as generated: fields sorted by size, the mixers in sequence */
+typedef struct {
+    float   ThrottleCurve1[5];
+    float   ThrottleCurve2[5];
+    int8_t  MixerValueRoll;
+    int8_t  MixerValuePitch;
+    int8_t  MixerValueYaw;
+    int8_t  RollDifferential;
+    uint8_t FirstRollServo;
+    uint8_t Curve2Source;
+    uint8_t Mixer1Type;
+    int8_t  Mixer1Vector[5];
+    uint8_t Mixer2Type;
+    int8_t  Mixer2Vector[5];
+    uint8_t Mixer3Type;
+    int8_t  Mixer3Vector[5];
+    uint8_t Mixer4Type;
+    int8_t  Mixer4Vector[5];
+    uint8_t Mixer5Type;
+    int8_t  Mixer5Vector[5];
+    uint8_t Mixer6Type;
+    int8_t  Mixer6Vector[5];
+    uint8_t Mixer7Type;
+    int8_t  Mixer7Vector[5];
+    uint8_t Mixer8Type;
+    int8_t  Mixer8Vector[5];
+    uint8_t Mixer9Type;
+    int8_t  Mixer9Vector[5];
+    uint8_t Mixer10Type;
+    int8_t  Mixer10Vector[5];
+    uint8_t Mixer11Type;
+    int8_t  Mixer11Vector[5];
+    uint8_t Mixer12Type;
+    int8_t  Mixer12Vector[5];
+} __attribute__((packed)) MixerSettingsData;
+
+#endif /* MIXERSETTINGS_H */
@@ -0,0 +1,6 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdbool.h>
+
+#endif /* OPENPILOT_H */
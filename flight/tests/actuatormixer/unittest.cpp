@@ -0,0 +1,232 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <math.h>
+#include <time.h>
+
+extern "C" {
+#include "actuatormixer.h"
+}
+
+#define SAMPLES 20000
+
+/*
+ * The mixer as it was evaluated before it was compiled into a matrix,
+ * kept as reference. One call per actuator, reading MixerSettings.
+ */
+typedef struct {
+    uint8_t type;
+    int8_t  matrix[5];
+} __attribute__((packed)) Mixer_t;
+
+static MixerSettingsData mixerSettings;
+
+static float ProcessMixer(const int index, const float curve1, const float curve2,
+                          const ActuatorDesiredData *desired, bool multirotor, bool fixedwing)
+{
+    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type; // pointer to array of mixers in UAVObjects
+    const Mixer_t *mixer  = &mixers[index];
+    float differential    = 1.0f;
+
+    // Apply differential only for fixedwing and Roll servos
+    if (fixedwing && (mixerSettings.FirstRollServo > 0) &&
+        (mixer->type == MIXERSETTINGS_MIXER1TYPE_SERVO) &&
+        (mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] != 0)) {
+        // Positive differential
+        if (mixerSettings.RollDifferential > 0) {
+            // Check for first Roll servo (should be left aileron or elevon) and Roll desired (positive/negative)
+            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))
+                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))) {
+                differential -= (mixerSettings.RollDifferential * 0.01f);
+            }
+        } else if (mixerSettings.RollDifferential < 0) {
+            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))
+                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))) {
+                differential -= (-mixerSettings.RollDifferential * 0.01f);
+            }
+        }
+    }
+
+    float result = ((((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1]) * curve1) +
+                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2]) * curve2) +
+                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL]) * desired->Roll * differential) +
+                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_PITCH]) * desired->Pitch) +
+                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_YAW]) * desired->Yaw)) / 128.0f;
+
+    if (mixer->type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+        if (!multirotor) { // we allow negative throttle with a multirotor
+            if (result < 0.0f) { // zero throttle
+                result = 0.0f;
+            }
+        }
+    }
+
+    return result;
+}
+
+/* The per channel part of the actuator task loop that called ProcessMixer */
+static void ReferenceMix(float curve1, float curve2, const ActuatorDesiredData *desired,
+                         bool multirotor, bool fixedwing, float result[ACTUATORMIXER_NUMELEM])
+{
+    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
+
+    for (int ct = 0; ct < ACTUATORMIXER_NUMELEM; ct++) {
+        uint8_t mixer_type = mixers[ct].type;
+
+        if (mixer_type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+            float nonreversible_curve1 = curve1;
+            float nonreversible_curve2 = curve2;
+            if (nonreversible_curve1 < 0.0f) {
+                nonreversible_curve1 = 0.0f;
+            }
+            if (nonreversible_curve2 < 0.0f) {
+                if (!multirotor) {
+                    nonreversible_curve2 = 0.0f;
+                }
+            }
+            result[ct] = ProcessMixer(ct, nonreversible_curve1, nonreversible_curve2, desired, multirotor, fixedwing);
+        } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR ||
+                   mixer_type == MIXERSETTINGS_MIXER1TYPE_SERVO) {
+            result[ct] = ProcessMixer(ct, curve1, curve2, desired, multirotor, fixedwing);
+        }
+    }
+}
+
+static float randomFloat(float min, float max)
+{
+    return min + (max - min) * (rand() / (float)RAND_MAX);
+}
+
+static double nanoseconds()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class ActuatorMixerTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        srand(42);
+        for (int i = 0; i < SAMPLES; i++) {
+            desired[i].Roll  = randomFloat(-1.2f, 1.2f);
+            desired[i].Pitch = randomFloat(-1.2f, 1.2f);
+            desired[i].Yaw   = randomFloat(-1.2f, 1.2f);
+            curve1[i] = randomFloat(-1.2f, 1.2f);
+            curve2[i] = randomFloat(-1.2f, 1.2f);
+            // make sure the exact zero cases of the sign checks are covered
+            if (i % 97 == 0) {
+                desired[i].Roll = 0.0f;
+            }
+            if (i % 89 == 0) {
+                curve2[i] = 0.0f;
+            }
+        }
+    }
+
+    /* A random mixer setup with all mixer types, and roll differential on some servos */
+    void RandomSettings()
+    {
+        Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
+
+        memset(&mixerSettings, 0, sizeof(mixerSettings));
+        for (int ct = 0; ct < ACTUATORMIXER_NUMELEM; ct++) {
+            mixers[ct].type = rand() % (MIXERSETTINGS_MIXER1TYPE_ACCESSORY5 + 1);
+            for (int i = 0; i < MIXERSETTINGS_MIXER1VECTOR_NUMELEM; i++) {
+                mixers[ct].matrix[i] = (rand() % 4) ? (int8_t)(rand() % 256 - 128) : 0;
+            }
+        }
+        mixerSettings.RollDifferential = rand() % 201 - 100;
+        mixerSettings.FirstRollServo   = rand() % (ACTUATORMIXER_NUMELEM + 1);
+    }
+
+    ActuatorDesiredData desired[SAMPLES];
+    float curve1[SAMPLES];
+    float curve2[SAMPLES];
+};
+
+TEST_F(ActuatorMixerTest, Count) {
+    ActuatorMixer_t mixer;
+    Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
+
+    memset(&mixerSettings, 0, sizeof(mixerSettings));
+    ActuatorMixerCompile(&mixer, &mixerSettings);
+    EXPECT_EQ(0, mixer.count);
+
+    mixers[0].type  = MIXERSETTINGS_MIXER1TYPE_MOTOR;
+    mixers[5].type  = MIXERSETTINGS_MIXER1TYPE_SERVO;
+    mixers[11].type = MIXERSETTINGS_MIXER1TYPE_CAMERAYAW;
+    ActuatorMixerCompile(&mixer, &mixerSettings);
+    EXPECT_EQ(3, mixer.count);
+    EXPECT_EQ(MIXERSETTINGS_MIXER1TYPE_MOTOR, mixer.type[0]);
+    EXPECT_EQ(MIXERSETTINGS_MIXER1TYPE_SERVO, mixer.type[5]);
+    EXPECT_EQ(MIXERSETTINGS_MIXER1TYPE_CAMERAYAW, mixer.type[11]);
+}
+
+TEST_F(ActuatorMixerTest, MatchesReference) {
+    ActuatorMixer_t mixer;
+    int compared = 0;
+
+    for (int setup = 0; setup < 50; setup++) {
+        RandomSettings();
+        ActuatorMixerCompile(&mixer, &mixerSettings);
+
+        const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
+        for (int frame = 0; frame < 4; frame++) {
+            bool multirotor = frame & 1;
+            bool fixedwing  = frame & 2;
+
+            for (int i = 0; i < SAMPLES; i += 7) {
+                float expected[ACTUATORMIXER_NUMELEM];
+                float result[ACTUATORMIXER_NUMELEM];
+
+                ReferenceMix(curve1[i], curve2[i], &desired[i], multirotor, fixedwing, expected);
+                ActuatorMixerProcess(&mixer, curve1[i], curve2[i], &desired[i], multirotor, fixedwing, result);
+
+                for (int ct = 0; ct < ACTUATORMIXER_NUMELEM; ct++) {
+                    uint8_t type = mixers[ct].type;
+                    if (type == MIXERSETTINGS_MIXER1TYPE_MOTOR ||
+                        type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR ||
+                        type == MIXERSETTINGS_MIXER1TYPE_SERVO) {
+                        // bit for bit, not just close
+                        ASSERT_EQ(0, memcmp(&expected[ct], &result[ct], sizeof(float)))
+                            << "setup " << setup << " frame " << frame << " sample " << i << " channel " << ct
+                            << ": " << expected[ct] << " != " << result[ct];
+                        compared++;
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_GT(compared, 0);
+}
+
+TEST_F(ActuatorMixerTest, Timing) {
+    ActuatorMixer_t mixer;
+    float result[ACTUATORMIXER_NUMELEM] = { 0 };
+    float sum = 0.0f;
+
+    RandomSettings();
+    ActuatorMixerCompile(&mixer, &mixerSettings);
+
+    double start = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        ReferenceMix(curve1[i], curve2[i], &desired[i], false, true, result);
+        sum += result[0];
+    }
+    double reference = (nanoseconds() - start) / SAMPLES;
+
+    start = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        ActuatorMixerProcess(&mixer, curve1[i], curve2[i], &desired[i], false, true, result);
+        sum += result[0];
+    }
+    double compiled = (nanoseconds() - start) / SAMPLES;
+
+    printf("Mixer: reference %.0f ns, compiled %.0f ns per cycle (%g)\n", reference, compiled, sum);
+}
@@ -0,0 +1,57 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdlib.h>
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define portMAX_DELAY    0xffffffff
+#define portTICK_RATE_MS 1
+
+#define configMINIMAL_STACK_SIZE 128
+#define tskIDLE_PRIORITY         0
+
+typedef long portBASE_TYPE;
+typedef uint32_t portTickType;
+typedef void *xSemaphoreHandle;
+typedef void *xTaskHandle;
+
+/* The unit tests are single threaded, locks and critical sections are no-ops */
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portSET_INTERRUPT_MASK_FROM_ISR()      0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)   ((void)(x))
+
+static inline xSemaphoreHandle xSemaphoreCreateRecursiveMutex()
+{
+    return (xSemaphoreHandle)1;
+}
+
+static inline int xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle mutex, __attribute__((unused)) uint32_t ticks)
+{
+    return pdTRUE;
+}
+
+static inline int xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle mutex)
+{
+    return pdTRUE;
+}
+
+#define vSemaphoreCreateBinary(x) ((x) = (xSemaphoreHandle)1)
+
+static inline int xSemaphoreGive(__attribute__((unused)) xSemaphoreHandle semaphore)
+{
+    return pdTRUE;
+}
+
+static inline int xSemaphoreGiveFromISR(__attribute__((unused)) xSemaphoreHandle semaphore, __attribute__((unused)) long *woken)
+{
+    return pdTRUE;
+}
+
+/* Time, sleeping and the scheduler tasks are simulated by the test */
+portTickType xTaskGetTickCount();
+int xSemaphoreTake(xSemaphoreHandle semaphore, uint32_t ticks);
+int xTaskCreate(void (*code)(void *), const char *name, uint32_t stackDepth, void *parameters, uint32_t priority, xTaskHandle *handle);
+
+#endif /* FREERTOS_H */
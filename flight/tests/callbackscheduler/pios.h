@@ -0,0 +1,26 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "pios_config.h"
+
+#include "FreeRTOS.h"
+#include "pios_mem.h"
+#include "pios_eventtrace.h"
+#include "pios_callbackscheduler.h"
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+#define PIOS_DEBUG_Assert(x) PIOS_Assert(x)
+
+/* Simulated by the test */
+uint32_t PIOS_DELAY_GetRaw();
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw);
+void PIOS_TASK_MONITOR_RegisterTask(uint16_t task_id, xTaskHandle handle);
+
+#endif /* PIOS_H */
@@ -0,0 +1,8 @@
+#ifndef PIOS_CONFIG_H
+#define PIOS_CONFIG_H
+
+/* Enable/Disable PiOS modules */
+#define PIOS_INCLUDE_CALLBACKSCHEDULER
+#define PIOS_CALLBACKSCHEDULER_LATENCY_HISTOGRAM
+
+#endif /* PIOS_CONFIG_H */
@@ -0,0 +1,6 @@
+#ifndef UAVOBJECTMANAGER_H
+#define UAVOBJECTMANAGER_H
+
+/* The callback scheduler does not use any UAVObjects */
+
+#endif /* UAVOBJECTMANAGER_H */
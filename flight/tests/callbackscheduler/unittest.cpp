@@ -0,0 +1,280 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <setjmp.h>
+#include <string>
+
+extern "C" {
+#include "pios.h"
+
+/* Simulated system time in ms */
+static portTickType tick;
+
+/* The scheduler task and the number of times it may still go to sleep before the test stops it */
+static void (*schedulerTask)(void *);
+static void *schedulerTaskParameters;
+static int sleepsLeft;
+static uint32_t longestSleep;
+static jmp_buf stopScheduler;
+
+portTickType xTaskGetTickCount()
+{
+    return tick;
+}
+
+/* Nothing wakes the scheduler task early, it always sleeps for the full delay */
+int xSemaphoreTake(__attribute__((unused)) xSemaphoreHandle semaphore, uint32_t ticks)
+{
+    if (ticks > longestSleep) {
+        longestSleep = ticks;
+    }
+    tick += ticks;
+    if (--sleepsLeft <= 0) {
+        longjmp(stopScheduler, 1);
+    }
+    return pdFALSE;
+}
+
+int xTaskCreate(void (*code)(void *),
+                __attribute__((unused)) const char *name,
+                __attribute__((unused)) uint32_t stackDepth,
+                void *parameters,
+                __attribute__((unused)) uint32_t priority,
+                xTaskHandle *handle)
+{
+    schedulerTask = code;
+    schedulerTaskParameters = parameters;
+    *handle = (xTaskHandle)1;
+    return pdTRUE;
+}
+
+void PIOS_TASK_MONITOR_RegisterTask(__attribute__((unused)) uint16_t task_id, __attribute__((unused)) xTaskHandle handle)
+{}
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+    return tick * 1000;
+}
+
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+    return tick * 1000 - raw;
+}
+}
+
+#define NUM_CALLBACKS 32
+#define STACK_SIZE    256
+
+static DelayedCallbackInfo *callbacks[NUM_CALLBACKS];
+static bool repeat[NUM_CALLBACKS];
+static uint32_t runTime[NUM_CALLBACKS];
+static uint32_t runCount[NUM_CALLBACKS];
+static std::string trace;
+static size_t traceLength;
+
+/* Callback n appends 'A' + n to the trace and dispatches itself again if it repeats */
+static void runCallback(int n)
+{
+    trace += (char)('A' + n);
+    runTime[n] = tick;
+    runCount[n]++;
+    if (repeat[n]) {
+        PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[n]);
+    }
+    if (trace.size() >= traceLength) {
+        longjmp(stopScheduler, 1);
+    }
+}
+
+#define CALLBACK(n) static void callback ## n() { runCallback(n); }
+CALLBACK(0) CALLBACK(1) CALLBACK(2) CALLBACK(3) CALLBACK(4) CALLBACK(5) CALLBACK(6) CALLBACK(7)
+CALLBACK(8) CALLBACK(9) CALLBACK(10) CALLBACK(11) CALLBACK(12) CALLBACK(13) CALLBACK(14) CALLBACK(15)
+CALLBACK(16) CALLBACK(17) CALLBACK(18) CALLBACK(19) CALLBACK(20) CALLBACK(21) CALLBACK(22) CALLBACK(23)
+CALLBACK(24) CALLBACK(25) CALLBACK(26) CALLBACK(27) CALLBACK(28) CALLBACK(29) CALLBACK(30) CALLBACK(31)
+
+static const DelayedCallback callbackFunctions[NUM_CALLBACKS] = {
+    callback0,  callback1,  callback2,  callback3,  callback4,  callback5,  callback6,  callback7,
+    callback8,  callback9,  callback10, callback11, callback12, callback13, callback14, callback15,
+    callback16, callback17, callback18, callback19, callback20, callback21, callback22, callback23,
+    callback24, callback25, callback26, callback27, callback28, callback29, callback30, callback31,
+};
+
+// To use a test fixture, derive a class from testing::Test.
+class CallbackSchedulerTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        tick = 1000;
+        schedulerTask = NULL;
+        longestSleep  = 0;
+        trace.clear();
+        memset(callbacks, 0, sizeof(callbacks));
+        memset(repeat, 0, sizeof(repeat));
+        memset(runTime, 0, sizeof(runTime));
+        memset(runCount, 0, sizeof(runCount));
+        EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Initialize());
+    }
+
+    void Create(int n, DelayedCallbackPriority priority)
+    {
+        callbacks[n] = PIOS_CALLBACKSCHEDULER_Create(callbackFunctions[n], priority, CALLBACK_TASK_AUXILIARY, n, STACK_SIZE);
+        ASSERT_TRUE(callbacks[n] != NULL);
+    }
+
+    /* Run the scheduler task until the trace has the given length or it went to sleep the given number of times */
+    void Run(size_t length, int sleeps)
+    {
+        traceLength = length;
+        sleepsLeft  = sleeps;
+        if (!setjmp(stopScheduler)) {
+            schedulerTask(schedulerTaskParameters);
+        }
+    }
+};
+
+/* The execution schedule documented in pios_callbackscheduler.h */
+TEST_F(CallbackSchedulerTest, PrioritiesShareSlots) {
+    // A and B are priority CRITICAL, C and D REGULAR, E and F LOW
+    Create(0, CALLBACK_PRIORITY_CRITICAL);
+    Create(1, CALLBACK_PRIORITY_CRITICAL);
+    Create(2, CALLBACK_PRIORITY_REGULAR);
+    Create(3, CALLBACK_PRIORITY_REGULAR);
+    Create(4, CALLBACK_PRIORITY_LOW);
+    Create(5, CALLBACK_PRIORITY_LOW);
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    for (int n = 0; n < 6; n++) {
+        repeat[n] = true;
+        PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[n]);
+    }
+    Run(36, 1);
+    EXPECT_EQ("ABCABDABEABCABDABFABCABDABEABCABDABF", trace);
+}
+
+TEST_F(CallbackSchedulerTest, SomeCallbacksWaiting) {
+    Create(0, CALLBACK_PRIORITY_CRITICAL);
+    Create(1, CALLBACK_PRIORITY_CRITICAL);
+    Create(2, CALLBACK_PRIORITY_REGULAR);
+    Create(3, CALLBACK_PRIORITY_REGULAR);
+    Create(4, CALLBACK_PRIORITY_LOW);
+    Create(5, CALLBACK_PRIORITY_LOW);
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    // only A, C and E want to execute
+    repeat[0] = repeat[2] = repeat[4] = true;
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[0]);
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[2]);
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[4]);
+    Run(16, 1);
+    EXPECT_EQ("ACAEACAEACAEACAE", trace);
+
+    // only A and F
+    repeat[2] = repeat[4] = false;
+    Run(trace.size() + 4, 1);
+    trace.clear();
+    repeat[5] = true;
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[5]);
+    Run(12, 1);
+    EXPECT_EQ("AFAFAFAFAFAF", trace);
+}
+
+TEST_F(CallbackSchedulerTest, DispatchTwiceRunsOnce) {
+    Create(0, CALLBACK_PRIORITY_REGULAR);
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[0]);
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[0]);
+    long woken = 0;
+    PIOS_CALLBACKSCHEDULER_DispatchFromISR(callbacks[0], &woken);
+    Run(10, 2);
+    EXPECT_EQ("A", trace);
+}
+
+TEST_F(CallbackSchedulerTest, SchedulesRunInDeadlineOrder) {
+    for (int n = 0; n < NUM_CALLBACKS; n++) {
+        Create(n, (DelayedCallbackPriority)(n % (CALLBACK_PRIORITY_LOW + 1)));
+    }
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    uint32_t start = tick;
+    for (int n = 0; n < NUM_CALLBACKS; n++) {
+        EXPECT_EQ(1, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[n], 10 + (n * 7919) % 3000, CALLBACK_UPDATEMODE_NONE));
+    }
+    Run(NUM_CALLBACKS, 100);
+
+    for (int n = 0; n < NUM_CALLBACKS; n++) {
+        EXPECT_EQ(1u, runCount[n]);
+        EXPECT_EQ(start + 10 + (n * 7919) % 3000, runTime[n]);
+    }
+    // nothing is scheduled anymore, the scheduler sleeps as long as it can
+    Run(NUM_CALLBACKS + 1, 3);
+    EXPECT_EQ(1000u, longestSleep);
+}
+
+TEST_F(CallbackSchedulerTest, ScheduleUpdateModes) {
+    Create(0, CALLBACK_PRIORITY_REGULAR);
+    Create(1, CALLBACK_PRIORITY_REGULAR);
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    uint32_t start = tick;
+    EXPECT_EQ(1, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 100, CALLBACK_UPDATEMODE_NONE));
+    EXPECT_EQ(2, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 50, CALLBACK_UPDATEMODE_SOONER));
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 80, CALLBACK_UPDATEMODE_SOONER));
+    EXPECT_EQ(2, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 200, CALLBACK_UPDATEMODE_LATER));
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 10, CALLBACK_UPDATEMODE_NONE));
+    EXPECT_EQ(2, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[0], 30, CALLBACK_UPDATEMODE_OVERRIDE));
+
+    // a dispatch runs the callback right away and resets its schedule
+    EXPECT_EQ(1, PIOS_CALLBACKSCHEDULER_Schedule(callbacks[1], 20, CALLBACK_UPDATEMODE_NONE));
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[1]);
+
+    Run(3, 10);
+    EXPECT_EQ("BA", trace);
+    EXPECT_EQ(start, runTime[1]);
+    EXPECT_EQ(start + 30, runTime[0]);
+}
+
+/* Callback 1 keeps the scheduler busy for 5ms after dispatching callback 0 */
+static void busyCallback()
+{
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[0]);
+    tick += 5;
+}
+
+struct LatencyCheck {
+    uint32_t runs[NUM_CALLBACKS];
+    uint32_t histogram[NUM_CALLBACKS][PIOS_CALLBACKSCHEDULER_LATENCY_BUCKETS];
+};
+
+static void latencyCheckCallback(int16_t callback_id, const struct pios_callback_info *callback_info, void *context)
+{
+    LatencyCheck *check = (LatencyCheck *)context;
+
+    check->runs[callback_id] = callback_info->running_time_count;
+    memcpy(check->histogram[callback_id], callback_info->latency_histogram, sizeof(callback_info->latency_histogram));
+}
+
+TEST_F(CallbackSchedulerTest, LatencyHistogram) {
+    Create(0, CALLBACK_PRIORITY_REGULAR);
+    callbacks[1] = PIOS_CALLBACKSCHEDULER_Create(busyCallback, CALLBACK_PRIORITY_CRITICAL, CALLBACK_TASK_AUXILIARY, 1, STACK_SIZE);
+    EXPECT_EQ(0, PIOS_CALLBACKSCHEDULER_Start());
+
+    // stop when the scheduler sleeps, so that the runs are complete
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[0]);
+    Run(NUM_CALLBACKS, 1);
+    PIOS_CALLBACKSCHEDULER_Dispatch(callbacks[1]);
+    Run(NUM_CALLBACKS, 1);
+
+    LatencyCheck check;
+    memset(&check, 0, sizeof(check));
+    PIOS_CALLBACKSCHEDULER_ForEachCallback(latencyCheckCallback, &check);
+
+    EXPECT_EQ(2u, check.runs[0]);
+    EXPECT_EQ(1u, check.runs[1]);
+    // the first run of callback 0 was immediate, the second one waited 5000us
+    EXPECT_EQ(1u, check.histogram[0][0]);
+    EXPECT_EQ(1u, check.histogram[0][13]);
+    EXPECT_EQ(1u, check.histogram[1][0]);
+}
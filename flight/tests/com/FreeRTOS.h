@@ -0,0 +1,23 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define portMAX_DELAY    0xffffffff
+#define portTICK_RATE_MS 1
+
+#define portBASE_TYPE long
+typedef uint32_t portTickType;
+
+/* The unit test is single threaded, a semaphore is its count and taking it never waits */
+typedef int *xSemaphoreHandle;
+
+xSemaphoreHandle xSemaphoreCreateMutex();
+#define vSemaphoreCreateBinary(x) ((x) = xSemaphoreCreateMutex())
+int xSemaphoreTake(xSemaphoreHandle semaphore, uint32_t ticks);
+int xSemaphoreGive(xSemaphoreHandle semaphore);
+int xSemaphoreGiveFromISR(xSemaphoreHandle semaphore, long *woken);
+
+#endif /* FREERTOS_H */
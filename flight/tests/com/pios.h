@@ -0,0 +1,24 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PIOS_INCLUDE_FREERTOS
+#define PIOS_INCLUDE_COM
+
+#include "FreeRTOS.h"
+#include "pios_com.h"
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+
+/* From static memory in the test, the COM ids are 32 bit */
+void *pios_malloc(size_t size);
+
+#endif /* PIOS_H */
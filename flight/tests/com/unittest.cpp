@@ -0,0 +1,186 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+
+extern "C" {
+#include "pios.h"
+
+/* The test is linked without PIE so that static memory has 32 bit addresses */
+static uint8_t heap[1024] __attribute__((aligned(8)));
+static size_t heapUsed;
+
+void *pios_malloc(size_t size)
+{
+    size = (size + 7) & ~7;
+    if (heapUsed + size > sizeof(heap)) {
+        return NULL;
+    }
+    void *p = &heap[heapUsed];
+    heapUsed += size;
+    return p;
+}
+
+static int semaphores[8];
+static int semaphoresUsed;
+
+xSemaphoreHandle xSemaphoreCreateMutex()
+{
+    int *semaphore = &semaphores[semaphoresUsed++];
+
+    *semaphore = 1;
+    return semaphore;
+}
+
+int xSemaphoreTake(xSemaphoreHandle semaphore, __attribute__((unused)) uint32_t ticks)
+{
+    if (*semaphore == 0) {
+        return pdFALSE;
+    }
+    (*semaphore)--;
+    return pdTRUE;
+}
+
+int xSemaphoreGive(xSemaphoreHandle semaphore)
+{
+    *semaphore = 1;
+    return pdTRUE;
+}
+
+int xSemaphoreGiveFromISR(xSemaphoreHandle semaphore, long *woken)
+{
+    *woken = pdFALSE;
+    return xSemaphoreGive(semaphore);
+}
+
+/* A port that only transmits when the test drains it */
+static pios_com_callback txOutCb;
+static uint32_t txOutContext;
+static uint32_t txStarts;
+static uint16_t txStartAvail;
+static bool connected;
+
+static void bindTx(__attribute__((unused)) uint32_t id, pios_com_callback tx_out_cb, uint32_t context)
+{
+    txOutCb = tx_out_cb;
+    txOutContext = context;
+}
+
+static void txStart(__attribute__((unused)) uint32_t id, uint16_t tx_bytes_avail)
+{
+    txStarts++;
+    txStartAvail = tx_bytes_avail;
+}
+
+static uint32_t available(__attribute__((unused)) uint32_t id)
+{
+    return connected ? COM_AVAILABLE_TX : COM_AVAILABLE_NONE;
+}
+}
+
+#define TX_BUFFER_LEN 33 /* holds 32 bytes */
+
+// To use a test fixture, derive a class from testing::Test.
+class ComSendBufferTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        heapUsed = 0;
+        semaphoresUsed = 0;
+        txStarts = 0;
+        txStartAvail = 0;
+        connected = true;
+
+        memset(&driver, 0, sizeof(driver));
+        driver.bind_tx_cb = bindTx;
+        driver.tx_start = txStart;
+        driver.available = available;
+        ASSERT_EQ(0, PIOS_COM_Init(&com, &driver, 0, NULL, 0, txBuffer, sizeof(txBuffer)));
+
+        for (uint8_t i = 0; i < sizeof(data); i++) {
+            data[i] = i;
+        }
+    }
+
+    virtual void TearDown() {}
+
+    uint16_t drain(uint8_t *buf, uint16_t len)
+    {
+        uint16_t headroom;
+        bool need_yield;
+
+        return txOutCb(txOutContext, buf, len, &headroom, &need_yield);
+    }
+
+    struct pios_com_driver driver;
+    uint32_t com;
+    uint8_t txBuffer[TX_BUFFER_LEN];
+    uint8_t data[64];
+};
+
+TEST_F(ComSendBufferTest, InvalidPort) {
+    EXPECT_EQ(-1, PIOS_COM_SendBufferBegin(0, 4));
+}
+
+TEST_F(ComSendBufferTest, PiecesGoOutTogether) {
+    ASSERT_EQ(0, PIOS_COM_SendBufferBegin(com, 10));
+
+    // the transmitter is only started once the whole package is in
+    PIOS_COM_SendBufferAppend(com, &data[0], 4);
+    EXPECT_EQ(0u, txStarts);
+    PIOS_COM_SendBufferAppend(com, &data[4], 6);
+    EXPECT_EQ(0u, txStarts);
+    PIOS_COM_SendBufferEnd(com);
+    EXPECT_EQ(1u, txStarts);
+    EXPECT_EQ(10, txStartAvail);
+
+    uint8_t out[TX_BUFFER_LEN];
+    ASSERT_EQ(10, drain(out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(out, data, 10));
+}
+
+TEST_F(ComSendBufferTest, ReserveFailsWhenFull) {
+    ASSERT_EQ(24, PIOS_COM_SendBufferNonBlocking(com, data, 24));
+    txStarts = 0;
+
+    // nothing of a package that does not fit goes in, and the port is released
+    EXPECT_EQ(-2, PIOS_COM_SendBufferBegin(com, 9));
+    EXPECT_EQ(0u, txStarts);
+
+    ASSERT_EQ(0, PIOS_COM_SendBufferBegin(com, 8));
+    PIOS_COM_SendBufferAppend(com, &data[24], 8);
+    PIOS_COM_SendBufferEnd(com);
+    EXPECT_EQ(32, txStartAvail);
+
+    uint8_t out[TX_BUFFER_LEN];
+    ASSERT_EQ(32, drain(out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(out, data, 32));
+}
+
+TEST_F(ComSendBufferTest, OneSenderAtATime) {
+    ASSERT_EQ(0, PIOS_COM_SendBufferBegin(com, 4));
+
+    // the port belongs to the package until it is complete
+    EXPECT_EQ(-3, PIOS_COM_SendBufferBegin(com, 4));
+    EXPECT_EQ(-3, PIOS_COM_SendBufferNonBlocking(com, &data[4], 4));
+
+    PIOS_COM_SendBufferAppend(com, data, 4);
+    PIOS_COM_SendBufferEnd(com);
+    EXPECT_EQ(0, PIOS_COM_SendBufferBegin(com, 4));
+}
+
+TEST_F(ComSendBufferTest, DisconnectedDropsStaleData) {
+    ASSERT_EQ(24, PIOS_COM_SendBufferNonBlocking(com, data, 24));
+
+    // a port that went down takes a whole package again
+    connected = false;
+    ASSERT_EQ(0, PIOS_COM_SendBufferBegin(com, 32));
+    PIOS_COM_SendBufferAppend(com, &data[32], 16);
+    PIOS_COM_SendBufferAppend(com, &data[48], 16);
+    PIOS_COM_SendBufferEnd(com);
+
+    uint8_t out[TX_BUFFER_LEN];
+    ASSERT_EQ(32, drain(out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(out, &data[32], 32));
+}
@@ -0,0 +1,40 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdlib.h>
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define portMAX_DELAY    0xffffffff
+#define portTICK_RATE_MS 1
+
+#define configMINIMAL_STACK_SIZE 128
+#define tskIDLE_PRIORITY         0
+
+typedef uint32_t portTickType;
+typedef void *xSemaphoreHandle;
+typedef void *xQueueHandle;
+
+/* The unit tests are single threaded, the dispatcher lock is a no-op */
+static inline xSemaphoreHandle xSemaphoreCreateRecursiveMutex()
+{
+    return (xSemaphoreHandle)1;
+}
+
+static inline int xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle mutex, __attribute__((unused)) uint32_t ticks)
+{
+    return pdTRUE;
+}
+
+static inline int xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle mutex)
+{
+    return pdTRUE;
+}
+
+/* Time and queues are simulated by the test */
+portTickType xTaskGetTickCount();
+xQueueHandle xQueueCreate(uint32_t length, uint32_t itemSize);
+int xQueueSend(xQueueHandle queue, const void *item, uint32_t ticks);
+int xQueueReceive(xQueueHandle queue, void *item, uint32_t ticks);
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,9 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include "FreeRTOS.h"
+#include "pios_mem.h"
+#include "pios_eventtrace.h"
+#include "pios_callbackscheduler.h"
+
+#endif /* PIOS_H */
@@ -0,0 +1,266 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+
+extern "C" {
+#include "openpilot.h"
+
+/* Simulated system time in ms, it only moves forward so that the tests do not depend on each other */
+static portTickType tick = 1000;
+
+/* The event task of the dispatcher and the delay it asked for on its last run */
+static DelayedCallback dispatcherTask;
+static int32_t dispatcherDelay;
+
+portTickType xTaskGetTickCount()
+{
+    return tick;
+}
+
+xQueueHandle xQueueCreate(__attribute__((unused)) uint32_t length, __attribute__((unused)) uint32_t itemSize)
+{
+    return (xQueueHandle)1;
+}
+
+int xQueueSend(__attribute__((unused)) xQueueHandle queue, __attribute__((unused)) const void *item, __attribute__((unused)) uint32_t ticks)
+{
+    return pdTRUE;
+}
+
+/* No direct callback dispatches are used, the event queue is always empty */
+int xQueueReceive(__attribute__((unused)) xQueueHandle queue, __attribute__((unused)) void *item, __attribute__((unused)) uint32_t ticks)
+{
+    return pdFALSE;
+}
+
+DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(DelayedCallback cb,
+                                                   __attribute__((unused)) DelayedCallbackPriority priority,
+                                                   __attribute__((unused)) DelayedCallbackPriorityTask priorityTask,
+                                                   __attribute__((unused)) int16_t callbackID,
+                                                   __attribute__((unused)) uint32_t stacksize)
+{
+    dispatcherTask = cb;
+    return (DelayedCallbackInfo *)1;
+}
+
+int32_t PIOS_CALLBACKSCHEDULER_Schedule(__attribute__((unused)) DelayedCallbackInfo *cbinfo, int32_t milliseconds, __attribute__((unused)) DelayedCallbackUpdateMode updatemode)
+{
+    dispatcherDelay = milliseconds;
+    return 1;
+}
+
+int32_t PIOS_CALLBACKSCHEDULER_Dispatch(__attribute__((unused)) DelayedCallbackInfo *cbinfo)
+{
+    dispatcherDelay = 0;
+    return -1;
+}
+
+uint32_t UAVObjGetID(UAVObjHandle obj)
+{
+    return (uint32_t)(uintptr_t)obj;
+}
+}
+
+#define MAX_ENTRIES 600
+
+/* Fake object handles, the dispatcher only compares them */
+#define ENTRY_HANDLE(i) ((UAVObjHandle)(uintptr_t)(0x1000 + (i)))
+#define ENTRY_INDEX(ev) ((int)((uintptr_t)(ev)->obj - 0x1000))
+
+static std::vector<uint32_t> fireTimes[MAX_ENTRIES];
+static uint32_t fireCount;
+
+static void recordCallback(UAVObjEvent *ev)
+{
+    fireTimes[ENTRY_INDEX(ev)].push_back(tick);
+}
+
+static void countCallback(__attribute__((unused)) UAVObjEvent *ev)
+{
+    fireCount++;
+}
+
+static const uint16_t periods[] = { 10, 20, 50, 100, 200, 250, 500, 1000, 5000 };
+#define NUM_PERIODS (sizeof(periods) / sizeof(periods[0]))
+
+// To use a test fixture, derive a class from testing::Test.
+class EventDispatcherTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        for (int i = 0; i < MAX_ENTRIES; i++) {
+            fireTimes[i].clear();
+        }
+        fireCount = 0;
+        EXPECT_EQ(0, EventDispatcherInitialize());
+    }
+
+    UAVObjEvent Event(int i)
+    {
+        UAVObjEvent ev;
+
+        memset(&ev, 0, sizeof(ev));
+        ev.obj   = ENTRY_HANDLE(i);
+        ev.event = EV_UPDATED_PERIODIC;
+        return ev;
+    }
+
+    /* Run the event task whenever it asked to be run, until ms have elapsed */
+    void RunFor(uint32_t ms, double *cpuTimeUs = NULL)
+    {
+        uint32_t end = tick + ms;
+
+        while (true) {
+            uint32_t wakeup = tick + (dispatcherDelay > 0 ? dispatcherDelay : 0);
+            if (wakeup > end) {
+                tick = end;
+                break;
+            }
+            tick = wakeup;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            dispatcherTask();
+            if (cpuTimeUs) {
+                *cpuTimeUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            }
+            // The real scheduler runs a callback at most once per tick
+            if (dispatcherDelay <= 0) {
+                dispatcherDelay = 1;
+            }
+        }
+    }
+
+    /* The first update after a (re)start sets a random phase, the following ones must be exactly one period apart */
+    void ExpectPeriod(int i, uint16_t periodMs, size_t first = 0)
+    {
+        ASSERT_GT(fireTimes[i].size(), first + 2);
+        for (size_t n = first + 2; n < fireTimes[i].size(); n++) {
+            EXPECT_EQ(periodMs, fireTimes[i][n] - fireTimes[i][n - 1]);
+        }
+    }
+};
+
+TEST_F(EventDispatcherTest, PeriodsAreKept) {
+    for (int i = 0; i < 200; i++) {
+        UAVObjEvent ev = Event(i);
+        EXPECT_EQ(0, EventPeriodicCallbackCreate(&ev, recordCallback, periods[i % NUM_PERIODS]));
+    }
+
+    RunFor(20000);
+
+    for (int i = 0; i < 200; i++) {
+        ExpectPeriod(i, periods[i % NUM_PERIODS]);
+        EXPECT_GE(fireTimes[i].size(), 20000u / periods[i % NUM_PERIODS]);
+    }
+}
+
+TEST_F(EventDispatcherTest, UpdateChangesPeriod) {
+    UAVObjEvent ev = Event(0);
+
+    EXPECT_EQ(0, EventPeriodicCallbackCreate(&ev, recordCallback, 100));
+    RunFor(1000);
+    ExpectPeriod(0, 100);
+
+    EXPECT_EQ(0, EventPeriodicCallbackUpdate(&ev, recordCallback, 30));
+    size_t updated = fireTimes[0].size();
+    RunFor(1000);
+    ExpectPeriod(0, 30, updated);
+
+    EXPECT_EQ(0, EventPeriodicCallbackUpdate(&ev, recordCallback, 0));
+    updated = fireTimes[0].size();
+    RunFor(1000);
+    EXPECT_EQ(updated, fireTimes[0].size());
+
+    EXPECT_EQ(0, EventPeriodicCallbackUpdate(&ev, recordCallback, 250));
+    updated = fireTimes[0].size();
+    RunFor(2000);
+    ExpectPeriod(0, 250, updated);
+}
+
+TEST_F(EventDispatcherTest, DuplicatesAndUnknownEntries) {
+    UAVObjEvent ev = Event(0);
+    UAVObjEvent other = Event(1);
+
+    EXPECT_EQ(0, EventPeriodicCallbackCreate(&ev, recordCallback, 100));
+    EXPECT_EQ(-1, EventPeriodicCallbackCreate(&ev, recordCallback, 50));
+    EXPECT_EQ(-1, EventPeriodicCallbackUpdate(&other, recordCallback, 50));
+
+    /* Entries without a period are registered but never fire */
+    EXPECT_EQ(0, EventPeriodicCallbackCreate(&other, recordCallback, 0));
+    RunFor(1000);
+    EXPECT_EQ(0u, fireTimes[1].size());
+    EXPECT_EQ(0, EventPeriodicCallbackUpdate(&other, recordCallback, 100));
+    RunFor(1000);
+    ExpectPeriod(1, 100, 0);
+}
+
+/* Reference implementation, the list scan the dispatcher used to do on every run */
+struct ReferenceEntry {
+    UAVObjEvent ev;
+    UAVObjEventCallback cb;
+    uint16_t updatePeriodMs;
+    int32_t  timeToNextUpdateMs;
+};
+
+static int32_t referenceProcess(std::vector<ReferenceEntry> &entries)
+{
+    int32_t timeToNextUpdate = tick + 1000;
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        ReferenceEntry *objEntry = &entries[i];
+        if (objEntry->updatePeriodMs > 0) {
+            int32_t timeNow = tick;
+            if (objEntry->timeToNextUpdateMs <= timeNow) {
+                int32_t offset = (timeNow - objEntry->timeToNextUpdateMs) % objEntry->updatePeriodMs;
+                objEntry->timeToNextUpdateMs = timeNow + objEntry->updatePeriodMs - offset;
+                objEntry->cb(&objEntry->ev);
+            }
+            if (objEntry->timeToNextUpdateMs < timeToNextUpdate) {
+                timeToNextUpdate = objEntry->timeToNextUpdateMs;
+            }
+        }
+    }
+    return timeToNextUpdate;
+}
+
+TEST_F(EventDispatcherTest, Benchmark) {
+    const uint32_t runTime = 60000;
+    std::vector<ReferenceEntry> reference;
+
+    /* Telemetry, logging and GCS periods for a few hundred objects */
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        UAVObjEvent ev = Event(i);
+        EXPECT_EQ(0, EventPeriodicCallbackCreate(&ev, countCallback, periods[i % NUM_PERIODS]));
+        /* Spread the phases like the dispatcher does */
+        ReferenceEntry entry = { ev, countCallback, periods[i % NUM_PERIODS], (int32_t)((i * 7919) % periods[i % NUM_PERIODS]) };
+        reference.push_back(entry);
+    }
+
+    double heapTimeUs = 0;
+    RunFor(runTime, &heapTimeUs);
+    uint32_t heapCount = fireCount;
+
+    fireCount = 0;
+    double listTimeUs = 0;
+    uint32_t end = tick + runTime;
+    int32_t next = tick;
+    while ((uint32_t)next <= end) {
+        tick = next;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        next = referenceProcess(reference);
+        listTimeUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+    tick = end;
+    uint32_t listCount = fireCount;
+
+    printf("%d periodic events over %u ms\n", MAX_ENTRIES, runTime);
+    printf("  heap      : %u updates, %.0f us dispatcher time\n", heapCount, heapTimeUs);
+    printf("  list scan : %u updates, %.0f us dispatcher time\n", listCount, listTimeUs);
+
+    /* Both implementations must deliver the same number of updates, give or take the first and last periods */
+    EXPECT_NEAR(listCount, heapCount, 2 * MAX_ENTRIES);
+}
@@ -0,0 +1,14 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define PIOS_INCLUDE_EVENTTRACE
+#define PIOS_EVENTTRACE_SIZE 64
+
+uint32_t PIOS_DELAY_GetRaw();
+
+#endif /* PIOS_H */
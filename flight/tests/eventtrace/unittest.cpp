@@ -0,0 +1,209 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+extern "C" {
+#include "pios.h"
+#include "pios_eventtrace.h"
+
+/* Simulated time, every call is one tick later */
+static uint32_t now;
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+    return __atomic_fetch_add(&now, 1, __ATOMIC_RELAXED);
+}
+}
+
+#define SIZE PIOS_EVENTTRACE_SIZE
+
+// To use a test fixture, derive a class from testing::Test.
+class EventTraceTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        now  = 1000;
+        next = 0;
+        lost = 0;
+        PIOS_EVENTTRACE_Init();
+    }
+
+    virtual void TearDown() {}
+
+    void record(uint32_t first, uint32_t count)
+    {
+        for (uint32_t id = first; id < first + count; id++) {
+            PIOS_EVENTTRACE_Record(id % 8, id, id & 0xffff);
+        }
+    }
+
+    uint16_t read()
+    {
+        return PIOS_EVENTTRACE_Read(&next, events, SIZE * 2, &lost);
+    }
+
+    uint32_t next;
+    uint32_t lost;
+    struct pios_eventtrace_event events[SIZE * 2];
+};
+
+TEST_F(EventTraceTest, NothingWhenOff) {
+    record(0, 10);
+    EXPECT_EQ(0u, PIOS_EVENTTRACE_GetRecorded());
+    EXPECT_EQ(0, read());
+}
+
+TEST_F(EventTraceTest, Continuous) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+    record(0, 10);
+    ASSERT_EQ(10, read());
+    for (uint32_t i = 0; i < 10; i++) {
+        EXPECT_EQ(i, events[i].id);
+        EXPECT_EQ(i % 8, events[i].type);
+        EXPECT_EQ(i, events[i].aux);
+        EXPECT_EQ(1000 + i, events[i].time);
+    }
+    EXPECT_EQ(10u, next);
+    EXPECT_EQ(0u, lost);
+
+    // the reader follows the writers
+    EXPECT_EQ(0, read());
+    record(10, 5);
+    ASSERT_EQ(5, read());
+    EXPECT_EQ(10u, events[0].id);
+    EXPECT_EQ(0u, lost);
+}
+
+TEST_F(EventTraceTest, ReadInParts) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+    record(0, 20);
+    EXPECT_EQ(16, PIOS_EVENTTRACE_Read(&next, events, 16, &lost));
+    EXPECT_EQ(4, PIOS_EVENTTRACE_Read(&next, events, 16, &lost));
+    EXPECT_EQ(16u, events[0].id);
+}
+
+TEST_F(EventTraceTest, Overrun) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+    record(0, 3 * SIZE + 5);
+    ASSERT_EQ(SIZE, read());
+    EXPECT_EQ(2u * SIZE + 5, lost);
+    for (uint32_t i = 0; i < SIZE; i++) {
+        EXPECT_EQ(2 * SIZE + 5 + i, events[i].id);
+    }
+}
+
+TEST_F(EventTraceTest, Snapshot) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_SNAPSHOT);
+    record(0, 1000);
+    EXPECT_EQ(0, read());
+
+    PIOS_EVENTTRACE_Trigger(42);
+    EXPECT_FALSE(PIOS_EVENTTRACE_IsFrozen());
+    EXPECT_EQ(0, read());
+
+    // a second trigger is recorded but does not move the end of the snapshot
+    record(2000, 10);
+    PIOS_EVENTTRACE_Trigger(43);
+    record(3000, 1000);
+    EXPECT_TRUE(PIOS_EVENTTRACE_IsFrozen());
+
+    // half a ring before the trigger, the rest after it
+    ASSERT_EQ(SIZE, read());
+    EXPECT_EQ(0u, lost);
+    EXPECT_EQ(1000u - SIZE / 2, events[0].id);
+    EXPECT_EQ(PIOS_EVENTTRACE_TRIGGER, events[SIZE / 2].type);
+    EXPECT_EQ(42u, events[SIZE / 2].id);
+    EXPECT_EQ(2000u, events[SIZE / 2 + 1].id);
+    EXPECT_EQ(PIOS_EVENTTRACE_TRIGGER, events[SIZE / 2 + 11].type);
+    EXPECT_EQ(43u, events[SIZE / 2 + 11].id);
+    EXPECT_EQ(3000u, events[SIZE / 2 + 12].id);
+    EXPECT_EQ(0, read());
+
+    // nothing is recorded until rearmed
+    uint32_t recorded = PIOS_EVENTTRACE_GetRecorded();
+    record(5000, 10);
+    EXPECT_EQ(recorded, PIOS_EVENTTRACE_GetRecorded());
+
+    PIOS_EVENTTRACE_Rearm();
+    record(6000, 10);
+    EXPECT_FALSE(PIOS_EVENTTRACE_IsFrozen());
+    EXPECT_EQ(0, read());
+}
+
+TEST_F(EventTraceTest, ContinuousTriggerIsAnEvent) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+    PIOS_EVENTTRACE_Trigger(7);
+    record(0, 3 * SIZE);
+    EXPECT_FALSE(PIOS_EVENTTRACE_IsFrozen());
+    ASSERT_EQ(SIZE, read());
+}
+
+#define WRITERS        3
+#define WRITER_EVENTS  200000
+
+static void *writer(void *arg)
+{
+    uint32_t base = (uint32_t)(uintptr_t)arg * WRITER_EVENTS;
+
+    for (uint32_t id = base; id < base + WRITER_EVENTS; id++) {
+        PIOS_EVENTTRACE_Record(id % 8, id, id & 0xffff);
+        if (id % 16 == 0) {
+            // let the reader keep up some of the time, even on a single core
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+TEST_F(EventTraceTest, ConcurrentWriters) {
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+
+    pthread_t threads[WRITERS];
+    for (uintptr_t i = 0; i < WRITERS; i++) {
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, writer, (void *)i));
+    }
+
+    // every event read is intact, and every event is either read or counted lost
+    uint32_t read_count = 0;
+    bool writing = true;
+    while (writing || next != PIOS_EVENTTRACE_GetRecorded()) {
+        writing = PIOS_EVENTTRACE_GetRecorded() < WRITERS * WRITER_EVENTS;
+        uint16_t count = read();
+        for (uint16_t i = 0; i < count; i++) {
+            ASSERT_EQ(events[i].id % 8, events[i].type);
+            ASSERT_EQ(events[i].id & 0xffff, events[i].aux);
+        }
+        read_count += count;
+    }
+    for (int i = 0; i < WRITERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    printf("read %u lost %u\n", read_count, lost);
+    EXPECT_EQ((uint32_t)WRITERS * WRITER_EVENTS, read_count + lost);
+    EXPECT_GT(read_count, 0u);
+}
+
+TEST_F(EventTraceTest, Overhead) {
+    struct timespec start, end;
+    const uint32_t count = 1000000;
+
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_OFF);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    record(0, count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double off = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / count;
+
+    PIOS_EVENTTRACE_SetMode(PIOS_EVENTTRACE_MODE_CONTINUOUS);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    record(0, count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double on = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / count;
+
+    printf("ns per event: %.1f recording, %.1f off\n", on, off);
+    EXPECT_EQ(count, PIOS_EVENTTRACE_GetRecorded());
+}
@@ -0,0 +1,242 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <math.h>
+#include <time.h>
+
+extern "C" {
+#include "insgps.h"
+
+#define NUMX 13
+#define NUMW 9
+
+void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
+                          float Q[NUMW], float dT, float P[NUMX][NUMX]);
+}
+
+#define LENGTH  2000 // samples of the synthetic flight
+#define SAMPLE_PERIOD 0.002f
+
+/*
+ * The covariance prediction as it was before it was specialized for the
+ * block structure of F and G, kept as reference.
+ */
+static const int8_t FrowMin[NUMX] = { 3, 4, 5, 6, 6, 6, 5, 5, 5, 5, 13, 13, 13 };
+static const int8_t FrowMax[NUMX] = { 3, 4, 5, 9, 9, 9, 12, 12, 12, 12, -1, -1, -1 };
+
+static const int8_t GrowMin[NUMX] = { 9, 9, 9, 3, 3, 3, 0, 0, 0, 0, 6, 7, 8 };
+static const int8_t GrowMax[NUMX] = { -1, -1, -1, 5, 5, 5, 2, 2, 2, 2, 6, 7, 8 };
+
+static void ReferenceCovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
+                                          float Q[NUMW], float dT, float P[NUMX][NUMX])
+{
+    const float dT1  = 1.0f / dT;
+    const float dTsq = dT * dT;
+
+    float Dummy[NUMX][NUMX];
+
+    for (int i = 0; i < NUMX; i++) {
+        for (int j = 0; j < NUMX; j++) {
+            Dummy[i][j] = P[i][j] * dT1;
+        }
+        for (int k = FrowMin[i]; k <= FrowMax[i]; k++) {
+            for (int j = 0; j < NUMX; j++) {
+                Dummy[i][j] += F[i][k] * P[k][j];
+            }
+        }
+    }
+    for (int i = 0; i < NUMX; i++) {
+        for (int j = i; j < NUMX; j++) {
+            float Ptmp = Dummy[i][j] * dT1;
+            for (int k = FrowMin[j]; k <= FrowMax[j]; k++) {
+                Ptmp += Dummy[i][k] * F[j][k];
+            }
+            int Gstart = GrowMin[i] > GrowMin[j] ? GrowMin[i] : GrowMin[j];
+            int Gend   = GrowMax[i] < GrowMax[j] ? GrowMax[i] : GrowMax[j];
+            for (int k = Gstart; k <= Gend; k++) {
+                Ptmp += Q[k] * G[i][k] * G[j][k];
+            }
+            P[j][i] = P[i][j] = Ptmp * dTsq;
+        }
+    }
+}
+
+/* F and G as LinearizeFG() builds them, for attitude q and bias corrected sensor data */
+static void Linearize(const float q[4], const float w[3], const float a[3], float F[NUMX][NUMX], float G[NUMX][NUMW])
+{
+    const float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    const float wx = w[0], wy = w[1], wz = w[2];
+    const float ax = a[0], ay = a[1], az = a[2];
+
+    memset(F, 0, sizeof(float) * NUMX * NUMX);
+    memset(G, 0, sizeof(float) * NUMX * NUMW);
+
+    F[0][3]  = F[1][4] = F[2][5] = 1.0f;
+
+    F[3][6]  = 2.0f * (q0 * ax - q3 * ay + q2 * az);
+    F[3][7]  = 2.0f * (q1 * ax + q2 * ay + q3 * az);
+    F[3][8]  = 2.0f * (-q2 * ax + q1 * ay + q0 * az);
+    F[3][9]  = 2.0f * (-q3 * ax - q0 * ay + q1 * az);
+    F[4][6]  = 2.0f * (q3 * ax + q0 * ay - q1 * az);
+    F[4][7]  = 2.0f * (q2 * ax - q1 * ay - q0 * az);
+    F[4][8]  = 2.0f * (q1 * ax + q2 * ay + q3 * az);
+    F[4][9]  = 2.0f * (q0 * ax - q3 * ay + q2 * az);
+    F[5][6]  = 2.0f * (-q2 * ax + q1 * ay + q0 * az);
+    F[5][7]  = 2.0f * (q3 * ax + q0 * ay - q1 * az);
+    F[5][8]  = 2.0f * (-q0 * ax + q3 * ay - q2 * az);
+    F[5][9]  = 2.0f * (q1 * ax + q2 * ay + q3 * az);
+
+    F[6][7]  = -wx / 2.0f;
+    F[6][8]  = -wy / 2.0f;
+    F[6][9]  = -wz / 2.0f;
+    F[7][6]  = wx / 2.0f;
+    F[7][8]  = wz / 2.0f;
+    F[7][9]  = -wy / 2.0f;
+    F[8][6]  = wy / 2.0f;
+    F[8][7]  = -wz / 2.0f;
+    F[8][9]  = wx / 2.0f;
+    F[9][6]  = wz / 2.0f;
+    F[9][7]  = wy / 2.0f;
+    F[9][8]  = -wx / 2.0f;
+
+    F[6][10] = q1 / 2.0f;
+    F[6][11] = q2 / 2.0f;
+    F[6][12] = q3 / 2.0f;
+    F[7][10] = -q0 / 2.0f;
+    F[7][11] = q3 / 2.0f;
+    F[7][12] = -q2 / 2.0f;
+    F[8][10] = -q3 / 2.0f;
+    F[8][11] = -q0 / 2.0f;
+    F[8][12] = q1 / 2.0f;
+    F[9][10] = q2 / 2.0f;
+    F[9][11] = -q1 / 2.0f;
+    F[9][12] = -q0 / 2.0f;
+
+    G[3][3]  = -q0 * q0 - q1 * q1 + q2 * q2 + q3 * q3;
+    G[3][4]  = 2.0f * (-q1 * q2 + q0 * q3);
+    G[3][5]  = -2.0f * (q1 * q3 + q0 * q2);
+    G[4][3]  = -2.0f * (q1 * q2 + q0 * q3);
+    G[4][4]  = -q0 * q0 + q1 * q1 - q2 * q2 + q3 * q3;
+    G[4][5]  = 2.0f * (-q2 * q3 + q0 * q1);
+    G[5][3]  = 2.0f * (-q1 * q3 + q0 * q2);
+    G[5][4]  = -2.0f * (q2 * q3 + q0 * q1);
+    G[5][5]  = -q0 * q0 + q1 * q1 + q2 * q2 - q3 * q3;
+
+    G[6][0]  = q1 / 2.0f;
+    G[6][1]  = q2 / 2.0f;
+    G[6][2]  = q3 / 2.0f;
+    G[7][0]  = -q0 / 2.0f;
+    G[7][1]  = q3 / 2.0f;
+    G[7][2]  = -q2 / 2.0f;
+    G[8][0]  = -q3 / 2.0f;
+    G[8][1]  = -q0 / 2.0f;
+    G[8][2]  = q1 / 2.0f;
+    G[9][0]  = q2 / 2.0f;
+    G[9][1]  = -q1 / 2.0f;
+    G[9][2]  = -q0 / 2.0f;
+
+    G[10][6] = G[11][7] = G[12][8] = 1.0f;
+}
+
+static double nanoseconds()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class InsgpsTestCovariance : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        /* Synthetic flight at 500Hz: a slow climbing turn with vibration on the accels */
+        float q[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+
+        for (int n = 0; n < LENGTH; n++) {
+            float t = n * SAMPLE_PERIOD;
+            float w[3] = { 0.3f * sinf(0.7f * t), 0.2f * cosf(1.3f * t), 0.5f };
+            float a[3] = { 0.5f * sinf(0.9f * t), 0.4f * cosf(0.5f * t) + 0.05f * sinf(600.0f * t), -9.81f + 0.1f * sinf(450.0f * t) };
+            Linearize(q, w, a, F[n], G[n]);
+
+            /* Integrate the attitude for the next sample */
+            float qdot[4] = {
+                0.5f * (-q[1] * w[0] - q[2] * w[1] - q[3] * w[2]),
+                0.5f * (q[0] * w[0] - q[3] * w[1] + q[2] * w[2]),
+                0.5f * (q[3] * w[0] + q[0] * w[1] - q[1] * w[2]),
+                0.5f * (-q[2] * w[0] + q[1] * w[1] + q[0] * w[2]),
+            };
+            float norm = 0.0f;
+            for (int i = 0; i < 4; i++) {
+                q[i] += qdot[i] * SAMPLE_PERIOD;
+                norm += q[i] * q[i];
+            }
+            for (int i = 0; i < 4; i++) {
+                q[i] /= sqrtf(norm);
+            }
+        }
+
+        /* Variances as filterekf starts out with them */
+        const float Pdiag[NUMX] = { 25.0f, 25.0f, 25.0f, 5.0f, 5.0f, 5.0f, 1e-5f, 1e-5f, 1e-5f, 1e-5f, 1e-6f, 1e-6f, 1e-6f };
+        memset(P, 0, sizeof(P));
+        for (int i = 0; i < NUMX; i++) {
+            P[i][i] = Pdiag[i];
+        }
+
+        const float Qdiag[NUMW] = { 1e-5f, 1e-5f, 1e-5f, 1e-2f, 1e-2f, 1e-2f, 2e-9f, 2e-9f, 2e-9f };
+        memcpy(Q, Qdiag, sizeof(Q));
+    }
+
+    float F[LENGTH][NUMX][NUMX];
+    float G[LENGTH][NUMX][NUMW];
+    float P[NUMX][NUMX];
+    float Q[NUMW];
+};
+
+TEST_F(InsgpsTestCovariance, MatchesReference) {
+    float Pref[NUMX][NUMX];
+    float Pnew[NUMX][NUMX];
+
+    memcpy(Pref, P, sizeof(P));
+    memcpy(Pnew, P, sizeof(P));
+
+    for (int n = 0; n < LENGTH; n++) {
+        ReferenceCovariancePrediction(F[n], G[n], Q, SAMPLE_PERIOD, Pref);
+        CovariancePrediction(F[n], G[n], Q, SAMPLE_PERIOD, Pnew);
+    }
+
+    for (int i = 0; i < NUMX; i++) {
+        for (int j = 0; j < NUMX; j++) {
+            /* Allow for the different order of summation relative to the scale of the two states */
+            float scale = sqrtf(Pref[i][i] * Pref[j][j]);
+            EXPECT_NEAR(Pref[i][j], Pnew[i][j], 1e-4f * scale) << "P[" << i << "][" << j << "]";
+            EXPECT_EQ(Pnew[i][j], Pnew[j][i]);
+        }
+        EXPECT_GT(Pnew[i][i], 0.0f);
+    }
+}
+
+TEST_F(InsgpsTestCovariance, Timing) {
+    float Pref[NUMX][NUMX];
+    float Pnew[NUMX][NUMX];
+
+    memcpy(Pref, P, sizeof(P));
+    memcpy(Pnew, P, sizeof(P));
+
+    double start = nanoseconds();
+    for (int n = 0; n < LENGTH; n++) {
+        ReferenceCovariancePrediction(F[n], G[n], Q, SAMPLE_PERIOD, Pref);
+    }
+    double reference = (nanoseconds() - start) / LENGTH;
+
+    start = nanoseconds();
+    for (int n = 0; n < LENGTH; n++) {
+        CovariancePrediction(F[n], G[n], Q, SAMPLE_PERIOD, Pnew);
+    }
+    double specialized = (nanoseconds() - start) / LENGTH;
+
+    printf("Covariance prediction: reference %.0f ns, specialized %.0f ns per call\n", reference, specialized);
+}
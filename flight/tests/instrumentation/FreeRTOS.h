@@ -0,0 +1,16 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef unsigned long UBaseType_t;
+
+#define pvPortMalloc(size) malloc(size)
+
+/* The unit tests are single threaded, the test checks that the interrupt mask is balanced */
+extern int interruptsMasked;
+#define portSET_INTERRUPT_MASK_FROM_ISR()    ((UBaseType_t)interruptsMasked++)
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x) (interruptsMasked = (int)(x))
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,16 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// As a board keeping the histogram defines it in its pios_config.h
+#define PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS 32
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+
+#endif /* PIOS_H */
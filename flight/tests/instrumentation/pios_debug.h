@@ -0,0 +1,4 @@
+#ifndef PIOS_DEBUG_H
+#define PIOS_DEBUG_H
+
+#endif /* PIOS_DEBUG_H */
@@ -0,0 +1,8 @@
+#ifndef PIOS_DELAY_H
+#define PIOS_DELAY_H
+
+/* Simulated by the test */
+uint32_t PIOS_DELAY_GetRaw();
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw);
+
+#endif /* PIOS_DELAY_H */
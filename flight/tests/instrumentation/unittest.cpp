@@ -0,0 +1,141 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <math.h>
+
+extern "C" {
+#include "pios_instrumentation.h"
+
+int interruptsMasked;
+
+/* Simulated time in us */
+static uint32_t now;
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+    return now;
+}
+
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+    return now - raw;
+}
+}
+
+#define SAMPLES 32767 // fills whole buckets, none of them open ended
+
+// To use a test fixture, derive a class from testing::Test.
+class InstrumentationTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        now = 1000;
+        interruptsMasked = 0;
+        pios_instrumentation_last_used_counter = -1;
+        PIOS_Instrumentation_Init(4);
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0, interruptsMasked);
+        free(pios_instrumentation_perf_counters);
+    }
+
+    uint32_t histogram[PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS];
+};
+
+TEST_F(InstrumentationTest, BucketBoundaries) {
+    EXPECT_EQ(0, PIOS_Instrumentation_HistogramBucket(-5));
+    EXPECT_EQ(0, PIOS_Instrumentation_HistogramBucket(0));
+    EXPECT_EQ(1, PIOS_Instrumentation_HistogramBucket(1));
+    EXPECT_EQ(2, PIOS_Instrumentation_HistogramBucket(2));
+    EXPECT_EQ(3, PIOS_Instrumentation_HistogramBucket(3));
+    EXPECT_EQ(4, PIOS_Instrumentation_HistogramBucket(4));
+    EXPECT_EQ(4, PIOS_Instrumentation_HistogramBucket(5));
+    EXPECT_EQ(5, PIOS_Instrumentation_HistogramBucket(6));
+    EXPECT_EQ(5, PIOS_Instrumentation_HistogramBucket(7));
+    EXPECT_EQ(20, PIOS_Instrumentation_HistogramBucket(1024));
+    EXPECT_EQ(20, PIOS_Instrumentation_HistogramBucket(1535));
+    EXPECT_EQ(21, PIOS_Instrumentation_HistogramBucket(1536));
+    EXPECT_EQ(PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1, PIOS_Instrumentation_HistogramBucket(INT32_MAX));
+
+    // buckets never go down as values go up
+    uint8_t last = 0;
+    for (int32_t value = 0; value < 1 << 20; value++) {
+        uint8_t bucket = PIOS_Instrumentation_HistogramBucket(value);
+        EXPECT_GE(bucket, last);
+        EXPECT_LE(bucket, last + 1);
+        last = bucket;
+    }
+}
+
+TEST_F(InstrumentationTest, TimedSections) {
+    pios_counter_t counter = PIOS_Instrumentation_CreateCounter(0x1234);
+
+    // 99% of the sections take 100us, 1% 5000us
+    for (int i = 0; i < 1000; i++) {
+        PIOS_Instrumentation_TimeStart(counter);
+        now += (i % 100 == 50) ? 5000 : 100;
+        PIOS_Instrumentation_TimeEnd(counter);
+    }
+    EXPECT_EQ(1000u, PIOS_Instrumentation_TakeHistogram(counter, histogram));
+    EXPECT_EQ(990u, histogram[PIOS_Instrumentation_HistogramBucket(100)]);
+    EXPECT_EQ(10u, histogram[PIOS_Instrumentation_HistogramBucket(5000)]);
+
+    // the histogram starts over once taken
+    EXPECT_EQ(0u, PIOS_Instrumentation_TakeHistogram(counter, histogram));
+    EXPECT_EQ(0, PIOS_Instrumentation_HistogramPercentile(histogram, 0, 500));
+}
+
+TEST_F(InstrumentationTest, Percentiles) {
+    pios_counter_t counter = PIOS_Instrumentation_CreateCounter(0x1234);
+
+    // uniform over 1 .. SAMPLES
+    for (int32_t i = 1; i <= SAMPLES; i++) {
+        PIOS_Instrumentation_updateCounter(counter, (i * 7919) % SAMPLES + 1);
+    }
+    uint32_t count = PIOS_Instrumentation_TakeHistogram(counter, histogram);
+    ASSERT_EQ((uint32_t)SAMPLES, count);
+
+    const uint16_t permilles[] = { 10, 500, 900, 990, 999 };
+    for (unsigned i = 0; i < sizeof(permilles) / sizeof(permilles[0]); i++) {
+        double exact    = SAMPLES * permilles[i] / 1000.0;
+        double estimate = PIOS_Instrumentation_HistogramPercentile(histogram, count, permilles[i]);
+        printf("p%.1f exact %.0f estimate %.0f\n", permilles[i] / 10.0, exact, estimate);
+        // the values are spread evenly within each bucket too, so interpolation is close
+        EXPECT_NEAR(exact, estimate, exact * 0.01 + 1);
+    }
+}
+
+TEST_F(InstrumentationTest, PercentileWithinBucket) {
+    // whatever the distribution, the estimate is in the bucket of the true percentile
+    memset(histogram, 0, sizeof(histogram));
+    histogram[PIOS_Instrumentation_HistogramBucket(3)]    = 500;
+    histogram[PIOS_Instrumentation_HistogramBucket(200)]  = 490;
+    histogram[PIOS_Instrumentation_HistogramBucket(9000)] = 9;
+    histogram[PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1] = 1;
+
+    EXPECT_EQ(3, PIOS_Instrumentation_HistogramPercentile(histogram, 1000, 500));
+    EXPECT_EQ(PIOS_Instrumentation_HistogramBucket(200),
+              PIOS_Instrumentation_HistogramBucket(PIOS_Instrumentation_HistogramPercentile(histogram, 1000, 501)));
+    EXPECT_EQ(PIOS_Instrumentation_HistogramBucket(200),
+              PIOS_Instrumentation_HistogramBucket(PIOS_Instrumentation_HistogramPercentile(histogram, 1000, 990)));
+    EXPECT_EQ(PIOS_Instrumentation_HistogramBucket(9000),
+              PIOS_Instrumentation_HistogramBucket(PIOS_Instrumentation_HistogramPercentile(histogram, 1000, 999)));
+    EXPECT_EQ(PIOS_INSTRUMENTATION_HISTOGRAM_BUCKETS - 1,
+              PIOS_Instrumentation_HistogramBucket(PIOS_Instrumentation_HistogramPercentile(histogram, 1000, 1000)));
+}
+
+TEST_F(InstrumentationTest, Period) {
+    pios_counter_t counter = PIOS_Instrumentation_CreateCounter(0x1234);
+
+    // the first call only starts the measurement
+    for (int i = 0; i < 101; i++) {
+        PIOS_Instrumentation_TrackPeriod(counter);
+        now += 2000;
+    }
+    EXPECT_EQ(100u, PIOS_Instrumentation_TakeHistogram(counter, histogram));
+    EXPECT_EQ(100u, histogram[PIOS_Instrumentation_HistogramBucket(2000)]);
+}
@@ -6,4 +6,7 @@
 // #define PIOS_FLASHFS_LOGFS_MAX_DEVS 5
 #define PIOS_INCLUDE_FREERTOS
 
+/* Index partition a, leave the larger arenas of flashfs_config_unindexed unindexed */
+#define PIOS_FLASHFS_LOGFS_INDEX_MAX_SLOTS 256
+
 #endif /* PIOS_CONFIG_H */
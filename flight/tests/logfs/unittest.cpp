@@ -3,6 +3,7 @@
 #include <stdio.h> /* printf */
 #include <stdlib.h> /* abort */
 #include <string.h> /* memset */
+#include <chrono>
 
 extern "C" {
 #include "pios_flash.h" /* PIOS_FLASH_* API */
@@ -14,6 +15,7 @@ extern struct pios_flash_ut_cfg flash_config;
 
 extern struct flashfs_logfs_cfg flashfs_config_partition_a;
 extern struct flashfs_logfs_cfg flashfs_config_partition_b;
+extern struct flashfs_logfs_cfg flashfs_config_unindexed;
 
 #include "pios_flashfs.h" /* PIOS_FLASHFS_* */
 }
@@ -37,15 +39,7 @@ class LogfsTestRaw : public testing::Test {
 protected:
     virtual void SetUp()
     {
-        /* create an empty, appropriately sized flash filesystem */
-        FILE *theflash = fopen(FLASH_IMAGE_FILE, "wb");
-        uint8_t sector[flash_config.size_of_sector];
-
-        memset(sector, 0xFF, sizeof(sector));
-        for (uint32_t i = 0; i < flash_config.size_of_flash / flash_config.size_of_sector; i++) {
-            fwrite(sector, sizeof(sector), 1, theflash);
-        }
-        fclose(theflash);
+        CreateFlash();
 
         /* Set up obj1 */
         for (uint32_t i = 0; i < sizeof(obj1); i++) {
@@ -78,6 +72,19 @@ protected:
         unlink("theflash.bin");
     }
 
+    /* create an empty, appropriately sized flash filesystem */
+    void CreateFlash()
+    {
+        FILE *theflash = fopen(FLASH_IMAGE_FILE, "wb");
+        uint8_t sector[flash_config.size_of_sector];
+
+        memset(sector, 0xFF, sizeof(sector));
+        for (uint32_t i = 0; i < flash_config.size_of_flash / flash_config.size_of_sector; i++) {
+            fwrite(sector, sizeof(sector), 1, theflash);
+        }
+        fclose(theflash);
+    }
+
     unsigned char obj1[OBJ1_SIZE];
     unsigned char obj1_alt[OBJ1_SIZE];
     unsigned char obj2[OBJ2_SIZE];
@@ -297,6 +304,86 @@ TEST_F(LogfsTestCooked, WriteManyVerify) {
     EXPECT_EQ(0, memcmp(obj3, obj3_check, sizeof(obj3)));
 }
 
+/* Flash driver that counts the reads going to the flash */
+static uint32_t flash_reads;
+
+static int32_t counting_read_data(uintptr_t flash_id, uint32_t addr, uint8_t *data, uint16_t len)
+{
+    flash_reads++;
+    return pios_ut_flash_driver.read_data(flash_id, addr, data, len);
+}
+
+class LogfsTestIndex : public LogfsTestRaw {
+protected:
+    virtual void SetUp()
+    {
+        LogfsTestRaw::SetUp();
+
+        counting_flash_driver = pios_ut_flash_driver;
+        counting_flash_driver.read_data = counting_read_data;
+    }
+
+    /* Fill a filesystem with settings like objects, remount it and load them all back */
+    void LoadAll(const struct flashfs_logfs_cfg *cfg, uint32_t *reads, double *loadTimeUs)
+    {
+        uintptr_t flash_id;
+        uintptr_t fs_id;
+
+        /* Destroying the flash removes its image */
+        CreateFlash();
+        ASSERT_EQ(0, PIOS_Flash_UT_Init(&flash_id, &flash_config));
+        EXPECT_EQ(0, PIOS_FLASHFS_Logfs_Init(&fs_id, cfg, &counting_flash_driver, flash_id));
+        EXPECT_EQ(0, PIOS_FLASHFS_Format(fs_id));
+
+        /* Stay below one arena so that both layouts are the same */
+        for (uint32_t i = 0; i < NUM_OBJECTS; i++) {
+            obj1[0] = (uint8_t)i;
+            EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID + i * 2, i % 3, obj1, sizeof(obj1)));
+        }
+        for (uint32_t i = 0; i < NUM_OBJECTS; i += 2) {
+            obj1_alt[0] = (uint8_t)i;
+            EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID + i * 2, i % 3, obj1_alt, sizeof(obj1_alt)));
+        }
+        PIOS_FLASHFS_Logfs_Destroy(fs_id);
+
+        /* Mount the filesystem again, the index is rebuilt from flash */
+        EXPECT_EQ(0, PIOS_FLASHFS_Logfs_Init(&fs_id, cfg, &counting_flash_driver, flash_id));
+
+        unsigned char obj_check[OBJ1_SIZE];
+        flash_reads = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < NUM_OBJECTS; i++) {
+            EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID + i * 2, i % 3, obj_check, sizeof(obj_check)));
+            EXPECT_EQ((uint8_t)i, obj_check[0]);
+            EXPECT_EQ(0, memcmp(((i % 2) ? obj1 : obj1_alt) + 1, obj_check + 1, sizeof(obj_check) - 1));
+        }
+        EXPECT_EQ(-3, PIOS_FLASHFS_ObjLoad(fs_id, OBJ0_ID, 0, obj_check, sizeof(obj_check)));
+        *loadTimeUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        *reads = flash_reads;
+
+        PIOS_FLASHFS_Logfs_Destroy(fs_id);
+        PIOS_Flash_UT_Destroy(flash_id);
+    }
+
+    static const uint32_t NUM_OBJECTS = 100;
+
+    struct pios_flash_driver counting_flash_driver;
+};
+
+TEST_F(LogfsTestIndex, IndexedLoadReadsLess) {
+    uint32_t indexedReads, scanReads;
+    double indexedTimeUs, scanTimeUs;
+
+    LoadAll(&flashfs_config_partition_a, &indexedReads, &indexedTimeUs);
+    LoadAll(&flashfs_config_unindexed, &scanReads, &scanTimeUs);
+
+    printf("Loading %u objects after remount\n", NUM_OBJECTS);
+    printf("  indexed : %u flash reads, %.0f us\n", indexedReads, indexedTimeUs);
+    printf("  scan    : %u flash reads, %.0f us\n", scanReads, scanTimeUs);
+
+    EXPECT_LT(indexedReads, scanReads);
+}
+
 class LogfsTestCookedMultiPart : public LogfsTestRaw {
 protected:
     virtual void SetUp()
@@ -34,3 +34,14 @@ const struct flashfs_logfs_cfg flashfs_config_partition_b = {
     .sector_size   = 0x00010000, /* 64K bytes */
     .page_size     = 0x00000100, /* 256 bytes */
 };
+
+const struct flashfs_logfs_cfg flashfs_config_unindexed = {
+    .fs_magic      = 0x89abceef,
+    .total_fs_size = 0x00200000, /* 2M bytes (32 sectors) */
+    .arena_size    = 0x00020000, /* 512 * slot size, too many slots for the RAM index */
+    .slot_size     = 0x00000100, /* 256 bytes */
+
+    .start_offset  = 0,          /* start at the beginning of the chip */
+    .sector_size   = 0x00010000, /* 64K bytes */
+    .page_size     = 0x00000100, /* 256 bytes */
+};
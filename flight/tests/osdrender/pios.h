@@ -0,0 +1,24 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * The NTSC size of pios_video.h, its lines are not a whole number of words
+ * so the renderer has to get the words across lines right.
+ */
+#define GRAPHICS_HDEADBAND   80
+#define GRAPHICS_VDEADBAND   0
+#define GRAPHICS_WIDTH_REAL  (312 + GRAPHICS_HDEADBAND)
+#define GRAPHICS_HEIGHT_REAL (225 + GRAPHICS_VDEADBAND)
+#define GRAPHICS_TOP         0
+#define GRAPHICS_LEFT        0
+#define GRAPHICS_BOTTOM      (GRAPHICS_HEIGHT_REAL - GRAPHICS_VDEADBAND - 1)
+#define GRAPHICS_RIGHT       (GRAPHICS_WIDTH_REAL - GRAPHICS_HDEADBAND - 1)
+#define GRAPHICS_WIDTH       (GRAPHICS_WIDTH_REAL / 8)
+#define GRAPHICS_HEIGHT      GRAPHICS_HEIGHT_REAL
+
+#endif /* PIOS_H */
@@ -0,0 +1,529 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <string.h> /* memset */
+#include <time.h>
+
+extern "C" {
+#include "osdrender.h"
+#include "font12x18.h"
+#include "font8x10.h"
+
+uint8_t *draw_buffer_level;
+uint8_t *draw_buffer_mask;
+}
+
+#define BUFFER_SIZE (GRAPHICS_WIDTH * GRAPHICS_HEIGHT)
+// The renderer may read and write the word the buffer ends in
+#define BUFFER_WORDS ((BUFFER_SIZE + 3) / 4)
+
+struct Bitmap {
+    uint8_t level[BUFFER_WORDS * 4] __attribute__((aligned(4)));
+    uint8_t mask[BUFFER_WORDS * 4] __attribute__((aligned(4)));
+
+    void draw()
+    {
+        draw_buffer_level = level;
+        draw_buffer_mask  = mask;
+    }
+
+    // What is displayed
+    bool shows(const Bitmap &other) const
+    {
+        return memcmp(level, other.level, BUFFER_SIZE) == 0 && memcmp(mask, other.mask, BUFFER_SIZE) == 0;
+    }
+};
+
+static double now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// What the primitives should do, one pixel at a time
+static void ref_pixel(uint8_t *buff, int x, int y, int mode)
+{
+    if (x < 0 || y < 0 || x > OSD_CLIP_RIGHT || y >= GRAPHICS_HEIGHT_REAL) {
+        return;
+    }
+    uint32_t pos = y * GRAPHICS_WIDTH_REAL + x;
+    uint8_t bit  = 0x80 >> (pos % 8);
+    switch (mode) {
+    case 0:
+        buff[pos / 8] &= ~bit;
+        break;
+    case 1:
+        buff[pos / 8] |= bit;
+        break;
+    case 2:
+        buff[pos / 8] ^= bit;
+        break;
+    }
+}
+
+// Bresenham as drawn by osdgen before, without the last point
+static void ref_line(uint8_t *buff, int x0, int y0, int x1, int y1, int mode)
+{
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int deltax = x1 - x0;
+    int deltay = abs(y1 - y0);
+    int error  = deltax / 2;
+    int ystep  = (y0 < y1) ? 1 : -1;
+    int y = y0;
+    for (int x = x0; x < x1; x++) {
+        if (steep) {
+            ref_pixel(buff, y, x, mode);
+        } else {
+            ref_pixel(buff, x, y, mode);
+        }
+        error -= deltay;
+        if (error < 0) {
+            y     += ystep;
+            error += deltax;
+        }
+    }
+}
+
+// A glyph line of 16 pixels, leftmost in bit 15
+static void ref_glyph_line(Bitmap *ref, int x, int y, uint16_t mask, uint16_t level)
+{
+    for (int c = 0; c < 16; c++) {
+        if (mask & (0x8000 >> c)) {
+            ref_pixel(ref->mask, x + c, y, 1);
+            ref_pixel(ref->level, x + c, y, (level >> (15 - c)) & 1);
+        }
+    }
+}
+
+static bool ref_glyph_visible(int x, int y, int height)
+{
+    return x >= 0 && x <= OSD_CLIP_RIGHT && y < GRAPHICS_HEIGHT_REAL && y + height > 0;
+}
+
+static void ref_char16(Bitmap *ref, uint8_t ch, int x, int y, int font)
+{
+    struct FontEntry font_info;
+
+    fetch_font_info(0, font, &font_info, NULL);
+    if (!ref_glyph_visible(x, y, font_info.height)) {
+        return;
+    }
+    unsigned int xshift = 16 - font_info.width;
+    for (int r = 0; r < font_info.height; r++) {
+        unsigned int row = ch * font_info.height + r;
+        uint16_t mask    = (font == 3 ? font_mask12x18[row] : font_mask8x10[row]) << xshift;
+        uint16_t level   = (font == 3 ? font_frame12x18[row] : font_frame8x10[row]) << xshift;
+        ref_glyph_line(ref, x, y + r, mask, level);
+    }
+}
+
+static void ref_char(Bitmap *ref, uint8_t ch, int x, int y, int flags, int font)
+{
+    struct FontEntry font_info;
+    char lookup = 0;
+
+    if (!fetch_font_info(ch, font, &font_info, &lookup) || font_info.width > 8 || !ref_glyph_visible(x, y, font_info.height)) {
+        return;
+    }
+    const uint8_t *data = (const uint8_t *)font_info.data + (uint8_t)lookup * font_info.height * 2;
+    unsigned int xshift = 16 - font_info.width;
+    for (int r = 0; r < font_info.height; r++) {
+        uint16_t level = data[r + font_info.height] << xshift;
+        if (flags & FONT_INVERT) {
+            level = ~level;
+        }
+        ref_glyph_line(ref, x, y + r, data[r] << xshift, level);
+    }
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class OsdRenderTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        // Something to draw over, so that wrong pixels show
+        srand(1);
+        for (unsigned int i = 0; i < sizeof(out.level); i++) {
+            out.level[i] = ref.level[i] = rand();
+            out.mask[i]  = ref.mask[i] = rand();
+        }
+        out.draw();
+    }
+
+    virtual void TearDown() {}
+
+    // Also checks that nothing was written past the end of the buffers
+    bool same()
+    {
+        return memcmp(&out, &ref, sizeof(out)) == 0;
+    }
+
+    Bitmap out;
+    Bitmap ref;
+};
+
+static const int xs[] = { -3, 0, 1, 7, 8, 31, 32, 33, 63, 64, 200, OSD_CLIP_RIGHT - 1, OSD_CLIP_RIGHT, OSD_CLIP_RIGHT + 1, GRAPHICS_WIDTH_REAL + 5 };
+static const int ys[] = { -1, 0, 1, 100, GRAPHICS_HEIGHT_REAL - 1, GRAPHICS_HEIGHT_REAL };
+
+TEST_F(OsdRenderTest, HorizontalLines) {
+    for (int mode = 0; mode < 3; mode++) {
+        for (unsigned int i = 0; i < SIZEOF_ARRAY(xs); i++) {
+            for (unsigned int j = 0; j < SIZEOF_ARRAY(xs); j++) {
+                for (unsigned int k = 0; k < SIZEOF_ARRAY(ys); k++) {
+                    write_hline(out.level, xs[i], xs[j], ys[k], mode);
+                    for (int x = MIN(xs[i], xs[j]); x <= MAX(xs[i], xs[j]); x++) {
+                        ref_pixel(ref.level, x, ys[k], mode);
+                    }
+                    write_hline_lm(xs[i], xs[j], ys[k], mode, 2 - mode);
+                    for (int x = MIN(xs[i], xs[j]); x <= MAX(xs[i], xs[j]); x++) {
+                        ref_pixel(ref.level, x, ys[k], mode);
+                        ref_pixel(ref.mask, x, ys[k], 2 - mode);
+                    }
+                    ASSERT_TRUE(same()) << "x0 " << xs[i] << " x1 " << xs[j] << " y " << ys[k] << " mode " << mode;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(OsdRenderTest, VerticalLines) {
+    for (int mode = 0; mode < 3; mode++) {
+        for (unsigned int i = 0; i < SIZEOF_ARRAY(xs); i++) {
+            for (unsigned int j = 0; j < SIZEOF_ARRAY(ys); j++) {
+                for (unsigned int k = 0; k < SIZEOF_ARRAY(ys); k++) {
+                    write_vline(out.mask, xs[i], ys[j], ys[k], mode);
+                    for (int y = MIN(ys[j], ys[k]); y <= MAX(ys[j], ys[k]); y++) {
+                        ref_pixel(ref.mask, xs[i], y, mode);
+                    }
+                    write_vline_lm(xs[i], ys[j], ys[k], 2 - mode, mode);
+                    for (int y = MIN(ys[j], ys[k]); y <= MAX(ys[j], ys[k]); y++) {
+                        ref_pixel(ref.level, xs[i], y, 2 - mode);
+                        ref_pixel(ref.mask, xs[i], y, mode);
+                    }
+                    ASSERT_TRUE(same()) << "x " << xs[i] << " y0 " << ys[j] << " y1 " << ys[k] << " mode " << mode;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(OsdRenderTest, FilledRectangles) {
+    static const int sizes[] = { 0, 1, 2, 9, 31, 32, 33, 100, GRAPHICS_WIDTH_REAL };
+
+    for (int mode = 0; mode < 3; mode++) {
+        for (unsigned int i = 0; i < SIZEOF_ARRAY(xs); i++) {
+            for (unsigned int j = 0; j < SIZEOF_ARRAY(ys); j++) {
+                for (unsigned int k = 0; k < SIZEOF_ARRAY(sizes); k++) {
+                    int width  = sizes[k];
+                    int height = sizes[(k + i) % SIZEOF_ARRAY(sizes)];
+                    write_filled_rectangle(out.level, xs[i], ys[j], width, height, mode);
+                    write_filled_rectangle_lm(xs[i], ys[j], height, width, mode, 2 - mode);
+                    for (int y = ys[j]; y < ys[j] + height; y++) {
+                        for (int x = xs[i]; x < xs[i] + width; x++) {
+                            ref_pixel(ref.level, x, y, mode);
+                        }
+                    }
+                    for (int y = ys[j]; y < ys[j] + width; y++) {
+                        for (int x = xs[i]; x < xs[i] + height; x++) {
+                            ref_pixel(ref.level, x, y, mode);
+                            ref_pixel(ref.mask, x, y, 2 - mode);
+                        }
+                    }
+                    ASSERT_TRUE(same()) << "x " << xs[i] << " y " << ys[j] << " size " << width << "x" << height << " mode " << mode;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(OsdRenderTest, Lines) {
+    for (int i = 0; i < 3000; i++) {
+        int x0   = rand() % (GRAPHICS_WIDTH_REAL + 40) - 20;
+        int y0   = rand() % (GRAPHICS_HEIGHT_REAL + 40) - 20;
+        int x1   = rand() % (GRAPHICS_WIDTH_REAL + 40) - 20;
+        int y1   = rand() % (GRAPHICS_HEIGHT_REAL + 40) - 20;
+        int mode = i % 3;
+
+        // short ones too
+        if (i % 2) {
+            x1 = x0 + rand() % 21 - 10;
+            y1 = y0 + rand() % 21 - 10;
+        }
+        write_line(out.level, x0, y0, x1, y1, mode);
+        ref_line(ref.level, x0, y0, x1, y1, mode);
+        write_line_lm(x1, y1, x0, y0, mode, 2 - mode);
+        ref_line(ref.mask, x1, y1, x0, y0, mode);
+        ref_line(ref.level, x1, y1, x0, y0, 2 - mode);
+        ASSERT_TRUE(same()) << x0 << "," << y0 << " to " << x1 << "," << y1 << " mode " << mode;
+    }
+}
+
+TEST_F(OsdRenderTest, Glyphs) {
+    static const int gys[] = { -20, -5, 0, 1, 100, GRAPHICS_HEIGHT_REAL - 10, GRAPHICS_HEIGHT_REAL - 1 };
+
+    for (int x = -1; x < 40; x++) {
+        for (unsigned int j = 0; j < SIZEOF_ARRAY(gys); j++) {
+            for (int ch = 0; ch < 256; ch += 7) {
+                write_char16(ch, x, gys[j], 2 + ch % 2);
+                ref_char16(&ref, ch, x, gys[j], 2 + ch % 2);
+                write_char(ch, x + 40, gys[j], ch & FONT_INVERT, ch % 2);
+                ref_char(&ref, ch, x + 40, gys[j], ch & FONT_INVERT, ch % 2);
+            }
+            ASSERT_TRUE(same()) << "x " << x << " y " << gys[j];
+        }
+    }
+    // at the right edge, each character of each font
+    for (int x = OSD_CLIP_RIGHT - 16; x < GRAPHICS_WIDTH_REAL; x++) {
+        for (int ch = 0; ch < 256; ch++) {
+            int font = ch % 4;
+            if (font >= 2) {
+                write_char16(ch, x, ch % 40, font);
+                ref_char16(&ref, ch, x, ch % 40, font);
+            } else {
+                write_char(ch, x, ch % 40 + 100, 0, font);
+                ref_char(&ref, ch, x, ch % 40 + 100, 0, font);
+            }
+        }
+        ASSERT_TRUE(same()) << "x " << x;
+    }
+}
+
+/*
+ * Widgets for the renderer tests. Their state is changed by the test, update
+ * takes it from there like the osdgen widgets take theirs from UAVObjects.
+ */
+struct TestWidget {
+    struct osd_widget widget;
+    int state;
+    int shown;
+};
+
+static bool test_update(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    if (test->shown == test->state) {
+        return false;
+    }
+    test->shown = test->state;
+    return true;
+}
+
+static void draw_text(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+    char temp[20];
+
+    sprintf(temp, "Alt:%dm", test->shown);
+    write_string(temp, APPLY_HDEADBAND(10 + test->shown % 50), APPLY_VDEADBAND(20), 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, 3);
+}
+
+static void draw_small_text(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+    char temp[20];
+
+    sprintf(temp, "Sat:%d", test->shown);
+    write_string(temp, APPLY_HDEADBAND(40), APPLY_VDEADBAND(25 + test->shown % 5), 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, 0);
+}
+
+static void draw_box(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    write_filled_rectangle_lm(APPLY_HDEADBAND(test->shown % 200), APPLY_VDEADBAND(10 + test->shown % 30), 60, 24, 0, 1);
+}
+
+static void draw_horizon(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    draw_artificial_horizon(test->shown % 90 - 45, test->shown % 30 - 15, APPLY_HDEADBAND(GRAPHICS_RIGHT / 2 - 32), APPLY_VDEADBAND(GRAPHICS_BOTTOM - 66), 64);
+}
+
+static void draw_compass(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    hud_draw_linear_compass(test->shown % 360, 150, 120, APPLY_HDEADBAND(GRAPHICS_RIGHT / 2), APPLY_VDEADBAND(GRAPHICS_BOTTOM - 100), 15, 30, 7, 12, 0);
+}
+
+static void draw_scale(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    hud_draw_vertical_scale(test->shown, 100, -1, APPLY_HDEADBAND(2), APPLY_VDEADBAND(145), 100, 10, 20, 7, 12, 15, 1000, HUD_VSCALE_FLAG_NO_NEGATIVE);
+}
+
+static void draw_attitude(struct osd_widget *widget)
+{
+    TestWidget *test = (TestWidget *)widget;
+
+    drawAttitude(APPLY_HDEADBAND(168), APPLY_VDEADBAND(120), test->shown % 60 - 30, test->shown % 180 - 90, 96);
+}
+
+static void draw_frame(__attribute__((unused)) struct osd_widget *widget)
+{
+    write_rectangle_outlined(APPLY_HDEADBAND(0), APPLY_VDEADBAND(0), GRAPHICS_RIGHT - 8, GRAPHICS_BOTTOM, 1, 1);
+}
+
+#define TEST_WIDGETS 8
+
+class OsdRenderFrameTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        static const osd_widget_draw_t draws[TEST_WIDGETS] = {
+            draw_frame, draw_box, draw_horizon, draw_text, draw_small_text, draw_compass, draw_scale, draw_attitude
+        };
+
+        memset(widgets, 0, sizeof(widgets));
+        for (int i = 0; i < TEST_WIDGETS; i++) {
+            widgets[i].widget.sources = 1 << i;
+            widgets[i].widget.update  = (i == 0) ? NULL : test_update;
+            widgets[i].widget.draw    = draws[i];
+            widgets[i].shown = -1;
+            screen[i] = &widgets[i].widget;
+        }
+        current = 0;
+        srand(2);
+        memset(buffers, 0xa5, sizeof(buffers));
+        osd_render_invalidate();
+    }
+
+    virtual void TearDown() {}
+
+    // A new frame, like the video driver does
+    void swap()
+    {
+        current = !current;
+        buffers[current].draw();
+    }
+
+    // Everything drawn from scratch
+    void full(Bitmap *bitmap)
+    {
+        memset(bitmap, 0, sizeof(*bitmap));
+        bitmap->draw();
+        for (int i = 0; i < TEST_WIDGETS; i++) {
+            screen[i]->draw(screen[i]);
+        }
+        buffers[current].draw();
+    }
+
+    // Changes some of the widgets, the ones in changes more often
+    uint32_t change(uint32_t often)
+    {
+        uint32_t changed = 0;
+
+        for (int i = 1; i < TEST_WIDGETS; i++) {
+            if ((often & (1 << i)) || rand() % 8 == 0) {
+                widgets[i].state += 1 + rand() % 3;
+                changed |= 1 << i;
+            }
+        }
+        return changed;
+    }
+
+    TestWidget widgets[TEST_WIDGETS];
+    struct osd_widget *screen[TEST_WIDGETS];
+    Bitmap buffers[2];
+    int current;
+};
+
+TEST_F(OsdRenderFrameTest, SameAsFullRedraw) {
+    static Bitmap expected;
+    struct osd_render_stats stats;
+
+    for (int frame = 0; frame < 500; frame++) {
+        swap();
+        uint32_t changed = change(frame % 50 < 25 ? 0 : 0x84);
+        osd_render_frame(screen, TEST_WIDGETS, changed, &stats);
+        full(&expected);
+        ASSERT_TRUE(expected.shows(buffers[current])) << "frame " << frame;
+    }
+}
+
+TEST_F(OsdRenderFrameTest, NothingWhenNothingChanged) {
+    struct osd_render_stats stats;
+
+    // once for each buffer
+    for (int frame = 0; frame < 2; frame++) {
+        swap();
+        osd_render_frame(screen, TEST_WIDGETS, 0, &stats);
+        EXPECT_EQ(TEST_WIDGETS, stats.drawn);
+        EXPECT_EQ((uint32_t)GRAPHICS_WIDTH_REAL * GRAPHICS_HEIGHT_REAL, stats.cleared);
+    }
+    swap();
+    osd_render_frame(screen, TEST_WIDGETS, 0, &stats);
+    EXPECT_EQ(0, stats.updated);
+    EXPECT_EQ(0, stats.drawn);
+    EXPECT_EQ(0u, stats.cleared);
+
+    // sources that changed without changing what the widgets show
+    swap();
+    osd_render_frame(screen, TEST_WIDGETS, 0xfe, &stats);
+    EXPECT_EQ(0, stats.updated);
+    EXPECT_EQ(0, stats.drawn);
+
+    // the scale moves, the frame around the screen is drawn again where the scale was
+    widgets[6].state = 10;
+    swap();
+    osd_render_frame(screen, TEST_WIDGETS, 1 << 6, &stats);
+    EXPECT_EQ(1, stats.updated);
+    EXPECT_EQ(2, stats.drawn);
+    EXPECT_LT(stats.cleared, 100u * 50u);
+
+    // then the other buffer catches up
+    swap();
+    osd_render_frame(screen, TEST_WIDGETS, 0, &stats);
+    EXPECT_EQ(0, stats.updated);
+    EXPECT_EQ(2, stats.drawn);
+
+    swap();
+    osd_render_frame(screen, TEST_WIDGETS, 0, &stats);
+    EXPECT_EQ(0, stats.drawn);
+}
+
+TEST_F(OsdRenderFrameTest, RenderTime) {
+    const int frames = 500;
+    struct osd_render_stats stats;
+    uint32_t drawn   = 0;
+    uint32_t cleared = 0;
+
+    // Attitude changes each frame, the rest now and then
+    double start = now();
+
+    for (int frame = 0; frame < frames; frame++) {
+        swap();
+        change(0x84);
+        osd_render_invalidate();
+        osd_render_frame(screen, TEST_WIDGETS, 0xff, NULL);
+    }
+    double redraw = (now() - start) / frames;
+
+    start = now();
+    for (int frame = 0; frame < frames; frame++) {
+        swap();
+        osd_render_frame(screen, TEST_WIDGETS, change(0x84), &stats);
+        drawn   += stats.drawn;
+        cleared += stats.cleared;
+    }
+    double dirty = (now() - start) / frames;
+
+    printf("us per frame: %.1f redrawing all, %.1f redrawing what changed (%.1f of %d widgets, %u pixels cleared)\n",
+           redraw / 1000, dirty / 1000, (double)drawn / frames, TEST_WIDGETS, cleared / frames);
+    EXPECT_LT(drawn, (uint32_t)frames * TEST_WIDGETS);
+}
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <math.h>
+#include <time.h>
+
+extern "C" {
+#include "sin_lookup.h"
+}
+
+#define SAMPLES 100000
+
+static double nanoseconds()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Keeps the compiler from dropping the benchmarked calls */
+static volatile float sink;
+
+// To use a test fixture, derive a class from testing::Test.
+class SinLookupTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        sin_lookup_initalize();
+        for (int i = 0; i < SAMPLES; i++) {
+            /* angles over several turns in both directions, plus values in [-1, 1] */
+            angles[i] = -1000.0f + 2000.0f * i / SAMPLES + 0.123f;
+            ratios[i] = -1.0f + 2.0f * i / (SAMPLES - 1);
+        }
+    }
+
+    float angles[SAMPLES];
+    float ratios[SAMPLES];
+};
+
+TEST_F(SinLookupTest, SinCosDegrees) {
+    float max_error = 0.0f;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        double rad = angles[i] * M_PI / 180.0;
+        float s, c;
+        sincos_lookup_deg(angles[i], &s, &c);
+        max_error = fmaxf(max_error, fabs(s - sin(rad)));
+        max_error = fmaxf(max_error, fabs(c - cos(rad)));
+        EXPECT_EQ(s, sin_lookup_deg(angles[i]));
+        EXPECT_EQ(c, cos_lookup_deg(angles[i]));
+    }
+    printf("sin/cos deg max error %g\n", max_error);
+    EXPECT_LT(max_error, 5e-6f);
+}
+
+TEST_F(SinLookupTest, SinCosRadians) {
+    float max_error = 0.0f;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        float rad = angles[i] * 0.01f;
+        float s, c;
+        sincos_lookup_rad(rad, &s, &c);
+        max_error = fmaxf(max_error, fabs(s - sin((double)rad)));
+        max_error = fmaxf(max_error, fabs(c - cos((double)rad)));
+    }
+    printf("sin/cos rad max error %g\n", max_error);
+    EXPECT_LT(max_error, 5e-6f);
+}
+
+TEST_F(SinLookupTest, ExactAngles) {
+    EXPECT_EQ(0.0f, sin_lookup_deg(0.0f));
+    EXPECT_EQ(1.0f, sin_lookup_deg(90.0f));
+    EXPECT_EQ(-1.0f, sin_lookup_deg(-90.0f));
+    EXPECT_EQ(1.0f, cos_lookup_deg(360.0f));
+    EXPECT_EQ(-1.0f, cos_lookup_deg(180.0f));
+    EXPECT_EQ(sin_lookup_phase(0x20000000), cos_lookup_phase(0x20000000));
+}
+
+TEST_F(SinLookupTest, Atan2) {
+    float max_error = 0.0f;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        float y = sinf(angles[i]) * (1.0f + i % 7);
+        float x = cosf(angles[i]) * (1.0f + i % 7);
+        max_error = fmaxf(max_error, fabs(atan2_approx(y, x) - atan2((double)y, (double)x)));
+    }
+    printf("atan2 max error %g rad\n", max_error);
+    EXPECT_LT(max_error, 2e-6f);
+    EXPECT_EQ(0.0f, atan2_approx(0.0f, 0.0f));
+    EXPECT_NEAR(M_PI, atan2_approx(0.0f, -1.0f), 1e-6f);
+    EXPECT_NEAR(-M_PI / 2, atan2_approx(-1.0f, 0.0f), 1e-6f);
+}
+
+TEST_F(SinLookupTest, Asin) {
+    float max_error = 0.0f;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        max_error = fmaxf(max_error, fabs(asin_approx(ratios[i]) - asin((double)ratios[i])));
+    }
+    printf("asin max error %g rad\n", max_error);
+    EXPECT_LT(max_error, 5e-7f);
+    /* rounding may push a sine just past 1 */
+    EXPECT_NEAR(M_PI / 2, asin_approx(1.0000001f), 1e-6f);
+}
+
+TEST_F(SinLookupTest, Timing) {
+    double start, libm, lookup;
+
+    start  = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        sink = sinf(angles[i]) + cosf(angles[i]);
+    }
+    libm   = (nanoseconds() - start) / SAMPLES;
+    start  = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        float s, c;
+        sincos_lookup_rad(angles[i], &s, &c);
+        sink = s + c;
+    }
+    lookup = (nanoseconds() - start) / SAMPLES;
+    printf("sinf+cosf %.1f ns, sincos_lookup_rad %.1f ns\n", libm, lookup);
+
+    start  = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        sink = atan2f(ratios[i], 0.5f) + asinf(ratios[i]);
+    }
+    libm   = (nanoseconds() - start) / SAMPLES;
+    start  = nanoseconds();
+    for (int i = 0; i < SAMPLES; i++) {
+        sink = atan2_approx(ratios[i], 0.5f) + asin_approx(ratios[i]);
+    }
+    lookup = (nanoseconds() - start) / SAMPLES;
+    printf("atan2f+asinf %.1f ns, atan2_approx+asin_approx %.1f ns\n", libm, lookup);
+}
@@ -0,0 +1,46 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define pvPortMalloc(xSize) (malloc(xSize))
+#define vPortFree(pv)       (free(pv))
+
+#define pdTRUE        1
+#define pdFALSE       0
+#define portMAX_DELAY 0xffffffff
+
+typedef void *xSemaphoreHandle;
+typedef void *xQueueHandle;
+
+/* The object manager mutex is a real one, the lock free read path is tested against concurrent writers */
+static inline xSemaphoreHandle xSemaphoreCreateRecursiveMutex()
+{
+    pthread_mutexattr_t attr;
+    pthread_mutex_t *mutex = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return (xSemaphoreHandle)mutex;
+}
+
+static inline int xSemaphoreTakeRecursive(xSemaphoreHandle mutex, __attribute__((unused)) uint32_t ticks)
+{
+    return pthread_mutex_lock((pthread_mutex_t *)mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+static inline int xSemaphoreGiveRecursive(xSemaphoreHandle mutex)
+{
+    return pthread_mutex_unlock((pthread_mutex_t *)mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+static inline int xQueueSend(__attribute__((unused)) xQueueHandle queue, __attribute__((unused)) const void *item, __attribute__((unused)) uint32_t ticks)
+{
+    return pdTRUE;
+}
+
+#endif /* FREERTOS_H */
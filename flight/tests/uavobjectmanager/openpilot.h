@@ -0,0 +1,31 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "pios.h"
+
+/*
+ * Copies made by the object manager yield half way when memcpy_yield is set,
+ * so that readers and writers interleave inside a copy even on a single core
+ */
+extern volatile bool memcpy_yield;
+void *yielding_memcpy(void *dest, const void *src, size_t n);
+#define memcpy(dest, src, n) yielding_memcpy(dest, src, n)
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+#define PIOS_DEBUG_Assert(x) PIOS_Assert(x)
+#define PIOS_STATIC_ASSERT(test) ((void)sizeof(int[1 - 2 * !(test)]))
+
+#include <utlist.h>
+#include <uavobjectmanager.h>
+#include <eventdispatcher.h>
+
+uint8_t PIOS_CRC_updateCRC(uint8_t crc, const uint8_t *data, int32_t length);
+
+#endif /* OPENPILOT_H */
@@ -0,0 +1,8 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include "FreeRTOS.h"
+#include "pios_mem.h"
+#include "pios_eventtrace.h"
+
+#endif /* PIOS_H */
@@ -0,0 +1,300 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+#include "openpilot.h"
+
+volatile bool memcpy_yield;
+
+void *yielding_memcpy(void *dest, const void *src, size_t n)
+{
+    if (!memcpy_yield) {
+        return (memcpy)(dest, src, n);
+    }
+    (memcpy)(dest, src, n / 2);
+    sched_yield();
+    (memcpy)((uint8_t *)dest + n / 2, (const uint8_t *)src + n / 2, n - n / 2);
+    return dest;
+}
+
+uint8_t PIOS_CRC_updateCRC(uint8_t crc, __attribute__((unused)) const uint8_t *data, __attribute__((unused)) int32_t length)
+{
+    return crc;
+}
+
+int32_t EventCallbackDispatch(__attribute__((unused)) UAVObjEvent *ev, __attribute__((unused)) UAVObjEventCallback cb)
+{
+    return pdTRUE;
+}
+}
+
+#define NUM_OBJECTS 100
+
+/* The object manager finds the handle slots through the _uavo_handles section */
+static UAVObjHandle handles[NUM_OBJECTS] __attribute__((section("_uavo_handles"), used));
+
+static uint32_t object_ids[NUM_OBJECTS];
+
+// To use a test fixture, derive a class from testing::Test.
+class UAVObjectManagerTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        EXPECT_EQ(0, UAVObjInitialize());
+
+        /* Register objects in random ID order, IDs are even so that no metaobject ID clashes with a data object ID */
+        srand(1234);
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            bool unique;
+            do {
+                object_ids[i] = (uint32_t)rand() << 1;
+                unique = true;
+                for (int j = 0; j < i; j++) {
+                    unique &= (object_ids[j] != object_ids[i]);
+                }
+            } while (!unique);
+
+            handles[i] = UAVObjRegister(object_ids[i], (i % 3) != 0, (i % 5) == 0, false, 4 + i, NULL);
+            ASSERT_TRUE(handles[i] != NULL);
+        }
+    }
+
+    /* Reference lookup, the linear walk UAVObjGetByID() used to do */
+    UAVObjHandle ListWalk(uint32_t id)
+    {
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            if (handles[i] == NULL) {
+                continue;
+            }
+            if (UAVObjGetID(handles[i]) == id) {
+                return handles[i];
+            }
+            if (MetaObjectId(UAVObjGetID(handles[i])) == id) {
+                return UAVObjGetLinkedObj(handles[i]);
+            }
+        }
+        return NULL;
+    }
+};
+
+TEST_F(UAVObjectManagerTest, GetByIDMatchesListWalk) {
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        EXPECT_EQ(handles[i], UAVObjGetByID(object_ids[i]));
+        EXPECT_EQ(ListWalk(object_ids[i]), UAVObjGetByID(object_ids[i]));
+    }
+}
+
+TEST_F(UAVObjectManagerTest, GetByIDFindsMetaobjects) {
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        UAVObjHandle meta = UAVObjGetByID(MetaObjectId(object_ids[i]));
+        EXPECT_EQ(UAVObjGetLinkedObj(handles[i]), meta);
+        EXPECT_EQ(ListWalk(MetaObjectId(object_ids[i])), meta);
+        EXPECT_TRUE(UAVObjIsMetaobject(meta));
+    }
+}
+
+TEST_F(UAVObjectManagerTest, GetByIDUnknownObject) {
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        /* Two above an even ID is neither a registered object nor its metaobject */
+        uint32_t id = object_ids[i] + 2;
+        EXPECT_EQ(ListWalk(id), UAVObjGetByID(id));
+    }
+    EXPECT_TRUE(UAVObjGetByID(0xFFFFFFFF) == NULL);
+}
+
+TEST_F(UAVObjectManagerTest, DuplicateRegistrationFails) {
+    EXPECT_TRUE(UAVObjRegister(object_ids[0], true, false, false, 4, NULL) == NULL);
+    EXPECT_TRUE(UAVObjRegister(MetaObjectId(object_ids[1]), true, false, false, 4, NULL) == NULL);
+}
+
+TEST_F(UAVObjectManagerTest, SetGetInstanceData) {
+    uint8_t in[4 + NUM_OBJECTS];
+    uint8_t out[4 + NUM_OBJECTS];
+
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        uint32_t size = UAVObjGetNumBytes(handles[i]);
+        for (uint32_t n = 0; n < size; n++) {
+            in[n] = (uint8_t)(i + n);
+        }
+        EXPECT_EQ(0, UAVObjSetInstanceData(handles[i], 0, in));
+        memset(out, 0, sizeof(out));
+        EXPECT_EQ(0, UAVObjGetInstanceData(handles[i], 0, out));
+        EXPECT_EQ(0, memcmp(in, out, size));
+        memset(out, 0, sizeof(out));
+        EXPECT_EQ(0, UAVObjGetInstanceDataField(handles[i], 0, out, 1, size - 1));
+        EXPECT_EQ(0, memcmp(in + 1, out, size - 1));
+        EXPECT_EQ(-1, UAVObjGetInstanceDataField(handles[i], 0, out, 1, size));
+    }
+}
+
+/*
+ * Lock free reads against a concurrent writer. The writer fills the whole
+ * instance with one value per update, so a reader that sees two different
+ * bytes read a torn instance.
+ */
+#define READERS     3
+#define READS       200000
+#define TORN_OBJECT (NUM_OBJECTS - 1)
+
+static volatile bool writing;
+
+/* Wraps every access when measuring what reads cost with the mutex they used to take */
+static pthread_mutex_t reference_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool locked;
+
+struct reader_result {
+    uint32_t torn;
+    std::vector<uint32_t> ns;
+};
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool uniform(const uint8_t *data, uint32_t size)
+{
+    for (uint32_t n = 1; n < size; n++) {
+        if (data[n] != data[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *instanceWriter(__attribute__((unused)) void *arg)
+{
+    uint8_t data[4 + NUM_OBJECTS];
+    uint8_t value = 0;
+
+    while (writing) {
+        memset(data, ++value, sizeof(data));
+        if (locked) {
+            pthread_mutex_lock(&reference_mutex);
+        }
+        UAVObjSetInstanceData(handles[TORN_OBJECT], 0, data);
+        if (locked) {
+            pthread_mutex_unlock(&reference_mutex);
+        }
+        if (value % 16 == 0) {
+            // let the readers run while a write is pending, even on a single core
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *instanceReader(void *arg)
+{
+    struct reader_result *result = (struct reader_result *)arg;
+    uint32_t size = UAVObjGetNumBytes(handles[TORN_OBJECT]);
+    uint8_t data[4 + NUM_OBJECTS];
+
+    for (uint32_t i = 0; i < READS; i++) {
+        uint32_t read = size;
+        double start  = now_ns();
+        if (locked) {
+            pthread_mutex_lock(&reference_mutex);
+        }
+        switch (i % 3) {
+        case 0:
+            UAVObjGetInstanceData(handles[TORN_OBJECT], 0, data);
+            break;
+        case 1:
+            UAVObjPack(handles[TORN_OBJECT], 0, data);
+            break;
+        default:
+            UAVObjGetInstanceDataField(handles[TORN_OBJECT], 0, data, 1, size - 1);
+            read = size - 1;
+            break;
+        }
+        if (locked) {
+            pthread_mutex_unlock(&reference_mutex);
+        }
+        result->ns.push_back(now_ns() - start);
+        if (!uniform(data, read)) {
+            result->torn++;
+        }
+    }
+    return NULL;
+}
+
+static void runReaders(struct reader_result *results)
+{
+    pthread_t writer_thread;
+    pthread_t reader_threads[READERS];
+
+    for (int i = 0; i < READERS; i++) {
+        results[i].torn = 0;
+        results[i].ns.clear();
+        results[i].ns.reserve(READS);
+    }
+    writing = true;
+    ASSERT_EQ(0, pthread_create(&writer_thread, NULL, instanceWriter, NULL));
+    for (int i = 0; i < READERS; i++) {
+        ASSERT_EQ(0, pthread_create(&reader_threads[i], NULL, instanceReader, &results[i]));
+    }
+    for (int i = 0; i < READERS; i++) {
+        pthread_join(reader_threads[i], NULL);
+    }
+    writing = false;
+    pthread_join(writer_thread, NULL);
+}
+
+/* Mean and 99th percentile of the read latencies of all readers */
+static void latency(struct reader_result *results, double *mean, uint32_t *p99)
+{
+    std::vector<uint32_t> all;
+
+    for (int i = 0; i < READERS; i++) {
+        all.insert(all.end(), results[i].ns.begin(), results[i].ns.end());
+    }
+    double total = 0;
+    for (size_t i = 0; i < all.size(); i++) {
+        total += all[i];
+    }
+    *mean = total / all.size();
+    std::nth_element(all.begin(), all.begin() + all.size() * 99 / 100, all.end());
+    *p99  = all[all.size() * 99 / 100];
+}
+
+TEST_F(UAVObjectManagerTest, ReadersNeverSeeTornInstance) {
+    struct reader_result results[READERS];
+
+    locked = false;
+    memcpy_yield = true;
+    runReaders(results);
+    memcpy_yield = false;
+    for (int i = 0; i < READERS; i++) {
+        EXPECT_EQ(0u, results[i].torn);
+    }
+}
+
+TEST_F(UAVObjectManagerTest, ReadLatencyUnderContention) {
+    struct reader_result results[READERS];
+    double lockless_mean, locked_mean;
+    uint32_t lockless_p99, locked_p99;
+
+    locked = false;
+    runReaders(results);
+    latency(results, &lockless_mean, &lockless_p99);
+
+    locked = true;
+    runReaders(results);
+    latency(results, &locked_mean, &locked_p99);
+    locked = false;
+
+    printf("ns per read with %d readers and a writer: %.1f mean %u p99 lock free, %.1f mean %u p99 with a mutex\n",
+           READERS, lockless_mean, lockless_p99, locked_mean, locked_p99);
+}
@@ -0,0 +1,44 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define portMAX_DELAY    0xffffffff
+#define portTICK_RATE_MS 1
+
+typedef uint32_t portTickType;
+typedef void *xSemaphoreHandle;
+
+/* The unit tests are single threaded, the UAVTalk locks are no-ops */
+static inline xSemaphoreHandle xSemaphoreCreateRecursiveMutex()
+{
+    return (xSemaphoreHandle)1;
+}
+
+#define vSemaphoreCreateBinary(sema) ((sema) = (xSemaphoreHandle)1)
+
+static inline int xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle mutex, __attribute__((unused)) uint32_t ticks)
+{
+    return pdTRUE;
+}
+
+static inline int xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle mutex)
+{
+    return pdTRUE;
+}
+
+static inline int xSemaphoreTake(__attribute__((unused)) xSemaphoreHandle sema, __attribute__((unused)) uint32_t ticks)
+{
+    return pdFALSE;
+}
+
+static inline int xSemaphoreGive(__attribute__((unused)) xSemaphoreHandle sema)
+{
+    return pdTRUE;
+}
+
+portTickType xTaskGetTickCount();
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,21 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include "pios.h"
+
+/* The few object manager calls UAVTalk makes, implemented by the test */
+#define UAVOBJ_ALL_INSTANCES 0xFFFF
+
+typedef void *UAVObjHandle;
+
+UAVObjHandle UAVObjGetByID(uint32_t id);
+uint32_t UAVObjGetID(UAVObjHandle obj);
+uint32_t UAVObjGetNumBytes(UAVObjHandle obj);
+uint16_t UAVObjGetNumInstances(UAVObjHandle obj);
+bool UAVObjIsSingleInstance(UAVObjHandle obj);
+int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut);
+int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId, const uint8_t *dataIn);
+
+#include "uavtalk.h"
+
+#endif /* OPENPILOT_H */
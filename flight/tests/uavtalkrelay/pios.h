@@ -0,0 +1,16 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "pios_crc.h"
+
+#define pios_malloc(size) (malloc(size))
+#define pios_free(p)      (free(p))
+
+#endif /* PIOS_H */
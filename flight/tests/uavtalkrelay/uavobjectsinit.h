@@ -0,0 +1,7 @@
+#ifndef UAVOBJECTSINIT_H
+#define UAVOBJECTSINIT_H
+
+// as generated from the current object definitions
+#define UAVOBJECTS_LARGEST 217
+
+#endif /* UAVOBJECTSINIT_H */
@@ -0,0 +1,368 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <time.h>
+
+extern "C" {
+#include "openpilot.h"
+#include "uavtalk_priv.h"
+
+#define KNOWN_OBJID    0x12345678
+#define KNOWN_OBJ_SIZE 40
+
+/* One object is known to the object manager, all others are relayed blind */
+static uint8_t known_obj;
+static uint8_t unpacked[KNOWN_OBJ_SIZE];
+static portTickType ticks;
+
+portTickType xTaskGetTickCount()
+{
+    return ticks;
+}
+
+UAVObjHandle UAVObjGetByID(uint32_t id)
+{
+    return (id == KNOWN_OBJID) ? &known_obj : NULL;
+}
+
+uint32_t UAVObjGetID(__attribute__((unused)) UAVObjHandle obj)
+{
+    return KNOWN_OBJID;
+}
+
+uint32_t UAVObjGetNumBytes(__attribute__((unused)) UAVObjHandle obj)
+{
+    return KNOWN_OBJ_SIZE;
+}
+
+uint16_t UAVObjGetNumInstances(__attribute__((unused)) UAVObjHandle obj)
+{
+    return 1;
+}
+
+bool UAVObjIsSingleInstance(__attribute__((unused)) UAVObjHandle obj)
+{
+    return true;
+}
+
+int32_t UAVObjPack(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, uint8_t *dataOut)
+{
+    memcpy(dataOut, unpacked, KNOWN_OBJ_SIZE);
+    return 0;
+}
+
+int32_t UAVObjUnpack(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, const uint8_t *dataIn)
+{
+    memcpy(unpacked, dataIn, KNOWN_OBJ_SIZE);
+    return 0;
+}
+
+/* Output of the relaying connection */
+static uint8_t sent[8192];
+static int32_t sent_length;
+
+static int32_t output(uint8_t *data, int32_t length)
+{
+    if (sent_length + length > (int32_t)sizeof(sent)) {
+        sent_length = 0;
+    }
+    memcpy(&sent[sent_length], data, length);
+    sent_length += length;
+    return length;
+}
+
+static int32_t discard(__attribute__((unused)) uint8_t *data, int32_t length)
+{
+    return length;
+}
+}
+
+/* Builds a frame the way a UAVTalk sender does, returns its length */
+static uint16_t frame(uint8_t *out, uint8_t type, uint32_t objId, uint16_t instId, uint16_t timestamp, uint16_t length, uint8_t seed)
+{
+    uint16_t header = (type & UAVTALK_TIMESTAMPED) ? UAVTALK_MAX_HEADER_LENGTH : UAVTALK_MIN_HEADER_LENGTH;
+
+    out[0]  = UAVTALK_SYNC_VAL;
+    out[1]  = type;
+    out[2]  = (header + length) & 0xff;
+    out[3]  = (header + length) >> 8;
+    out[4]  = objId & 0xff;
+    out[5]  = (objId >> 8) & 0xff;
+    out[6]  = (objId >> 16) & 0xff;
+    out[7]  = objId >> 24;
+    out[8]  = instId & 0xff;
+    out[9]  = instId >> 8;
+    out[10] = timestamp & 0xff;
+    out[11] = timestamp >> 8;
+    for (uint16_t i = 0; i < length; i++) {
+        out[header + i] = seed + i * 7;
+    }
+    out[header + length] = PIOS_CRC_updateCRC(0, out, header + length);
+    return header + length + UAVTALK_CHECKSUM_LENGTH;
+}
+
+/* Relays everything received on in to out, in chunks of the given size, returns the relayed frames */
+static int relay(UAVTalkConnection in, UAVTalkConnection out, uint8_t *stream, uint32_t length, uint8_t chunk)
+{
+    int frames = 0;
+
+    for (uint32_t offset = 0; offset < length; offset += chunk) {
+        uint8_t count    = (length - offset < chunk) ? length - offset : chunk;
+        uint8_t position = 0;
+        while (position < count) {
+            if (UAVTalkProcessInputStreamQuiet(in, &stream[offset], count, &position) == UAVTALK_STATE_COMPLETE) {
+                EXPECT_EQ(0, UAVTalkRelayPacket(in, out));
+                frames++;
+            }
+        }
+    }
+    return frames;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class UAVTalkRelayTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        sent_length = 0;
+        ticks = 1000;
+        in    = UAVTalkInitialize(discard);
+        out   = UAVTalkInitialize(output);
+        ASSERT_TRUE(in != NULL);
+        ASSERT_TRUE(out != NULL);
+    }
+
+    virtual void TearDown() {}
+
+    /* A bit of everything a GCS and a flight controller send each other */
+    uint32_t mixed(uint8_t *stream)
+    {
+        uint32_t length = 0;
+
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ, KNOWN_OBJID, 0, 0, KNOWN_OBJ_SIZE, 1);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ_TS, KNOWN_OBJID, 0, 0xbeef, KNOWN_OBJ_SIZE, 2);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ, 0xcafe0000, 3, 0, 200, 3);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ_ACK_TS, 0xcafe0002, 0, 0x1234, 1, 4);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ_ACK, 0xcafe0004, 1, 0, 12, 5);
+        length += frame(&stream[length], UAVTALK_TYPE_ACK, 0xcafe0006, 0, 0, 0, 6);
+        length += frame(&stream[length], UAVTALK_TYPE_NACK, 0xcafe0008, 0, 0, 0, 7);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ_REQ, KNOWN_OBJID, 0, 0, 0, 8);
+        length += frame(&stream[length], UAVTALK_TYPE_OBJ, 0xcafe000a, 0, 0, UAVOBJECTS_LARGEST, 9);
+        return length;
+    }
+
+    UAVTalkConnection in;
+    UAVTalkConnection out;
+};
+
+TEST_F(UAVTalkRelayTest, RelaysFramesAsReceived) {
+    uint8_t stream[1024];
+    uint32_t length = mixed(stream);
+
+    // Chunks split the frames at every possible state
+    for (uint8_t chunk = 1; chunk <= 64; chunk++) {
+        sent_length = 0;
+        EXPECT_EQ(9, relay(in, out, stream, length, chunk));
+        ASSERT_EQ((int32_t)length, sent_length);
+        EXPECT_EQ(0, memcmp(stream, sent, length));
+    }
+
+    UAVTalkStats stats;
+    UAVTalkGetStats(out, &stats, false);
+    EXPECT_EQ(64 * length, stats.txBytes);
+    EXPECT_EQ(0u, stats.txErrors);
+}
+
+TEST_F(UAVTalkRelayTest, TimestampedFrameKeepsItsCrc) {
+    uint8_t stream[64];
+    uint32_t length = frame(stream, UAVTALK_TYPE_OBJ_TS, 0xcafe0000, 0, 0xbeef, 20, 1);
+
+    ticks = 42;
+    EXPECT_EQ(1, relay(in, out, stream, length, 64));
+
+    // What was relayed still parses, with the timestamp of the sender
+    UAVTalkConnection gcs = UAVTalkInitialize(discard);
+    uint8_t position = 0;
+    EXPECT_EQ(UAVTALK_STATE_COMPLETE, UAVTalkProcessInputStreamQuiet(gcs, sent, sent_length, &position));
+
+    uint16_t timestamp;
+    UAVTalkGetLastTimestamp(gcs, &timestamp);
+    EXPECT_EQ(0xbeef, timestamp);
+
+    UAVTalkStats stats;
+    UAVTalkGetStats(gcs, &stats, false);
+    EXPECT_EQ(0u, stats.rxCrcErrors);
+}
+
+TEST_F(UAVTalkRelayTest, ReceivesPayloadAfterHeader) {
+    uint8_t stream[64];
+    uint8_t types[] = { UAVTALK_TYPE_OBJ, UAVTALK_TYPE_OBJ_TS };
+
+    for (uint8_t i = 0; i < sizeof(types); i++) {
+        uint32_t length = frame(stream, types[i], KNOWN_OBJID, 0, 0x1234, KNOWN_OBJ_SIZE, 10 * i);
+        uint16_t header = length - KNOWN_OBJ_SIZE - UAVTALK_CHECKSUM_LENGTH;
+
+        memset(unpacked, 0, sizeof(unpacked));
+        EXPECT_EQ(UAVTALK_STATE_COMPLETE, UAVTalkProcessInputStream(in, stream, length));
+        EXPECT_EQ(0, memcmp(&stream[header], unpacked, KNOWN_OBJ_SIZE));
+    }
+}
+
+TEST_F(UAVTalkRelayTest, IncompleteFrameNotRelayed) {
+    uint8_t stream[64];
+    uint32_t length = frame(stream, UAVTALK_TYPE_OBJ, 0xcafe0000, 0, 0, 20, 1);
+    uint8_t position = 0;
+
+    EXPECT_EQ(UAVTALK_STATE_DATA, UAVTalkProcessInputStreamQuiet(in, stream, length - 5, &position));
+    EXPECT_EQ(-1, UAVTalkRelayPacket(in, out));
+    EXPECT_EQ(0, sent_length);
+
+    // A bad checksum is not relayed either
+    stream[length - 1] ^= 0xff;
+    position = 0;
+    EXPECT_EQ(UAVTALK_STATE_ERROR, UAVTalkProcessInputStreamQuiet(in, stream, length, &position));
+    EXPECT_EQ(-1, UAVTalkRelayPacket(in, out));
+    EXPECT_EQ(0, sent_length);
+}
+
+TEST_F(UAVTalkRelayTest, BatchSentBeforeOtherPackets) {
+    // A batched update followed by a direct send of the same object
+    EXPECT_EQ(0, UAVTalkSendObjectBatched(out, &known_obj, 0));
+    EXPECT_EQ(0, sent_length);
+    EXPECT_EQ(0, UAVTalkSendObject(out, &known_obj, 0, 0, 0));
+
+    // The multi object packet, then the object on its own
+    uint16_t batch = UAVTALK_MIN_HEADER_LENGTH + UAVTALK_MULTI_RECORD_HEADER_LENGTH + KNOWN_OBJ_SIZE + UAVTALK_CHECKSUM_LENGTH;
+    ASSERT_EQ(batch + UAVTALK_MIN_HEADER_LENGTH + KNOWN_OBJ_SIZE + UAVTALK_CHECKSUM_LENGTH, sent_length);
+    EXPECT_EQ(UAVTALK_TYPE_OBJ_MULTI, sent[1]);
+    EXPECT_EQ(UAVTALK_TYPE_OBJ, sent[batch + 1]);
+
+    // Nothing is left to flush
+    EXPECT_EQ(0, UAVTalkFlushBatch(out));
+    EXPECT_EQ(batch + UAVTALK_MIN_HEADER_LENGTH + KNOWN_OBJ_SIZE + UAVTALK_CHECKSUM_LENGTH, sent_length);
+
+    // Relayed packets are ordered the same way
+    uint8_t stream[64];
+    uint32_t length = frame(stream, UAVTALK_TYPE_OBJ, 0xcafe0000, 0, 0, 20, 1);
+    sent_length = 0;
+    EXPECT_EQ(0, UAVTalkSendObjectBatched(out, &known_obj, 0));
+    EXPECT_EQ(1, relay(in, out, stream, length, 64));
+    ASSERT_EQ((int32_t)(batch + length), sent_length);
+    EXPECT_EQ(UAVTALK_TYPE_OBJ_MULTI, sent[1]);
+    EXPECT_EQ(0, memcmp(stream, &sent[batch], length));
+}
+
+TEST_F(UAVTalkRelayTest, FullBatchesPassTheParser) {
+    // Enough updates for several multi object packets
+    for (int i = 0; i < 20; i++) {
+        EXPECT_EQ(0, UAVTalkSendObjectBatched(out, &known_obj, 0));
+    }
+    EXPECT_EQ(0, UAVTalkFlushBatch(out));
+    ASSERT_GT(sent_length, 0);
+
+    // Each batch is received and relayed like any other frame
+    uint8_t stream[sizeof(sent)];
+    uint32_t length = sent_length;
+    memcpy(stream, sent, length);
+    sent_length = 0;
+
+    int frames = relay(in, out, stream, length, 64);
+    EXPECT_GT(frames, 1);
+    EXPECT_EQ((int32_t)length, sent_length);
+    EXPECT_EQ(0, memcmp(stream, sent, length));
+
+    // The batches are as full as the parser allows
+    uint16_t records = UAVTALK_MAX_MULTI_PAYLOAD_LENGTH / (UAVTALK_MULTI_RECORD_HEADER_LENGTH + KNOWN_OBJ_SIZE);
+    EXPECT_EQ((20 + records - 1) / records, frames);
+}
+
+/* What the relay used to do : rebuild the header and copy the payload into the tx buffer */
+static int32_t reframe(UAVTalkConnection inHandle, UAVTalkConnection outHandle)
+{
+    UAVTalkConnectionData *inConnection  = (UAVTalkConnectionData *)inHandle;
+    UAVTalkConnectionData *outConnection = (UAVTalkConnectionData *)outHandle;
+    UAVTalkInputProcessor *inIproc = &inConnection->iproc;
+    uint8_t *tx = outConnection->txBuffer;
+    uint16_t length = (inIproc->type & UAVTALK_TIMESTAMPED) ? UAVTALK_MAX_HEADER_LENGTH : UAVTALK_MIN_HEADER_LENGTH;
+
+    tx[0]  = UAVTALK_SYNC_VAL;
+    tx[1]  = inIproc->type;
+    tx[4]  = inIproc->objId & 0xff;
+    tx[5]  = (inIproc->objId >> 8) & 0xff;
+    tx[6]  = (inIproc->objId >> 16) & 0xff;
+    tx[7]  = inIproc->objId >> 24;
+    tx[8]  = inIproc->instId & 0xff;
+    tx[9]  = inIproc->instId >> 8;
+    tx[10] = inIproc->timestamp & 0xff;
+    tx[11] = inIproc->timestamp >> 8;
+    memcpy(&tx[length], &inConnection->rxBuffer[UAVTALK_RX_PAYLOAD_OFFSET], inIproc->length);
+    length += inIproc->length;
+    tx[2]  = length & 0xff;
+    tx[3]  = length >> 8;
+    tx[length] = inIproc->cs;
+    return (*outConnection->outStream)(tx, length + UAVTALK_CHECKSUM_LENGTH);
+}
+
+static double seconds(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+TEST_F(UAVTalkRelayTest, RelayThroughput) {
+    // Telemetry sized frames, received in 64 byte reads like the com bridge does
+    uint8_t stream[4096];
+    uint32_t length = 0;
+    int frames = 0;
+
+    while (length + UAVTALK_MAX_PACKET_LENGTH < sizeof(stream)) {
+        length += frame(&stream[length], (frames % 4) ? UAVTALK_TYPE_OBJ : UAVTALK_TYPE_OBJ_TS, 0xcafe0000 + 2 * frames, 0, frames, 8 + (frames * 37) % 120, frames);
+        frames++;
+    }
+
+    UAVTalkSetOutputStream(out, discard);
+
+    // Each frame is relayed once, then 17 times to tell the relay from the parsing
+    const int rounds = 2000;
+    double wall[2][2], cpu[2][2];
+    for (int pass = 0; pass < 4; pass++) {
+        int method = pass & 1;
+        int repeat = (pass & 2) ? 17 : 1;
+        double wall_start = seconds(CLOCK_MONOTONIC);
+        double cpu_start  = seconds(CLOCK_PROCESS_CPUTIME_ID);
+        for (int round = 0; round < rounds; round++) {
+            for (uint32_t offset = 0; offset < length; offset += 64) {
+                uint8_t count    = (length - offset < 64) ? length - offset : 64;
+                uint8_t position = 0;
+                while (position < count) {
+                    if (UAVTalkProcessInputStreamQuiet(in, &stream[offset], count, &position) == UAVTALK_STATE_COMPLETE) {
+                        for (int i = 0; i < repeat; i++) {
+                            if (method == 0) {
+                                UAVTalkRelayPacket(in, out);
+                            } else {
+                                reframe(in, out);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        wall[pass >> 1][method] = seconds(CLOCK_MONOTONIC) - wall_start;
+        cpu[pass >> 1][method]  = seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_start;
+    }
+
+    double total = (double)frames * rounds;
+    printf("frames/s: %.0f passing through, %.0f re-framing (%d frames, %.1f bytes per frame)\n",
+           total / wall[0][0], total / wall[0][1], frames, (double)length / frames);
+    printf("CPU ns per frame: %.1f passing through, %.1f re-framing, of which relaying: %.1f, %.1f\n",
+           cpu[0][0] * 1e9 / total, cpu[0][1] * 1e9 / total,
+           (cpu[1][0] - cpu[0][0]) * 1e9 / (16 * total), (cpu[1][1] - cpu[0][1]) * 1e9 / (16 * total));
+
+    UAVTalkStats stats;
+    UAVTalkGetStats(in, &stats, false);
+    EXPECT_EQ(0u, stats.rxErrors);
+}
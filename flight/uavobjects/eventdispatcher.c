@@ -44,6 +44,7 @@
 #define CALLBACK_PRIORITY    CALLBACK_PRIORITY_CRITICAL
 #define TASK_PRIORITY        CALLBACK_TASK_FLIGHTCONTROL
 #define MAX_UPDATE_PERIOD_MS 1000
+#define HEAP_INITIAL_SIZE    32
 
 // Private types
 
@@ -65,12 +66,18 @@ struct PeriodicObjectListStruct {
     EventCallbackInfo evInfo; /** Event callback information */
     uint16_t updatePeriodMs; /** Update period in ms or 0 if no periodic updates are needed */
     int32_t  timeToNextUpdateMs; /** Time delay to the next update */
+    int16_t  heapIndex; /** Position in the update heap or -1 if no periodic updates are scheduled */
     struct PeriodicObjectListStruct *next; /** Needed by linked list library (utlist.h) */
 };
 typedef struct PeriodicObjectListStruct PeriodicObjectList;
 
 // Private variables
 static PeriodicObjectList *mObjList;
+// Binary min-heap of the scheduled entries ordered by timeToNextUpdateMs, so that
+// only the entries that are due have to be looked at
+static PeriodicObjectList **mHeap;
+static uint16_t mHeapSize;
+static uint16_t mHeapCapacity;
 static xQueueHandle mQueue;
 static DelayedCallbackInfo *eventSchedulerCallback;
 static xSemaphoreHandle mMutex;
@@ -82,6 +89,10 @@ static void eventTask();
 static int32_t eventPeriodicCreate(UAVObjEvent *ev, UAVObjEventCallback cb, xQueueHandle queue, uint16_t periodMs);
 static int32_t eventPeriodicUpdate(UAVObjEvent *ev, UAVObjEventCallback cb, xQueueHandle queue, uint16_t periodMs);
 static uint16_t randomizePeriod(uint16_t periodMs);
+static int32_t heapInsert(PeriodicObjectList *objEntry);
+static void heapRemove(PeriodicObjectList *objEntry);
+static void heapSiftUp(uint16_t index);
+static void heapSiftDown(uint16_t index);
 
 
 /**
@@ -91,7 +102,10 @@ static uint16_t randomizePeriod(uint16_t periodMs);
 int32_t EventDispatcherInitialize()
 {
     // Initialize variables
-    mObjList = NULL;
+    mObjList      = NULL;
+    mHeap         = NULL;
+    mHeapSize     = 0;
+    mHeapCapacity = 0;
     memset(&mStats, 0, sizeof(EventStats));
 
     // Create mMutex
@@ -230,6 +244,7 @@ static int32_t eventPeriodicCreate(UAVObjEvent *ev, UAVObjEventCallback cb, xQue
     // Create handle
     objEntry = (PeriodicObjectList *)pios_malloc(sizeof(PeriodicObjectList));
     if (objEntry == NULL) {
+        xSemaphoreGiveRecursive(mMutex);
         return -1;
     }
     objEntry->evInfo.ev.obj      = ev->obj;
@@ -239,6 +254,13 @@ static int32_t eventPeriodicCreate(UAVObjEvent *ev, UAVObjEventCallback cb, xQue
     objEntry->evInfo.queue       = queue;
     objEntry->updatePeriodMs     = periodMs;
     objEntry->timeToNextUpdateMs = randomizePeriod(periodMs); // avoid bunching of updates
+    objEntry->heapIndex = -1;
+    // Schedule the first update
+    if (periodMs > 0 && heapInsert(objEntry) != 0) {
+        pios_free(objEntry);
+        xSemaphoreGiveRecursive(mMutex);
+        return -1;
+    }
     // Add to list
     LL_APPEND(mObjList, objEntry);
     // Release lock
@@ -270,9 +292,15 @@ static int32_t eventPeriodicUpdate(UAVObjEvent *ev, UAVObjEventCallback cb, xQue
             // Object found, update period
             objEntry->updatePeriodMs     = periodMs;
             objEntry->timeToNextUpdateMs = randomizePeriod(periodMs); // avoid bunching of updates
+            // Reschedule
+            heapRemove(objEntry);
+            int32_t ret = 0;
+            if (periodMs > 0) {
+                ret = heapInsert(objEntry);
+            }
             // Release lock
             xSemaphoreGiveRecursive(mMutex);
-            return 0;
+            return ret;
         }
     }
     // If this point is reached the object was not found
@@ -294,6 +322,7 @@ static void eventTask()
     while (xQueueReceive(mQueue, &evInfo, 0) == pdTRUE) {
         // Invoke callback, if any
         if (evInfo.cb != 0) {
+            PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECT_RECEIVE, evInfo.ev.obj ? UAVObjGetID(evInfo.ev.obj) : 0, evInfo.ev.event);
             evInfo.cb(&evInfo.ev); // the function is expected to copy the event information
         }
         // limit loop to max queue size to slightly reduce the impact of recursive events
@@ -324,44 +353,135 @@ static int32_t processPeriodicUpdates()
     // Get lock
     xSemaphoreTakeRecursive(mMutex, portMAX_DELAY);
 
-    // Iterate through each object and update its timer, if zero then transmit object.
-    // Also calculate smallest delay to next update.
-    timeToNextUpdate = xTaskGetTickCount() * portTICK_RATE_MS + MAX_UPDATE_PERIOD_MS;
-    LL_FOREACH(mObjList, objEntry) {
-        // If object is configured for periodic updates
-        if (objEntry->updatePeriodMs > 0) {
-            // Check if time for the next update
-            timeNow = xTaskGetTickCount() * portTICK_RATE_MS;
-            if (objEntry->timeToNextUpdateMs <= timeNow) {
-                // Reset timer
-                offset = (timeNow - objEntry->timeToNextUpdateMs) % objEntry->updatePeriodMs;
-                objEntry->timeToNextUpdateMs = timeNow + objEntry->updatePeriodMs - offset;
-                // Invoke callback, if one
-                if (objEntry->evInfo.cb != 0) {
-                    objEntry->evInfo.cb(&objEntry->evInfo.ev); // the function is expected to copy the event information
-                }
-                // Push event to queue, if one
-                if (objEntry->evInfo.queue != 0) {
-                    if (xQueueSend(objEntry->evInfo.queue, &objEntry->evInfo.ev, 0) != pdTRUE && !objEntry->evInfo.ev.lowPriority) { // do not block if queue is full
-                        if (objEntry->evInfo.ev.obj != NULL) {
-                            mStats.lastErrorID = UAVObjGetID(objEntry->evInfo.ev.obj);
-                        }
-                        ++mStats.eventErrors;
-                    }
+    // Take the objects that are due from the top of the heap, update their timer and transmit them.
+    timeNow = xTaskGetTickCount() * portTICK_RATE_MS;
+    while (mHeapSize > 0 && mHeap[0]->timeToNextUpdateMs <= timeNow) {
+        objEntry = mHeap[0];
+        // Reset timer, the entry is moved to its new place before the callback can change the heap
+        offset = (timeNow - objEntry->timeToNextUpdateMs) % objEntry->updatePeriodMs;
+        objEntry->timeToNextUpdateMs = timeNow + objEntry->updatePeriodMs - offset;
+        heapSiftDown(0);
+        // Invoke callback, if one
+        if (objEntry->evInfo.cb != 0) {
+            objEntry->evInfo.cb(&objEntry->evInfo.ev); // the function is expected to copy the event information
+        }
+        // Push event to queue, if one
+        if (objEntry->evInfo.queue != 0) {
+            if (xQueueSend(objEntry->evInfo.queue, &objEntry->evInfo.ev, 0) != pdTRUE && !objEntry->evInfo.ev.lowPriority) { // do not block if queue is full
+                if (objEntry->evInfo.ev.obj != NULL) {
+                    mStats.lastErrorID = UAVObjGetID(objEntry->evInfo.ev.obj);
                 }
-            }
-            // Update minimum delay
-            if (objEntry->timeToNextUpdateMs < timeToNextUpdate) {
-                timeToNextUpdate = objEntry->timeToNextUpdateMs;
+                ++mStats.eventErrors;
             }
         }
     }
 
+    // The next update is the one on top of the heap
+    timeToNextUpdate = timeNow + MAX_UPDATE_PERIOD_MS;
+    if (mHeapSize > 0 && mHeap[0]->timeToNextUpdateMs < timeToNextUpdate) {
+        timeToNextUpdate = mHeap[0]->timeToNextUpdateMs;
+    }
+
     // Done
     xSemaphoreGiveRecursive(mMutex);
     return timeToNextUpdate;
 }
 
+/**
+ * Add an entry to the update heap, growing the heap if needed.
+ * \param[in] objEntry The entry to schedule
+ * \return Success (0), failure (-1)
+ */
+static int32_t heapInsert(PeriodicObjectList *objEntry)
+{
+    if (mHeapSize == mHeapCapacity) {
+        uint16_t capacity = (mHeapCapacity > 0) ? mHeapCapacity * 2 : HEAP_INITIAL_SIZE;
+        // pios_realloc is not available on all targets
+        PeriodicObjectList **heap = (PeriodicObjectList **)pios_malloc(capacity * sizeof(PeriodicObjectList *));
+        if (heap == NULL) {
+            return -1;
+        }
+        if (mHeap) {
+            memcpy(heap, mHeap, mHeapSize * sizeof(PeriodicObjectList *));
+            pios_free(mHeap);
+        }
+        mHeap = heap;
+        mHeapCapacity = capacity;
+    }
+    objEntry->heapIndex = mHeapSize;
+    mHeap[mHeapSize++]  = objEntry;
+    heapSiftUp(objEntry->heapIndex);
+    return 0;
+}
+
+/**
+ * Remove an entry from the update heap, if it is scheduled.
+ * \param[in] objEntry The entry to remove
+ */
+static void heapRemove(PeriodicObjectList *objEntry)
+{
+    int16_t index = objEntry->heapIndex;
+
+    if (index < 0) {
+        return;
+    }
+    objEntry->heapIndex = -1;
+    if (--mHeapSize == index) {
+        return;
+    }
+    // Fill the hole with the last entry and restore the heap order
+    mHeap[index] = mHeap[mHeapSize];
+    mHeap[index]->heapIndex = index;
+    heapSiftUp(index);
+    heapSiftDown(mHeap[index]->heapIndex);
+}
+
+/**
+ * Move a heap entry up until its parent is due before it.
+ */
+static void heapSiftUp(uint16_t index)
+{
+    PeriodicObjectList *objEntry = mHeap[index];
+
+    while (index > 0) {
+        uint16_t parent = (index - 1) / 2;
+        if (mHeap[parent]->timeToNextUpdateMs <= objEntry->timeToNextUpdateMs) {
+            break;
+        }
+        mHeap[index] = mHeap[parent];
+        mHeap[index]->heapIndex = index;
+        index = parent;
+    }
+    mHeap[index] = objEntry;
+    objEntry->heapIndex = index;
+}
+
+/**
+ * Move a heap entry down until its children are due after it.
+ */
+static void heapSiftDown(uint16_t index)
+{
+    PeriodicObjectList *objEntry = mHeap[index];
+
+    while (true) {
+        uint16_t child = 2 * index + 1;
+        if (child >= mHeapSize) {
+            break;
+        }
+        if (child + 1 < mHeapSize && mHeap[child + 1]->timeToNextUpdateMs < mHeap[child]->timeToNextUpdateMs) {
+            child++;
+        }
+        if (objEntry->timeToNextUpdateMs <= mHeap[child]->timeToNextUpdateMs) {
+            break;
+        }
+        mHeap[index] = mHeap[child];
+        mHeap[index]->heapIndex = index;
+        index = child;
+    }
+    mHeap[index] = objEntry;
+    objEntry->heapIndex = index;
+}
+
 /**
  * Return a psedorandom integer from 0 to periodMs
  * Based on the Park-Miller-Carta Pseudo-Random Number Generator
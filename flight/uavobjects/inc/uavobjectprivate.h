@@ -120,6 +120,11 @@ struct UAVOData {
      */
     struct UAVOMeta metaObj;
     uint16_t instance_size;
+    /*
+     * Sequence counter for lockless reads of the instance data.
+     * Odd while a writer is copying into any instance of this object.
+     */
+    volatile uint16_t seq;
 } __attribute__((packed, aligned(4)));
 
 /* Augmented type for Single Instance Data UAVO */
@@ -166,6 +171,29 @@ struct UAVOMulti {
 #define InstanceDataOffset(inst)         ((void *)&(((struct UAVOMultiInst *)inst)->instance))
 #define InstanceData(instance)           ((void *)instance)
 
+/** Number of lockless read attempts before a reader falls back to taking the mutex **/
+#define UAVO_SEQ_READ_ATTEMPTS 2
+
+/** Full memory barrier, DMB on Cortex-M **/
+#define UAVO_MEMORY_BARRIER()            __sync_synchronize()
+
+/**
+ * Mark the start and end of a change to the instance data of a data object.
+ * Writers are still serialized by the object manager mutex, the sequence
+ * counter only lets readers detect that they raced with a writer.
+ */
+static inline void beginInstanceWrite(struct UAVOData *obj)
+{
+    obj->seq++;
+    UAVO_MEMORY_BARRIER();
+}
+
+static inline void endInstanceWrite(struct UAVOData *obj)
+{
+    UAVO_MEMORY_BARRIER();
+    obj->seq++;
+}
+
 // Private functions
 int32_t sendEvent(struct UAVOBase *obj, uint16_t instId, UAVObjEventType event);
 InstanceHandle getInstance(struct UAVOData *obj, uint16_t instId);
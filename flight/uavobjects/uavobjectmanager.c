@@ -40,6 +40,8 @@ static InstanceHandle createInstance(struct UAVOData *obj, uint16_t instId);
 static int32_t connectObj(UAVObjHandle obj_handle, xQueueHandle queue, UAVObjEventCallback cb, uint8_t eventMask, bool fast);
 static int32_t disconnectObj(UAVObjHandle obj_handle, xQueueHandle queue, UAVObjEventCallback cb);
 static void instanceAutoUpdated(UAVObjHandle obj_handle, uint16_t instId);
+static void addToIndex(struct UAVOData *obj);
+static struct UAVOData *findInIndex(uint32_t id);
 
 
 int32_t UAVObjPers_stub(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused))  uint16_t instId)
@@ -67,6 +69,11 @@ static const UAVObjMetadata defMetadata = {
 
 static UAVObjStats stats;
 
+/* Registered data objects sorted by object ID, used by UAVObjGetByID() */
+static struct UAVOData * *uavo_index;
+static uint16_t uavo_index_size;
+static uint16_t uavo_index_count;
+
 
 static inline bool IsMetaobject(UAVObjHandle obj_handle)
 {
@@ -166,6 +173,16 @@ int32_t UAVObjInitialize()
     memset(__start__uavo_handles, 0,
            (uintptr_t)__stop__uavo_handles - (uintptr_t)__start__uavo_handles);
 
+    // Allocate the ID index, there can't be more objects than handle slots
+    uavo_index_size  = __stop__uavo_handles - __start__uavo_handles;
+    uavo_index_count = 0;
+    if (uavo_index_size > 0) {
+        uavo_index = (struct UAVOData * *)pios_malloc(uavo_index_size * sizeof(struct UAVOData *));
+        if (uavo_index == NULL) {
+            return -1;
+        }
+    }
+
     // Create mutex
     mutex = xSemaphoreCreateRecursiveMutex();
     if (mutex == NULL) {
@@ -314,6 +331,9 @@ UAVObjHandle UAVObjRegister(uint32_t id,
     /* Fill in the details about this UAVO */
     uavo_data->id = id;
     uavo_data->instance_size = num_bytes;
+
+    /* Make it visible to UAVObjGetByID() */
+    addToIndex(uavo_data);
     if (isSettings) {
         uavo_data->base.flags.isSettings = true;
         // settings defaults to being sent with priority
@@ -359,20 +379,21 @@ UAVObjHandle UAVObjGetByID(uint32_t id)
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
     // Look for object
-    UAVO_LIST_ITERATE(tmp_obj)
-    if (tmp_obj->id == id) {
-        found_obj = (UAVObjHandle *)tmp_obj;
+    struct UAVOData *uavo_data = findInIndex(id);
+    if (uavo_data) {
+        found_obj = (UAVObjHandle *)uavo_data;
         goto unlock_exit;
     }
-    if (MetaObjectId(tmp_obj->id) == id) {
-        found_obj = (UAVObjHandle *)&(tmp_obj->metaObj);
+    // Look for the data object this metaobject belongs to
+    uavo_data = findInIndex(id - 1);
+    if (uavo_data && MetaObjectId(uavo_data->id) == id) {
+        found_obj = (UAVObjHandle *)&(uavo_data->metaObj);
         goto unlock_exit;
     }
-}
 
 unlock_exit:
-xSemaphoreGiveRecursive(mutex);
-return found_obj;
+    xSemaphoreGiveRecursive(mutex);
+    return found_obj;
 }
 
 /**
@@ -511,6 +532,43 @@ unlock_exit:
     return instId;
 }
 
+/**
+ * Copy instance data of a data object without taking the mutex.
+ * The copy is retried if a writer changed the object meanwhile, after
+ * UAVO_SEQ_READ_ATTEMPTS attempts the caller has to fall back to a locked
+ * read. This also covers a reader that preempted a writer, as the locked
+ * read lets priority inheritance finish the write.
+ * \param[in] obj The object
+ * \param[in] instId The instance ID
+ * \param[out] dataOut Destination buffer
+ * \param[in] offset Offset into the instance data
+ * \param[in] size Number of bytes to copy
+ * \return 0 if success, -1 if the instance does not exist or 1 if the read has to be retried locked
+ */
+static int32_t readInstanceDataLockless(struct UAVOData *obj, uint16_t instId, void *dataOut, uint32_t offset, uint32_t size)
+{
+    for (uint8_t attempt = 0; attempt < UAVO_SEQ_READ_ATTEMPTS; attempt++) {
+        uint16_t seq = obj->seq;
+        if (seq & 1) {
+            // Write in progress
+            continue;
+        }
+        UAVO_MEMORY_BARRIER();
+
+        InstanceHandle instEntry = getInstance(obj, instId);
+        if (instEntry == NULL) {
+            return -1;
+        }
+        memcpy(dataOut, InstanceData(instEntry) + offset, size);
+
+        UAVO_MEMORY_BARRIER();
+        if (obj->seq == seq) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 /**
  * Unpack an object from a byte array
  * \param[in] obj The object handle
@@ -550,7 +608,9 @@ int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId, const uint8_t *da
             }
         }
         // Set the data
+        beginInstanceWrite(obj);
         memcpy(InstanceData(instEntry), dataIn, obj->instance_size);
+        endInstanceWrite(obj);
     }
 
     // Fire event
@@ -573,6 +633,14 @@ int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut)
 {
     PIOS_Assert(obj_handle);
 
+    // Data objects are read without taking the lock unless a writer got in the way
+    if (!IsMetaobject(obj_handle)) {
+        int32_t rc = readInstanceDataLockless((struct UAVOData *)obj_handle, instId, dataOut, 0, ((struct UAVOData *)obj_handle)->instance_size);
+        if (rc <= 0) {
+            return rc;
+        }
+    }
+
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
@@ -940,7 +1008,9 @@ int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
             goto unlock_exit;
         }
         // Set data
+        beginInstanceWrite(obj);
         memcpy(InstanceData(instEntry), dataIn, obj->instance_size);
+        endInstanceWrite(obj);
     }
 
     // Fire event
@@ -1005,7 +1075,9 @@ int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, con
         }
 
         // Set data
+        beginInstanceWrite(obj);
         memcpy(InstanceData(instEntry) + offset, dataIn, size);
+        endInstanceWrite(obj);
     }
 
 
@@ -1030,6 +1102,14 @@ int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
 {
     PIOS_Assert(obj_handle);
 
+    // Data objects are read without taking the lock unless a writer got in the way
+    if (!IsMetaobject(obj_handle)) {
+        int32_t rc = readInstanceDataLockless((struct UAVOData *)obj_handle, instId, dataOut, 0, ((struct UAVOData *)obj_handle)->instance_size);
+        if (rc <= 0) {
+            return rc;
+        }
+    }
+
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
@@ -1076,6 +1156,18 @@ int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, voi
 {
     PIOS_Assert(obj_handle);
 
+    // Data objects are read without taking the lock unless a writer got in the way
+    if (!IsMetaobject(obj_handle)) {
+        // Check for overrun
+        if ((size + offset) > ((struct UAVOData *)obj_handle)->instance_size) {
+            return -1;
+        }
+        int32_t rc = readInstanceDataLockless((struct UAVOData *)obj_handle, instId, dataOut, offset, size);
+        if (rc <= 0) {
+            return rc;
+        }
+    }
+
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
@@ -1536,6 +1628,8 @@ int32_t sendEvent(struct UAVOBase *obj, uint16_t instId, UAVObjEventType trigger
         .lowPriority = false,
     };
 
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECT_SEND, UAVObjGetID(obj), triggered_event);
+
     // Go through each object and push the event message in the queue (if event is activated for the queue)
     struct ObjectEventEntry *event;
 
@@ -1614,6 +1708,48 @@ static InstanceHandle createInstance(struct UAVOData *obj, uint16_t instId)
     return InstanceDataOffset(instEntry);
 }
 
+/**
+ * Insert a newly registered object into the sorted ID index.
+ * Objects are registered at init time only so an insertion sort is enough.
+ */
+static void addToIndex(struct UAVOData *obj)
+{
+    uint16_t pos = uavo_index_count;
+
+    PIOS_Assert(uavo_index_count < uavo_index_size);
+
+    while (pos > 0 && uavo_index[pos - 1]->id > obj->id) {
+        uavo_index[pos] = uavo_index[pos - 1];
+        pos--;
+    }
+    uavo_index[pos] = obj;
+    uavo_index_count++;
+}
+
+/**
+ * Binary search the ID index for a data object
+ * \param[in] id The object ID
+ * \return The object or NULL if no data object with this ID is registered
+ */
+static struct UAVOData *findInIndex(uint32_t id)
+{
+    uint16_t low  = 0;
+    uint16_t high = uavo_index_count;
+
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (uavo_index[mid]->id < id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < uavo_index_count && uavo_index[low]->id == id) {
+        return uavo_index[low];
+    }
+    return NULL;
+}
+
 /**
  * Get the instance information or NULL if the instance does not exist
  */
@@ -86,30 +86,26 @@ int32_t UAVObjLoad(UAVObjHandle obj_handle, uint16_t instId)
         if (instId != 0) {
             return -1;
         }
+    } else if (getInstance((struct UAVOData *)obj_handle, instId) == NULL) {
+        return -1;
+    }
 
-        // Fire event on success
-        if (PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id, UAVObjGetID(obj_handle), instId, (uint8_t *)MetaDataPtr((struct UAVOMeta *)obj_handle), UAVObjGetNumBytes(obj_handle)) == 0) {
-            sendEvent((struct UAVOBase *)obj_handle, instId, EV_UNPACKED);
-        } else {
-            return -1;
-        }
-    } else {
-        InstanceHandle instEntry = getInstance((struct UAVOData *)obj_handle, instId);
-
-        if (instEntry == NULL) {
-            return -1;
-        }
-
-        // Fire event on success
-        if (PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id, UAVObjGetID(obj_handle), instId, InstanceData(instEntry), UAVObjGetNumBytes(obj_handle)) == 0) {
-            sendEvent((struct UAVOBase *)obj_handle, instId, EV_UNPACKED);
-        } else {
-            return -1;
-        }
+    // The flash is read into a temporary buffer first: the object is only
+    // locked, and marked as being written for the lockless readers, while the
+    // data is copied in by UAVObjUnpack(), which also fires the event
+    uint16_t size = UAVObjGetNumBytes(obj_handle);
+    uint8_t *data = pios_malloc(size);
+    if (data == NULL) {
+        return -1;
     }
 
+    int32_t rc = -1;
+    if (PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id, UAVObjGetID(obj_handle), instId, data, size) == 0) {
+        rc = UAVObjUnpack(obj_handle, instId, data);
+    }
+    pios_free(data);
 
-    return 0;
+    return rc;
 }
 
 /**
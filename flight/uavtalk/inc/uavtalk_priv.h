@@ -46,6 +46,24 @@
 #define UAVTALK_MIN_PACKET_LENGTH  UAVTALK_MAX_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH
 #define UAVTALK_MAX_PACKET_LENGTH  UAVTALK_MIN_PACKET_LENGTH + UAVTALK_MAX_PAYLOAD_LENGTH
 
+// multi object packets carry the record count as instance ID and a payload made of
+// records : object ID(4), instance ID(2), data length(1), data
+#define UAVTALK_MULTI_RECORD_HEADER_LENGTH 7
+
+// a multi object packet must pass the payload length checks of every UAVTalk parser
+// on the way, relays included, and the GCS does not accept payloads of more than 255 bytes
+#if UAVTALK_MAX_PAYLOAD_LENGTH - 1 < 255
+#define UAVTALK_MAX_MULTI_PAYLOAD_LENGTH   (UAVTALK_MAX_PAYLOAD_LENGTH - 1)
+#else
+#define UAVTALK_MAX_MULTI_PAYLOAD_LENGTH   255
+#endif
+
+#define UAVTALK_MAX_MULTI_PACKET_LENGTH    UAVTALK_MIN_HEADER_LENGTH + UAVTALK_MAX_MULTI_PAYLOAD_LENGTH + UAVTALK_CHECKSUM_LENGTH
+
+// the received frame is kept whole in rxBuffer so that it can be relayed as is,
+// it starts at frameStart so that the payload is always found at this offset
+#define UAVTALK_RX_PAYLOAD_OFFSET          UAVTALK_MAX_HEADER_LENGTH
+
 typedef struct {
     uint8_t  type;
     uint16_t packet_size;
@@ -58,6 +76,7 @@ typedef struct {
     uint32_t rxCount;
     UAVTalkRxState state;
     uint16_t rxPacketLength;
+    uint8_t  frameStart; // offset of the received frame in rxBuffer
 } UAVTalkInputProcessor;
 
 typedef struct {
@@ -73,6 +92,10 @@ typedef struct {
     UAVTalkInputProcessor iproc;
     uint8_t      *rxBuffer;
     uint8_t      *txBuffer;
+    uint8_t      *batchBuffer;
+    uint16_t     batchLength;
+    uint16_t     batchCount;
+    uint16_t     batchObjectBytes;
 } UAVTalkConnectionData;
 
 #define UAVTALK_CANARI          0xCA
@@ -86,6 +109,7 @@ typedef struct {
 #define UAVTALK_TYPE_OBJ_ACK    (UAVTALK_TYPE_VER | 0x02)
 #define UAVTALK_TYPE_ACK        (UAVTALK_TYPE_VER | 0x03)
 #define UAVTALK_TYPE_NACK       (UAVTALK_TYPE_VER | 0x04)
+#define UAVTALK_TYPE_OBJ_MULTI  (UAVTALK_TYPE_VER | 0x05)
 #define UAVTALK_TYPE_OBJ_TS     (UAVTALK_TIMESTAMPED | UAVTALK_TYPE_OBJ)
 #define UAVTALK_TYPE_OBJ_ACK_TS (UAVTALK_TIMESTAMPED | UAVTALK_TYPE_OBJ_ACK)
 
@@ -51,6 +51,8 @@
 static int32_t objectTransaction(UAVTalkConnectionData *connection, uint8_t type, UAVObjHandle obj, uint16_t instId, int32_t timeout);
 static int32_t sendObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, UAVObjHandle obj);
 static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, UAVObjHandle obj);
+static int32_t batchSingleObject(UAVTalkConnectionData *connection, uint32_t objId, uint16_t instId, UAVObjHandle obj);
+static int32_t flushBatch(UAVTalkConnectionData *connection);
 static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, uint8_t *data);
 static void updateAck(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId);
 // UavTalk Process FSM functions
@@ -92,6 +94,11 @@ UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream)
     if (!connection->txBuffer) {
         return 0;
     }
+    // the batch buffer is only allocated when batching is first used
+    connection->batchBuffer      = NULL;
+    connection->batchLength      = 0;
+    connection->batchCount       = 0;
+    connection->batchObjectBytes = 0;
     vSemaphoreCreateBinary(connection->respSema);
     xSemaphoreTake(connection->respSema, 0); // reset to zero
     UAVTalkResetStats((UAVTalkConnection)connection);
@@ -273,6 +280,80 @@ int32_t UAVTalkSendObject(UAVTalkConnection connectionHandle, UAVObjHandle obj,
     }
 }
 
+/**
+ * Queue the specified object for transmission in a multi object packet.
+ * Queued objects are sent when the packet is full, when UAVTalkFlushBatch() is called
+ * or before any other packet is sent on the connection.
+ * Objects that do not fit in a multi object packet are sent on their own.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object to send
+ * \param[in] instId The instance ID or UAVOBJ_ALL_INSTANCES for all instances.
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkSendObjectBatched(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId)
+{
+    UAVTalkConnectionData *connection;
+    uint32_t numInst;
+    uint32_t n;
+    int32_t ret;
+
+    CHECKCONHANDLE(connectionHandle, connection, return -1);
+
+    // Lock
+    xSemaphoreTakeRecursive(connection->lock, portMAX_DELAY);
+
+    if (!connection->batchBuffer) {
+        connection->batchBuffer = pios_malloc(UAVTALK_MAX_MULTI_PACKET_LENGTH);
+    }
+
+    if (!connection->batchBuffer) {
+        // Out of memory, send the object the usual way
+        ret = sendObject(connection, UAVTALK_TYPE_OBJ, UAVObjGetID(obj), instId, obj);
+    } else if (instId == UAVOBJ_ALL_INSTANCES && !UAVObjIsSingleInstance(obj)) {
+        // Queue all instances in reverse order, as sendObject() does
+        numInst = UAVObjGetNumInstances(obj);
+        ret     = 0;
+        for (n = 0; n < numInst && ret == 0; ++n) {
+            ret = batchSingleObject(connection, UAVObjGetID(obj), numInst - n - 1, obj);
+        }
+    } else {
+        if (instId == UAVOBJ_ALL_INSTANCES) {
+            instId = 0;
+        }
+        ret = batchSingleObject(connection, UAVObjGetID(obj), instId, obj);
+    }
+
+    // Release lock
+    xSemaphoreGiveRecursive(connection->lock);
+
+    return ret;
+}
+
+/**
+ * Send the objects queued by UAVTalkSendObjectBatched(), if any.
+ * \param[in] connection UAVTalkConnection to be used
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkFlushBatch(UAVTalkConnection connectionHandle)
+{
+    UAVTalkConnectionData *connection;
+    int32_t ret;
+
+    CHECKCONHANDLE(connectionHandle, connection, return -1);
+
+    // Lock
+    xSemaphoreTakeRecursive(connection->lock, portMAX_DELAY);
+
+    ret = flushBatch(connection);
+
+    // Release lock
+    xSemaphoreGiveRecursive(connection->lock);
+
+    return ret;
+}
+
 /**
  * Send the specified object through the telemetry link with a timestamp.
  * \param[in] connection UAVTalkConnection to be used
@@ -453,10 +534,11 @@ UAVTalkRxState UAVTalkProcessInputStream(UAVTalkConnection connectionHandle, uin
 /**
  * Send a parsed packet received on one connection handle out on a different connection handle.
  * The packet must be in a complete state, meaning it is completed parsing.
- * The packet is re-assembled from the component parts into a complete message and sent.
+ * The receiver only accepts packets of our own UAVTalk version and keeps the verified
+ * frame in its rx buffer, so the packet is sent out as received, without re-framing.
  * This can be used to relay packets from one UAVTalk connection to another.
- * \param[in] connection UAVTalkConnection to be used
- * \param[in] rxbyte Received byte
+ * \param[in] inConnectionHandle UAVTalkConnection the packet was received on
+ * \param[in] outConnectionHandle UAVTalkConnection to send the packet on
  * \return 0 Success
  * \return -1 Failure
  */
@@ -486,49 +568,18 @@ int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnecti
     // Lock
     xSemaphoreTakeRecursive(outConnection->lock, portMAX_DELAY);
 
-    outConnection->txBuffer[0] = UAVTALK_SYNC_VAL;
-    // Setup type
-    outConnection->txBuffer[1] = inIproc->type;
-    // next 2 bytes are reserved for data length (inserted here later)
-    // Setup object ID
-    outConnection->txBuffer[4] = (uint8_t)(inIproc->objId & 0xFF);
-    outConnection->txBuffer[5] = (uint8_t)((inIproc->objId >> 8) & 0xFF);
-    outConnection->txBuffer[6] = (uint8_t)((inIproc->objId >> 16) & 0xFF);
-    outConnection->txBuffer[7] = (uint8_t)((inIproc->objId >> 24) & 0xFF);
-    // Setup instance ID
-    outConnection->txBuffer[8] = (uint8_t)(inIproc->instId & 0xFF);
-    outConnection->txBuffer[9] = (uint8_t)((inIproc->instId >> 8) & 0xFF);
-    int32_t headerLength = 10;
-
-    // Add timestamp when the transaction type is appropriate
-    if (inIproc->type & UAVTALK_TIMESTAMPED) {
-        portTickType time = xTaskGetTickCount();
-        outConnection->txBuffer[10] = (uint8_t)(time & 0xFF);
-        outConnection->txBuffer[11] = (uint8_t)((time >> 8) & 0xFF);
-        headerLength += 2;
-    }
-
-    // Copy data (if any)
-    if (inIproc->length > 0) {
-        memcpy(&outConnection->txBuffer[headerLength], inConnection->rxBuffer, inIproc->length);
-    }
-
-    // Store the packet length
-    outConnection->txBuffer[2] = (uint8_t)((headerLength + inIproc->length) & 0xFF);
-    outConnection->txBuffer[3] = (uint8_t)(((headerLength + inIproc->length) >> 8) & 0xFF);
+    // Keep the order of anything batched on the out connection
+    flushBatch(outConnection);
 
-    // Copy the checksum
-    outConnection->txBuffer[headerLength + inIproc->length] = inIproc->cs;
-
-    // Send the buffer.
-    int32_t rc = (*outConnection->outStream)(outConnection->txBuffer, headerLength + inIproc->length + UAVTALK_CHECKSUM_LENGTH);
+    // Send the frame, header, timestamp and checksum included.
+    int32_t rc = (*outConnection->outStream)(&inConnection->rxBuffer[inIproc->frameStart], inIproc->rxPacketLength);
 
     // Update stats
     outConnection->stats.txBytes += (rc > 0) ? rc : 0;
 
     // evaluate return value before releasing the lock
     int32_t ret = 0;
-    if (rc != (int32_t)(headerLength + inIproc->length + UAVTALK_CHECKSUM_LENGTH)) {
+    if (rc != (int32_t)inIproc->rxPacketLength) {
         outConnection->stats.txErrors++;
         ret = -1;
     }
@@ -557,7 +608,7 @@ int32_t UAVTalkReceiveObject(UAVTalkConnection connectionHandle)
         return -1;
     }
 
-    return receiveObject(connection, iproc->type, iproc->objId, iproc->instId, connection->rxBuffer);
+    return receiveObject(connection, iproc->type, iproc->objId, iproc->instId, &connection->rxBuffer[UAVTALK_RX_PAYLOAD_OFFSET]);
 }
 
 /**
@@ -737,6 +788,10 @@ static int32_t sendObject(UAVTalkConnectionData *connection, uint8_t type, uint3
 
     // Important note : obj can be null (when type is NACK for example) so protect all obj dereferences.
 
+    // Batched updates go out first, the receiver must not get an older copy of an object after a newer one.
+    // The batch is dropped if this fails, like on any flush.
+    flushBatch(connection);
+
     // If all instances are requested and this is a single instance object, force instance ID to zero
     if ((obj != NULL) && (instId == UAVOBJ_ALL_INSTANCES) && UAVObjIsSingleInstance(obj)) {
         instId = 0;
@@ -861,6 +916,115 @@ static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type,
     return 0;
 }
 
+/**
+ * Append an object instance to the pending multi object packet, sending the packet first
+ * if the object does not fit anymore. Must be called with the connection lock held.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] objId The object ID
+ * \param[in] instId The instance ID (can NOT be UAVOBJ_ALL_INSTANCES)
+ * \param[in] obj Object handle to send
+ * \return 0 Success
+ * \return -1 Failure
+ */
+static int32_t batchSingleObject(UAVTalkConnectionData *connection, uint32_t objId, uint16_t instId, UAVObjHandle obj)
+{
+    uint16_t length = UAVObjGetNumBytes(obj);
+
+    // Objects too large for a multi object packet are sent on their own
+    if (length + UAVTALK_MULTI_RECORD_HEADER_LENGTH > UAVTALK_MAX_MULTI_PAYLOAD_LENGTH) {
+        if (flushBatch(connection) == -1) {
+            return -1;
+        }
+        return sendSingleObject(connection, UAVTALK_TYPE_OBJ, objId, instId, obj);
+    }
+
+    if (connection->batchLength + UAVTALK_MULTI_RECORD_HEADER_LENGTH + length > UAVTALK_MAX_MULTI_PAYLOAD_LENGTH) {
+        if (flushBatch(connection) == -1) {
+            return -1;
+        }
+    }
+
+    // Records follow the packet header
+    uint8_t *record = &connection->batchBuffer[UAVTALK_MIN_HEADER_LENGTH + connection->batchLength];
+    record[0] = (uint8_t)(objId & 0xFF);
+    record[1] = (uint8_t)((objId >> 8) & 0xFF);
+    record[2] = (uint8_t)((objId >> 16) & 0xFF);
+    record[3] = (uint8_t)((objId >> 24) & 0xFF);
+    record[4] = (uint8_t)(instId & 0xFF);
+    record[5] = (uint8_t)((instId >> 8) & 0xFF);
+    record[6] = (uint8_t)length;
+
+    if (UAVObjPack(obj, instId, &record[UAVTALK_MULTI_RECORD_HEADER_LENGTH]) == -1) {
+        connection->stats.txErrors++;
+        return -1;
+    }
+
+    connection->batchLength      += UAVTALK_MULTI_RECORD_HEADER_LENGTH + length;
+    connection->batchObjectBytes += length;
+    connection->batchCount++;
+
+    return 0;
+}
+
+/**
+ * Send the pending multi object packet. Must be called with the connection lock held.
+ * \param[in] connection UAVTalkConnection to be used
+ * \return 0 Success
+ * \return -1 Failure
+ */
+static int32_t flushBatch(UAVTalkConnectionData *connection)
+{
+    if (connection->batchCount == 0) {
+        return 0;
+    }
+
+    uint16_t count        = connection->batchCount;
+    uint16_t objectBytes  = connection->batchObjectBytes;
+    uint16_t packetLength = UAVTALK_MIN_HEADER_LENGTH + connection->batchLength;
+
+    // The batch is dropped on failure, the objects will be sent again on their next update
+    connection->batchLength      = 0;
+    connection->batchCount       = 0;
+    connection->batchObjectBytes = 0;
+
+    if (!connection->outStream) {
+        connection->stats.txErrors++;
+        return -1;
+    }
+
+    uint8_t *buffer = connection->batchBuffer;
+    buffer[0] = UAVTALK_SYNC_VAL;
+    buffer[1] = UAVTALK_TYPE_OBJ_MULTI;
+    buffer[2] = (uint8_t)(packetLength & 0xFF);
+    buffer[3] = (uint8_t)((packetLength >> 8) & 0xFF);
+    // No object ID, the instance ID holds the number of records
+    buffer[4] = 0;
+    buffer[5] = 0;
+    buffer[6] = 0;
+    buffer[7] = 0;
+    buffer[8] = (uint8_t)(count & 0xFF);
+    buffer[9] = (uint8_t)((count >> 8) & 0xFF);
+
+    // Calculate and store checksum
+    buffer[packetLength] = PIOS_CRC_updateCRC(0, buffer, packetLength);
+
+    uint16_t tx_msg_len = packetLength + UAVTALK_CHECKSUM_LENGTH;
+    int32_t rc = (*connection->outStream)(buffer, tx_msg_len);
+
+    // Update stats
+    if (rc == tx_msg_len) {
+        connection->stats.txObjects     += count;
+        connection->stats.txObjectBytes += objectBytes;
+        connection->stats.txBytes       += tx_msg_len;
+    } else {
+        connection->stats.txErrors++;
+        connection->stats.txBytes += (rc > 0) ? rc : 0;
+        return -1;
+    }
+
+    return 0;
+}
+
 /*
  * Functions that implements the UAVTalk Process FSM. return false to break out of current cycle
  */
@@ -898,6 +1062,11 @@ static bool UAVTalkProcess_TYPE(UAVTalkConnectionData *connection, UAVTalkInputP
     // update the CRC
     iproc->cs    = PIOS_CRC_updateByte(iproc->cs, rxbyte);
 
+    // place the frame so that its payload starts at UAVTALK_RX_PAYLOAD_OFFSET
+    iproc->frameStart = UAVTALK_RX_PAYLOAD_OFFSET - ((rxbyte & UAVTALK_TIMESTAMPED) ? UAVTALK_MAX_HEADER_LENGTH : UAVTALK_MIN_HEADER_LENGTH);
+    connection->rxBuffer[iproc->frameStart]     = UAVTALK_SYNC_VAL;
+    connection->rxBuffer[iproc->frameStart + 1] = rxbyte;
+
     iproc->type  = rxbyte;
     iproc->rxPacketLength++;
     iproc->packet_size = 0;
@@ -911,6 +1080,7 @@ static bool UAVTalkProcess_SIZE(UAVTalkConnectionData *connection, UAVTalkInputP
         uint8_t rxbyte = rxbuffer[(*position)++];
         // update the CRC
         iproc->cs = PIOS_CRC_updateByte(iproc->cs, rxbyte);
+        connection->rxBuffer[iproc->frameStart + iproc->rxPacketLength + iproc->rxCount] = rxbyte;
         iproc->packet_size += rxbyte << 8 * iproc->rxCount;
         iproc->rxCount++;
     }
@@ -933,11 +1103,12 @@ static bool UAVTalkProcess_SIZE(UAVTalkConnectionData *connection, UAVTalkInputP
     return true;
 }
 
-static bool UAVTalkProcess_OBJID(__attribute__((unused)) UAVTalkConnectionData *connection, UAVTalkInputProcessor *iproc, uint8_t *rxbuffer, uint8_t length, uint8_t *position)
+static bool UAVTalkProcess_OBJID(UAVTalkConnectionData *connection, UAVTalkInputProcessor *iproc, uint8_t *rxbuffer, uint8_t length, uint8_t *position)
 {
     while (iproc->rxCount < 4 && length > (*position)) {
         uint8_t rxbyte = rxbuffer[(*position)++];
         iproc->cs     = PIOS_CRC_updateByte(iproc->cs, rxbyte);
+        connection->rxBuffer[iproc->frameStart + iproc->rxPacketLength + iproc->rxCount] = rxbyte;
         iproc->objId += rxbyte << (8 * (iproc->rxCount++));
     }
 
@@ -956,6 +1127,7 @@ static bool UAVTalkProcess_INSTID(UAVTalkConnectionData *connection, UAVTalkInpu
     while (iproc->rxCount < 2 && length > (*position)) {
         uint8_t rxbyte = rxbuffer[(*position)++];
         iproc->cs      = PIOS_CRC_updateByte(iproc->cs, rxbyte);
+        connection->rxBuffer[iproc->frameStart + iproc->rxPacketLength + iproc->rxCount] = rxbyte;
         iproc->instId += rxbyte << (8 * (iproc->rxCount++));
     }
 
@@ -1012,11 +1184,12 @@ static bool UAVTalkProcess_INSTID(UAVTalkConnectionData *connection, UAVTalkInpu
     return true;
 }
 
-static bool UAVTalkProcess_TIMESTAMP(__attribute__((unused)) UAVTalkConnectionData *connection, UAVTalkInputProcessor *iproc, uint8_t *rxbuffer, uint8_t length, uint8_t *position)
+static bool UAVTalkProcess_TIMESTAMP(UAVTalkConnectionData *connection, UAVTalkInputProcessor *iproc, uint8_t *rxbuffer, uint8_t length, uint8_t *position)
 {
     while (iproc->rxCount < 2 && length > (*position)) {
         uint8_t rxbyte = rxbuffer[(*position)++];
         iproc->cs = PIOS_CRC_updateByte(iproc->cs, rxbyte);
+        connection->rxBuffer[iproc->frameStart + iproc->rxPacketLength + iproc->rxCount] = rxbyte;
         iproc->timestamp += rxbyte << (8 * (iproc->rxCount++));
     }
 
@@ -1043,11 +1216,13 @@ static bool UAVTalkProcess_DATA(UAVTalkConnectionData *connection, UAVTalkInputP
         toCopy = length - (*position);
     }
 
-    memcpy(&connection->rxBuffer[iproc->rxCount], &rxbuffer[(*position)], toCopy);
+    uint8_t *payload = &connection->rxBuffer[UAVTALK_RX_PAYLOAD_OFFSET];
+
+    memcpy(&payload[iproc->rxCount], &rxbuffer[(*position)], toCopy);
     (*position)    += toCopy;
 
     // update the CRC
-    iproc->cs       = PIOS_CRC_updateCRC(iproc->cs, &connection->rxBuffer[iproc->rxCount], toCopy);
+    iproc->cs       = PIOS_CRC_updateCRC(iproc->cs, &payload[iproc->rxCount], toCopy);
     iproc->rxCount += toCopy;
 
     iproc->rxPacketLength += toCopy;
@@ -1074,6 +1249,7 @@ static bool UAVTalkProcess_CS(UAVTalkConnectionData *connection, UAVTalkInputPro
         iproc->state = UAVTALK_STATE_ERROR;
         return false;;
     }
+    connection->rxBuffer[iproc->frameStart + iproc->rxPacketLength] = rxbyte;
     iproc->rxPacketLength++;
 
     if (iproc->rxPacketLength != (iproc->packet_size + UAVTALK_CHECKSUM_LENGTH)) {
@@ -0,0 +1,17 @@
+#-------------------------------------------------
+#
+# Example of a tool that reads the telemetry the GCS shares
+# when "Share telemetry with local tools" is enabled
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = UAVTalkBusClient
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+SOURCES += main.cpp
@@ -0,0 +1,135 @@
+/**
+ ******************************************************************************
+ *
+ * @file       main.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Prints the telemetry frames the GCS shares with local tools.
+ *             See uavtalkbus.h in the UAVTalk plugin for the layout of the ring.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include <QtCore/QCoreApplication>
+#include <QSharedMemory>
+#include <QThread>
+#include <QDebug>
+
+#include <atomic>
+#include <stddef.h>
+#include <string.h>
+
+static const char *const SHARED_MEMORY_KEY = "LibrePilotGCS.UAVTalkBus";
+static const quint32 MAGIC   = 0x42564155;
+static const quint32 VERSION = 1;
+
+struct RingHeader {
+    quint32 magic;
+    quint32 version;
+    quint32 slotCount;
+    quint32 slotSize;
+    std::atomic<quint64> head;
+};
+
+struct Slot {
+    std::atomic<quint64> sequence;
+    qint64  timestamp;
+    quint32 objId;
+    quint16 instId;
+    quint8  type;
+    quint8  direction;
+    quint16 length;
+    quint8  data[256];
+};
+
+static_assert(sizeof(RingHeader) == 24 && sizeof(Slot) == 288 && offsetof(Slot, data) == 26, "layout does not match the GCS");
+
+static Slot *slot(RingHeader *ring, quint64 sequence)
+{
+    return (Slot *)((char *)ring + sizeof(RingHeader) + (sequence % ring->slotCount) * ring->slotSize);
+}
+
+/**
+ * Copy the frame with the given sequence number out of the ring.
+ * Returns false if it was overwritten before or while it was copied.
+ */
+static bool readFrame(RingHeader *ring, quint64 sequence, Slot *frame)
+{
+    Slot *s = slot(ring, sequence);
+
+    if (s->sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    frame->timestamp = s->timestamp;
+    frame->objId     = s->objId;
+    frame->instId    = s->instId;
+    frame->type      = s->type;
+    frame->direction = s->direction;
+    frame->length    = qMin<quint16>(s->length, sizeof(frame->data));
+    memcpy(frame->data, s->data, frame->length);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return s->sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QSharedMemory memory(SHARED_MEMORY_KEY);
+
+    if (!memory.attach(QSharedMemory::ReadOnly)) {
+        qDebug() << "Cannot attach to the GCS telemetry, is sharing enabled?" << memory.errorString();
+        return 1;
+    }
+
+    RingHeader *ring = (RingHeader *)memory.constData();
+    if (memory.size() < (int)sizeof(RingHeader) || ring->magic != MAGIC || ring->version != VERSION
+        || ring->slotSize < sizeof(Slot) || memory.size() < (int)(sizeof(RingHeader) + ring->slotCount * ring->slotSize)) {
+        qDebug() << "Unknown shared telemetry layout";
+        return 1;
+    }
+
+    quint64 next = ring->head.load(std::memory_order_acquire);
+    quint64 lost = 0;
+    Slot frame;
+
+    while (1) {
+        const quint64 head = ring->head.load(std::memory_order_acquire);
+
+        if (head < next) {
+            qDebug() << "GCS restarted";
+            next = head;
+        }
+        // Keep half a ring away from the GCS, it is about to overwrite the older frames
+        if (head - next > ring->slotCount / 2) {
+            lost += head - ring->slotCount / 2 - next;
+            next  = head - ring->slotCount / 2;
+        }
+
+        for (; next < head; next++) {
+            if (!readFrame(ring, next, &frame)) {
+                lost++;
+                continue;
+            }
+            qDebug().nospace() << frame.timestamp << (frame.direction ? " tx" : " rx")
+                               << " type 0x" << hex << frame.type << " obj 0x" << frame.objId << dec
+                               << " inst " << frame.instId << " length " << frame.length << " lost " << lost;
+        }
+
+        QThread::msleep(10);
+    }
+
+    return 0;
+}
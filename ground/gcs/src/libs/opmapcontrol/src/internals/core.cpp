@@ -44,6 +44,7 @@ Core::Core() : MouseWheelZooming(false), currentPosition(0, 0), currentPositionP
     dragPoint    = Point(0, 0);
     CanDragMap   = true;
     tilesToload  = 0;
+    decodedTiles.setMaxCost(DecodedTilesMemorySize);
     OPMaps::Instance();
 }
 Core::~Core()
@@ -63,14 +64,15 @@ void Core::run()
     Mdebug.unlock();
     qDebug() << "core:run" << " ID=" << debug;
 #endif // DEBUG_CORE
-    bool last = false;
+    bool last     = false;
+    bool finished = false;
 
     LoadTask task;
 
     MtileLoadQueue.lock();
     {
         if (tileLoadQueue.count() > 0) {
-            task = tileLoadQueue.dequeue();
+            task = tileLoadQueue.Dequeue();
             {
                 last = (tileLoadQueue.count() == 0);
 #ifdef DEBUG_CORE
@@ -108,6 +110,13 @@ void Core::run()
                         foreach(MapType::Types tl, layers) {
                             int retry = 0;
 
+                            MtileLoadQueue.lock();
+                            bool cancelled = tileLoadQueue.IsCancelled(task);
+                            MtileLoadQueue.unlock();
+                            if (cancelled) {
+                                break;
+                            }
+
                             do {
                                 QByteArray img;
 
@@ -144,8 +153,18 @@ void Core::run()
                             } while (++retry < OPMaps::Instance()->RetryLoadTile);
                         }
 
-                        if (t->Overlays.count() > 0) {
+                        // the tile must not get into the matrix once the task is cancelled,
+                        // the matrix may have been cleared for a new zoom already
+                        bool added = false;
+                        MtileLoadQueue.lock();
+                        finished = true;
+                        if (tileLoadQueue.Finished(task) && t->Overlays.count() > 0) {
                             Matrix.SetTileAt(task.Pos, t);
+                            added = true;
+                        }
+                        MtileLoadQueue.unlock();
+
+                        if (added) {
                             emit OnNeedInvalidation();
 
 #ifdef DEBUG_CORE
@@ -192,6 +211,12 @@ void Core::run()
             emit OnTilesStillToLoad(tilesToload < 0 ? 0 : tilesToload);
             loaderLimit.release();
         }
+
+        if (!finished) {
+            MtileLoadQueue.lock();
+            tileLoadQueue.Finished(task);
+            MtileLoadQueue.unlock();
+        }
     }
     MrunningThreads.lock();
     --runningThreads;
@@ -214,8 +239,9 @@ void Core::SetZoom(const int &value)
         maxOfTiles = Projection()->GetTileMatrixMaxXY(value);
         currentPositionPixel = Projection()->FromLatLngToPixel(currentPosition, value);
         if (started) {
+            // every task is for the old zoom
             MtileLoadQueue.lock();
-            tileLoadQueue.clear();
+            tileLoadQueue.Clear();
             MtileLoadQueue.unlock();
             MtileToload.lock();
             tilesToload = 0;
@@ -417,13 +443,14 @@ void Core::ReloadMap()
 
         MtileLoadQueue.lock();
         {
-            tileLoadQueue.clear();
+            tileLoadQueue.Clear();
         }
         MtileLoadQueue.unlock();
         MtileToload.lock();
         tilesToload = 0;
         MtileToload.unlock();
         Matrix.Clear();
+        decodedTiles.clear();
 
         emit OnNeedInvalidation();
     }
@@ -513,7 +540,7 @@ void Core::CancelAsyncTasks()
         ProcessLoadTaskCallback.waitForDone();
         MtileLoadQueue.lock();
         {
-            tileLoadQueue.clear();
+            tileLoadQueue.Clear();
             // tilesToload=0;
         }
         MtileLoadQueue.unlock();
@@ -535,17 +562,25 @@ void Core::UpdateBounds()
 
         emit OnTileLoadStart();
 
+        // cancel what went out of view, the rest loads from the center out
+        MtileLoadQueue.lock();
+        {
+            int cancelled = tileLoadQueue.Retain(Zoom(), centerTileXYLocation, tileDrawingList);
+            MtileToload.lock();
+            tilesToload -= cancelled;
+            MtileToload.unlock();
+        }
+        MtileLoadQueue.unlock();
 
         foreach(Point p, tileDrawingList) {
             LoadTask task = LoadTask(p, Zoom());
             {
                 MtileLoadQueue.lock();
                 {
-                    if (!tileLoadQueue.contains(task)) {
+                    if (tileLoadQueue.Enqueue(task)) {
                         MtileToload.lock();
                         ++tilesToload;
                         MtileToload.unlock();
-                        tileLoadQueue.enqueue(task);
 #ifdef DEBUG_CORE
                         qDebug() << "Core::UpdateBounds new Task" << task.Pos.ToString();
 #endif // DEBUG_CORE
@@ -38,8 +38,10 @@
 #include "rectangle.h"
 #include "QThreadPool"
 #include "tilematrix.h"
-#include <QQueue>
+#include <QCache>
+#include <QPixmap>
 #include "loadtask.h"
+#include "tileloadqueue.h"
 #include "copyrightstrings.h"
 #include "rectlatlng.h"
 #include "../internals/projections/lks94projection.h"
@@ -341,7 +343,12 @@ private:
 
     Rectangle CurrentRegion;
 
-    QQueue<LoadTask> tileLoadQueue;
+    TileLoadQueue tileLoadQueue;
+
+    // Tiles decoded for drawing, with all layers composed, keyed by zoom and
+    // position. Only used by the GUI thread.
+    QCache<LoadTask, QPixmap> decodedTiles;
+    static const int DecodedTilesMemorySize = 32 * 1024 * 1024; // bytes
 
     int zoom;
 
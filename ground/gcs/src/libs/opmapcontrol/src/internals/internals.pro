@@ -5,6 +5,7 @@ HEADERS += core.h \
     tile.h \
     tilematrix.h \
     loadtask.h \
+    tileloadqueue.h \
     copyrightstrings.h \
     pureprojection.h \
     pointlatlng.h \
@@ -20,6 +21,7 @@ SOURCES += core.cpp \
     sizelatlng.cpp \
     pointlatlng.cpp \
     loadtask.cpp \
+    tileloadqueue.cpp \
     mousewheelzoomtype.cpp
 HEADERS += ./projections/lks94projection.h \
     ./projections/mercatorprojection.h \
@@ -32,4 +32,10 @@ bool operator==(LoadTask const & lhs, LoadTask const & rhs)
 {
     return (lhs.Pos == rhs.Pos) && (lhs.Zoom == rhs.Zoom);
 }
+uint qHash(LoadTask const & task)
+{
+    return (int)((quint32)task.Pos.X() ^
+                 (((quint32)task.Pos.Y() << 13) | ((quint32)task.Pos.Y() >> 19)) ^
+                 ((quint32)task.Zoom << 26));
+}
 }
@@ -33,6 +33,7 @@
 using namespace core;
 namespace internals {
 struct LoadTask {
+    friend uint qHash(LoadTask const & task);
     friend bool operator==(LoadTask const & lhs, LoadTask const & rhs);
 public:
     core::Point Pos;
@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tileloadqueue.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "tileloadqueue.h"
+
+#include <algorithm>
+
+namespace internals {
+TileLoadQueue::TileLoadQueue() : zoom(-1), center(0, 0)
+{}
+
+/**
+ * @brief Queue a task, unless it is queued or loading already
+ *
+ * @return true if the task was queued
+ */
+bool TileLoadQueue::Enqueue(LoadTask const & task)
+{
+    if (queued.contains(task) || loading.contains(task)) {
+        return false;
+    }
+    queued.insert(task);
+
+    Entry entry;
+    entry.priority = Priority(task);
+    entry.task     = task;
+    heap.append(entry);
+    std::push_heap(heap.begin(), heap.end(), Later);
+    return true;
+}
+
+/**
+ * @brief Take the task nearest to the center of the view, it is loading until Finished() is called
+ *
+ * @return the task, or an empty task if there is none
+ */
+LoadTask TileLoadQueue::Dequeue()
+{
+    if (heap.isEmpty()) {
+        return LoadTask();
+    }
+    std::pop_heap(heap.begin(), heap.end(), Later);
+    LoadTask task = heap.last().task;
+    heap.removeLast();
+
+    queued.remove(task);
+    loading.insert(task);
+    return task;
+}
+
+/**
+ * @brief  Check if a loading task was cancelled and its result should be dropped
+ */
+bool TileLoadQueue::IsCancelled(LoadTask const & task) const
+{
+    return !loading.contains(task);
+}
+
+/**
+ * @brief Done loading a task
+ *
+ * @return false if the task was cancelled while loading
+ */
+bool TileLoadQueue::Finished(LoadTask const & task)
+{
+    return loading.remove(task);
+}
+
+/**
+ * @brief Cancel all tasks that are not for one of the tiles at zoom and give the others
+ *        a new priority by their distance to center
+ *
+ * @return the number of queued tasks that were cancelled
+ */
+int TileLoadQueue::Retain(int zoom, core::Point const & center, QList<core::Point> const & tiles)
+{
+    this->zoom   = zoom;
+    this->center = center;
+
+    QSet<LoadTask> wanted;
+    wanted.reserve(tiles.count());
+    foreach(core::Point p, tiles) {
+        wanted.insert(LoadTask(p, zoom));
+    }
+
+    foreach(LoadTask task, loading) {
+        if (!wanted.contains(task)) {
+            loading.remove(task);
+        }
+    }
+
+    int cancelled = 0;
+    QVector<Entry> retained;
+    retained.reserve(heap.count());
+    foreach(Entry entry, heap) {
+        if (wanted.contains(entry.task)) {
+            entry.priority = Priority(entry.task);
+            retained.append(entry);
+        } else {
+            queued.remove(entry.task);
+            ++cancelled;
+        }
+    }
+    heap = retained;
+    std::make_heap(heap.begin(), heap.end(), Later);
+    return cancelled;
+}
+
+/**
+ * @brief Cancel all tasks
+ *
+ * @return the number of queued tasks that were cancelled
+ */
+int TileLoadQueue::Clear()
+{
+    int cancelled = heap.count();
+
+    heap.clear();
+    queued.clear();
+    loading.clear();
+    return cancelled;
+}
+
+/**
+ * Tiles at the current zoom before any other, then by the squared distance
+ * of the tile to the center.
+ */
+quint64 TileLoadQueue::Priority(LoadTask const & task) const
+{
+    qint64 dx = task.Pos.X() - center.X();
+    qint64 dy = task.Pos.Y() - center.Y();
+    quint64 priority = (quint64)(dx * dx + dy * dy);
+
+    if (task.Zoom != zoom) {
+        priority |= Q_UINT64_C(1) << 63;
+    }
+    return priority;
+}
+}
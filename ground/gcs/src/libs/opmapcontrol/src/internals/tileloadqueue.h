@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tileloadqueue.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef TILELOADQUEUE_H
+#define TILELOADQUEUE_H
+
+#include <QList>
+#include <QSet>
+#include <QVector>
+#include "loadtask.h"
+#include "../core/point.h"
+
+namespace internals {
+/**
+ * Tiles waiting to be loaded, nearest to the center of the view first.
+ *
+ * A task is queued until Dequeue() hands it to a loader, and loading until
+ * the loader calls Finished(). Tasks that are no longer in view are cancelled
+ * one by one with Retain(), whether they are still queued or already loading,
+ * so a loader can tell that its result is not wanted anymore.
+ *
+ * Not thread safe, Core guards it with MtileLoadQueue.
+ */
+class TileLoadQueue {
+public:
+    TileLoadQueue();
+
+    bool Enqueue(LoadTask const & task);
+    LoadTask Dequeue();
+    bool IsCancelled(LoadTask const & task) const;
+    bool Finished(LoadTask const & task);
+
+    int Retain(int zoom, core::Point const & center, QList<core::Point> const & tiles);
+    int Clear();
+
+    int count() const
+    {
+        return heap.count();
+    }
+
+private:
+    struct Entry {
+        quint64  priority;
+        LoadTask task;
+    };
+    static bool Later(Entry const & lhs, Entry const & rhs)
+    {
+        return lhs.priority > rhs.priority;
+    }
+    quint64 Priority(LoadTask const & task) const;
+
+    int zoom;
+    core::Point center;
+    QVector<Entry> heap; // binary heap, lowest priority value on top
+    QSet<LoadTask> queued;
+    QSet<LoadTask> loading;
+};
+}
+#endif // TILELOADQUEUE_H
@@ -294,6 +294,45 @@ void MapGraphicItem::wheelEvent(QGraphicsSceneWheelEvent *event)
         core->MouseWheelZooming = false;
     }
 }
+/**
+ * @brief Get a tile decoded for drawing, with all its layers composed. Tiles
+ *        that were decoded before are drawn even while the tile is not loaded,
+ *        after the map was panned or zoomed back to them.
+ *
+ * @param pos position of the tile at the current zoom
+ * @param t the loaded tile, may be 0
+ * @return the decoded tile, or 0 if there is nothing to draw yet
+ */
+QPixmap *MapGraphicItem::DecodedTile(core::Point const & pos, internals::Tile *t)
+{
+    internals::LoadTask key(pos, core->Zoom());
+    QPixmap *pixmap = core->decodedTiles.object(key);
+
+    if (pixmap != 0 || t == 0) {
+        return pixmap;
+    }
+
+    foreach(QByteArray img, t->Overlays) {
+        if (img.count() != 0) {
+            if (pixmap == 0) {
+                pixmap = new QPixmap(PureImageProxy::FromStream(img));
+            } else {
+                QPainter layer(pixmap);
+                layer.drawPixmap(pixmap->rect(), PureImageProxy::FromStream(img));
+            }
+        }
+    }
+    if (pixmap == 0) {
+        return 0;
+    }
+
+    // the cache takes ownership, and deletes the tile right away if it is larger than the whole cache
+    int cost = pixmap->width() * pixmap->height() * pixmap->depth() / 8;
+    if (!core->decodedTiles.insert(key, pixmap, cost)) {
+        return 0;
+    }
+    return pixmap;
+}
 void MapGraphicItem::DrawMap2D(QPainter *painter)
 {
     // painter->drawImage(this->boundingRect(), dragons.toImage());
@@ -316,17 +355,10 @@ void MapGraphicItem::DrawMap2D(QPainter *painter)
 
                         // render tile
                         // lock(t.Overlays)
-                        if (t != 0) {
-                            foreach(QByteArray img, t->Overlays) {
-                                if (img.count() != 0) {
-                                    if (!found) {
-                                        found = true;
-                                    }
-                                    {
-                                        painter->drawPixmap(core->tileRect.X(), core->tileRect.Y(), core->tileRect.Width(), core->tileRect.Height(), PureImageProxy::FromStream(img));
-                                    }
-                                }
-                            }
+                        QPixmap *pixmap = DecodedTile(core->GettilePoint(), t);
+                        if (pixmap != 0) {
+                            found = true;
+                            painter->drawPixmap(core->tileRect.X(), core->tileRect.Y(), core->tileRect.Width(), core->tileRect.Height(), *pixmap);
                         }
 
                         if (showTileGridLines) {
@@ -144,6 +144,7 @@ private:
     bool showTileGridLines;
     qreal MapRenderTransform;
     void DrawMap2D(QPainter *painter);
+    QPixmap *DecodedTile(core::Point const & pos, internals::Tile *t);
     /**
      * @brief Maximum possible zoom
      *
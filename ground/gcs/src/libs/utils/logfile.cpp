@@ -1,11 +1,28 @@
 #include "logfile.h"
 #include <QDebug>
 #include <QtGlobal>
+#include <QDataStream>
+#include <QFileInfo>
+#include <QDateTime>
+
+// Size of the time stamp and packet size preceding each packet in the log
+#define ENTRY_HEADER_SIZE  (sizeof(quint32) + sizeof(qint64))
+
+// Index cache file format
+#define INDEX_FILE_SUFFIX  ".idx"
+#define INDEX_FILE_MAGIC   0x4F504C49 // "OPLI"
+#define INDEX_FILE_VERSION 1
+
+// Number of packets replayed per timer tick when replaying as fast as possible
+#define FASTEST_REPLAY_BATCH 1000
 
 LogFile::LogFile(QObject *parent) :
     QIODevice(parent),
-    m_lastTimeStamp(0),
-    m_lastPlayed(0),
+    m_logData(NULL),
+    m_logSize(0),
+    m_replayIndex(0),
+    m_replayTime(0),
+    m_fastestReplay(false),
     m_timeOffset(0),
     m_playbackSpeed(1.0),
     m_nextTimeStamp(0),
@@ -54,6 +71,13 @@ void LogFile::close()
     if (m_timer.isActive()) {
         m_timer.stop();
     }
+    if (m_logData && m_logDataCopy.isEmpty()) {
+        m_file.unmap((uchar *)m_logData);
+    }
+    m_logData = NULL;
+    m_logSize = 0;
+    m_logDataCopy.clear();
+    m_index.clear();
     m_file.close();
     QIODevice::close();
 }
@@ -94,72 +118,191 @@ qint64 LogFile::bytesAvailable() const
     return m_dataBuffer.size();
 }
 
-void LogFile::timerFired()
+/**
+ * Map the whole log file into memory. Falls back to reading it if the
+ * file can not be mapped.
+ */
+bool LogFile::mapLogFile()
 {
-    qint64 dataSize;
-
-    if (m_file.bytesAvailable() > 4) {
-        int time;
-        time = m_myTime.elapsed();
+    m_logDataCopy.clear();
+    m_logSize = m_file.size();
+    m_logData = m_file.map(0, m_logSize);
+    if (m_logData == NULL) {
+        m_file.seek(0);
+        m_logDataCopy = m_file.readAll();
+        m_logData     = (const uchar *)m_logDataCopy.constData();
+        m_logSize     = m_logDataCopy.size();
+    }
+    return m_logData != NULL;
+}
 
-        // TODO: going back in time will be a problem
-        while ((m_lastPlayed + ((time - m_timeOffset) * m_playbackSpeed) > m_lastTimeStamp)) {
-            m_lastPlayed += ((time - m_timeOffset) * m_playbackSpeed);
-            if (m_file.bytesAvailable() < (qint64)sizeof(dataSize)) {
-                stopReplay();
-                return;
-            }
+/**
+ * Load the packet index cached beside the log file by an earlier replay.
+ * The cache is only used if it was built from a file of the same size and
+ * modification time, and if every packet it points to lies within the mapped
+ * file, after the previous one.
+ */
+bool LogFile::loadIndex(const QString &indexFileName)
+{
+    QFile indexFile(indexFileName);
 
-            m_file.read((char *)&dataSize, sizeof(dataSize));
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
 
-            if (dataSize < 1 || dataSize > (1024 * 1024)) {
-                qDebug() << "Error: Logfile corrupted! Unlikely packet size: " << dataSize << "\n";
-                stopReplay();
-                return;
-            }
+    QDataStream stream(&indexFile);
+    quint32 magic, version, count;
+    qint64 fileSize, modified;
+    stream >> magic >> version >> fileSize >> modified >> count;
 
-            if (m_file.bytesAvailable() < dataSize) {
-                stopReplay();
-                return;
-            }
+    QFileInfo info(m_file);
+    if (stream.status() != QDataStream::Ok || magic != INDEX_FILE_MAGIC || version != INDEX_FILE_VERSION
+        || fileSize != info.size() || modified != info.lastModified().toMSecsSinceEpoch()
+        || count > (quint32)(fileSize / ENTRY_HEADER_SIZE)) {
+        return false;
+    }
 
-            m_mutex.lock();
-            m_dataBuffer.append(m_file.read(dataSize));
-            m_mutex.unlock();
+    m_index.resize(count);
+    qint64 end = 0;
+    for (quint32 i = 0; i < count; i++) {
+        LogEntry &entry = m_index[i];
+        stream >> entry.timeStamp >> entry.offset >> entry.size;
+        if (stream.status() != QDataStream::Ok || entry.offset < end + (qint64)ENTRY_HEADER_SIZE
+            || entry.size < 1 || entry.size > m_logSize - entry.offset) {
+            qDebug() << "Ignoring invalid log index" << indexFileName;
+            m_index.clear();
+            return false;
+        }
+        end = entry.offset + entry.size;
+    }
+    return true;
+}
 
-            emit readyRead();
+/**
+ * Build the packet index in one pass over the mapped file.
+ * Indexing stops at the first entry that looks corrupted, the packets before
+ * it can still be replayed.
+ */
+void LogFile::buildIndex()
+{
+    qint64 fileSize = m_logSize;
+    qint64 pos = 0;
 
-            if (m_file.bytesAvailable() < (qint64)sizeof(m_lastTimeStamp)) {
-                stopReplay();
-                return;
-            }
+    m_index.clear();
+    while (pos + (qint64)ENTRY_HEADER_SIZE <= fileSize) {
+        LogEntry entry;
+        memcpy(&entry.timeStamp, m_logData + pos, sizeof(entry.timeStamp));
+        memcpy(&entry.size, m_logData + pos + sizeof(entry.timeStamp), sizeof(entry.size));
+        entry.offset = pos + ENTRY_HEADER_SIZE;
 
-            int save = m_lastTimeStamp;
-            m_file.read((char *)&m_lastTimeStamp, sizeof(m_lastTimeStamp));
+        if (entry.size < 1 || entry.size > (1024 * 1024)) {
+            qDebug() << "Error: Logfile corrupted! Unlikely packet size: " << entry.size << "\n";
+            break;
+        }
+        if (entry.offset + entry.size > fileSize) {
+            break;
+        }
+        if (!m_index.isEmpty()) {
+            quint32 previous = m_index.last().timeStamp;
             // some validity checks
-            if (m_lastTimeStamp < save // logfile goes back in time
-                || (m_lastTimeStamp - save) > (60 * 60 * 1000)) { // gap of more than 60 minutes)
-                qDebug() << "Error: Logfile corrupted! Unlikely timestamp " << m_lastTimeStamp << " after " << save << "\n";
-                stopReplay();
-                return;
+            if (entry.timeStamp < previous // logfile goes back in time
+                || (entry.timeStamp - previous) > (60 * 60 * 1000)) { // gap of more than 60 minutes)
+                qDebug() << "Error: Logfile corrupted! Unlikely timestamp " << entry.timeStamp << " after " << previous << "\n";
+                break;
             }
-
-            m_timeOffset = time;
-            time = m_myTime.elapsed();
         }
-    } else {
+        m_index.append(entry);
+        pos = entry.offset + entry.size;
+    }
+}
+
+/**
+ * Cache the packet index beside the log file, failures are not fatal.
+ */
+void LogFile::saveIndex(const QString &indexFileName)
+{
+    QFile indexFile(indexFileName);
+
+    if (!indexFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return;
+    }
+
+    QFileInfo info(m_file);
+    QDataStream stream(&indexFile);
+    stream << (quint32)INDEX_FILE_MAGIC << (quint32)INDEX_FILE_VERSION << (qint64)info.size()
+           << (qint64)info.lastModified().toMSecsSinceEpoch() << (quint32)m_index.size();
+    foreach(const LogEntry &entry, m_index) {
+        stream << entry.timeStamp << entry.offset << entry.size;
+    }
+}
+
+/**
+ * Hand the next packets over to the reader
+ */
+void LogFile::replayEntries(int count)
+{
+    count = qMin(count, m_index.size() - m_replayIndex);
+    if (count <= 0) {
+        return;
+    }
+
+    m_mutex.lock();
+    for (int i = 0; i < count; i++) {
+        const LogEntry &entry = m_index.at(m_replayIndex++);
+        m_dataBuffer.append((const char *)m_logData + entry.offset, entry.size);
+    }
+    m_mutex.unlock();
+
+    emit readyRead();
+}
+
+void LogFile::timerFired()
+{
+    if (m_replayIndex >= m_index.size()) {
         stopReplay();
+        return;
+    }
+
+    if (m_fastestReplay) {
+        replayEntries(FASTEST_REPLAY_BATCH);
+        if (m_replayIndex > 0) {
+            m_replayTime = m_index.at(m_replayIndex - 1).timeStamp;
+        }
+        return;
     }
+
+    int time = m_myTime.elapsed();
+    m_replayTime += (time - m_timeOffset) * m_playbackSpeed;
+    m_timeOffset  = time;
+
+    // Replay everything that is due
+    int count = 0;
+    while (m_replayIndex + count < m_index.size() && m_index.at(m_replayIndex + count).timeStamp <= m_replayTime) {
+        count++;
+    }
+    replayEntries(count);
 }
 
 bool LogFile::startReplay()
 {
     m_dataBuffer.clear();
     m_myTime.restart();
-    m_timeOffset = 0;
-    m_lastPlayed = 0;
-    m_file.read((char *)&m_lastTimeStamp, sizeof(m_lastTimeStamp));
-    m_timer.setInterval(10);
+    m_timeOffset  = 0;
+    m_replayIndex = 0;
+
+    if (!mapLogFile()) {
+        qDebug() << "Error: Unable to read logfile" << m_file.fileName();
+        return false;
+    }
+
+    QString indexFileName = m_file.fileName() + INDEX_FILE_SUFFIX;
+    if (!loadIndex(indexFileName)) {
+        buildIndex();
+        saveIndex(indexFileName);
+    }
+
+    m_replayTime = replayStartTime();
+    m_timer.setInterval(m_fastestReplay ? 0 : 10);
     m_timer.start();
     emit replayStarted();
     return true;
@@ -182,3 +325,72 @@ void LogFile::resumeReplay()
     m_timeOffset = m_myTime.elapsed();
     m_timer.start();
 }
+
+quint32 LogFile::replayStartTime() const
+{
+    return m_index.isEmpty() ? 0 : m_index.first().timeStamp;
+}
+
+quint32 LogFile::replayEndTime() const
+{
+    return m_index.isEmpty() ? 0 : m_index.last().timeStamp;
+}
+
+quint32 LogFile::replayPosition() const
+{
+    return m_replayTime;
+}
+
+/**
+ * Continue the replay from the first packet logged at or after the given time
+ */
+void LogFile::seekToTime(quint32 timeStamp)
+{
+    int low  = 0;
+    int high = m_index.size();
+
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (m_index.at(mid).timeStamp < timeStamp) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    m_replayIndex = low;
+    m_replayTime  = timeStamp;
+    m_timeOffset  = m_myTime.elapsed();
+}
+
+/**
+ * Replay the next packet only, meant to be used while paused
+ */
+void LogFile::stepForward()
+{
+    if (m_replayIndex < m_index.size()) {
+        m_replayTime = m_index.at(m_replayIndex).timeStamp;
+        replayEntries(1);
+    }
+}
+
+/**
+ * Replay the packet before the last replayed one, meant to be used while paused
+ */
+void LogFile::stepBackward()
+{
+    if (m_replayIndex >= 2) {
+        m_replayIndex -= 2;
+        m_replayTime   = m_index.at(m_replayIndex).timeStamp;
+        replayEntries(1);
+    }
+}
+
+/**
+ * Replay the log as fast as the reader can take it, ignoring the time stamps
+ */
+void LogFile::setFastestReplay(bool fastest)
+{
+    m_fastestReplay = fastest;
+    m_timer.setInterval(m_fastestReplay ? 0 : 10);
+    m_timeOffset    = m_myTime.elapsed();
+}
@@ -8,6 +8,7 @@
 #include <QDebug>
 #include <QBuffer>
 #include <QFile>
+#include <QVector>
 #include "utils_global.h"
 
 class QTCREATOR_UTILS_EXPORT LogFile : public QIODevice {
@@ -30,6 +31,11 @@ public:
 
     bool startReplay();
     bool stopReplay();
+
+    // Log time range and current replay position, in ms
+    quint32 replayStartTime() const;
+    quint32 replayEndTime() const;
+    quint32 replayPosition() const;
     void useProvidedTimeStamp(bool useProvidedTimeStamp)
     {
         m_useProvidedTimeStamp = useProvidedTimeStamp;
@@ -48,6 +54,10 @@ public slots:
     };
     void pauseReplay();
     void resumeReplay();
+    void seekToTime(quint32 timeStamp);
+    void stepForward();
+    void stepBackward();
+    void setFastestReplay(bool fastest);
 
 protected slots:
     void timerFired();
@@ -58,14 +68,27 @@ signals:
     void replayFinished();
 
 protected:
+    // One logged packet: its time stamp and where its data is in the file
+    struct LogEntry {
+        quint32 timeStamp;
+        qint64  offset;
+        qint64  size;
+    };
+
     QByteArray m_dataBuffer;
     QTimer m_timer;
     QTime m_myTime;
     QFile m_file;
-    qint32 m_lastTimeStamp;
-    qint32 m_lastPlayed;
     QMutex m_mutex;
 
+    // Replay state, the file is mapped and indexed once when the replay starts
+    const uchar *m_logData;
+    qint64 m_logSize;
+    QByteArray m_logDataCopy;
+    QVector<LogEntry> m_index;
+    int m_replayIndex;
+    double m_replayTime;
+    bool m_fastestReplay;
 
     int m_timeOffset;
     double m_playbackSpeed;
@@ -73,6 +96,12 @@ protected:
 private:
     quint32 m_nextTimeStamp;
     bool m_useProvidedTimeStamp;
+
+    bool mapLogFile();
+    bool loadIndex(const QString &indexFileName);
+    void buildIndex();
+    void saveIndex(const QString &indexFileName);
+    void replayEntries(int count);
 };
 
 #endif // LOGFILE_H
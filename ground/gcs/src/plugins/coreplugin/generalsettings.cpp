@@ -48,7 +48,7 @@ GeneralSettings::GeneralSettings() :
     m_saveSettingsOnExit(true),
     m_autoConnect(true),
     m_autoSelect(true),
-    m_useUDPMirror(false),
+    m_shareTelemetry(false),
     m_useExpertMode(false),
     m_collectUsageData(true),
     m_showUsageDataDisclaimer(true),
@@ -126,7 +126,7 @@ QWidget *GeneralSettings::createPage(QWidget *parent)
     m_page->checkBoxSaveOnExit->setChecked(m_saveSettingsOnExit);
     m_page->checkAutoConnect->setChecked(m_autoConnect);
     m_page->checkAutoSelect->setChecked(m_autoSelect);
-    m_page->cbUseUDPMirror->setChecked(m_useUDPMirror);
+    m_page->cbShareTelemetry->setChecked(m_shareTelemetry);
     m_page->cbExpertMode->setChecked(m_useExpertMode);
     m_page->cbUsageData->setChecked(m_collectUsageData);
     m_page->colorButton->setColor(StyleHelper::baseColor());
@@ -145,10 +145,10 @@ void GeneralSettings::apply()
     StyleHelper::setBaseColor(m_page->colorButton->color());
 
     m_saveSettingsOnExit = m_page->checkBoxSaveOnExit->isChecked();
-    m_useUDPMirror  = m_page->cbUseUDPMirror->isChecked();
-    m_useExpertMode = m_page->cbExpertMode->isChecked();
-    m_autoConnect   = m_page->checkAutoConnect->isChecked();
-    m_autoSelect    = m_page->checkAutoSelect->isChecked();
+    m_shareTelemetry = m_page->cbShareTelemetry->isChecked();
+    m_useExpertMode  = m_page->cbExpertMode->isChecked();
+    m_autoConnect    = m_page->checkAutoConnect->isChecked();
+    m_autoSelect     = m_page->checkAutoSelect->isChecked();
     setCollectUsageData(m_page->cbUsageData->isChecked());
 }
 
@@ -164,7 +164,7 @@ void GeneralSettings::readSettings(QSettings *qs)
     m_saveSettingsOnExit = qs->value(QLatin1String("SaveSettingsOnExit"), m_saveSettingsOnExit).toBool();
     m_autoConnect        = qs->value(QLatin1String("AutoConnect"), m_autoConnect).toBool();
     m_autoSelect         = qs->value(QLatin1String("AutoSelect"), m_autoSelect).toBool();
-    m_useUDPMirror       = qs->value(QLatin1String("UDPMirror"), m_useUDPMirror).toBool();
+    m_shareTelemetry     = qs->value(QLatin1String("ShareTelemetry"), m_shareTelemetry).toBool();
     m_useExpertMode      = qs->value(QLatin1String("ExpertMode"), m_useExpertMode).toBool();
     m_collectUsageData   = qs->value(QLatin1String("CollectUsageData"), m_collectUsageData).toBool();
     m_showUsageDataDisclaimer = qs->value(QLatin1String("ShowUsageDataDisclaimer"), m_showUsageDataDisclaimer).toBool();
@@ -185,7 +185,7 @@ void GeneralSettings::saveSettings(QSettings *qs)
     qs->setValue(QLatin1String("SaveSettingsOnExit"), m_saveSettingsOnExit);
     qs->setValue(QLatin1String("AutoConnect"), m_autoConnect);
     qs->setValue(QLatin1String("AutoSelect"), m_autoSelect);
-    qs->setValue(QLatin1String("UDPMirror"), m_useUDPMirror);
+    qs->setValue(QLatin1String("ShareTelemetry"), m_shareTelemetry);
     qs->setValue(QLatin1String("ExpertMode"), m_useExpertMode);
     qs->setValue(QLatin1String("CollectUsageData"), m_collectUsageData);
     qs->setValue(QLatin1String("ShowUsageDataDisclaimer"), m_showUsageDataDisclaimer);
@@ -255,9 +255,9 @@ bool GeneralSettings::autoSelect() const
     return m_autoSelect;
 }
 
-bool GeneralSettings::useUDPMirror() const
+bool GeneralSettings::shareTelemetry() const
 {
-    return m_useUDPMirror;
+    return m_shareTelemetry;
 }
 
 bool GeneralSettings::collectUsageData() const
@@ -57,7 +57,7 @@ public:
     bool saveSettingsOnExit() const;
     bool autoConnect() const;
     bool autoSelect() const;
-    bool useUDPMirror() const;
+    bool shareTelemetry() const;
     bool collectUsageData() const;
     bool showUsageDataDisclaimer() const;
     QString lastUsageHash() const;
@@ -83,7 +83,7 @@ private:
     bool m_saveSettingsOnExit;
     bool m_autoConnect;
     bool m_autoSelect;
-    bool m_useUDPMirror;
+    bool m_shareTelemetry;
     bool m_useExpertMode;
     bool m_collectUsageData;
     bool m_showUsageDataDisclaimer;
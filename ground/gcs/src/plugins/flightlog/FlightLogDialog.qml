@@ -105,6 +105,10 @@ Rectangle {
                             id: totalEntries
                             text: "<b>" + qsTr("Entries downloaded:") + "</b> " + logManager.logEntriesCount
                         }
+                        Text {
+                            id: downloadStatus
+                            text: "<b>" + qsTr("Download status:") + "</b> " + logManager.downloadStatus
+                        }
                         Rectangle {
                             Layout.fillHeight: true
                         }
@@ -147,6 +151,12 @@ Rectangle {
                                 activeFocusOnPress: true
                                 onClicked: logManager.retrieveLogs(flightCombo.currentIndex - 1)
                             }
+                            Button {
+                                text: qsTr("Download to file...")
+                                enabled: !logManager.disableControls && logManager.boardConnected
+                                activeFocusOnPress: true
+                                onClicked: logManager.retrieveLogsToFile(flightCombo.currentIndex - 1)
+                            }
                         }
                         Rectangle {
                             Layout.fillHeight: true
@@ -11,11 +11,19 @@ include(../../plugins/uavtalk/uavtalk.pri)
 
 HEADERS += \
     flightlogplugin.h \
-    flightlogmanager.h
+    flightlogmanager.h \
+    flightlogdownload.h \
+    flightlogstreamwriter.h \
+    flightlogdecoder.h \
+    flightlogexport.h
 
 SOURCES += \
     flightlogplugin.cpp \
-    flightlogmanager.cpp
+    flightlogmanager.cpp \
+    flightlogdownload.cpp \
+    flightlogstreamwriter.cpp \
+    flightlogdecoder.cpp \
+    flightlogexport.cpp
 
 OTHER_FILES += \
     Flightlog.pluginspec \
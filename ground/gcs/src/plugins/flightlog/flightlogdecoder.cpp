@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogdecoder.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Decodes flight log records into UAVObjects.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogdecoder.h"
+
+FlightLogDecoder::FlightLogDecoder(UAVObjectManager *objectManager) :
+    m_objectManager(objectManager)
+{}
+
+FlightLogDecoder::~FlightLogDecoder()
+{
+    qDeleteAll(m_objects);
+}
+
+UAVDataObject *FlightLogDecoder::decode(const DebugLogEntry::DataFields &record)
+{
+    if (record.Type != DebugLogEntry::TYPE_UAVOBJECT && record.Type != DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
+        return 0;
+    }
+
+    QPair<quint32, quint16> key(record.ObjectID, record.InstanceID);
+    UAVDataObject *object = m_objects.value(key);
+
+    if (!object) {
+        UAVDataObject *reference = dynamic_cast<UAVDataObject *>(m_objectManager->getObject(record.ObjectID));
+        if (!reference) {
+            return 0;
+        }
+        object = reference->clone(record.InstanceID);
+        m_objects.insert(key, object);
+    }
+    object->unpack(record.Data);
+    return object;
+}
@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogdecoder.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Decodes flight log records into UAVObjects.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGDECODER_H
+#define FLIGHTLOGDECODER_H
+
+#include <QHash>
+#include <QPair>
+
+#include "uavobjectmanager.h"
+#include "uavdataobject.h"
+#include "debuglogentry.h"
+
+/**
+ * Unpacks log records into one shared object per object type and instance,
+ * so decoding a log does not create a UAVObject per record. The returned
+ * object is only valid until the next record of the same type is decoded,
+ * and a decoder must only be used from one thread.
+ */
+class FlightLogDecoder {
+public:
+    explicit FlightLogDecoder(UAVObjectManager *objectManager);
+    ~FlightLogDecoder();
+
+    UAVDataObject *decode(const DebugLogEntry::DataFields &record);
+
+private:
+    UAVObjectManager *m_objectManager;
+    QHash<QPair<quint32, quint16>, UAVDataObject *> m_objects;
+};
+
+#endif // FLIGHTLOGDECODER_H
@@ -0,0 +1,255 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogdownload.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Windowed, resumable download of the onboard flight log.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogdownload.h"
+
+#include <QDebug>
+
+FlightLogDownload::FlightLogDownload(UAVObjectManager *objectManager, TelemetryManager *telemetryManager, QObject *parent) :
+    QObject(parent), m_objectManager(objectManager), m_telemetryManager(telemetryManager),
+    m_running(false), m_paused(false), m_flight(0), m_endFlight(0), m_windowStart(0),
+    m_delivered(0), m_retries(0), m_received(WINDOW_SIZE), m_window(WINDOW_SIZE),
+    m_entriesReceived(0), m_bytesReceived(0)
+{
+    m_control = DebugLogControl::GetInstance(m_objectManager);
+    Q_ASSERT(m_control);
+
+    // The flight side answers a request with entries in instances 0..WINDOW_SIZE-1.
+    // Create them up front so that all of them are connected below, UAVTalk would
+    // otherwise create the missing ones on the fly when they are first received.
+    if (m_objectManager->getNumInstances(DebugLogEntry::OBJID) < WINDOW_SIZE) {
+        DebugLogEntry *entry = new DebugLogEntry;
+        entry->initialize(WINDOW_SIZE - 1, entry->getMetaObject());
+        if (!m_objectManager->registerObject(entry)) {
+            delete entry;
+        }
+    }
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+        DebugLogEntry *entry = DebugLogEntry::GetInstance(m_objectManager, i);
+        Q_ASSERT(entry);
+        connect(entry, SIGNAL(objectUnpacked(UAVObject *)), this, SLOT(entryUnpacked(UAVObject *)));
+    }
+
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(REQUEST_TIMEOUT);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(requestTimeout()));
+
+    connect(m_telemetryManager, SIGNAL(connected()), this, SLOT(connectionStatusChanged()));
+    connect(m_telemetryManager, SIGNAL(disconnected()), this, SLOT(connectionStatusChanged()));
+}
+
+FlightLogDownload::~FlightLogDownload()
+{}
+
+void FlightLogDownload::start(int startFlight, int endFlight)
+{
+    m_flight          = startFlight;
+    m_endFlight       = endFlight;
+    m_windowStart     = 0;
+    m_entriesReceived = 0;
+    m_bytesReceived   = 0;
+    m_running         = true;
+    m_paused          = !m_telemetryManager->isConnected();
+    m_elapsed.start();
+
+    if (!m_paused) {
+        requestWindow();
+    }
+}
+
+void FlightLogDownload::cancel()
+{
+    if (m_running) {
+        finish(false);
+    }
+}
+
+double FlightLogDownload::kBytesPerSecond() const
+{
+    qint64 elapsed = m_elapsed.isValid() ? m_elapsed.elapsed() : 0;
+
+    if (elapsed <= 0) {
+        return 0.0;
+    }
+    return (double)m_bytesReceived / elapsed * 1000.0 / 1024.0;
+}
+
+void FlightLogDownload::requestWindow()
+{
+    m_delivered = 0;
+    m_received.fill(false);
+
+    m_control->setOperation(DebugLogControl::OPERATION_RETRIEVE);
+    m_control->setFlight(m_flight);
+    m_control->setEntry(m_windowStart);
+    m_control->setCount(WINDOW_SIZE);
+    m_control->updated();
+
+    m_timer.start();
+}
+
+void FlightLogDownload::entryUnpacked(UAVObject *obj)
+{
+    if (!m_running || m_paused) {
+        return;
+    }
+
+    DebugLogEntry *entry = static_cast<DebugLogEntry *>(obj);
+    int index = entry->getInstID();
+    DebugLogEntry::DataFields data = entry->getData();
+
+    // Drop late answers to an earlier request
+    if (index >= WINDOW_SIZE || m_received[index] ||
+        data.Flight != m_flight || data.Entry != (quint16)(m_windowStart + index)) {
+        return;
+    }
+
+    m_received[index] = true;
+    m_window[index]   = data;
+    m_bytesReceived  += entry->getNumBytes();
+
+    deliverWindow();
+}
+
+void FlightLogDownload::deliverWindow()
+{
+    int delivered = m_delivered;
+
+    while (m_running && m_delivered < WINDOW_SIZE && m_received[m_delivered]) {
+        const DebugLogEntry::DataFields &data = m_window[m_delivered];
+
+        if (data.Type == DebugLogEntry::TYPE_EMPTY) {
+            // No more entries in this flight
+            if (m_flight < m_endFlight) {
+                m_flight++;
+                m_windowStart = 0;
+                m_retries     = 0;
+                emit progress(m_entriesReceived, kBytesPerSecond());
+                requestWindow();
+            } else {
+                finish(true);
+            }
+            return;
+        }
+
+        m_delivered++;
+        m_entriesReceived++;
+        emit entryReceived(data);
+    }
+
+    if (!m_running) {
+        return;
+    }
+
+    if (m_delivered > delivered) {
+        m_retries = 0;
+        m_timer.start();
+    }
+
+    if (m_delivered == WINDOW_SIZE) {
+        m_windowStart += WINDOW_SIZE;
+        emit progress(m_entriesReceived, kBytesPerSecond());
+        requestWindow();
+    }
+}
+
+void FlightLogDownload::requestTimeout()
+{
+    if (!m_running || m_paused) {
+        return;
+    }
+
+    if (++m_retries > MAX_RETRIES) {
+        qDebug() << "FlightLogDownload: no answer for flight" << m_flight << "entry" << m_windowStart + m_delivered;
+        finish(false);
+        return;
+    }
+
+    // Ask again from the first entry that has not been delivered
+    m_windowStart += m_delivered;
+    requestWindow();
+}
+
+void FlightLogDownload::connectionStatusChanged()
+{
+    if (!m_running) {
+        return;
+    }
+
+    if (m_telemetryManager->isConnected()) {
+        if (m_paused) {
+            m_paused       = false;
+            m_retries      = 0;
+            m_windowStart += m_delivered;
+            requestWindow();
+        }
+    } else {
+        m_paused = true;
+        m_timer.stop();
+    }
+}
+
+void FlightLogDownload::finish(bool success)
+{
+    m_running = false;
+    m_paused  = false;
+    m_timer.stop();
+
+    emit progress(m_entriesReceived, kBytesPerSecond());
+    emit finished(success);
+}
+
+QList<DebugLogEntry::DataFields> FlightLogDownload::splitEntry(const DebugLogEntry::DataFields &entry)
+{
+    QList<DebugLogEntry::DataFields> records;
+
+    records << entry;
+    if (entry.Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
+        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
+        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
+        const quint32 header_len = total_len - data_len;
+
+        DebugLogEntry::DataFields fields;
+        quint32 start = entry.Size;
+
+        // cycle until there is space for another object
+        while (start + header_len + 1 < data_len) {
+            memset(&fields, 0xFF, total_len);
+            memcpy(&fields, &entry.Data[start], header_len);
+            // check wether a packed object is found
+            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
+            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
+            quint32 toread = header_len + fields.Size;
+            if (!(toread + start > data_len)) {
+                memcpy(&fields, &entry.Data[start], toread);
+                records << fields;
+            }
+            start += toread;
+        }
+    }
+    return records;
+}
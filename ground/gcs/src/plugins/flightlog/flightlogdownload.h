@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogdownload.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Windowed, resumable download of the onboard flight log.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGDOWNLOAD_H
+#define FLIGHTLOGDOWNLOAD_H
+
+#include <QObject>
+#include <QList>
+#include <QVector>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "uavobjectmanager.h"
+#include "debuglogentry.h"
+#include "debuglogcontrol.h"
+#include "uavtalk/telemetrymanager.h"
+
+/**
+ * Downloads log entries from the flight side without blocking the UI.
+ *
+ * Each request asks the flight side for a window of consecutive entries
+ * (DebugLogControl Count), which it returns in DebugLogEntry instances
+ * 0..Count-1. Entries are handed out in order through entryReceived(). A
+ * window that does not complete in time is re-requested from its first
+ * missing entry, and a dropped connection pauses the download until
+ * telemetry is connected again.
+ */
+class FlightLogDownload : public QObject {
+    Q_OBJECT
+
+public:
+    explicit FlightLogDownload(UAVObjectManager *objectManager, TelemetryManager *telemetryManager, QObject *parent = 0);
+    ~FlightLogDownload();
+
+    void start(int startFlight, int endFlight);
+    void cancel();
+
+    bool isRunning() const
+    {
+        return m_running;
+    }
+
+    int entriesReceived() const
+    {
+        return m_entriesReceived;
+    }
+
+    double kBytesPerSecond() const;
+
+    /**
+     * Split a log entry into the records it holds. A TYPE_MULTIPLEUAVOBJECTS
+     * entry packs further objects behind the first one, every other entry is
+     * returned as is.
+     */
+    static QList<DebugLogEntry::DataFields> splitEntry(const DebugLogEntry::DataFields &entry);
+
+signals:
+    void entryReceived(const DebugLogEntry::DataFields &entry);
+    void progress(int entries, double kBytesPerSecond);
+    void finished(bool success);
+
+private slots:
+    void entryUnpacked(UAVObject *obj);
+    void requestTimeout();
+    void connectionStatusChanged();
+
+private:
+    void requestWindow();
+    void deliverWindow();
+    void finish(bool success);
+
+    static const int WINDOW_SIZE     = 8;
+    static const int REQUEST_TIMEOUT = 4000;
+    static const int MAX_RETRIES     = 5;
+
+    UAVObjectManager *m_objectManager;
+    TelemetryManager *m_telemetryManager;
+    DebugLogControl *m_control;
+
+    QTimer m_timer;
+    QElapsedTimer m_elapsed;
+
+    bool m_running;
+    bool m_paused;
+    int m_flight;
+    int m_endFlight;
+    int m_windowStart;
+    int m_delivered;
+    int m_retries;
+    QVector<bool> m_received;
+    QVector<DebugLogEntry::DataFields> m_window;
+
+    int m_entriesReceived;
+    quint64 m_bytesReceived;
+};
+
+#endif // FLIGHTLOGDOWNLOAD_H
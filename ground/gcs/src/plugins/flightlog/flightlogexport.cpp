@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogexport.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Exports downloaded flight log records on a worker thread.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogexport.h"
+
+FlightLogExport::FlightLogExport(UAVObjectManager *objectManager, const QVector<DebugLogEntry::DataFields> &records,
+                                 const QString &fileName, FlightLogStreamWriter::Format format, bool adjustTimestamps) :
+    QObject(), m_objectManager(objectManager), m_records(records), m_fileName(fileName),
+    m_format(format), m_adjustTimestamps(adjustTimestamps), m_cancel(0)
+{}
+
+void FlightLogExport::run()
+{
+    FlightLogStreamWriter writer(m_objectManager, m_adjustTimestamps);
+    bool success = writer.open(m_fileName, m_format);
+
+    if (success) {
+        foreach(const DebugLogEntry::DataFields &record, m_records) {
+            if (m_cancel.load()) {
+                success = false;
+                break;
+            }
+            writer.write(record);
+        }
+        writer.close();
+    }
+
+    m_records.clear();
+    emit finished(success);
+}
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogexport.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Exports downloaded flight log records on a worker thread.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGEXPORT_H
+#define FLIGHTLOGEXPORT_H
+
+#include <QObject>
+#include <QVector>
+#include <QAtomicInt>
+
+#include "uavobjectmanager.h"
+#include "debuglogentry.h"
+#include "flightlogstreamwriter.h"
+
+/**
+ * Writes a list of raw log records to file. The object is moved to a worker
+ * thread and run() is invoked there, the writer and its decoding objects
+ * are created on that thread.
+ */
+class FlightLogExport : public QObject {
+    Q_OBJECT
+
+public:
+    FlightLogExport(UAVObjectManager *objectManager, const QVector<DebugLogEntry::DataFields> &records,
+                    const QString &fileName, FlightLogStreamWriter::Format format, bool adjustTimestamps);
+
+    // May be called from any thread
+    void cancel()
+    {
+        m_cancel.store(1);
+    }
+
+public slots:
+    void run();
+
+signals:
+    void finished(bool success);
+
+private:
+    UAVObjectManager *m_objectManager;
+    QVector<DebugLogEntry::DataFields> m_records;
+    QString m_fileName;
+    FlightLogStreamWriter::Format m_format;
+    bool m_adjustTimestamps;
+    QAtomicInt m_cancel;
+};
+
+#endif // FLIGHTLOGEXPORT_H
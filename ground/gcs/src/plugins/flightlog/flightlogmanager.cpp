@@ -26,11 +26,14 @@
  */
 
 #include "flightlogmanager.h"
+#include "flightlogstreamwriter.h"
+#include "flightlogexport.h"
 #include "extensionsystem/pluginmanager.h"
 
 #include <QApplication>
 #include <QFileDialog>
 #include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <QMessageBox>
 #include <QDebug>
 
@@ -42,7 +45,7 @@
 #include <uavobjectutil/uavobjectutilmanager.h>
 
 FlightLogManager::FlightLogManager(QObject *parent) :
-    QObject(parent), m_disableControls(false),
+    QObject(parent), m_streamWriter(0), m_export(0), m_disableControls(false),
     m_disableExport(true), m_cancelDownload(false),
     m_adjustExportedTimestamps(true)
 {
@@ -66,15 +69,18 @@ FlightLogManager::FlightLogManager(QObject *parent) :
     Q_ASSERT(m_flightLogStatus);
     connect(m_flightLogStatus, SIGNAL(FlightChanged(quint16)), this, SLOT(updateFlightEntries(quint16)));
 
-    m_flightLogEntry    = DebugLogEntry::GetInstance(m_objectManager);
-    Q_ASSERT(m_flightLogEntry);
-
     m_flightLogSettings = DebugLogSettings::GetInstance(m_objectManager);
     Q_ASSERT(m_flightLogSettings);
 
     m_objectPersistence = ObjectPersistence::GetInstance(m_objectManager);
     Q_ASSERT(m_objectPersistence);
 
+    m_decoder  = new FlightLogDecoder(m_objectManager);
+    m_download = new FlightLogDownload(m_objectManager, m_telemtryManager, this);
+    connect(m_download, SIGNAL(entryReceived(DebugLogEntry::DataFields)), this, SLOT(downloadEntryReceived(DebugLogEntry::DataFields)));
+    connect(m_download, SIGNAL(progress(int, double)), this, SLOT(downloadProgress(int, double)));
+    connect(m_download, SIGNAL(finished(bool)), this, SLOT(downloadFinished(bool)));
+
     updateFlightEntries(m_flightLogStatus->getFlight());
 
     setupLogSettings();
@@ -84,13 +90,24 @@ FlightLogManager::FlightLogManager(QObject *parent) :
     connect(m_telemtryManager, SIGNAL(connected()), this, SLOT(connectionStatusChanged()));
     connect(m_telemtryManager, SIGNAL(disconnected()), this, SLOT(connectionStatusChanged()));
     connectionStatusChanged();
+
+    m_exportThread.start();
 }
 
 FlightLogManager::~FlightLogManager()
 {
+    if (m_export) {
+        m_export->cancel();
+    }
+    m_exportThread.quit();
+    m_exportThread.wait();
+    delete m_export;
+
+    delete m_streamWriter;
     while (!m_logEntries.isEmpty()) {
         delete m_logEntries.takeFirst();
     }
+    delete m_decoder;
     while (!m_uavoEntries.isEmpty()) {
         delete m_uavoEntries.takeFirst();
     }
@@ -188,187 +205,114 @@ void FlightLogManager::clearLogList()
 
 void FlightLogManager::retrieveLogs(int flightToRetrieve)
 {
-    setDisableControls(true);
-    QApplication::setOverrideCursor(Qt::WaitCursor);
-    m_cancelDownload = false;
-    UAVObjectUpdaterHelper updateHelper;
-    UAVObjectRequestHelper requestHelper;
-
     clearLogList();
+    startDownload(flightToRetrieve);
+}
 
-    // Set up what to retrieve
-    int startFlight = (flightToRetrieve == -1) ? 0 : flightToRetrieve;
-    int endFlight   = (flightToRetrieve == -1) ? m_flightLogStatus->getFlight() : flightToRetrieve;
+void FlightLogManager::retrieveLogsToFile(int flightToRetrieve)
+{
+    QString oplFilter   = tr("OpenPilot Log file %1").arg("(*.opl)");
+    QString csvFilter   = tr("Text file %1").arg("(*.csv)");
+    QString traceFilter = tr("Event trace %1").arg("(*.json)");
 
-    // Prepare to send request for event retrieval
-    m_flightLogControl->setOperation(DebugLogControl::OPERATION_RETRIEVE);
-    for (int flight = startFlight; flight <= endFlight; flight++) {
-        m_flightLogControl->setFlight(flight);
-        bool gotLast = false;
-        int slot     = 0;
-        while (!gotLast) {
-            // Send request for loading flight entry on flight side and wait for ack/nack
-            m_flightLogControl->setEntry(slot);
-
-            if (updateHelper.doObjectAndWait(m_flightLogControl, UAVTALK_TIMEOUT) == UAVObjectUpdaterHelper::SUCCESS &&
-                requestHelper.doObjectAndWait(m_flightLogEntry, UAVTALK_TIMEOUT) == UAVObjectUpdaterHelper::SUCCESS) {
-                if (m_flightLogEntry->getType() != DebugLogEntry::TYPE_EMPTY) {
-                    // Ok, we retrieved the entry, and it was the correct one. clone it and add it to the list
-                    ExtendedDebugLogEntry *logEntry = new ExtendedDebugLogEntry();
-
-                    logEntry->setData(m_flightLogEntry->getData(), m_objectManager);
-                    m_logEntries << logEntry;
-                    if (logEntry->getData().Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-                        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
-                        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
-                        const quint32 header_len = total_len - data_len;
-
-                        DebugLogEntry::DataFields fields;
-                        quint32 start = logEntry->getData().Size;
-
-                        // cycle until there is space for another object
-                        while (start + header_len + 1 < data_len) {
-                            memset(&fields, 0xFF, total_len);
-                            memcpy(&fields, &logEntry->getData().Data[start], header_len);
-                            // check wether a packed object is found
-                            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
-                            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
-                            quint32 toread = header_len + fields.Size;
-                            if (!(toread + start > data_len)) {
-                                memcpy(&fields, &logEntry->getData().Data[start], toread);
-                                ExtendedDebugLogEntry *subEntry = new ExtendedDebugLogEntry();
-                                subEntry->setData(fields, m_objectManager);
-                                m_logEntries << subEntry;
-                            }
-                            start += toread;
-                        }
-                    }
+    QString selectedFilter = oplFilter;
 
-                    // Increment to get next entry from flight side
-                    slot++;
-                } else {
-                    // We are done, not more entries on this flight
-                    gotLast = true;
-                }
-            } else {
-                // We failed for some reason
-                break;
-            }
-            if (m_cancelDownload) {
-                break;
-            }
+    QString fileName = QFileDialog::getSaveFileName(NULL, tr("Save Log Entries"), QDir::homePath(),
+                                                    QString("%1;;%2;;%3").arg(oplFilter, csvFilter, traceFilter), &selectedFilter);
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    FlightLogStreamWriter::Format format = FlightLogStreamWriter::CSV;
+    if (selectedFilter == oplFilter) {
+        if (!fileName.endsWith(".opl")) {
+            fileName.append(".opl");
         }
-        if (m_cancelDownload) {
-            break;
+        format = FlightLogStreamWriter::OPL;
+    } else if (selectedFilter == traceFilter) {
+        if (!fileName.endsWith(".json")) {
+            fileName.append(".json");
         }
+        format = FlightLogStreamWriter::TRACE;
+    } else if (!fileName.endsWith(".csv")) {
+        fileName.append(".csv");
     }
 
-    if (m_cancelDownload) {
-        clearLogList();
-        m_cancelDownload = false;
+    // Entries go straight to the file and are not kept in the list
+    clearLogList();
+    m_streamWriter = new FlightLogStreamWriter(m_objectManager, m_adjustExportedTimestamps);
+    if (!m_streamWriter->open(fileName, format)) {
+        delete m_streamWriter;
+        m_streamWriter = 0;
+        QMessageBox::warning(NULL, tr("Save Log Entries"), tr("Could not open %1 for writing.").arg(fileName));
+        return;
     }
-
-    emit logEntriesChanged();
-    setDisableExport(m_logEntries.count() == 0);
-
-    QApplication::restoreOverrideCursor();
-    setDisableControls(false);
+    startDownload(flightToRetrieve);
 }
 
-void FlightLogManager::exportToOPL(QString fileName)
+void FlightLogManager::startDownload(int flightToRetrieve)
 {
-    // Fix the file name
-    fileName.replace(QString(".opl"), QString("%1.opl"));
-
-    // Loop and create a new file for each flight.
-    int currentEntry  = 0;
-    int currentFlight = 0;
-    quint32 adjustedBaseTime = 0;
-    // Continue until all entries are exported
-    while (currentEntry < m_logEntries.count()) {
-        if (m_adjustExportedTimestamps) {
-            adjustedBaseTime = m_logEntries[currentEntry]->getFlightTime();
-        }
-
-        // Get current flight
-        currentFlight = m_logEntries[currentEntry]->getFlight();
-
-        LogFile logFile;
-        logFile.useProvidedTimeStamp(true);
-
-        // Set the file name to contain flight number
-        logFile.setFileName(fileName.arg(tr("_flight-%1").arg(currentFlight + 1)));
-        logFile.open(QIODevice::WriteOnly);
-        UAVTalk uavTalk(&logFile, m_objectManager);
+    setDisableControls(true);
+    m_cancelDownload = false;
 
-        // Export entries until no more available or flight changes
-        while (currentEntry < m_logEntries.count() && m_logEntries[currentEntry]->getFlight() == currentFlight) {
-            ExtendedDebugLogEntry *entry = m_logEntries[currentEntry];
+    // Set up what to retrieve
+    int startFlight = (flightToRetrieve == -1) ? 0 : flightToRetrieve;
+    int endFlight   = (flightToRetrieve == -1) ? m_flightLogStatus->getFlight() : flightToRetrieve;
 
-            // Only log uavobjects
-            if (entry->getType() == ExtendedDebugLogEntry::TYPE_UAVOBJECT || entry->getType() == ExtendedDebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-                // Set timestamp that should be logged for this entry
-                logFile.setNextTimeStamp(entry->getFlightTime() - adjustedBaseTime);
+    setDownloadStatus(tr("Downloading..."));
+    m_download->start(startFlight, endFlight);
+}
 
-                // Use UAVTalk to log complete message to file
-                uavTalk.sendObject(entry->uavObject(), false, false);
-                qDebug() << entry->getFlightTime() - adjustedBaseTime << "=" << entry->toStringBrief();
-            }
-            currentEntry++;
+void FlightLogManager::downloadEntryReceived(const DebugLogEntry::DataFields &entry)
+{
+    foreach(const DebugLogEntry::DataFields &record, FlightLogDownload::splitEntry(entry)) {
+        if (m_streamWriter) {
+            m_streamWriter->write(record);
+        } else {
+            ExtendedDebugLogEntry *logEntry = new ExtendedDebugLogEntry();
+            logEntry->setData(record, m_decoder);
+            m_logEntries << logEntry;
         }
-
-        logFile.close();
     }
 }
 
-void FlightLogManager::exportToCSV(QString fileName)
+void FlightLogManager::downloadProgress(int entries, double kBytesPerSecond)
 {
-    QFile csvFile(fileName);
-
-    if (csvFile.open(QFile::WriteOnly | QFile::Truncate)) {
-        QTextStream csvStream(&csvFile);
-        quint32 baseTime = 0;
-        quint32 currentFlight = 0;
-        csvStream << "Flight" << '\t' << "Flight Time" << '\t' << "Entry" << '\t' << "Data" << '\n';
-        foreach(ExtendedDebugLogEntry * entry, m_logEntries) {
-            if (m_adjustExportedTimestamps && entry->getFlight() != currentFlight) {
-                currentFlight = entry->getFlight();
-                baseTime = entry->getFlightTime();
-            }
-            entry->toCSV(&csvStream, baseTime);
-        }
-        csvStream.flush();
-        csvFile.flush();
-        csvFile.close();
+    setDownloadStatus(tr("%1 entries, %2 KB/s").arg(entries).arg(kBytesPerSecond, 0, 'f', 1));
+    if (!m_streamWriter) {
+        emit logEntriesChanged();
     }
 }
 
-void FlightLogManager::exportToXML(QString fileName)
+void FlightLogManager::downloadFinished(bool success)
 {
-    QFile xmlFile(fileName);
+    if (m_streamWriter) {
+        m_streamWriter->close();
+        delete m_streamWriter;
+        m_streamWriter = 0;
+    }
 
-    if (xmlFile.open(QFile::WriteOnly | QFile::Truncate)) {
-        QXmlStreamWriter xmlWriter(&xmlFile);
-        xmlWriter.setAutoFormatting(true);
-        xmlWriter.setAutoFormattingIndent(4);
+    if (m_cancelDownload) {
+        clearLogList();
+        m_cancelDownload = false;
+        setDownloadStatus(tr("Cancelled"));
+    } else if (!success) {
+        setDownloadStatus(tr("Failed after %1 entries").arg(m_download->entriesReceived()));
+    } else {
+        setDownloadStatus(tr("%1 entries at %2 KB/s").arg(m_download->entriesReceived()).arg(m_download->kBytesPerSecond(), 0, 'f', 1));
+    }
 
-        xmlWriter.writeStartDocument("1.0", true);
-        xmlWriter.writeStartElement("logs");
-        xmlWriter.writeComment("This file was created by the flight log export in OpenPilot GCS.");
+    emit logEntriesChanged();
+    setDisableExport(m_logEntries.count() == 0);
+    setDisableControls(false);
+}
 
-        quint32 baseTime = 0;
-        quint32 currentFlight = 0;
-        foreach(ExtendedDebugLogEntry * entry, m_logEntries) {
-            if (m_adjustExportedTimestamps && entry->getFlight() != currentFlight) {
-                currentFlight = entry->getFlight();
-                baseTime = entry->getFlightTime();
-            }
-            entry->toXML(&xmlWriter, baseTime);
-        }
-        xmlWriter.writeEndElement();
-        xmlWriter.writeEndDocument();
-        xmlFile.flush();
-        xmlFile.close();
+void FlightLogManager::setDownloadStatus(QString arg)
+{
+    if (m_downloadStatus != arg) {
+        m_downloadStatus = arg;
+        emit downloadStatusChanged(arg);
     }
 }
 
@@ -378,43 +322,75 @@ void FlightLogManager::exportLogs()
         return;
     }
 
-    setDisableControls(true);
-    QApplication::setOverrideCursor(Qt::WaitCursor);
-
-    QString oplFilter = tr("OpenPilot Log file %1").arg("(*.opl)");
-    QString csvFilter = tr("Text file %1").arg("(*.csv)");
-    QString xmlFilter = tr("XML file %1").arg("(*.xml)");
+    QString oplFilter   = tr("OpenPilot Log file %1").arg("(*.opl)");
+    QString csvFilter   = tr("Text file %1").arg("(*.csv)");
+    QString xmlFilter   = tr("XML file %1").arg("(*.xml)");
+    QString traceFilter = tr("Event trace %1").arg("(*.json)");
 
     QString selectedFilter = csvFilter;
 
     QString fileName = QFileDialog::getSaveFileName(NULL, tr("Save Log Entries"), QDir::homePath(),
-                                                    QString("%1;;%2;;%3").arg(oplFilter, csvFilter, xmlFilter), &selectedFilter);
-    if (!fileName.isEmpty()) {
-        if (selectedFilter == oplFilter) {
-            if (!fileName.endsWith(".opl")) {
-                fileName.append(".opl");
-            }
-            exportToOPL(fileName);
-        } else if (selectedFilter == csvFilter) {
-            if (!fileName.endsWith(".csv")) {
-                fileName.append(".csv");
-            }
-            exportToCSV(fileName);
-        } else if (selectedFilter == xmlFilter) {
-            if (!fileName.endsWith(".xml")) {
-                fileName.append(".xml");
-            }
-            exportToXML(fileName);
+                                                    QString("%1;;%2;;%3;;%4").arg(oplFilter, csvFilter, xmlFilter, traceFilter), &selectedFilter);
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    FlightLogStreamWriter::Format format;
+    if (selectedFilter == oplFilter) {
+        if (!fileName.endsWith(".opl")) {
+            fileName.append(".opl");
         }
+        format = FlightLogStreamWriter::OPL;
+    } else if (selectedFilter == csvFilter) {
+        if (!fileName.endsWith(".csv")) {
+            fileName.append(".csv");
+        }
+        format = FlightLogStreamWriter::CSV;
+    } else if (selectedFilter == traceFilter) {
+        if (!fileName.endsWith(".json")) {
+            fileName.append(".json");
+        }
+        format = FlightLogStreamWriter::TRACE;
+    } else {
+        if (!fileName.endsWith(".xml")) {
+            fileName.append(".xml");
+        }
+        format = FlightLogStreamWriter::XML;
     }
 
-    QApplication::restoreOverrideCursor();
+    // The worker only gets the raw records, they are decoded while writing
+    QVector<DebugLogEntry::DataFields> records;
+    records.reserve(m_logEntries.count());
+    foreach(ExtendedDebugLogEntry * entry, m_logEntries) {
+        records << entry->getData();
+    }
+
+    setDisableControls(true);
+    setDownloadStatus(tr("Exporting..."));
+
+    m_export = new FlightLogExport(m_objectManager, records, fileName, format, m_adjustExportedTimestamps);
+    m_export->moveToThread(&m_exportThread);
+    connect(m_export, SIGNAL(finished(bool)), this, SLOT(exportFinished(bool)));
+    QMetaObject::invokeMethod(m_export, "run", Qt::QueuedConnection);
+}
+
+void FlightLogManager::exportFinished(bool success)
+{
+    m_export->deleteLater();
+    m_export = 0;
+
+    setDownloadStatus(success ? tr("Exported %1 entries").arg(m_logEntries.count()) : tr("Export failed"));
     setDisableControls(false);
 }
 
 void FlightLogManager::cancelExportLogs()
 {
     m_cancelDownload = true;
+    m_download->cancel();
+    if (m_export) {
+        m_export->cancel();
+    }
 }
 
 void FlightLogManager::loadSettings()
@@ -626,66 +602,30 @@ bool FlightLogManager::updateLogWrapper(QString name, int level, int period)
 }
 
 ExtendedDebugLogEntry::ExtendedDebugLogEntry() : DebugLogEntry(),
-    m_object(0)
+    m_decoder(0)
 {}
 
 ExtendedDebugLogEntry::~ExtendedDebugLogEntry()
-{
-    if (m_object) {
-        delete m_object;
-        m_object = 0;
-    }
-}
+{}
 
 QString ExtendedDebugLogEntry::getLogString()
 {
     if (getType() == DebugLogEntry::TYPE_TEXT) {
         return QString((const char *)getData().Data);
-    } else if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        return m_object->toString().replace("\n", " ").replace("\t", " ");
-    } else {
-        return "";
-    }
-}
-
-void ExtendedDebugLogEntry::toXML(QXmlStreamWriter *xmlWriter, quint32 baseTime)
-{
-    xmlWriter->writeStartElement("entry");
-    xmlWriter->writeAttribute("flight", QString::number(getFlight() + 1));
-    xmlWriter->writeAttribute("flighttime", QString::number(getFlightTime() - baseTime));
-    xmlWriter->writeAttribute("entry", QString::number(getEntry()));
-    if (getType() == DebugLogEntry::TYPE_TEXT) {
-        xmlWriter->writeAttribute("type", "text");
-        xmlWriter->writeTextElement("message", QString((const char *)getData().Data));
-    } else if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        xmlWriter->writeAttribute("type", "uavobject");
-        m_object->toXML(xmlWriter);
-    }
-    xmlWriter->writeEndElement(); // entry
-}
-
-void ExtendedDebugLogEntry::toCSV(QTextStream *csvStream, quint32 baseTime)
-{
-    QString data;
-
-    if (getType() == DebugLogEntry::TYPE_TEXT) {
-        data = QString((const char *)getData().Data);
-    } else if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        data = m_object->toString().replace("\n", "").replace("\t", "");
+    } else if (m_decoder) {
+        // Decoded on demand, only the visible rows of the table ask for it
+        UAVDataObject *object = m_decoder->decode(getData());
+        if (object) {
+            return object->toString().replace("\n", " ").replace("\t", " ");
+        }
     }
-    *csvStream << QString::number(getFlight() + 1) << '\t' << QString::number(getFlightTime() - baseTime) << '\t' << QString::number(getEntry()) << '\t' << data << '\n';
+    return "";
 }
 
-void ExtendedDebugLogEntry::setData(const DebugLogEntry::DataFields &data, UAVObjectManager *objectManager)
+void ExtendedDebugLogEntry::setData(const DebugLogEntry::DataFields &data, FlightLogDecoder *decoder)
 {
     DebugLogEntry::setData(data);
-
-    if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        UAVDataObject *object = (UAVDataObject *)objectManager->getObject(getObjectID(), getInstanceID());
-        Q_ASSERT(object);
-        m_object = object->clone(getInstanceID());
-        m_object->unpack(getData().Data);
-    }
+    m_decoder = decoder;
 }
 
 
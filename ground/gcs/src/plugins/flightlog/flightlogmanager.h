@@ -33,8 +33,7 @@
 #include <QHash>
 #include <QQmlListProperty>
 #include <QSemaphore>
-#include <QXmlStreamWriter>
-#include <QTextStream>
+#include <QThread>
 
 #include "uavobjectmanager.h"
 #include "uavobjectutilmanager.h"
@@ -44,6 +43,11 @@
 #include "debuglogcontrol.h"
 #include "objectpersistence.h"
 #include "uavtalk/telemetrymanager.h"
+#include "flightlogdownload.h"
+#include "flightlogdecoder.h"
+
+class FlightLogStreamWriter;
+class FlightLogExport;
 
 class UAVOLogSettingsWrapper : public QObject {
     Q_OBJECT Q_PROPERTY(UAVDataObject *object READ object NOTIFY objectChanged)
@@ -145,14 +149,8 @@ public:
     ~ExtendedDebugLogEntry();
 
     QString getLogString();
-    void toXML(QXmlStreamWriter *xmlWriter, quint32 baseTime);
-    void toCSV(QTextStream *csvStream, quint32 baseTime);
-    UAVDataObject *uavObject()
-    {
-        return m_object;
-    }
 
-    void setData(const DataFields & data, UAVObjectManager *objectManager);
+    void setData(const DataFields & data, FlightLogDecoder *decoder);
 
 public slots:
     void setLogString(QString arg)
@@ -164,7 +162,7 @@ signals:
     void LogStringUpdated(QString arg);
 
 private:
-    UAVDataObject *m_object;
+    FlightLogDecoder *m_decoder;
 };
 
 class FlightLogManager : public QObject {
@@ -183,6 +181,7 @@ class FlightLogManager : public QObject {
     Q_PROPERTY(QStringList logStatuses READ logStatuses NOTIFY logStatusesChanged)
     Q_PROPERTY(int loggingEnabled READ loggingEnabled WRITE setLoggingEnabled NOTIFY loggingEnabledChanged)
     Q_PROPERTY(int logEntriesCount READ logEntriesCount NOTIFY logEntriesChanged)
+    Q_PROPERTY(QString downloadStatus READ downloadStatus NOTIFY downloadStatusChanged)
 
 public:
     explicit FlightLogManager(QObject *parent = 0);
@@ -248,6 +247,11 @@ public:
     {
         return m_logEntries.count();
     }
+
+    QString downloadStatus() const
+    {
+        return m_downloadStatus;
+    }
 signals:
     void logEntriesChanged();
     void flightEntriesChanged();
@@ -260,10 +264,12 @@ signals:
 
     void logStatusesChanged(QStringList arg);
     void loggingEnabledChanged(int arg);
+    void downloadStatusChanged(QString arg);
 
 public slots:
     void clearAllLogs();
     void retrieveLogs(int flightToRetrieve = -1);
+    void retrieveLogsToFile(int flightToRetrieve = -1);
     void exportLogs();
     void cancelExportLogs();
     void loadSettings();
@@ -319,6 +325,10 @@ private slots:
     void setupLogStatuses();
     void connectionStatusChanged();
     bool updateLogWrapper(QString name, int level, int period);
+    void downloadEntryReceived(const DebugLogEntry::DataFields &entry);
+    void downloadProgress(int entries, double kBytesPerSecond);
+    void downloadFinished(bool success);
+    void exportFinished(bool success);
 
 private:
     UAVObjectManager *m_objectManager;
@@ -326,9 +336,13 @@ private:
     TelemetryManager *m_telemtryManager;
     DebugLogControl *m_flightLogControl;
     DebugLogStatus *m_flightLogStatus;
-    DebugLogEntry *m_flightLogEntry;
     DebugLogSettings *m_flightLogSettings;
     ObjectPersistence *m_objectPersistence;
+    FlightLogDownload *m_download;
+    FlightLogStreamWriter *m_streamWriter;
+    FlightLogDecoder *m_decoder;
+    FlightLogExport *m_export;
+    QThread m_exportThread;
 
     QList<ExtendedDebugLogEntry *> m_logEntries;
     QStringList m_flightEntries;
@@ -338,9 +352,8 @@ private:
     QList<UAVOLogSettingsWrapper *> m_uavoEntries;
     QHash<QString, UAVOLogSettingsWrapper *> m_uavoEntriesHash;
 
-    void exportToOPL(QString fileName);
-    void exportToCSV(QString fileName);
-    void exportToXML(QString fileName);
+    void startDownload(int flightToRetrieve);
+    void setDownloadStatus(QString arg);
 
     static const int UAVTALK_TIMEOUT = 4000;
     static const int LOG_SETTINGS_FILE_VERSION = 1;
@@ -350,6 +363,7 @@ private:
     bool m_adjustExportedTimestamps;
     bool m_boardConnected;
     int m_loggingEnabled;
+    QString m_downloadStatus;
 };
 
 #endif // FLIGHTLOGMANAGER_H
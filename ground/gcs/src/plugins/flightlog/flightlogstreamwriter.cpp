@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogstreamwriter.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Writes flight log records to file one record at a time.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogstreamwriter.h"
+
+#include <QObject>
+
+#include "uavtalk/uavtalk.h"
+#include "utils/logfile.h"
+
+FlightLogStreamWriter::FlightLogStreamWriter(UAVObjectManager *objectManager, bool adjustTimestamps) :
+    m_objectManager(objectManager), m_adjustTimestamps(adjustTimestamps), m_format(CSV),
+    m_decoder(objectManager), m_flightOpen(false), m_flight(0), m_baseTime(0),
+    m_logFile(0), m_uavTalk(0), m_traceWriter(objectManager)
+{}
+
+FlightLogStreamWriter::~FlightLogStreamWriter()
+{
+    close();
+}
+
+bool FlightLogStreamWriter::open(const QString &fileName, Format format)
+{
+    close();
+
+    m_format     = format;
+    m_fileName   = fileName;
+    m_flightOpen = false;
+
+    if (m_format == OPL) {
+        // Files are created per flight, see openFlight()
+        m_fileName.replace(QString(".opl"), QString("%1.opl"));
+        return true;
+    } else if (m_format == TRACE) {
+        return m_traceWriter.open(m_fileName);
+    }
+
+    m_file.setFileName(m_fileName);
+    if (!m_file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+
+    if (m_format == CSV) {
+        m_csvStream.setDevice(&m_file);
+        m_csvStream << "Flight" << '\t' << "Flight Time" << '\t' << "Entry" << '\t' << "Data" << '\n';
+    } else {
+        m_xmlWriter.setDevice(&m_file);
+        m_xmlWriter.setAutoFormatting(true);
+        m_xmlWriter.setAutoFormattingIndent(4);
+
+        m_xmlWriter.writeStartDocument("1.0", true);
+        m_xmlWriter.writeStartElement("logs");
+        m_xmlWriter.writeComment("This file was created by the flight log export in OpenPilot GCS.");
+    }
+    return true;
+}
+
+void FlightLogStreamWriter::close()
+{
+    closeFlight();
+    m_traceWriter.close();
+    if (m_file.isOpen()) {
+        if (m_format == CSV) {
+            m_csvStream.flush();
+            m_csvStream.setDevice(0);
+        } else {
+            m_xmlWriter.writeEndElement();
+            m_xmlWriter.writeEndDocument();
+            m_xmlWriter.setDevice(0);
+        }
+        m_file.flush();
+        m_file.close();
+    }
+}
+
+void FlightLogStreamWriter::openFlight(quint16 flight)
+{
+    closeFlight();
+
+    m_flightOpen = true;
+    m_flight     = flight;
+
+    if (m_format == OPL) {
+        m_logFile = new LogFile();
+        m_logFile->useProvidedTimeStamp(true);
+        m_logFile->setFileName(m_fileName.arg(QObject::tr("_flight-%1").arg(flight + 1)));
+        m_logFile->open(QIODevice::WriteOnly);
+        m_uavTalk = new UAVTalk(m_logFile, m_objectManager);
+    }
+}
+
+void FlightLogStreamWriter::closeFlight()
+{
+    if (m_logFile) {
+        delete m_uavTalk;
+        m_uavTalk = 0;
+        m_logFile->close();
+        delete m_logFile;
+        m_logFile = 0;
+    }
+    m_flightOpen = false;
+}
+
+void FlightLogStreamWriter::write(const DebugLogEntry::DataFields &record)
+{
+    if (!m_flightOpen || record.Flight != m_flight) {
+        openFlight(record.Flight);
+        if (m_adjustTimestamps) {
+            m_baseTime = record.FlightTime;
+        }
+    }
+
+    UAVDataObject *object = m_decoder.decode(record);
+
+    if (m_format == TRACE) {
+        EventTrace *trace = qobject_cast<EventTrace *>(object);
+        if (trace) {
+            m_traceWriter.write(trace->getData());
+        }
+    } else if (m_format == OPL) {
+        // Only log uavobjects
+        if (object && m_uavTalk) {
+            m_logFile->setNextTimeStamp(record.FlightTime - m_baseTime);
+            m_uavTalk->sendObject(object, false, false);
+        }
+    } else if (m_format == CSV) {
+        QString data;
+        if (record.Type == DebugLogEntry::TYPE_TEXT) {
+            data = QString((const char *)record.Data);
+        } else if (object) {
+            data = object->toString().replace("\n", "").replace("\t", "");
+        }
+        m_csvStream << QString::number(record.Flight + 1) << '\t' << QString::number(record.FlightTime - m_baseTime) << '\t'
+                    << QString::number(record.Entry) << '\t' << data << '\n';
+    } else {
+        m_xmlWriter.writeStartElement("entry");
+        m_xmlWriter.writeAttribute("flight", QString::number(record.Flight + 1));
+        m_xmlWriter.writeAttribute("flighttime", QString::number(record.FlightTime - m_baseTime));
+        m_xmlWriter.writeAttribute("entry", QString::number(record.Entry));
+        if (record.Type == DebugLogEntry::TYPE_TEXT) {
+            m_xmlWriter.writeAttribute("type", "text");
+            m_xmlWriter.writeTextElement("message", QString((const char *)record.Data));
+        } else if (object) {
+            m_xmlWriter.writeAttribute("type", "uavobject");
+            object->toXML(&m_xmlWriter);
+        }
+        m_xmlWriter.writeEndElement(); // entry
+    }
+}
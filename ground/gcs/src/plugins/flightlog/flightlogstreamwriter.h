@@ -0,0 +1,83 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogstreamwriter.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Writes flight log records to file one record at a time.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGSTREAMWRITER_H
+#define FLIGHTLOGSTREAMWRITER_H
+
+#include <QFile>
+#include <QTextStream>
+#include <QXmlStreamWriter>
+
+#include "uavobjectmanager.h"
+#include "debuglogentry.h"
+#include "flightlogdecoder.h"
+#include "eventtracewriter.h"
+
+class LogFile;
+class UAVTalk;
+
+/**
+ * Writes log records to an .opl, CSV or XML file one at a time, so that
+ * neither a download nor an export needs the whole log decoded in memory.
+ * The .opl format gets one file per flight. The trace format only keeps the
+ * EventTrace records, as Chrome trace JSON.
+ */
+class FlightLogStreamWriter {
+public:
+    enum Format { OPL, CSV, XML, TRACE };
+
+    FlightLogStreamWriter(UAVObjectManager *objectManager, bool adjustTimestamps);
+    ~FlightLogStreamWriter();
+
+    bool open(const QString &fileName, Format format);
+    void write(const DebugLogEntry::DataFields &record);
+    void close();
+
+private:
+    void openFlight(quint16 flight);
+    void closeFlight();
+
+    UAVObjectManager *m_objectManager;
+    bool m_adjustTimestamps;
+    Format m_format;
+    QString m_fileName;
+
+    FlightLogDecoder m_decoder;
+
+    bool m_flightOpen;
+    quint16 m_flight;
+    quint32 m_baseTime;
+
+    LogFile *m_logFile;
+    UAVTalk *m_uavTalk;
+    QFile m_file;
+    QTextStream m_csvStream;
+    QXmlStreamWriter m_xmlWriter;
+    EventTraceWriter m_traceWriter;
+};
+
+#endif // FLIGHTLOGSTREAMWRITER_H
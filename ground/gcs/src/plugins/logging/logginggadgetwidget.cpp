@@ -58,6 +58,14 @@ void LoggingGadgetWidget::setPlugin(LoggingPlugin *p)
     connect(m_logging->pauseButton, SIGNAL(clicked()), p->getLogfile(), SLOT(pauseReplay()));
     connect(m_logging->pauseButton, SIGNAL(clicked()), scpPlugin, SLOT(stopPlotting()));
     connect(m_logging->playbackSpeed, SIGNAL(valueChanged(double)), p->getLogfile(), SLOT(setReplaySpeed(double)));
+    connect(m_logging->fastestReplay, SIGNAL(toggled(bool)), p->getLogfile(), SLOT(setFastestReplay(bool)));
+    connect(m_logging->fastestReplay, SIGNAL(toggled(bool)), m_logging->playbackSpeed, SLOT(setDisabled(bool)));
+    connect(m_logging->stepForwardButton, SIGNAL(clicked()), p->getLogfile(), SLOT(stepForward()));
+    connect(m_logging->stepBackwardButton, SIGNAL(clicked()), p->getLogfile(), SLOT(stepBackward()));
+    connect(m_logging->positionSlider, SIGNAL(sliderReleased()), this, SLOT(seekToSliderPosition()));
+    connect(p->getLogfile(), SIGNAL(replayStarted()), this, SLOT(replayStarted()));
+    connect(p->getLogfile(), SIGNAL(replayFinished()), this, SLOT(replayFinished()));
+    connect(&m_positionTimer, SIGNAL(timeout()), this, SLOT(updatePosition()));
     void pauseReplay();
     void resumeReplay();
 }
@@ -68,6 +76,54 @@ void LoggingGadgetWidget::stateChanged(QString status)
     m_logging->statusLabel->setText(status);
 }
 
+static QString formatReplayTime(quint32 ms)
+{
+    quint32 seconds = ms / 1000;
+
+    return QString("%1:%2").arg(seconds / 60).arg(seconds % 60, 2, 10, QChar('0'));
+}
+
+/**
+ * The slider covers the logged time range, in ms from the first packet
+ */
+void LoggingGadgetWidget::replayStarted()
+{
+    LogFile *logFile = loggingPlugin->getLogfile();
+
+    m_logging->positionSlider->setRange(0, logFile->replayEndTime() - logFile->replayStartTime());
+    m_logging->positionSlider->setPageStep(10000);
+    m_logging->positionSlider->setEnabled(true);
+    updatePosition();
+    m_positionTimer.start(200);
+}
+
+void LoggingGadgetWidget::replayFinished()
+{
+    m_positionTimer.stop();
+    m_logging->positionSlider->setEnabled(false);
+}
+
+void LoggingGadgetWidget::updatePosition()
+{
+    LogFile *logFile = loggingPlugin->getLogfile();
+    quint32 position = logFile->replayPosition() - logFile->replayStartTime();
+
+    // Do not move the slider away from the user
+    if (!m_logging->positionSlider->isSliderDown()) {
+        m_logging->positionSlider->setValue(position);
+    }
+    m_logging->positionLabel->setText(formatReplayTime(position) + " / "
+                                      + formatReplayTime(logFile->replayEndTime() - logFile->replayStartTime()));
+}
+
+void LoggingGadgetWidget::seekToSliderPosition()
+{
+    LogFile *logFile = loggingPlugin->getLogfile();
+
+    logFile->seekToTime(logFile->replayStartTime() + m_logging->positionSlider->value());
+    updatePosition();
+}
+
 /**
  * @}
  * @}
@@ -42,6 +42,7 @@
 #include <extensionsystem/pluginmanager.h>
 #include <QKeySequence>
 #include "uavobjectmanager.h"
+#include <uavtalk/telemetrymanager.h>
 
 
 LoggingConnection::LoggingConnection(LoggingPlugin *loggingPlugin) :
@@ -114,6 +115,9 @@ QString LoggingConnection::shortName()
 }
 
 
+LoggingThread::LoggingThread() : uavTalk(NULL), bus(NULL), busReader(NULL)
+{}
+
 LoggingThread::~LoggingThread()
 {
     stopLogging();
@@ -136,47 +140,57 @@ bool LoggingThread::openFile(QString file, LoggingPlugin *parent)
     uavTalk = new UAVTalk(&logFile, objManager);
     connect(parent, SIGNAL(stopLoggingSignal()), this, SLOT(stopLogging()));
 
+    // Log what goes over the telemetry link, from the next frame on
+    TelemetryManager *telMngr = pm->getObject<TelemetryManager>();
+    bus = telMngr->bus();
+    busReader = new UAVTalkBusReader(bus);
+    connect(bus, SIGNAL(framesPublished()), this, SLOT(framesPublished()));
+
     return true;
 };
 
 /**
- * Logs an object update to the file.  Data format is the
+ * Logs the object updates received from or sent to the autopilot since the
+ * last call to the file.  Data format is the
  * timestamp as a 32 bit uint counting ms from start of
  * file writing (flight time will be embedded in stream),
  * then object packet size, then the packed UAVObject.
  */
-void LoggingThread::objectUpdated(UAVObject *obj)
+void LoggingThread::framesPublished()
 {
     QWriteLocker locker(&lock);
 
-    if (!uavTalk->sendObject(obj, false, false)) {
-        qDebug() << "Error logging " << obj->getName();
+    if (!busReader) {
+        return;
+    }
+
+    UAVTalkBus::Frame frame;
+    quint8 data[UAVTalkBus::MAX_PAYLOAD_LENGTH];
+    while (busReader->read(&frame)) {
+        // Requests, acks and nacks carry no object data
+        if (frame.length == 0) {
+            busReader->release();
+            continue;
+        }
+        memcpy(data, frame.data, frame.length);
+        if (!busReader->release()) {
+            // overwritten while it was copied
+            continue;
+        }
+        if (!uavTalk->sendObjectData(frame.objId, frame.instId, data, frame.length)) {
+            qDebug() << "Error logging object" << frame.objId << frame.instId;
+        }
     }
 };
 
 /**
- * Connect signals from all the objects updates to the write routine then
- * run event loop
+ * Ask for the settings if connected then run event loop
  */
 void LoggingThread::run()
 {
     ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
     UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
 
-    QList< QList<UAVObject *> > list;
-    list = objManager->getObjects();
-    QList< QList<UAVObject *> >::const_iterator i;
-    QList<UAVObject *>::const_iterator j;
-    int objects = 0;
-
-    for (i = list.constBegin(); i != list.constEnd(); ++i) {
-        for (j = (*i).constBegin(); j != (*i).constEnd(); ++j) {
-            connect(*j, SIGNAL(objectUpdated(UAVObject *)), (LoggingThread *)this, SLOT(objectUpdated(UAVObject *)));
-            objects++;
-            // qDebug() << "Detected " << j[0];
-        }
-    }
-
     GCSTelemetryStats *gcsStatsObj = GCSTelemetryStats::GetInstance(objManager);
     GCSTelemetryStats::DataFields gcsStats = gcsStatsObj->getData();
     if (gcsStats.Status == GCSTelemetryStats::STATUS_CONNECTED) {
@@ -198,19 +212,15 @@ void LoggingThread::stopLogging()
 {
     QWriteLocker locker(&lock);
 
-    // Disconnect all objects we registered with:
-    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
-    UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
-
-    QList< QList<UAVObject *> > list;
-    list = objManager->getObjects();
-    QList< QList<UAVObject *> >::const_iterator i;
-    QList<UAVObject *>::const_iterator j;
-
-    for (i = list.constBegin(); i != list.constEnd(); ++i) {
-        for (j = (*i).constBegin(); j != (*i).constEnd(); ++j) {
-            disconnect(*j, SIGNAL(objectUpdated(UAVObject *)), (LoggingThread *)this, SLOT(objectUpdated(UAVObject *)));
+    if (bus) {
+        disconnect(bus, SIGNAL(framesPublished()), this, SLOT(framesPublished()));
+    }
+    if (busReader) {
+        if (busReader->lost() > 0) {
+            qDebug() << "Logging: lost" << busReader->lost() << "frames";
         }
+        delete busReader;
+        busReader = NULL;
     }
 
     logFile.close();
@@ -35,6 +35,7 @@
 #include "uavobjectmanager.h"
 #include "gcstelemetrystats.h"
 #include <uavtalk/uavtalk.h>
+#include <uavtalk/uavtalkbus.h>
 #include <utils/logfile.h>
 
 #include <QThread>
@@ -90,12 +91,13 @@ protected:
 class LoggingThread : public QThread {
     Q_OBJECT
 public:
+    LoggingThread();
     virtual ~LoggingThread();
 
     bool openFile(QString file, LoggingPlugin *parent);
 
 private slots:
-    void objectUpdated(UAVObject *obj);
+    void framesPublished();
     void transactionCompleted(UAVObject *obj, bool success);
 
 public slots:
@@ -106,6 +108,8 @@ protected:
     QReadWriteLock lock;
     LogFile logFile;
     UAVTalk *uavTalk;
+    UAVTalkBus *bus;
+    UAVTalkBusReader *busReader;
 
 private:
     QQueue<UAVDataObject *> queue;
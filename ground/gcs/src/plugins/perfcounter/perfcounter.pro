@@ -0,0 +1,21 @@
+TEMPLATE = lib
+TARGET = PerfCounterGadget
+
+QT += widgets
+
+include(../../plugin.pri)
+include(perfcounter_dependencies.pri)
+
+HEADERS += \
+    perfcounterplugin.h \
+    perfcountergadget.h \
+    perfcountergadgetwidget.h \
+    perfcountergadgetfactory.h
+
+SOURCES += \
+    perfcounterplugin.cpp \
+    perfcountergadget.cpp \
+    perfcountergadgetfactory.cpp \
+    perfcountergadgetwidget.cpp
+
+OTHER_FILES += PerfCounterGadget.pluginspec
@@ -0,0 +1,5 @@
+include(../../plugins/coreplugin/coreplugin.pri)
+include(../../plugins/uavobjects/uavobjects.pri)
+include(../../plugins/uavtalk/uavtalk.pri)
+include(../../plugins/uavobjectutil/uavobjectutil.pri)
+include(../../libs/qwt/qwt.pri)
@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ *
+ * @file       perfcountergadgetfactory.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup PerfCounterGadgetPlugin Performance Counter Gadget Plugin
+ * @{
+ * @brief Live view of the flight performance counters
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PERFCOUNTERGADGETFACTORY_H_
+#define PERFCOUNTERGADGETFACTORY_H_
+
+#include <coreplugin/iuavgadgetfactory.h>
+
+namespace Core {
+class IUAVGadget;
+class IUAVGadgetFactory;
+}
+
+using namespace Core;
+
+class PerfCounterGadgetFactory : public IUAVGadgetFactory {
+    Q_OBJECT
+public:
+    PerfCounterGadgetFactory(QObject *parent = 0);
+    ~PerfCounterGadgetFactory();
+
+    IUAVGadget *createGadget(QWidget *parent);
+};
+
+#endif // PERFCOUNTERGADGETFACTORY_H_
@@ -0,0 +1,275 @@
+/**
+ ******************************************************************************
+ *
+ * @file       perfcountergadgetwidget.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup PerfCounterGadgetPlugin Performance Counter Gadget Plugin
+ * @{
+ * @brief Live view of the flight performance counters
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "perfcountergadgetwidget.h"
+#include "perfcounter.h"
+#include "eventtrace.h"
+#include "eventtracewriter.h"
+
+#include "extensionsystem/pluginmanager.h"
+#include "uavobjectmanager.h"
+#include <uavtalk/telemetrymanager.h>
+
+#include "qwt/src/qwt_legend.h"
+#include "qwt/src/qwt_plot.h"
+#include "qwt/src/qwt_plot_curve.h"
+
+#include <QDir>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+enum Column { COLUMN_ID, COLUMN_SAMPLES, COLUMN_P50, COLUMN_P99, COLUMN_P999, COLUMN_VALUE, COLUMN_MIN, COLUMN_MAX, COLUMN_COUNT };
+
+PerfCounterGadgetWidget::PerfCounterGadgetWidget(QWidget *parent) : QWidget(parent), m_metadataChanged(false), m_traceWriter(0)
+{
+    setMinimumSize(64, 64);
+    setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::MinimumExpanding);
+
+    m_table = new QTableWidget(0, COLUMN_COUNT, this);
+    m_table->setHorizontalHeaderLabels(QStringList() << tr("Id") << tr("Samples") << tr("P50") << tr("P99") << tr("P99.9")
+                                                     << tr("Value") << tr("Min") << tr("Max"));
+    m_table->verticalHeader()->hide();
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_table->setSelectionMode(QAbstractItemView::SingleSelection);
+    connect(m_table, SIGNAL(itemSelectionChanged()), this, SLOT(selectionChanged()));
+
+    m_plot = new QwtPlot(this);
+    m_plot->setAxisTitle(QwtPlot::xBottom, tr("Time (s)"));
+    m_plot->insertLegend(new QwtLegend(), QwtPlot::TopLegend);
+
+    const QString names[3] = { tr("P50"), tr("P99"), tr("P99.9") };
+    const QColor colors[3] = { Qt::darkGreen, QColor(255, 140, 0), Qt::red };
+    for (int i = 0; i < 3; i++) {
+        m_curves[i] = new QwtPlotCurve(names[i]);
+        m_curves[i]->setPen(QPen(colors[i], 1));
+        m_curves[i]->attach(m_plot);
+    }
+
+    QSplitter *splitter = new QSplitter(Qt::Vertical, this);
+    splitter->addWidget(m_table);
+    splitter->addWidget(m_plot);
+
+    m_traceButton = new QPushButton(tr("Record Event Trace"), this);
+    m_traceButton->setCheckable(true);
+    connect(m_traceButton, SIGNAL(toggled(bool)), this, SLOT(recordTrace(bool)));
+    m_traceStatus = new QLabel(this);
+
+    QHBoxLayout *traceLayout = new QHBoxLayout();
+    traceLayout->addWidget(m_traceButton);
+    traceLayout->addWidget(m_traceStatus, 1);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addLayout(traceLayout);
+    layout->addWidget(splitter);
+
+    m_clock.start();
+
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+    m_objManager = pm->getObject<UAVObjectManager>();
+    m_counter    = m_objManager->getObject(PerfCounter::NAME);
+
+    // the flight side creates an instance for each counter, they show up as they are received
+    connect(m_objManager, SIGNAL(newInstance(UAVObject *)), this, SLOT(newInstance(UAVObject *)));
+    foreach(UAVObject * obj, m_objManager->getObjectInstances(PerfCounter::NAME)) {
+        watch(obj);
+    }
+
+    TelemetryManager *telMngr = pm->getObject<TelemetryManager>();
+    connect(telMngr, SIGNAL(connected()), this, SLOT(onAutopilotConnect()));
+    connect(telMngr, SIGNAL(disconnected()), this, SLOT(onAutopilotDisconnect()));
+    if (telMngr->isConnected()) {
+        onAutopilotConnect();
+    }
+}
+
+PerfCounterGadgetWidget::~PerfCounterGadgetWidget()
+{
+    delete m_traceWriter;
+    if (m_metadataChanged) {
+        m_counter->setMetadata(m_initialMetadata);
+    }
+}
+
+/**
+ * Have every update of the counters sent while the widget is there
+ */
+void PerfCounterGadgetWidget::onAutopilotConnect()
+{
+    if (!m_metadataChanged) {
+        m_initialMetadata = m_counter->getMetadata();
+        m_metadataChanged = true;
+    }
+    UAVObject::Metadata mdata = m_initialMetadata;
+    UAVObject::SetFlightTelemetryUpdateMode(mdata, UAVObject::UPDATEMODE_ONCHANGE);
+    m_counter->setMetadata(mdata);
+
+    // for the counters that do not change
+    m_counter->requestUpdateAll();
+}
+
+void PerfCounterGadgetWidget::onAutopilotDisconnect()
+{
+    // the board starts over with its own metadata
+    m_metadataChanged = false;
+}
+
+void PerfCounterGadgetWidget::newInstance(UAVObject *obj)
+{
+    if (obj->getObjID() == PerfCounter::OBJID) {
+        watch(obj);
+    }
+}
+
+void PerfCounterGadgetWidget::watch(UAVObject *obj)
+{
+    connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(counterUpdated(UAVObject *)));
+}
+
+void PerfCounterGadgetWidget::counterUpdated(UAVObject *obj)
+{
+    PerfCounter *counter = qobject_cast<PerfCounter *>(obj);
+
+    if (!counter) {
+        return;
+    }
+    PerfCounter::DataFields data = counter->getData();
+
+    if (!m_rows.contains(data.Id)) {
+        int row = m_table->rowCount();
+        m_table->insertRow(row);
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            QTableWidgetItem *item = new QTableWidgetItem();
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            m_table->setItem(row, column, item);
+        }
+        m_table->item(row, COLUMN_ID)->setText(QString("0x%1").arg(data.Id, 8, 16, QChar('0')));
+        m_rows.insert(data.Id, row);
+    }
+
+    int row = m_rows.value(data.Id);
+    m_table->item(row, COLUMN_SAMPLES)->setText(QString::number(data.Samples));
+    m_table->item(row, COLUMN_P50)->setText(QString::number(data.Percentile[PerfCounter::PERCENTILE_P50]));
+    m_table->item(row, COLUMN_P99)->setText(QString::number(data.Percentile[PerfCounter::PERCENTILE_P99]));
+    m_table->item(row, COLUMN_P999)->setText(QString::number(data.Percentile[PerfCounter::PERCENTILE_P999]));
+    m_table->item(row, COLUMN_VALUE)->setText(QString::number(data.Counter[PerfCounter::COUNTER_VALUE]));
+    m_table->item(row, COLUMN_MIN)->setText(QString::number(data.Counter[PerfCounter::COUNTER_MIN]));
+    m_table->item(row, COLUMN_MAX)->setText(QString::number(data.Counter[PerfCounter::COUNTER_MAX]));
+
+    // a window without samples has no percentiles
+    if (data.Samples == 0) {
+        return;
+    }
+
+    History &history = m_history[data.Id];
+    history.time.append(m_clock.elapsed() / 1000.0);
+    history.percentile[0].append(data.Percentile[PerfCounter::PERCENTILE_P50]);
+    history.percentile[1].append(data.Percentile[PerfCounter::PERCENTILE_P99]);
+    history.percentile[2].append(data.Percentile[PerfCounter::PERCENTILE_P999]);
+    if (history.time.count() > HISTORY_LENGTH) {
+        history.time.remove(0);
+        for (int i = 0; i < 3; i++) {
+            history.percentile[i].remove(0);
+        }
+    }
+
+    int selected = m_table->currentRow();
+    if (selected >= 0 && selected == row) {
+        updatePlot();
+    }
+}
+
+void PerfCounterGadgetWidget::selectionChanged()
+{
+    updatePlot();
+}
+
+void PerfCounterGadgetWidget::updatePlot()
+{
+    quint32 id = m_rows.key(m_table->currentRow(), 0);
+    const History history = m_history.value(id);
+
+    for (int i = 0; i < 3; i++) {
+        m_curves[i]->setSamples(history.time, history.percentile[i]);
+    }
+    m_plot->setTitle(history.time.isEmpty() ? QString() : m_table->item(m_table->currentRow(), COLUMN_ID)->text());
+    m_plot->replot();
+}
+
+/**
+ * Start writing every EventTrace chunk received to a file, or stop
+ */
+void PerfCounterGadgetWidget::recordTrace(bool record)
+{
+    UAVObject *trace = m_objManager->getObject(EventTrace::NAME);
+
+    if (!record) {
+        if (m_traceWriter) {
+            disconnect(trace, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(traceUpdated(UAVObject *)));
+            m_traceWriter->close();
+            m_traceStatus->setText(tr("%1 events, %2 missing").arg(m_traceWriter->eventsWritten()).arg(m_traceWriter->eventsMissing()));
+            delete m_traceWriter;
+            m_traceWriter = 0;
+        }
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Save Event Trace"), QDir::homePath(),
+                                                    tr("Event trace %1").arg("(*.json)"));
+    if (!fileName.isEmpty() && !fileName.endsWith(".json")) {
+        fileName.append(".json");
+    }
+
+    m_traceWriter = new EventTraceWriter(m_objManager);
+    if (fileName.isEmpty() || !m_traceWriter->open(fileName)) {
+        if (!fileName.isEmpty()) {
+            QMessageBox::warning(this, tr("Save Event Trace"), tr("Could not open %1 for writing.").arg(fileName));
+        }
+        delete m_traceWriter;
+        m_traceWriter = 0;
+        m_traceButton->setChecked(false);
+        return;
+    }
+    m_traceStatus->setText(tr("Recording to %1").arg(fileName));
+    connect(trace, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(traceUpdated(UAVObject *)));
+}
+
+void PerfCounterGadgetWidget::traceUpdated(UAVObject *obj)
+{
+    EventTrace *trace = qobject_cast<EventTrace *>(obj);
+
+    if (trace && m_traceWriter) {
+        m_traceWriter->write(trace->getData());
+    }
+}
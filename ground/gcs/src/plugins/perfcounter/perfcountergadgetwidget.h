@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ *
+ * @file       perfcountergadgetwidget.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup PerfCounterGadgetPlugin Performance Counter Gadget Plugin
+ * @{
+ * @brief Live view of the flight performance counters
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PERFCOUNTERGADGETWIDGET_H_
+#define PERFCOUNTERGADGETWIDGET_H_
+
+#include "uavobject.h"
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QVector>
+#include <QWidget>
+
+class QLabel;
+class QPushButton;
+class QTableWidget;
+class EventTraceWriter;
+class QwtPlot;
+class QwtPlotCurve;
+class UAVObjectManager;
+
+/**
+ * Lists the performance counters of the flight side, one row per counter,
+ * and plots the P50, P99 and P99.9 of the selected one over time.
+ *
+ * The flight side starts a new histogram every time it updates PerfCounter,
+ * so while the widget is shown and the board is connected it switches the
+ * telemetry of PerfCounter to on change, to see every one of them.
+ *
+ * It also records the event trace to a Chrome trace file, for as long as the
+ * record button is down. What is traced and when is set in EventTraceSettings.
+ */
+class PerfCounterGadgetWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    PerfCounterGadgetWidget(QWidget *parent = 0);
+    ~PerfCounterGadgetWidget();
+
+private slots:
+    void onAutopilotConnect();
+    void onAutopilotDisconnect();
+    void newInstance(UAVObject *obj);
+    void counterUpdated(UAVObject *obj);
+    void selectionChanged();
+    void recordTrace(bool record);
+    void traceUpdated(UAVObject *obj);
+
+private:
+    static const int HISTORY_LENGTH = 600;
+
+    struct History {
+        QVector<double> time;
+        QVector<double> percentile[3];
+    };
+
+    void watch(UAVObject *obj);
+    void updatePlot();
+
+    UAVObjectManager *m_objManager;
+    UAVObject *m_counter;
+    UAVObject::Metadata m_initialMetadata;
+    bool m_metadataChanged;
+
+    QPushButton *m_traceButton;
+    QLabel *m_traceStatus;
+    EventTraceWriter *m_traceWriter;
+
+    QTableWidget *m_table;
+    QwtPlot *m_plot;
+    QwtPlotCurve *m_curves[3];
+
+    QElapsedTimer m_clock;
+    QMap<quint32, int> m_rows; // counter id to table row
+    QMap<quint32, History> m_history;
+};
+
+#endif /* PERFCOUNTERGADGETWIDGET_H_ */
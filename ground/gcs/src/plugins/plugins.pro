@@ -117,6 +117,14 @@ plugin_systemhealth.depends += plugin_uavobjects
 plugin_systemhealth.depends += plugin_uavtalk
 SUBDIRS += plugin_systemhealth
 
+# Performance counters gadget
+plugin_perfcounter.subdir = perfcounter
+plugin_perfcounter.depends = plugin_coreplugin
+plugin_perfcounter.depends += plugin_uavobjects
+plugin_perfcounter.depends += plugin_uavtalk
+plugin_perfcounter.depends += plugin_uavobjectutil
+SUBDIRS += plugin_perfcounter
+
 # Config gadget
 plugin_config.subdir = config
 plugin_config.depends = plugin_coreplugin
@@ -229,6 +237,7 @@ plugin_flightlog.subdir = flightlog
 plugin_flightlog.depends = plugin_coreplugin
 plugin_flightlog.depends += plugin_uavobjects
 plugin_flightlog.depends += plugin_uavtalk
+plugin_flightlog.depends += plugin_uavobjectutil
 SUBDIRS += plugin_flightlog
 
 # Usage Tracker plugin
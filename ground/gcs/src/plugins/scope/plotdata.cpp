@@ -30,12 +30,27 @@
 #include <math.h>
 #include <QDebug>
 
+// Initial capacity of the buffers of time based plots, they grow as needed
+#define INITIAL_BUFFER_CAPACITY 1024
+
+static void growIfFull(QContiguousCache<double> &buffer)
+{
+    if (buffer.isFull()) {
+        buffer.setCapacity(buffer.capacity() * 2);
+    }
+    if (!buffer.areIndexesValid()) {
+        buffer.normalizeIndexes();
+    }
+}
+
 PlotData::PlotData(UAVObject *object, UAVObjectField *field, int element,
                    int scaleOrderFactor, int meanSamples, QString mathFunction,
                    double plotDataSize, QPen pen, bool antialiased) :
     m_scalePower(scaleOrderFactor), m_meanSamples(meanSamples),
-    m_meanSum(0.0f), m_mathFunction(mathFunction), m_correctionSum(0.0f),
+    m_meanSum(0.0f), m_deviationSquareSum(0.0f), m_mathFunction(mathFunction), m_correctionSum(0.0f),
     m_correctionCount(0), m_plotDataSize(plotDataSize),
+    m_xDataEntries(INITIAL_BUFFER_CAPACITY), m_yDataEntries(INITIAL_BUFFER_CAPACITY),
+    m_yDataHistory(qMax(1, meanSamples)),
     m_object(object), m_field(field), m_element(element),
     m_plotCurve(NULL), m_isVisible(true), m_pen(pen), m_isEnumPlot(false)
 {
@@ -62,7 +77,8 @@ PlotData::PlotData(UAVObject *object, UAVObjectField *field, int element,
     }
 
     m_plotCurve->setPen(m_pen);
-    m_plotCurve->setSamples(m_xDataEntries, m_yDataEntries);
+    // The curve takes ownership of the series
+    m_plotCurve->setData(new PlotDataSeries(m_plotSamples, m_plotBounds));
     m_isEnumPlot = m_field->getType() == UAVObjectField::ENUM;
 }
 
@@ -88,18 +104,81 @@ void PlotData::setVisible(bool visible)
     visibilityChanged(m_plotCurve);
 }
 
-void PlotData::updatePlotData()
+double PlotData::xValue(int index) const
 {
-    m_plotCurve->setSamples(m_xDataEntries, m_yDataEntries);
+    if (plotType() == SequentialPlot) {
+        return index;
+    }
+    return m_xDataEntries.at(m_xDataEntries.firstIndex() + index);
+}
+
+/**
+ * Prepare the samples for the next replot. When there are more samples than pixels
+ * only the minimum and maximum of the samples falling on each pixel column are kept,
+ * which draws the same envelope at a fraction of the cost.
+ */
+void PlotData::updatePlotData(int pixelWidth)
+{
+    int count = m_yDataEntries.count();
+    int first = m_yDataEntries.firstIndex();
+
+    m_plotSamples.resize(0);
+    if (count == 0) {
+        m_plotBounds = QRectF(1.0, 1.0, -2.0, -2.0); // invalid
+        return;
+    }
+
+    double yMin = m_yDataEntries.at(first);
+    double yMax = yMin;
+
+    if (pixelWidth <= 0 || count <= 2 * pixelWidth) {
+        for (int i = 0; i < count; i++) {
+            double y = m_yDataEntries.at(first + i);
+            yMin = qMin(yMin, y);
+            yMax = qMax(yMax, y);
+            m_plotSamples.append(QPointF(xValue(i), y));
+        }
+    } else {
+        for (int column = 0; column < pixelWidth; column++) {
+            int begin  = (qint64)column * count / pixelWidth;
+            int end    = (qint64)(column + 1) * count / pixelWidth;
+            int minIdx = begin;
+            int maxIdx = begin;
+            for (int i = begin + 1; i < end; i++) {
+                double y = m_yDataEntries.at(first + i);
+                if (y < m_yDataEntries.at(first + minIdx)) {
+                    minIdx = i;
+                }
+                if (y > m_yDataEntries.at(first + maxIdx)) {
+                    maxIdx = i;
+                }
+            }
+            int lowIdx  = qMin(minIdx, maxIdx);
+            int highIdx = qMax(minIdx, maxIdx);
+            m_plotSamples.append(QPointF(xValue(lowIdx), m_yDataEntries.at(first + lowIdx)));
+            if (highIdx != lowIdx) {
+                m_plotSamples.append(QPointF(xValue(highIdx), m_yDataEntries.at(first + highIdx)));
+            }
+            yMin = qMin(yMin, m_yDataEntries.at(first + minIdx));
+            yMax = qMax(yMax, m_yDataEntries.at(first + maxIdx));
+        }
+    }
+
+    double xMin = xValue(0);
+    double xMax = xValue(count - 1);
+    m_plotBounds = QRectF(xMin, yMin, xMax - xMin, yMax - yMin);
 }
 
 void PlotData::clear()
 {
-    m_meanSum = 0.0f;
+    m_meanSum         = 0.0f;
+    m_deviationSquareSum = 0.0f;
     m_correctionSum   = 0.0f;
     m_correctionCount = 0;
     m_xDataEntries.clear();
     m_yDataEntries.clear();
+    m_yDataHistory.clear();
+    m_plotSamples.clear();
     while (!m_enumMarkerList.isEmpty()) {
         QwtPlotMarker *marker = m_enumMarkerList.takeFirst();
         marker->detach();
@@ -113,7 +192,7 @@ void PlotData::clear()
 bool PlotData::hasData() const
 {
     if (!m_isEnumPlot) {
-        return !m_xDataEntries.isEmpty();
+        return !m_yDataEntries.isEmpty();
     } else {
         return !m_enumMarkerList.isEmpty();
     }
@@ -122,7 +201,7 @@ bool PlotData::hasData() const
 QString PlotData::lastDataAsString()
 {
     if (!m_isEnumPlot) {
-        return QString().sprintf("%3.10g", m_yDataEntries.last());
+        return QString("%1").arg(m_yDataEntries.last(), 3, 'g', 10);
     } else {
         return m_enumMarkerList.last()->title().text();
     }
@@ -144,32 +223,52 @@ void PlotData::visibilityChanged(QwtPlotItem *item)
 
 void PlotData::calcMathFunction(double currentValue)
 {
-    // Put the new value at the back
+    int historySize = m_yDataHistory.count();
+    double lastAvg  = historySize > 0 ? m_meanSum / historySize : 0.0;
+    double oldest   = 0.0;
+    bool dropped    = m_yDataHistory.isFull();
+
+    // Drop the oldest value when the history is full, then put the new value at the back
+    if (dropped) {
+        oldest     = m_yDataHistory.takeFirst();
+        m_meanSum -= oldest;
+    }
     m_yDataHistory.append(currentValue);
 
     // calculate average value
     m_meanSum += currentValue;
-    if (m_yDataHistory.size() > m_meanSamples) {
-        m_meanSum -= m_yDataHistory.first();
-        m_yDataHistory.pop_front();
-    }
-    // make sure to correct the sum every meanSamples steps to prevent it
+
+    // make sure to correct the sums every meanSamples steps to prevent them
     // from running away due to floating point rounding errors
+    bool correct = false;
     m_correctionSum += currentValue;
     if (++m_correctionCount >= m_meanSamples) {
-        m_meanSum = m_correctionSum;
-        m_correctionSum = 0.0f;
+        m_meanSum         = m_correctionSum;
+        m_correctionSum   = 0.0f;
         m_correctionCount = 0;
+        correct = true;
     }
 
-    double boxcarAvg = m_meanSum / m_yDataHistory.size();
+    historySize = m_yDataHistory.count();
+    double boxcarAvg = m_meanSum / historySize;
     if (m_mathFunction == "Standard deviation") {
-        // Calculate square of sample standard deviation, with Bessel's correction
-        double stdSum = 0;
-        for (int i = 0; i < m_yDataHistory.size(); i++) {
-            stdSum += pow(m_yDataHistory.at(i) - boxcarAvg, 2) / (m_meanSamples - 1);
+        // Sum of the squared deviations from the average, updated with Welford's method.
+        // Unlike sum(x^2) - n * avg^2 it does not cancel out when the values are
+        // large compared to their spread, e.g. a barometric altitude
+        if (correct) {
+            m_deviationSquareSum = 0.0;
+            for (int i = m_yDataHistory.firstIndex(); i <= m_yDataHistory.lastIndex(); i++) {
+                double deviation = m_yDataHistory.at(i) - boxcarAvg;
+                m_deviationSquareSum += deviation * deviation;
+            }
+        } else if (dropped) {
+            m_deviationSquareSum += (currentValue - oldest) * (currentValue - boxcarAvg + oldest - lastAvg);
+        } else {
+            m_deviationSquareSum += (currentValue - lastAvg) * (currentValue - boxcarAvg);
         }
-        m_yDataEntries.append(sqrt(stdSum));
+        // Square of sample standard deviation, with Bessel's correction
+        double stdSum = m_deviationSquareSum / (m_meanSamples - 1);
+        m_yDataEntries.append(sqrt(qMax(stdSum, 0.0)));
     } else {
         m_yDataEntries.append(boxcarAvg);
     }
@@ -207,7 +306,7 @@ bool SequentialPlotData::append(UAVObject *obj)
 
     if (m_object == obj && m_field) {
         if (!m_isEnumPlot) {
-            double currentValue = m_field->getValue(m_element).toDouble() * pow(10, m_scalePower);
+            double currentValue = m_field->getDouble(m_element) * pow(10, m_scalePower);
 
             // Perform scope math, if necessary
             if (m_mathFunction == "Boxcar average" || m_mathFunction == "Standard deviation") {
@@ -216,13 +315,7 @@ bool SequentialPlotData::append(UAVObject *obj)
                 m_yDataEntries.append(currentValue);
             }
 
-            if (m_yDataEntries.size() > m_plotDataSize) {
-                // If new data overflows the window, remove old data...
-                m_yDataEntries.pop_front();
-            } else {
-                // ...otherwise, add a new y point at position xData
-                m_xDataEntries.insert(m_xDataEntries.size(), m_xDataEntries.size());
-            }
+            // A full buffer drops its oldest value, the x values are the sample indexes
             return true;
         } else {
             // Enum markers
@@ -256,7 +349,10 @@ bool ChronoPlotData::append(UAVObject *obj)
 
         double xValue = NOW.toTime_t() + NOW.time().msec() / 1000.0;
         if (!m_isEnumPlot) {
-            double currentValue = m_field->getValue(m_element).toDouble() * pow(10, m_scalePower);
+            double currentValue = m_field->getDouble(m_element) * pow(10, m_scalePower);
+
+            growIfFull(m_xDataEntries);
+            growIfFull(m_yDataEntries);
 
             // Perform scope math, if necessary
             if (m_mathFunction == "Boxcar average" || m_mathFunction == "Standard deviation") {
@@ -291,8 +387,8 @@ void ChronoPlotData::removeStaleData()
 {
     while (!m_xDataEntries.isEmpty() &&
            (m_xDataEntries.last() - m_xDataEntries.first()) > m_plotDataSize) {
-        m_yDataEntries.pop_front();
-        m_xDataEntries.pop_front();
+        m_yDataEntries.removeFirst();
+        m_xDataEntries.removeFirst();
     }
     while (!m_enumMarkerList.isEmpty() &&
            (m_enumMarkerList.last()->xValue() - m_enumMarkerList.first()->xValue()) > m_plotDataSize) {
@@ -35,11 +35,13 @@
 #include "qwt/src/qwt_plot_curve.h"
 #include "qwt/src/qwt_scale_draw.h"
 #include "qwt/src/qwt_scale_widget.h"
+#include "qwt/src/qwt_series_data.h"
 #include <qwt/src/qwt_plot_marker.h>
 
 #include <QTimer>
 #include <QTime>
 #include <QVector>
+#include <QContiguousCache>
 #include <uavdataobject.h>
 
 /*!
@@ -47,6 +49,32 @@
  */
 enum PlotType { SequentialPlot, ChronoPlot };
 
+/*!
+   \brief Hands the samples prepared by a PlotData to its curve without copying them.
+ */
+class PlotDataSeries : public QwtSeriesData<QPointF> {
+public:
+    PlotDataSeries(const QVector<QPointF> &samples, const QRectF &bounds)
+        : m_samples(samples), m_bounds(bounds) {}
+
+    size_t size() const
+    {
+        return m_samples.size();
+    }
+    QPointF sample(size_t i) const
+    {
+        return m_samples.at(i);
+    }
+    QRectF boundingRect() const
+    {
+        return m_bounds;
+    }
+
+private:
+    const QVector<QPointF> &m_samples;
+    const QRectF &m_bounds;
+};
+
 /*!
    \brief Base class that keeps the data for each curve in the plot.
  */
@@ -92,7 +120,7 @@ public:
     virtual PlotType plotType() const   = 0;
     virtual void removeStaleData() = 0;
 
-    void updatePlotData();
+    void updatePlotData(int pixelWidth);
     void clear();
 
     bool hasData() const;
@@ -108,14 +136,20 @@ protected:
     int m_scalePower;
     int m_meanSamples;
     double m_meanSum;
+    double m_deviationSquareSum;
     QString m_mathFunction;
     double m_correctionSum;
     int m_correctionCount;
     double m_plotDataSize;
 
-    QVector<double> m_xDataEntries;
-    QVector<double> m_yDataEntries;
-    QVector<double> m_yDataHistory;
+    // Ring buffers, x is only kept for chrono plots as sequential plots use the sample index
+    QContiguousCache<double> m_xDataEntries;
+    QContiguousCache<double> m_yDataEntries;
+    QContiguousCache<double> m_yDataHistory;
+
+    // Samples handed to the curve, decimated to the canvas width
+    QVector<QPointF> m_plotSamples;
+    QRectF m_plotBounds;
 
     UAVObject *m_object;
     UAVObjectField *m_field;
@@ -128,6 +162,7 @@ protected:
     QPen m_pen;
     bool m_isEnumPlot;
     virtual void calcMathFunction(double currentValue);
+    double xValue(int index) const;
     QwtPlotMarker *createMarker(QString value);
 };
 
@@ -142,7 +177,11 @@ public:
                        int scaleFactor, int meanSamples, QString mathFunction,
                        double plotDataSize, QPen pen, bool antialiased)
         : PlotData(object, field, element, scaleFactor, meanSamples,
-                   mathFunction, plotDataSize, pen, antialiased) {}
+                   mathFunction, plotDataSize, pen, antialiased)
+    {
+        // The window is a fixed number of samples, appending to a full buffer drops the oldest one
+        m_yDataEntries.setCapacity(qMax(1, (int)plotDataSize));
+    }
     ~SequentialPlotData() {}
 
     bool append(UAVObject *obj);
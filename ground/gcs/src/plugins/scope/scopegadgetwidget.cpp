@@ -432,7 +432,7 @@ void ScopeGadgetWidget::replotNewData()
     QMutexLocker locker(&m_mutex);
     foreach(PlotData * plotData, m_curvesData.values()) {
         plotData->removeStaleData();
-        plotData->updatePlotData();
+        plotData->updatePlotData(canvas()->width());
     }
 
     QDateTime NOW = QDateTime::currentDateTime();
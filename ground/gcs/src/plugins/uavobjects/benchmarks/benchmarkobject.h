@@ -0,0 +1,89 @@
+/**
+ ******************************************************************************
+ *
+ * @file       benchmarkobject.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      A data object for the benchmarks, laid out like a generated one
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef BENCHMARKOBJECT_H
+#define BENCHMARKOBJECT_H
+
+#include "uavdataobject.h"
+#include "uavobjectfield.h"
+
+#include <string.h>
+
+/**
+ * Stands in for a generated object, any ID and name. The fields are those of
+ * a typical sensor object: a float vector, a few integers and an enum.
+ */
+class BenchmarkObject : public UAVDataObject {
+public:
+    static const int NUM_FLOATS   = 16;
+    static const int NUM_INTEGERS = 4;
+    static const quint32 NUMBYTES = NUM_FLOATS * sizeof(float) + NUM_INTEGERS * sizeof(qint32) + sizeof(quint8);
+
+    typedef struct {
+        float   Float[NUM_FLOATS];
+        qint32  Integer[NUM_INTEGERS];
+        quint8  Status;
+    } __attribute__((packed)) DataFields;
+
+    BenchmarkObject(quint32 objId, const QString & name, bool isSingleInst = true) :
+        UAVDataObject(objId, isSingleInst, false, name)
+    {
+        QList<UAVObjectField *> fields;
+        fields.append(new UAVObjectField(QString("Float"), QString(), QString("m"), UAVObjectField::FLOAT32, NUM_FLOATS, QStringList()));
+        fields.append(new UAVObjectField(QString("Integer"), QString(), QString(), UAVObjectField::INT32, NUM_INTEGERS, QStringList()));
+        fields.append(new UAVObjectField(QString("Status"), QString(), QString(), UAVObjectField::ENUM, 1,
+                                         QStringList() << "Idle" << "Running" << "Error"));
+        memset(&data_, 0, sizeof(data_));
+        initializeFields(fields, (quint8 *)&data_, NUMBYTES);
+    }
+
+    Metadata getDefaultMetadata()
+    {
+        Metadata metadata;
+
+        memset(&metadata, 0, sizeof(metadata));
+        UAVObject::SetGcsAccess(metadata, ACCESS_READWRITE);
+        return metadata;
+    }
+
+    UAVDataObject *clone(quint32 instID)
+    {
+        BenchmarkObject *obj = new BenchmarkObject(getObjID(), getName(), isSingleInstance());
+
+        obj->initialize(instID, getMetaObject());
+        return obj;
+    }
+
+    UAVDataObject *dirtyClone()
+    {
+        return new BenchmarkObject(getObjID(), getName(), isSingleInstance());
+    }
+
+private:
+    DataFields data_;
+};
+
+#endif // BENCHMARKOBJECT_H
@@ -0,0 +1,34 @@
+# Common settings of the GCS micro benchmarks. Each benchmark is a QtTest
+# application built from the sources it measures. Build and run them all from
+# the top directory with "make gcs_benchmarks_run", or run one with e.g.
+#   ./lookup -iterations 1000
+QT       -= gui
+QT       += testlib
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+TEMPLATE  = app
+
+UAVOBJECTS_DIR = $$PWD/..
+UAVTALK_DIR    = $$PWD/../../uavtalk
+UTILS_DIR      = $$PWD/../../../libs/utils
+
+# the sources are built in, not linked from the GCS libraries
+DEFINES     += UAVOBJECTS_LIBRARY UAVTALK_LIBRARY QTCREATOR_UTILS_STATIC_LIB
+INCLUDEPATH += $$PWD $$UAVOBJECTS_DIR $$UAVTALK_DIR $$PWD/../../../libs
+
+# UAVObject and its manager, with a BenchmarkObject instead of the generated objects
+HEADERS += \
+    $$PWD/benchmarkobject.h \
+    $$UAVOBJECTS_DIR/uavobject.h \
+    $$UAVOBJECTS_DIR/uavmetaobject.h \
+    $$UAVOBJECTS_DIR/uavdataobject.h \
+    $$UAVOBJECTS_DIR/uavobjectfield.h \
+    $$UAVOBJECTS_DIR/uavobjectmanager.h
+
+SOURCES += \
+    $$UAVOBJECTS_DIR/uavobject.cpp \
+    $$UAVOBJECTS_DIR/uavmetaobject.cpp \
+    $$UAVOBJECTS_DIR/uavdataobject.cpp \
+    $$UAVOBJECTS_DIR/uavobjectfield.cpp \
+    $$UAVOBJECTS_DIR/uavobjectmanager.cpp \
+    $$UTILS_DIR/crc.cpp
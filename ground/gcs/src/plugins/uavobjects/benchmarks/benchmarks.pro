@@ -0,0 +1,6 @@
+TEMPLATE = subdirs
+
+SUBDIRS = lookup \
+    inputparse \
+    logindex \
+    fieldaccess
@@ -0,0 +1,5 @@
+TARGET = fieldaccess
+
+include(../benchmarks.pri)
+
+SOURCES += tst_fieldaccess.cpp
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_fieldaccess.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Benchmark of the UAVObjectField element accessors, as used by the scope
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "benchmarkobject.h"
+
+#include <QtCore/QObject>
+#include <QtTest/QtTest>
+
+class tst_FieldAccess : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void getValue();
+    void getDouble();
+    void getTyped();
+    void copyElements();
+    void getEnum();
+
+private:
+    BenchmarkObject *obj;
+    UAVObjectField *floatField;
+    UAVObjectField *enumField;
+    double expectedSum;
+};
+
+void tst_FieldAccess::initTestCase()
+{
+    obj = new BenchmarkObject(0x30000000, QString("BenchmarkObject"));
+    floatField = obj->getField("Float");
+    enumField  = obj->getField("Status");
+    QVERIFY(floatField != 0);
+    QVERIFY(enumField != 0);
+
+    expectedSum = 0;
+    for (int i = 0; i < BenchmarkObject::NUM_FLOATS; i++) {
+        floatField->setDouble(0.5 * i, i);
+        expectedSum += 0.5 * i;
+    }
+    enumField->setValue("Running");
+}
+
+void tst_FieldAccess::cleanupTestCase()
+{
+    delete obj;
+}
+
+// The way the scope read all elements before the typed accessors
+void tst_FieldAccess::getValue()
+{
+    double sum = 0;
+
+    QBENCHMARK {
+        sum = 0;
+        for (int i = 0; i < BenchmarkObject::NUM_FLOATS; i++) {
+            sum += floatField->getValue(i).toDouble();
+        }
+    }
+    QCOMPARE(sum, expectedSum);
+}
+
+void tst_FieldAccess::getDouble()
+{
+    double sum = 0;
+
+    QBENCHMARK {
+        sum = 0;
+        for (int i = 0; i < BenchmarkObject::NUM_FLOATS; i++) {
+            sum += floatField->getDouble(i);
+        }
+    }
+    QCOMPARE(sum, expectedSum);
+}
+
+void tst_FieldAccess::getTyped()
+{
+    double sum = 0;
+
+    QBENCHMARK {
+        sum = 0;
+        for (int i = 0; i < BenchmarkObject::NUM_FLOATS; i++) {
+            sum += floatField->get<float>(i);
+        }
+    }
+    QCOMPARE(sum, expectedSum);
+}
+
+void tst_FieldAccess::copyElements()
+{
+    double values[BenchmarkObject::NUM_FLOATS];
+    double sum = 0;
+
+    QBENCHMARK {
+        sum = 0;
+        quint32 count = floatField->copyElements(values, BenchmarkObject::NUM_FLOATS);
+        for (quint32 i = 0; i < count; i++) {
+            sum += values[i];
+        }
+    }
+    QCOMPARE(sum, expectedSum);
+}
+
+// Enum fields keep the text based path for getValue(), the option index is typed
+void tst_FieldAccess::getEnum()
+{
+    quint8 option = 0;
+
+    QBENCHMARK {
+        option = enumField->get<quint8>();
+    }
+    QCOMPARE(option, (quint8)1);
+    QCOMPARE(enumField->getValue().toString(), QString("Running"));
+}
+
+QTEST_MAIN(tst_FieldAccess)
+
+#include "tst_fieldaccess.moc"
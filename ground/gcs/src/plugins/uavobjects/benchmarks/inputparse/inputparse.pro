@@ -0,0 +1,14 @@
+TARGET = inputparse
+
+include(../benchmarks.pri)
+
+HEADERS += \
+    $$UAVTALK_DIR/uavtalk.h \
+    $$UAVTALK_DIR/uavtalkbus.h \
+    $$UTILS_DIR/logfile.h
+
+SOURCES += \
+    $$UAVTALK_DIR/uavtalk.cpp \
+    $$UAVTALK_DIR/uavtalkbus.cpp \
+    $$UTILS_DIR/logfile.cpp \
+    tst_inputparse.cpp
@@ -0,0 +1,297 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_inputparse.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Benchmark of the UAVTalk receive path, from a recorded stream to updated objects
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "benchmarkobject.h"
+#include "uavobjectmanager.h"
+#include "uavtalk.h"
+
+#include <utils/logfile.h>
+
+#include <QtCore/QObject>
+#include <QtCore/QBuffer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+
+#define OBJECT_TYPES 8
+#define PACKETS      2000
+// Every CORRUPT_EVERY-th packet of the recording has a bad checksum
+#define CORRUPT_EVERY 97
+
+/**
+ * A buffer that hands out at most chunkSize bytes per read, as a serial port
+ * signalling every byte does. Unbuffered, so that QIODevice does not read ahead.
+ */
+class ChunkedBuffer : public QBuffer {
+public:
+    ChunkedBuffer(QByteArray *data, qint64 chunkSize) : QBuffer(data), chunkSize(chunkSize)
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+    qint64 bytesAvailable() const
+    {
+        return chunkSize > 0 ? qMin(QBuffer::bytesAvailable(), chunkSize) : QBuffer::bytesAvailable();
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize)
+    {
+        return QBuffer::readData(data, chunkSize > 0 ? qMin(maxSize, chunkSize) : maxSize);
+    }
+
+private:
+    qint64 chunkSize;
+};
+
+/**
+ * Records the objects updated by the receiver, in order
+ */
+class UpdateRecorder : public QObject {
+    Q_OBJECT
+
+public:
+    QList<QByteArray> updates;
+
+public slots:
+    void objectUnpacked(UAVObject *obj)
+    {
+        QByteArray update(sizeof(quint32) + sizeof(quint32) + obj->getNumBytes(), 0);
+        quint32 objId  = obj->getObjID();
+        quint32 instId = obj->getInstID();
+
+        memcpy(update.data(), &objId, sizeof(objId));
+        memcpy(update.data() + sizeof(objId), &instId, sizeof(instId));
+        obj->pack((quint8 *)update.data() + sizeof(objId) + sizeof(instId));
+        updates.append(update);
+    }
+};
+
+class tst_InputParse : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void identicalUpdates();
+    void processInputStream_data();
+    void processInputStream();
+
+private:
+    bool record(const QString &fileName);
+    static QByteArray readRecording(const QString &fileName);
+    UAVTalk::ComStats parse(qint64 chunkSize, UpdateRecorder *recorder);
+
+    UAVObjectManager *objMngr;
+    QTemporaryDir dir;
+    QByteArray stream;
+};
+
+/**
+ * The stream is read from the .opl file given in the INPUTPARSE_OPL environment variable,
+ * a telemetry log recorded by the GCS. Without it, a log of the benchmark objects is recorded
+ * first. Updates are only compared for the benchmark objects, the statistics for all objects.
+ */
+void tst_InputParse::initTestCase()
+{
+    objMngr = new UAVObjectManager();
+
+    for (int i = 0; i < OBJECT_TYPES; i++) {
+        QVERIFY(objMngr->registerObject(new BenchmarkObject(0x20000000 + 2 * i, QString("BenchmarkObject%1").arg(i))));
+    }
+
+    QString fileName = QString::fromLocal8Bit(qgetenv("INPUTPARSE_OPL"));
+    if (fileName.isEmpty()) {
+        QVERIFY(dir.isValid());
+        fileName = dir.path() + "/inputparse.opl";
+        QVERIFY(record(fileName));
+    }
+    stream = readRecording(fileName);
+    QVERIFY(!stream.isEmpty());
+    qDebug() << "Parsing" << stream.size() << "bytes from" << fileName;
+}
+
+void tst_InputParse::cleanupTestCase()
+{
+    delete objMngr;
+}
+
+/**
+ * Record a telemetry log the way the GCS does, one packet per log entry:
+ * all object types in turn with changing data, a few packets with a bad
+ * checksum and some line noise between the packets.
+ */
+bool tst_InputParse::record(const QString &fileName)
+{
+    LogFile logFile;
+
+    logFile.setFileName(fileName);
+    if (!logFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    logFile.useProvidedTimeStamp(true);
+
+    QByteArray packet;
+    QBuffer buffer(&packet);
+    buffer.open(QIODevice::WriteOnly);
+    UAVTalk sender(&buffer, objMngr);
+
+    quint32 noise = 1;
+    for (int n = 0; n < PACKETS; n++) {
+        UAVObject *obj = objMngr->getObject(0x20000000 + 2 * (n % OBJECT_TYPES));
+        BenchmarkObject::DataFields data;
+        for (int i = 0; i < BenchmarkObject::NUM_FLOATS; i++) {
+            data.Float[i] = n + i * 0.5f;
+        }
+        for (int i = 0; i < BenchmarkObject::NUM_INTEGERS; i++) {
+            data.Integer[i] = n * i;
+        }
+        data.Status = n % 3;
+        obj->unpack((const quint8 *)&data);
+
+        packet.clear();
+        buffer.seek(0);
+        if (!sender.sendObject(obj, false, false)) {
+            return false;
+        }
+        if (n % CORRUPT_EVERY == 0) {
+            packet[packet.size() - 1] = (char)(packet.at(packet.size() - 1) ^ 0x55);
+        }
+        for (int i = 0; i < n % 5; i++) {
+            // anything, the sync byte included
+            noise = noise * 1103515245 + 12345;
+            packet.append((char)(noise >> 16));
+        }
+        logFile.setNextTimeStamp(n * 2);
+        logFile.write(packet);
+    }
+    logFile.close();
+
+    return true;
+}
+
+/**
+ * The telemetry stream of a log: the data of all its entries, without their timestamp and size
+ */
+QByteArray tst_InputParse::readRecording(const QString &fileName)
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    QByteArray data;
+    quint32 timeStamp;
+    qint64 dataSize;
+    while (file.read((char *)&timeStamp, sizeof(timeStamp)) == sizeof(timeStamp)
+           && file.read((char *)&dataSize, sizeof(dataSize)) == sizeof(dataSize)) {
+        if (dataSize < 0 || dataSize > file.bytesAvailable()) {
+            break;
+        }
+        data.append(file.read(dataSize));
+    }
+
+    return data;
+}
+
+/**
+ * Parse the whole stream, handed out chunkSize bytes at a time (all at once if 0)
+ */
+UAVTalk::ComStats tst_InputParse::parse(qint64 chunkSize, UpdateRecorder *recorder)
+{
+    QList< QList<UAVObject *> > objs = objMngr->getObjects();
+    foreach(QList<UAVObject *> instances, objs) {
+        connect(instances.first(), SIGNAL(objectUnpacked(UAVObject *)), recorder, SLOT(objectUnpacked(UAVObject *)));
+    }
+
+    ChunkedBuffer input(&stream, chunkSize);
+    UAVTalk receiver(&input, objMngr);
+    // the same slot the telemetry device's readyRead() is connected to
+    QMetaObject::invokeMethod(&receiver, "processInputStream", Qt::DirectConnection);
+
+    foreach(QList<UAVObject *> instances, objs) {
+        instances.first()->disconnect(recorder);
+    }
+
+    return receiver.getStats();
+}
+
+/**
+ * The bulk parser must update the same objects with the same data as the byte by byte parser
+ */
+void tst_InputParse::identicalUpdates()
+{
+    UpdateRecorder bulk;
+    UpdateRecorder bytewise;
+    UAVTalk::ComStats bulkStats     = parse(0, &bulk);
+    UAVTalk::ComStats bytewiseStats = parse(1, &bytewise);
+
+    QVERIFY(bulkStats.rxObjects > 0);
+    QCOMPARE(bulkStats.rxBytes, (quint32)stream.size());
+    QCOMPARE(bytewiseStats.rxBytes, bulkStats.rxBytes);
+    QCOMPARE(bytewiseStats.rxObjects, bulkStats.rxObjects);
+    QCOMPARE(bytewiseStats.rxObjectBytes, bulkStats.rxObjectBytes);
+    QCOMPARE(bytewiseStats.rxErrors, bulkStats.rxErrors);
+    QCOMPARE(bytewiseStats.rxSyncErrors, bulkStats.rxSyncErrors);
+    QCOMPARE(bytewiseStats.rxCrcErrors, bulkStats.rxCrcErrors);
+    QCOMPARE(bytewise.updates.size(), bulk.updates.size());
+    QVERIFY(bytewise.updates == bulk.updates);
+}
+
+void tst_InputParse::processInputStream_data()
+{
+    QTest::addColumn<qint64>("chunkSize");
+    QTest::newRow("bulk") << (qint64)0;
+    QTest::newRow("bytewise") << (qint64)1;
+}
+
+void tst_InputParse::processInputStream()
+{
+    QFETCH(qint64, chunkSize);
+
+    ChunkedBuffer input(&stream, chunkSize);
+    UAVTalk receiver(&input, objMngr);
+
+    qint64 bytes = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK {
+        input.seek(0);
+        QMetaObject::invokeMethod(&receiver, "processInputStream", Qt::DirectConnection);
+        bytes += stream.size();
+    }
+    qint64 elapsed = timer.nsecsElapsed();
+    QCOMPARE(input.bytesAvailable(), 0LL);
+
+    qDebug("%.1f MB/s", bytes * 1e3 / qMax(elapsed, (qint64)1));
+}
+
+QTEST_MAIN(tst_InputParse)
+
+#include "tst_inputparse.moc"
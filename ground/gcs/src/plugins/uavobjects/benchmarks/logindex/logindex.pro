@@ -0,0 +1,9 @@
+TARGET = logindex
+
+include(../benchmarks.pri)
+
+HEADERS += $$UTILS_DIR/logfile.h
+
+SOURCES += \
+    $$UTILS_DIR/logfile.cpp \
+    tst_logindex.cpp
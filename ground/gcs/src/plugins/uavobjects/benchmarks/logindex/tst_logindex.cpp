@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_logindex.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Benchmark of the .opl log replay: indexing, seeking and stepping
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <utils/logfile.h>
+
+#include <QtCore/QObject>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+
+// About ten minutes of telemetry at 500 packets/s
+#define PACKETS     300000
+#define PACKET_SIZE 60
+#define INTERVAL_MS 2
+
+class tst_LogIndex : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void buildIndex();
+    void loadCachedIndex();
+    void seekToTime();
+    void stepForward();
+    void fullReplay();
+
+private:
+    bool startReplay(LogFile *logFile);
+
+    QTemporaryDir dir;
+    QString logFileName;
+};
+
+void tst_LogIndex::initTestCase()
+{
+    QVERIFY(dir.isValid());
+    logFileName = dir.path() + "/benchmark.opl";
+
+    LogFile logFile;
+    logFile.setFileName(logFileName);
+    QVERIFY(logFile.open(QIODevice::WriteOnly));
+    logFile.useProvidedTimeStamp(true);
+
+    QByteArray packet(PACKET_SIZE, 0);
+    for (int n = 0; n < PACKETS; n++) {
+        packet[0] = 0x3c;
+        packet[1] = (char)n;
+        logFile.setNextTimeStamp(n * INTERVAL_MS);
+        logFile.write(packet);
+    }
+    logFile.close();
+
+    QCOMPARE(QFile(logFileName).size(), (qint64)PACKETS * (sizeof(quint32) + sizeof(qint64) + PACKET_SIZE));
+}
+
+bool tst_LogIndex::startReplay(LogFile *logFile)
+{
+    logFile->setFileName(logFileName);
+    if (!logFile->open(QIODevice::ReadOnly) || !logFile->startReplay()) {
+        return false;
+    }
+    // The replay is driven by hand from here on
+    logFile->pauseReplay();
+    return true;
+}
+
+void tst_LogIndex::buildIndex()
+{
+    LogFile logFile;
+
+    QBENCHMARK {
+        QFile::remove(logFileName + ".idx");
+        QVERIFY(startReplay(&logFile));
+        logFile.stopReplay();
+    }
+    QVERIFY(QFile::exists(logFileName + ".idx"));
+}
+
+void tst_LogIndex::loadCachedIndex()
+{
+    LogFile logFile;
+
+    QVERIFY(startReplay(&logFile));
+    QCOMPARE(logFile.replayEndTime(), (quint32)(PACKETS - 1) * INTERVAL_MS);
+    logFile.stopReplay();
+
+    QBENCHMARK {
+        QVERIFY(startReplay(&logFile));
+        logFile.stopReplay();
+    }
+}
+
+void tst_LogIndex::seekToTime()
+{
+    LogFile logFile;
+
+    QVERIFY(startReplay(&logFile));
+
+    quint32 time = 0;
+    QBENCHMARK {
+        // jump around the whole log
+        time = (time + 7919 * INTERVAL_MS) % (PACKETS * INTERVAL_MS);
+        logFile.seekToTime(time);
+    }
+    QCOMPARE(logFile.replayPosition(), time);
+
+    logFile.stopReplay();
+}
+
+void tst_LogIndex::stepForward()
+{
+    LogFile logFile;
+
+    QVERIFY(startReplay(&logFile));
+
+    QByteArray packet;
+    QBENCHMARK {
+        logFile.stepForward();
+        packet = logFile.read(logFile.bytesAvailable());
+        if (packet.isEmpty()) {
+            // at the end, start over
+            logFile.seekToTime(0);
+        }
+    }
+    logFile.seekToTime(0);
+    logFile.stepForward();
+    QCOMPARE(logFile.read(logFile.bytesAvailable()).size(), PACKET_SIZE);
+
+    logFile.stopReplay();
+}
+
+/**
+ * Replay the whole log packet by packet, as fast as it can be read
+ */
+void tst_LogIndex::fullReplay()
+{
+    LogFile logFile;
+
+    QVERIFY(startReplay(&logFile));
+
+    qint64 bytes = 0;
+    int packets  = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK {
+        logFile.seekToTime(0);
+        packets = 0;
+        forever {
+            logFile.stepForward();
+            qint64 size = logFile.read(logFile.bytesAvailable()).size();
+            if (size == 0) {
+                break;
+            }
+            bytes += size;
+            packets++;
+        }
+    }
+    qint64 elapsed = timer.nsecsElapsed();
+    QCOMPARE(packets, PACKETS);
+
+    qDebug("%.1f MB/s", bytes * 1e3 / qMax(elapsed, (qint64)1));
+
+    logFile.stopReplay();
+}
+
+QTEST_MAIN(tst_LogIndex)
+
+#include "tst_logindex.moc"
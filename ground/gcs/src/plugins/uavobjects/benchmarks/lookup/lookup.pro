@@ -0,0 +1,12 @@
+TARGET = lookup
+
+include(../benchmarks.pri)
+
+HEADERS += \
+    $$UAVTALK_DIR/uavtalk.h \
+    $$UAVTALK_DIR/uavtalkbus.h
+
+SOURCES += \
+    $$UAVTALK_DIR/uavtalk.cpp \
+    $$UAVTALK_DIR/uavtalkbus.cpp \
+    tst_lookup.cpp
@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_lookup.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Benchmark of the UAVObjectManager lookups done for every received packet,
+ *             alone and as part of the UAVTalk receive path
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "benchmarkobject.h"
+#include "uavobjectmanager.h"
+#include "uavtalk.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QBuffer>
+#include <QtCore/QElapsedTimer>
+#include <QtTest/QtTest>
+
+// About as many object types as the GCS registers
+#define OBJECT_TYPES 130
+#define INSTANCES    32
+// Packets in the stream of the receive benchmark
+#define PACKETS      4000
+
+class tst_Lookup : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void getObjectById_data();
+    void getObjectById();
+    void getObjectByName_data();
+    void getObjectByName();
+    void getInstance();
+    void getNumInstances();
+    void receiveObjects();
+
+private:
+    static quint32 objectId(int index)
+    {
+        // data object IDs are even, their metaobject has the next ID
+        return 0x10000000 + 2 * index;
+    }
+
+    static QString objectName(int index)
+    {
+        return QString("BenchmarkObject%1").arg(index);
+    }
+
+    void addTypes();
+    QByteArray makeStream();
+
+    UAVObjectManager *objMngr;
+};
+
+void tst_Lookup::initTestCase()
+{
+    objMngr = new UAVObjectManager();
+
+    for (int i = 0; i < OBJECT_TYPES; i++) {
+        QVERIFY(objMngr->registerObject(new BenchmarkObject(objectId(i), objectName(i), i != OBJECT_TYPES - 1)));
+    }
+    // The last type has many instances, like the waypoints
+    for (int inst = 1; inst < INSTANCES; inst++) {
+        QVERIFY(objMngr->registerObject(new BenchmarkObject(objectId(OBJECT_TYPES - 1), objectName(OBJECT_TYPES - 1), false)));
+    }
+    QCOMPARE(objMngr->getNumInstances(objectId(OBJECT_TYPES - 1)), INSTANCES);
+}
+
+void tst_Lookup::cleanupTestCase()
+{
+    delete objMngr;
+}
+
+void tst_Lookup::addTypes()
+{
+    QTest::addColumn<int>("index");
+    QTest::newRow("first") << 0;
+    QTest::newRow("middle") << OBJECT_TYPES / 2;
+    QTest::newRow("last") << OBJECT_TYPES - 1;
+}
+
+void tst_Lookup::getObjectById_data()
+{
+    addTypes();
+}
+
+void tst_Lookup::getObjectById()
+{
+    QFETCH(int, index);
+    const quint32 objId = objectId(index);
+    UAVObject *obj = 0;
+
+    QBENCHMARK {
+        obj = objMngr->getObject(objId);
+    }
+    QVERIFY(obj != 0);
+    QCOMPARE(obj->getObjID(), objId);
+}
+
+void tst_Lookup::getObjectByName_data()
+{
+    addTypes();
+}
+
+void tst_Lookup::getObjectByName()
+{
+    QFETCH(int, index);
+    const QString name = objectName(index);
+    UAVObject *obj = 0;
+
+    QBENCHMARK {
+        obj = objMngr->getObject(name);
+    }
+    QVERIFY(obj != 0);
+    QCOMPARE(obj->getName(), name);
+}
+
+void tst_Lookup::getInstance()
+{
+    const quint32 objId = objectId(OBJECT_TYPES - 1);
+    UAVObject *obj = 0;
+
+    QBENCHMARK {
+        obj = objMngr->getObject(objId, INSTANCES - 1);
+    }
+    QVERIFY(obj != 0);
+    QCOMPARE(obj->getInstID(), (quint32)INSTANCES - 1);
+}
+
+void tst_Lookup::getNumInstances()
+{
+    const quint32 objId = objectId(OBJECT_TYPES - 1);
+    qint32 count = 0;
+
+    QBENCHMARK {
+        count = objMngr->getNumInstances(objId);
+    }
+    QCOMPARE(count, INSTANCES);
+}
+
+/**
+ * Packets of all object types and instances in turn, so that each packet
+ * received needs a lookup of a different object.
+ */
+QByteArray tst_Lookup::makeStream()
+{
+    QByteArray stream;
+    QBuffer buffer(&stream);
+
+    buffer.open(QIODevice::WriteOnly);
+
+    UAVTalk sender(&buffer, objMngr);
+    const int objects = OBJECT_TYPES - 1 + INSTANCES;
+    for (int n = 0; n < PACKETS; n++) {
+        int index = n % objects;
+        UAVObject *obj;
+        if (index < OBJECT_TYPES - 1) {
+            obj = objMngr->getObject(objectId(index));
+        } else {
+            obj = objMngr->getObject(objectId(OBJECT_TYPES - 1), index - (OBJECT_TYPES - 1));
+        }
+        if (!obj || !sender.sendObject(obj, false, false)) {
+            return QByteArray();
+        }
+    }
+
+    return stream;
+}
+
+/**
+ * Objects received per second through UAVTalk::processInputStream(), end to end:
+ * parsing, object lookup and unpacking into the object.
+ */
+void tst_Lookup::receiveObjects()
+{
+    QByteArray stream = makeStream();
+
+    QVERIFY(!stream.isEmpty());
+
+    QBuffer input(&stream);
+    input.open(QIODevice::ReadOnly);
+    UAVTalk receiver(&input, objMngr);
+
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK {
+        input.seek(0);
+        // the same slot the telemetry device's readyRead() is connected to
+        QMetaObject::invokeMethod(&receiver, "processInputStream", Qt::DirectConnection);
+    }
+    qint64 elapsed = timer.nsecsElapsed();
+
+    UAVTalk::ComStats stats = receiver.getStats();
+    QCOMPARE(stats.rxObjects % PACKETS, 0u);
+    QVERIFY(stats.rxObjects > 0);
+    QCOMPARE(stats.rxErrors, 0u);
+    qDebug("%u objects of %d types received, %.0f objects/s", stats.rxObjects, OBJECT_TYPES,
+           stats.rxObjects * 1e9 / qMax(elapsed, (qint64)1));
+}
+
+QTEST_MAIN(tst_Lookup)
+
+#include "tst_lookup.moc"
@@ -33,6 +33,7 @@
 #include <QXmlStreamReader>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QVector>
 
 UAVObjectField::UAVObjectField(const QString & name, const QString & description, const QString & units, FieldType type, quint32 numElements, const QStringList & options, const QString &limits)
 {
@@ -700,8 +701,16 @@ QString UAVObjectField::toString()
     QString sout;
 
     sout.append(QString("%1: [ ").arg(name));
-    for (unsigned int n = 0; n < numElements; ++n) {
-        sout.append(QString("%1 ").arg(getDouble(n)));
+    if (isNumeric()) {
+        QVector<double> values(numElements);
+        copyElements(values.data(), numElements);
+        foreach(double value, values) {
+            sout.append(QString("%1 ").arg(value));
+        }
+    } else {
+        for (unsigned int n = 0; n < numElements; ++n) {
+            sout.append(QString("%1 ").arg(getDouble(n)));
+        }
     }
     sout.append(QString("] %1\n").arg(units));
     return sout;
@@ -1184,10 +1193,33 @@ void UAVObjectField::setValue(const QVariant & value, quint32 index)
 
 double UAVObjectField::getDouble(quint32 index)
 {
-    return getValue(index).toDouble();
+    // Enum and string values convert from their text representation
+    if (type == ENUM || type == STRING) {
+        return getValue(index).toDouble();
+    }
+    return get<double>(index);
 }
 
 void UAVObjectField::setDouble(double value, quint32 index)
 {
     setValue(QVariant(value), index);
 }
+
+/**
+ * Copy the field elements as doubles, taking the object mutex once for all of them.
+ * Enum fields are copied as option indexes.
+ * \param dataOut Destination buffer
+ * \param maxElements Size of the destination buffer
+ * \return The number of elements copied
+ */
+quint32 UAVObjectField::copyElements(double *dataOut, quint32 maxElements)
+{
+    QMutexLocker locker(obj->getMutex());
+
+    quint32 count = qMin(numElements, maxElements);
+
+    for (quint32 index = 0; index < count; ++index) {
+        dataOut[index] = readElement<double>(index);
+    }
+    return count;
+}
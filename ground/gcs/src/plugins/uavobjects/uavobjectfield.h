@@ -35,6 +35,7 @@
 #include <QVariant>
 #include <QList>
 #include <QMap>
+#include <QMutexLocker>
 
 class UAVObject;
 
@@ -73,6 +74,9 @@ public:
     void setValue(const QVariant & data, quint32 index = 0);
     double getDouble(quint32 index = 0);
     void setDouble(double value, quint32 index = 0);
+    template<typename T>
+    T get(quint32 index = 0);
+    quint32 copyElements(double *dataOut, quint32 maxElements);
     quint32 getDataOffset();
     quint32 getNumBytes();
     bool isNumeric();
@@ -109,6 +113,80 @@ protected:
     void clear();
     void constructorInitialize(const QString & name, const QString & description, const QString & units, FieldType type, const QStringList & elementNames, const QStringList & options, const QString &limits);
     void limitsInitialize(const QString &limits);
+    template<typename T>
+    T readElement(quint32 index);
 };
 
+/**
+ * Get the value of one element converted to T, without going through QVariant.
+ * Enum fields return the option index, string fields the character at index.
+ * \param index The element index
+ * \return The element value or T() if the index is out of bounds
+ */
+template<typename T>
+T UAVObjectField::get(quint32 index)
+{
+    QMutexLocker locker(obj->getMutex());
+
+    return readElement<T>(index);
+}
+
+/**
+ * Read one element from the object data, the caller must hold the object mutex.
+ */
+template<typename T>
+T UAVObjectField::readElement(quint32 index)
+{
+    if (index >= numElements) {
+        return T();
+    }
+    const quint8 *element = &data[offset + numBytesPerElement * index];
+    switch (type) {
+    case INT8:
+    {
+        qint8 tmpint8;
+        memcpy(&tmpint8, element, sizeof(tmpint8));
+        return static_cast<T>(tmpint8);
+    }
+    case INT16:
+    {
+        qint16 tmpint16;
+        memcpy(&tmpint16, element, sizeof(tmpint16));
+        return static_cast<T>(tmpint16);
+    }
+    case INT32:
+    {
+        qint32 tmpint32;
+        memcpy(&tmpint32, element, sizeof(tmpint32));
+        return static_cast<T>(tmpint32);
+    }
+    case FLOAT32:
+    {
+        float tmpfloat;
+        memcpy(&tmpfloat, element, sizeof(tmpfloat));
+        return static_cast<T>(tmpfloat);
+    }
+    case UINT8:
+    case ENUM:
+    case STRING:
+        return static_cast<T>(*element);
+
+    case UINT16:
+    {
+        quint16 tmpuint16;
+        memcpy(&tmpuint16, element, sizeof(tmpuint16));
+        return static_cast<T>(tmpuint16);
+    }
+    case UINT32:
+    {
+        quint32 tmpuint32;
+        memcpy(&tmpuint32, element, sizeof(tmpuint32));
+        return static_cast<T>(tmpuint32);
+    }
+    case BITFIELD:
+        return static_cast<T>((data[offset + numBytesPerElement * (index / 8)] >> (index % 8)) & 1);
+    }
+    return T();
+}
+
 #endif // UAVOBJECTFIELD_H
@@ -67,6 +67,8 @@ UAVOBJS = \
     $${UAVOBJ_XML_DIR}/debuglogstatus.xml \
     $${UAVOBJ_XML_DIR}/ekfconfiguration.xml \
     $${UAVOBJ_XML_DIR}/ekfstatevariance.xml \
+    $${UAVOBJ_XML_DIR}/eventtrace.xml \
+    $${UAVOBJ_XML_DIR}/eventtracesettings.xml \
     $${UAVOBJ_XML_DIR}/faultsettings.xml \
     $${UAVOBJ_XML_DIR}/firmwareiapobj.xml \
     $${UAVOBJ_XML_DIR}/fixedwingpathfollowersettings.xml \
@@ -120,6 +122,7 @@ UAVOBJS = \
     $${UAVOBJ_XML_DIR}/poilocation.xml \
     $${UAVOBJ_XML_DIR}/positionstate.xml \
     $${UAVOBJ_XML_DIR}/optipositionstate.xml\
+    $${UAVOBJ_XML_DIR}/mavlinkbridgestatus.xml \
     $${UAVOBJ_XML_DIR}/optivelocitystate.xml\
     $${UAVOBJ_XML_DIR}/optisetpoint.xml\
     $${UAVOBJ_XML_DIR}/optisetpointsettings.xml\
@@ -0,0 +1,303 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracewriter.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup UAVObjectUtilPlugin
+ * @{
+ * @brief Converts the flight event trace to Chrome trace JSON.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "eventtracewriter.h"
+
+#include <QObject>
+
+// Rows of the trace, tasks use their task number
+#define CALLBACK_ROWS  100 // plus the task number of the callback scheduler task
+#define ISR_ROW        200
+#define PROCESS_ID     1
+
+static QString jsonString(const QString &string)
+{
+    QString escaped = string;
+
+    escaped.replace("\\", "\\\\").replace("\"", "\\\"");
+    return QString("\"%1\"").arg(escaped);
+}
+
+static QStringList fieldElementNames(UAVObjectManager *objectManager, const QString &objectName, const QString &fieldName)
+{
+    UAVObject *object = objectManager->getObject(objectName);
+    UAVObjectField *field = object ? object->getField(fieldName) : 0;
+
+    return field ? field->getElementNames() : QStringList();
+}
+
+EventTraceWriter::EventTraceWriter(UAVObjectManager *objectManager) :
+    m_objectManager(objectManager), m_firstRecord(true), m_started(false), m_synced(false),
+    m_nextSequence(0), m_lastRaw(0), m_ticks(0), m_time(0), m_task(-1), m_taskStart(0), m_isrDepth(0),
+    m_written(0), m_missing(0)
+{
+    // the flight side numbers tasks and callbacks after the elements of these
+    m_taskNames     = fieldElementNames(objectManager, "TaskInfo", "Running");
+    m_callbackNames = fieldElementNames(objectManager, "CallbackInfo", "Running");
+    m_alarmNames    = fieldElementNames(objectManager, "SystemAlarms", "Alarm");
+}
+
+EventTraceWriter::~EventTraceWriter()
+{
+    close();
+}
+
+bool EventTraceWriter::open(const QString &fileName)
+{
+    close();
+
+    m_file.setFileName(fileName);
+    if (!m_file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+    m_stream.setDevice(&m_file);
+    m_stream << "{\"traceEvents\":[\n";
+
+    m_firstRecord = true;
+    m_namedThreads.clear();
+    m_started = false;
+    m_synced  = false;
+    m_ticks   = 0;
+    m_time    = 0;
+    m_task    = -1;
+    m_openCallbacks.clear();
+    m_isrDepth = 0;
+    m_written  = 0;
+    m_missing  = 0;
+
+    writeRecord(QString("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%1,\"args\":{\"name\":\"Flight\"}}").arg(PROCESS_ID));
+    return true;
+}
+
+void EventTraceWriter::close()
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+    endOpenSpans(QString());
+    m_stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    m_stream.flush();
+    m_stream.setDevice(0);
+    m_file.close();
+}
+
+/**
+ * Add a chunk. Chunks must come in the order they were sent, a chunk that is
+ * missing or events the flight side lost show up as a gap in the trace.
+ */
+void EventTraceWriter::write(const EventTrace::DataFields &chunk)
+{
+    if (!m_file.isOpen() || chunk.Count > EventTrace::TIME_NUMELEM || chunk.TicksPerUs <= 0) {
+        return;
+    }
+
+    if (m_started) {
+        if (chunk.Sequence == m_nextSequence) {
+            // the same chunk sent twice, one it overwrote before being sent shows up as missing events
+            return;
+        }
+        // the sequence counts lost events too, anything between the chunks did not make it here
+        qint32 gap = (qint32)(chunk.Sequence - m_nextSequence - chunk.Count);
+        if (gap < 0) {
+            // the trace was started again, the time starts over from this chunk
+            endOpenSpans(QObject::tr("Trace restarted"));
+            m_synced = false;
+        } else if (gap > 0) {
+            endOpenSpans(QObject::tr("%1 events missing").arg(gap));
+            m_missing += gap;
+        }
+    }
+    m_started = true;
+    m_nextSequence = chunk.Sequence;
+
+    for (int i = 0; i < chunk.Count; i++) {
+        writeEvent(chunk, i);
+    }
+}
+
+void EventTraceWriter::writeEvent(const EventTrace::DataFields &chunk, int index)
+{
+    quint32 raw = chunk.Time[index];
+
+    if (!m_synced) {
+        m_lastRaw = raw;
+        m_synced  = true;
+    }
+    // events from interrupts may be a few ticks older than the one before them
+    m_ticks  += (qint32)(raw - m_lastRaw);
+    m_lastRaw = raw;
+    m_time    = m_ticks / chunk.TicksPerUs;
+    m_written++;
+
+    quint32 id = chunk.Id[index];
+    switch (chunk.Type[index]) {
+    case EventTrace::TYPE_TASKSWITCH:
+        if (m_task >= 0) {
+            writeSpan(taskName(m_task), m_task, m_taskStart, m_time);
+        }
+        m_task = id;
+        m_taskStart = m_time;
+        break;
+
+    case EventTrace::TYPE_CALLBACKSTART:
+    {
+        int row = CALLBACK_ROWS + qMax(m_task, 0);
+        nameThread(row, QObject::tr("Callbacks in %1").arg(taskName(qMax(m_task, 0))));
+        m_openCallbacks.insert(id, row);
+        writeBeginEnd('B', elementName(m_callbackNames, id), row, m_time);
+        break;
+    }
+
+    case EventTrace::TYPE_CALLBACKEND:
+        // callbacks that started before the trace have no beginning
+        if (m_openCallbacks.contains(id)) {
+            writeBeginEnd('E', elementName(m_callbackNames, id), m_openCallbacks.take(id), m_time);
+        }
+        break;
+
+    case EventTrace::TYPE_OBJECTSEND:
+    case EventTrace::TYPE_OBJECTRECEIVE:
+        writeInstant(QString("%1 %2").arg(chunk.Type[index] == EventTrace::TYPE_OBJECTSEND ? QObject::tr("Send") : QObject::tr("Receive"),
+                                          objectName(id)),
+                     't', qMax(m_task, 0), m_time, QString("{\"event\":%1}").arg(chunk.Aux[index]));
+        break;
+
+    case EventTrace::TYPE_ISRENTER:
+        nameThread(ISR_ROW, QObject::tr("Interrupts"));
+        writeBeginEnd('B', QString("IRQ %1").arg((qint32)id), ISR_ROW, m_time);
+        m_isrDepth++;
+        break;
+
+    case EventTrace::TYPE_ISREXIT:
+        if (m_isrDepth > 0) {
+            writeBeginEnd('E', QString("IRQ %1").arg((qint32)id), ISR_ROW, m_time);
+            m_isrDepth--;
+        }
+        break;
+
+    case EventTrace::TYPE_TRIGGER:
+        writeInstant(QObject::tr("Trigger: %1").arg(elementName(m_alarmNames, id)), 'g', 0, m_time);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * Ends what still runs at the last event, the trace does not know when it
+ * ended. Marks why, if there is a reason.
+ */
+void EventTraceWriter::endOpenSpans(const QString &why)
+{
+    if (m_task >= 0) {
+        writeSpan(taskName(m_task), m_task, m_taskStart, m_time);
+        m_task = -1;
+    }
+    QHash<quint32, int>::const_iterator i;
+    for (i = m_openCallbacks.constBegin(); i != m_openCallbacks.constEnd(); ++i) {
+        writeBeginEnd('E', elementName(m_callbackNames, i.key()), i.value(), m_time);
+    }
+    m_openCallbacks.clear();
+    for (; m_isrDepth > 0; m_isrDepth--) {
+        writeBeginEnd('E', QString(), ISR_ROW, m_time);
+    }
+    if (!why.isEmpty() && m_started) {
+        writeInstant(why, 'g', 0, m_time);
+    }
+}
+
+void EventTraceWriter::writeSpan(const QString &name, int tid, double start, double end)
+{
+    nameThread(tid, taskName(tid));
+    writeRecord(QString("{\"name\":%1,\"ph\":\"X\",\"ts\":%2,\"dur\":%3,\"pid\":%4,\"tid\":%5}")
+                .arg(jsonString(name)).arg(start, 0, 'f', 3).arg(end - start, 0, 'f', 3).arg(PROCESS_ID).arg(tid));
+}
+
+void EventTraceWriter::writeBeginEnd(char phase, const QString &name, int tid, double time)
+{
+    writeRecord(QString("{\"name\":%1,\"ph\":\"%2\",\"ts\":%3,\"pid\":%4,\"tid\":%5}")
+                .arg(jsonString(name)).arg(phase).arg(time, 0, 'f', 3).arg(PROCESS_ID).arg(tid));
+}
+
+void EventTraceWriter::writeInstant(const QString &name, char scope, int tid, double time, const QString &args)
+{
+    writeRecord(QString("{\"name\":%1,\"ph\":\"i\",\"s\":\"%2\",\"ts\":%3,\"pid\":%4,\"tid\":%5%6}")
+                .arg(jsonString(name)).arg(scope).arg(time, 0, 'f', 3).arg(PROCESS_ID).arg(tid)
+                .arg(args.isEmpty() ? QString() : QString(",\"args\":%1").arg(args)));
+}
+
+void EventTraceWriter::writeRecord(const QString &record)
+{
+    if (!m_firstRecord) {
+        m_stream << ",\n";
+    }
+    m_firstRecord = false;
+    m_stream << record;
+}
+
+void EventTraceWriter::nameThread(int tid, const QString &name)
+{
+    if (m_namedThreads.contains(tid)) {
+        return;
+    }
+    m_namedThreads.insert(tid);
+    writeRecord(QString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%1,\"tid\":%2,\"args\":{\"name\":%3}}")
+                .arg(PROCESS_ID).arg(tid).arg(jsonString(name)));
+    writeRecord(QString("{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%1,\"tid\":%2,\"args\":{\"sort_index\":%2}}")
+                .arg(PROCESS_ID).arg(tid));
+}
+
+/**
+ * Task numbers are the TaskInfo element plus one, 0 is any task without one
+ * (idle, timer and the ones the task monitor does not know)
+ */
+QString EventTraceWriter::taskName(quint32 taskNumber) const
+{
+    if (taskNumber == 0) {
+        return QObject::tr("Other tasks");
+    }
+    return elementName(m_taskNames, taskNumber - 1);
+}
+
+QString EventTraceWriter::elementName(const QStringList &names, quint32 index) const
+{
+    if (index < (quint32)names.count()) {
+        return names.at(index);
+    }
+    if (index == 0xffffffff) {
+        return QObject::tr("Unnamed");
+    }
+    return QString::number(index);
+}
+
+QString EventTraceWriter::objectName(quint32 objId) const
+{
+    UAVObject *object = objId ? m_objectManager->getObject(objId) : 0;
+
+    return object ? object->getName() : QString("0x%1").arg(objId, 8, 16, QChar('0'));
+}
@@ -0,0 +1,112 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracewriter.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup [Group]
+ * @{
+ * @addtogroup UAVObjectUtilPlugin
+ * @{
+ * @brief Converts the flight event trace to Chrome trace JSON.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACEWRITER_H
+#define EVENTTRACEWRITER_H
+
+#include <QFile>
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+#include <QTextStream>
+
+#include "uavobjectutil_global.h"
+#include "uavobjectmanager.h"
+#include "eventtrace.h"
+
+/**
+ * Writes the chunks of EventTrace, as received over telemetry or read back
+ * from the flight log, to a file that chrome://tracing and similar viewers
+ * load. There is one row per task, one row for the callbacks run by each
+ * callback scheduler task and one row for interrupts. Object events and
+ * triggers are instant events, and so are the places where events are
+ * missing because the flight side or the link could not keep up.
+ *
+ * Task, callback, object and alarm names are looked up in the object
+ * manager, so it must hold the objects of the firmware the trace comes from.
+ */
+class UAVOBJECTUTIL_EXPORT EventTraceWriter {
+public:
+    explicit EventTraceWriter(UAVObjectManager *objectManager);
+    ~EventTraceWriter();
+
+    bool open(const QString &fileName);
+    void write(const EventTrace::DataFields &chunk);
+    void close();
+
+    quint32 eventsWritten() const
+    {
+        return m_written;
+    }
+    quint32 eventsMissing() const
+    {
+        return m_missing;
+    }
+
+private:
+    void writeEvent(const EventTrace::DataFields &chunk, int index);
+    void endOpenSpans(const QString &why);
+
+    void writeSpan(const QString &name, int tid, double start, double end);
+    void writeBeginEnd(char phase, const QString &name, int tid, double time);
+    void writeInstant(const QString &name, char scope, int tid, double time, const QString &args = QString());
+    void writeRecord(const QString &record);
+    void nameThread(int tid, const QString &name);
+
+    QString taskName(quint32 taskNumber) const;
+    QString elementName(const QStringList &names, quint32 index) const;
+    QString objectName(quint32 objId) const;
+
+    UAVObjectManager *m_objectManager;
+    QStringList m_taskNames;
+    QStringList m_callbackNames;
+    QStringList m_alarmNames;
+
+    QFile m_file;
+    QTextStream m_stream;
+    bool m_firstRecord;
+    QSet<int> m_namedThreads;
+
+    // where the trace is at
+    bool m_started;
+    bool m_synced;
+    quint32 m_nextSequence;
+    quint32 m_lastRaw;
+    qint64 m_ticks; // since the first event, the raw time wraps around
+    double m_time;
+
+    // what runs at m_time
+    int m_task;
+    double m_taskStart;
+    QHash<quint32, int> m_openCallbacks; // callback to row, for the ones that did not end yet
+    int m_isrDepth;
+
+    quint32 m_written;
+    quint32 m_missing;
+};
+
+#endif // EVENTTRACEWRITER_H
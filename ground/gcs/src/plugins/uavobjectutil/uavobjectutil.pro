@@ -11,11 +11,13 @@ HEADERS += \
     uavobjectutilmanager.h \
     uavobjectutilplugin.h \
     devicedescriptorstruct.h \
-    uavobjecthelper.h
+    uavobjecthelper.h \
+    eventtracewriter.h
 
 SOURCES += \
     uavobjectutilmanager.cpp \
     uavobjectutilplugin.cpp \
-    uavobjecthelper.cpp
+    uavobjecthelper.cpp \
+    eventtracewriter.cpp
 
 OTHER_FILES += UAVObjectUtil.pluginspec
@@ -32,11 +32,15 @@
 #include <extensionsystem/pluginmanager.h>
 #include <coreplugin/icore.h>
 #include <coreplugin/threadmanager.h>
+#include <coreplugin/generalsettings.h>
 
 TelemetryManager::TelemetryManager() : QObject(), m_connectionState(TELEMETRY_DISCONNECTED)
 {
     moveToThread(Core::ICore::instance()->threadManager()->getRealTimeThread());
 
+    // Created after the move so that it lives in the telemetry thread too
+    m_bus = new UAVTalkBus(this);
+
     // Get UAVObjectManager instance
     ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
     m_uavobjectManager = pm->getObject<UAVObjectManager>();
@@ -59,6 +63,11 @@ TelemetryManager::ConnectionState TelemetryManager::connectionState() const
     return m_connectionState;
 }
 
+UAVTalkBus *TelemetryManager::bus() const
+{
+    return m_bus;
+}
+
 void TelemetryManager::start(QIODevice *dev)
 {
     m_connectionState = TELEMETRY_CONNECTING;
@@ -77,6 +86,13 @@ void TelemetryManager::start(QIODevice *dev)
 void TelemetryManager::onStart()
 {
     m_uavTalk = new UAVTalk(m_telemetryDevice, m_uavobjectManager);
+
+    // Share the telemetry with tools outside of the GCS if enabled
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+    Core::Internal::GeneralSettings *settings = pm->getObject<Core::Internal::GeneralSettings>();
+    m_bus->setShared(settings->shareTelemetry());
+    m_uavTalk->setBus(m_bus);
+
     if (false) {
         // UAVTalk must be thread safe and for that:
         // 1- all public methods must lock a mutex
@@ -99,7 +115,15 @@ void TelemetryManager::onStart()
     }
 
     m_telemetry = new Telemetry(m_uavTalk, m_uavobjectManager);
-    m_telemetryMonitor = new TelemetryMonitor(m_uavobjectManager, m_telemetry);
+    // Let the autopilot stream the settings instead of requesting them one by one, whatever the link:
+    // the OPLink USB HID device forwards a radio link just like a serial port does.
+    // Serial links are usually slow radio links where each request costs a round trip over the air:
+    // keep fewer requests in flight there
+    if (m_telemetryDevice->inherits("QSerialPort")) {
+        m_telemetryMonitor = new TelemetryMonitor(m_uavobjectManager, m_telemetry, SERIAL_SYNC_WINDOW, true);
+    } else {
+        m_telemetryMonitor = new TelemetryMonitor(m_uavobjectManager, m_telemetry, SYNC_WINDOW, true);
+    }
 
     connect(m_telemetryMonitor, SIGNAL(connected()), this, SLOT(onConnect()));
     connect(m_telemetryMonitor, SIGNAL(disconnected()), this, SLOT(onDisconnect()));
@@ -31,6 +31,7 @@
 
 #include "uavtalk_global.h"
 #include "uavtalk.h"
+#include "uavtalkbus.h"
 #include "uavobjectmanager.h"
 #include <QIODevice>
 #include <QObject>
@@ -57,6 +58,9 @@ public:
     bool isConnected() const;
     ConnectionState connectionState() const;
 
+    // Decoded telemetry frames, for consumers that want more than the object updates
+    UAVTalkBus *bus() const;
+
 signals:
     void connecting();
     void connected();
@@ -74,6 +78,10 @@ private slots:
     void onStop();
 
 private:
+    // Object requests in flight while connecting, see TelemetryMonitor
+    static const int SYNC_WINDOW = 8;
+    static const int SERIAL_SYNC_WINDOW = 4;
+
     UAVObjectManager *m_uavobjectManager;
     UAVTalk *m_uavTalk;
     Telemetry *m_telemetry;
@@ -81,6 +89,7 @@ private:
     QIODevice *m_telemetryDevice;
     ConnectionState m_connectionState;
     QThread m_telemetryReaderThread;
+    UAVTalkBus *m_bus;
 };
 
 
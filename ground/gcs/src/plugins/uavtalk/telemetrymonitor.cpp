@@ -32,15 +32,21 @@
 
 /**
  * Constructor
+ * \param syncWindow number of object requests kept in flight while retrieving the objects on connection
+ * \param settingsDump ask the autopilot to stream all settings instead of requesting them one by one
  */
-TelemetryMonitor::TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel) :
+TelemetryMonitor::TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel, int syncWindow, bool settingsDump) :
     objMngr(objMngr),
     tel(tel),
+    syncWindow(qMax(1, syncWindow)),
+    settingsDump(settingsDump),
+    retrieving(false),
+    dumpReceived(0),
     gcsStatsObj(GCSTelemetryStats::GetInstance(objMngr)),
     flightStatsObj(FlightTelemetryStats::GetInstance(objMngr)),
     firmwareIAPObj(FirmwareIAPObj::GetInstance(objMngr)),
     statsTimer(new QTimer(this)),
-    objPending(NULL),
+    dumpTimer(new QTimer(this)),
     mutex(new QMutex(QMutex::Recursive)),
     connectionTimer(new QTime())
 {
@@ -50,6 +56,11 @@ TelemetryMonitor::TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel) :
     // Start update timer
     connect(statsTimer, SIGNAL(timeout()), this, SLOT(processStatsUpdates()));
     statsTimer->start(STATS_CONNECT_PERIOD_MS);
+
+    // Fall back to requests for the settings the autopilot did not stream
+    dumpTimer->setSingleShot(true);
+    dumpTimer->setInterval(SETTINGS_DUMP_TIMEOUT_MS);
+    connect(dumpTimer, SIGNAL(timeout()), this, SLOT(settingsDumpTimeout()));
 }
 
 TelemetryMonitor::~TelemetryMonitor()
@@ -64,11 +75,16 @@ TelemetryMonitor::~TelemetryMonitor()
 
 /**
  * Initiate object retrieval, initialize queue with objects to be retrieved.
+ * Settings are expected from the autopilot's settings dump if it has been requested.
  */
 void TelemetryMonitor::startRetrievingObjects()
 {
     // Clear object queue
     queue.clear();
+    objsPending.clear();
+    dumpPending.clear();
+    dumpReceived = 0;
+    retrieving = true;
     // Get all objects, add metaobjects, settings and data objects with OnChange update mode to the queue
     QList< QList<UAVObject *> > objs = objMngr->getObjects();
     for (int n = 0; n < objs.length(); ++n) {
@@ -80,7 +96,12 @@ void TelemetryMonitor::startRetrievingObjects()
             queue.enqueue(obj);
         } else if (dobj != NULL) {
             if (dobj->isSettingsObject()) {
-                queue.enqueue(obj);
+                if (settingsDump) {
+                    connect(obj, SIGNAL(objectUnpacked(UAVObject *)), this, SLOT(settingsObjectUnpacked(UAVObject *)));
+                    dumpPending.insert(obj);
+                } else {
+                    queue.enqueue(obj);
+                }
             } else {
                 if (UAVObject::GetFlightTelemetryUpdateMode(mdata) == UAVObject::UPDATEMODE_ONCHANGE) {
                     queue.enqueue(obj);
@@ -89,8 +110,12 @@ void TelemetryMonitor::startRetrievingObjects()
         }
     }
     // Start retrieving
-    qDebug() << "TelemetryMonitor::startRetrievingObjects - retrieving" << queue.length() << "objects";
-    retrieveNextObject();
+    qDebug() << "TelemetryMonitor::startRetrievingObjects - retrieving" << queue.length() << "objects," << dumpPending.size()
+             << "settings from the settings dump," << syncWindow << "requests in flight";
+    if (!dumpPending.isEmpty()) {
+        dumpTimer->start();
+    }
+    retrieveNextObjects();
 }
 
 /**
@@ -99,62 +124,152 @@ void TelemetryMonitor::startRetrievingObjects()
 void TelemetryMonitor::stopRetrievingObjects()
 {
     qDebug() << "TelemetryMonitor::stopRetrievingObjects - object retrieval has been cancelled";
+    foreach(UAVObject * obj, objsPending + dumpPending) {
+        obj->disconnect(this);
+    }
     queue.clear();
+    objsPending.clear();
+    dumpPending.clear();
+    dumpTimer->stop();
+    retrieving = false;
 }
 
 /**
- * Retrieve the next object in the queue
+ * Request the next objects in the queue, up to syncWindow requests are in flight at any time
  */
-void TelemetryMonitor::retrieveNextObject()
+void TelemetryMonitor::retrieveNextObjects()
 {
-    // If queue is empty return
-    if (queue.isEmpty()) {
-        qDebug() << "TelemetryMonitor::retrieveNextObject - object retrieval completed";
+    while (objsPending.size() < syncWindow && !queue.isEmpty()) {
+        // Get next object from the queue
+        UAVObject *obj = queue.dequeue();
+        // qDebug( tr("Retrieving object: %1").arg(obj->getName()) );
+
+        // Connect to object
+        connect(obj, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(transactionCompleted(UAVObject *, bool)));
+
+        // Request update
+        objsPending.insert(obj);
+        obj->requestUpdate();
+    }
+
+    // If all objects have been retrieved (requests can complete from within requestUpdate(), only report once)
+    if (retrieving && queue.isEmpty() && objsPending.isEmpty() && dumpPending.isEmpty()) {
+        retrieving = false;
+        qDebug() << "TelemetryMonitor::retrieveNextObjects - object retrieval completed";
         if (firmwareIAPObj->getBoardType()) {
-            emit connected();
+            syncCompleted();
         } else {
             connect(firmwareIAPObj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(firmwareIAPUpdated(UAVObject *)));
         }
-        return;
     }
+}
 
-    // Get next object from the queue
-    UAVObject *obj = queue.dequeue();
-    // qDebug( tr("Retrieving object: %1").arg(obj->getName()) );
+/**
+ * Record the time it took to connect and announce the connection
+ */
+void TelemetryMonitor::syncCompleted()
+{
+    GCSTelemetryStats::DataFields gcsStats = gcsStatsObj->getData();
 
-    // Connect to object
-    connect(obj, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(transactionCompleted(UAVObject *, bool)));
+    gcsStats.ConnectTime = syncTimer.elapsed();
+    gcsStatsObj->setData(gcsStats);
+    qDebug() << "TelemetryMonitor - connected in" << gcsStats.ConnectTime << "ms";
 
-    // Request update
-    obj->requestUpdate();
-    objPending = obj;
+    emit connected();
 }
 
 /**
- * Called by the retrieved object when a transaction is completed.
+ * Called by the retrieved objects when a transaction is completed.
  */
 void TelemetryMonitor::transactionCompleted(UAVObject *obj, bool success)
 {
     Q_UNUSED(success);
     QMutexLocker locker(mutex);
 
-    if (obj == objPending) {
+    if (objsPending.remove(obj)) {
         // Disconnect from sending object
         obj->disconnect(this);
-        objPending = NULL;
 
         // Process next object if telemetry is still available
         GCSTelemetryStats::DataFields gcsStats = gcsStatsObj->getData();
         if (gcsStats.Status == GCSTelemetryStats::STATUS_CONNECTED) {
-            retrieveNextObject();
+            retrieveNextObjects();
         } else {
             stopRetrievingObjects();
         }
     } else {
-        qCritical() << "TelemetryMonitor::retrieveNextObject - unexpected object" << obj;
+        qCritical() << "TelemetryMonitor::transactionCompleted - unexpected object" << obj;
     }
 }
 
+/**
+ * Called when a settings object is received from the autopilot's settings dump.
+ */
+void TelemetryMonitor::settingsObjectUnpacked(UAVObject *obj)
+{
+    QMutexLocker locker(mutex);
+
+    if (dumpPending.remove(obj)) {
+        obj->disconnect(this);
+        obj->setIsKnown(true);
+        ++dumpReceived;
+        if (dumpPending.isEmpty()) {
+            dumpTimer->stop();
+            retrieveNextObjects();
+        } else {
+            // The dump is still flowing, however long it takes on a slow link
+            dumpTimer->start();
+        }
+    }
+}
+
+/**
+ * The settings dump stalled before bringing all settings, request the missing ones.
+ */
+void TelemetryMonitor::settingsDumpTimeout()
+{
+    QMutexLocker locker(mutex);
+
+    qDebug() << "TelemetryMonitor::settingsDumpTimeout - requesting" << dumpPending.size() << "settings missing from the settings dump";
+    requestMissingSettings();
+}
+
+/**
+ * The autopilot reported the end of the settings dump and the number of settings it sent.
+ * If all of them arrived, the settings still pending do not exist on this board and are
+ * not requested, otherwise some were lost on the way and the missing ones are requested.
+ */
+void TelemetryMonitor::settingsDumpCompleted(int dumpCount)
+{
+    dumpTimer->stop();
+    if (dumpReceived >= dumpCount) {
+        qDebug() << "TelemetryMonitor::settingsDumpCompleted - received" << dumpReceived << "settings," << dumpPending.size()
+                 << "settings are not on the autopilot";
+        foreach(UAVObject * obj, dumpPending) {
+            obj->disconnect(this);
+        }
+        dumpPending.clear();
+        retrieveNextObjects();
+    } else {
+        qDebug() << "TelemetryMonitor::settingsDumpCompleted - received" << dumpReceived << "of" << dumpCount
+                 << "settings, requesting" << dumpPending.size() << "settings missing from the settings dump";
+        requestMissingSettings();
+    }
+}
+
+/**
+ * Queue requests for the settings which did not come with the settings dump
+ */
+void TelemetryMonitor::requestMissingSettings()
+{
+    foreach(UAVObject * obj, dumpPending) {
+        obj->disconnect(this);
+        queue.enqueue(obj);
+    }
+    dumpPending.clear();
+    retrieveNextObjects();
+}
+
 /**
  * Called each time the flight stats object is updated by the autopilot
  */
@@ -170,6 +285,11 @@ void TelemetryMonitor::flightStatsUpdated(UAVObject *obj)
         flightStats.Status != FlightTelemetryStats::STATUS_CONNECTED) {
         processStatsUpdates();
     }
+
+    // The autopilot sends the flight stats right behind the last object of the settings dump
+    if (!dumpPending.isEmpty() && flightStats.SettingsDump == FlightTelemetryStats::SETTINGSDUMP_DONE) {
+        settingsDumpCompleted(flightStats.SettingsDumpCount);
+    }
 }
 
 /**
@@ -182,7 +302,7 @@ void TelemetryMonitor::firmwareIAPUpdated(UAVObject *obj)
 
     if (firmwareIAPObj->getBoardType() != 0) {
         disconnect(firmwareIAPObj);
-        emit connected();
+        syncCompleted();
     }
 }
 
@@ -228,6 +348,8 @@ void TelemetryMonitor::processStatsUpdates()
     if (gcsStats.Status == GCSTelemetryStats::STATUS_DISCONNECTED) {
         // Request connection
         gcsStats.Status = GCSTelemetryStats::STATUS_HANDSHAKEREQ;
+        gcsStats.SettingsDump = settingsDump ? GCSTelemetryStats::SETTINGSDUMP_REQUEST : GCSTelemetryStats::SETTINGSDUMP_NONE;
+        syncTimer.start();
     } else if (gcsStats.Status == GCSTelemetryStats::STATUS_HANDSHAKEREQ) {
         // Check for connection acknowledge
         if (flightStats.Status == FlightTelemetryStats::STATUS_HANDSHAKEACK) {
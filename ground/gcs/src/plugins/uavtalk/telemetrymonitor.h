@@ -30,6 +30,7 @@
 
 #include <QObject>
 #include <QQueue>
+#include <QSet>
 #include <QTimer>
 #include <QTime>
 #include <QMutex>
@@ -45,7 +46,10 @@ class TelemetryMonitor : public QObject {
     Q_OBJECT
 
 public:
-    TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel);
+    // Number of object requests kept in flight during the connection sync
+    static const int DEFAULT_SYNC_WINDOW = 4;
+
+    TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel, int syncWindow = DEFAULT_SYNC_WINDOW, bool settingsDump = false);
     ~TelemetryMonitor();
 
 signals:
@@ -58,25 +62,40 @@ public slots:
     void processStatsUpdates();
     void flightStatsUpdated(UAVObject *obj);
     void firmwareIAPUpdated(UAVObject *obj);
+    void settingsObjectUnpacked(UAVObject *obj);
+    void settingsDumpTimeout();
 
 private:
-    static const int STATS_UPDATE_PERIOD_MS  = 4000;
-    static const int STATS_CONNECT_PERIOD_MS = 2000;
-    static const int CONNECTION_TIMEOUT_MS   = 8000;
+    static const int STATS_UPDATE_PERIOD_MS   = 4000;
+    static const int STATS_CONNECT_PERIOD_MS  = 2000;
+    static const int CONNECTION_TIMEOUT_MS    = 8000;
+    // Longest silence allowed between two objects of the settings dump, each object restarts the timer.
+    // Only a fallback for when the end of the dump reported in the flight stats gets lost.
+    static const int SETTINGS_DUMP_TIMEOUT_MS = 5000;
 
     UAVObjectManager *objMngr;
     Telemetry *tel;
+    int syncWindow;
+    bool settingsDump;
+    bool retrieving;
     QQueue<UAVObject *> queue;
+    QSet<UAVObject *> objsPending;
+    QSet<UAVObject *> dumpPending;
+    int dumpReceived;
     GCSTelemetryStats *gcsStatsObj;
     FlightTelemetryStats *flightStatsObj;
     FirmwareIAPObj *firmwareIAPObj;
     QTimer *statsTimer;
-    UAVObject *objPending;
+    QTimer *dumpTimer;
     QMutex *mutex;
     QTime *connectionTimer;
+    QTime syncTimer;
 
     void startRetrievingObjects();
-    void retrieveNextObject();
+    void retrieveNextObjects();
+    void syncCompleted();
+    void settingsDumpCompleted(int dumpCount);
+    void requestMissingSettings();
     void stopRetrievingObjects();
 };
 
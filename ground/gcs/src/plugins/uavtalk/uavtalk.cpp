@@ -25,8 +25,7 @@
  * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
  */
 #include "uavtalk.h"
-#include <extensionsystem/pluginmanager.h>
-#include <coreplugin/generalsettings.h>
+#include "uavtalkbus.h"
 #include <utils/crc.h>
 
 #include <QtEndian>
@@ -49,27 +48,12 @@ using namespace Utils;
 /**
  * Constructor
  */
-UAVTalk::UAVTalk(QIODevice *iodev, UAVObjectManager *objMngr) : io(iodev), objMngr(objMngr), mutex(QMutex::Recursive)
+UAVTalk::UAVTalk(QIODevice *iodev, UAVObjectManager *objMngr) : io(iodev), objMngr(objMngr), mutex(QMutex::Recursive), bus(0)
 {
     rxState = STATE_SYNC;
     rxPacketLength = 0;
 
     memset(&stats, 0, sizeof(ComStats));
-
-    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
-    Core::Internal::GeneralSettings *settings = pm->getObject<Core::Internal::GeneralSettings>();
-    useUDPMirror = settings->useUDPMirror();
-    if (useUDPMirror) {
-        qDebug() << "UAVTalk::UAVTalk -*** UDP mirror is enabled ***";
-    }
-    if (useUDPMirror) {
-        udpSocketTx = new QUdpSocket(this);
-        udpSocketRx = new QUdpSocket(this);
-        udpSocketTx->bind(9000);
-        udpSocketRx->connectToHost(QHostAddress::LocalHost, 9000);
-        connect(udpSocketTx, SIGNAL(readyRead()), this, SLOT(dummyUDPRead()));
-        connect(udpSocketRx, SIGNAL(readyRead()), this, SLOT(dummyUDPRead()));
-    }
 }
 
 UAVTalk::~UAVTalk()
@@ -100,15 +84,15 @@ UAVTalk::ComStats UAVTalk::getStats()
     return stats;
 }
 
-void UAVTalk::dummyUDPRead()
+/**
+ * Publish all frames received and transmitted from now on to the given bus.
+ * \param[in] bus The bus, or NULL to stop publishing
+ */
+void UAVTalk::setBus(UAVTalkBus *bus)
 {
-    QUdpSocket *socket = qobject_cast<QUdpSocket *>(sender());
-    QByteArray junk;
+    QMutexLocker locker(&mutex);
 
-    while (socket->hasPendingDatagrams()) {
-        junk.resize(socket->pendingDatagramSize());
-        socket->readDatagram(junk.data(), junk.size());
-    }
+    this->bus = bus;
 }
 
 /**
@@ -139,6 +123,29 @@ bool UAVTalk::sendObject(UAVObject *obj, bool acked, bool allInstances)
     return success;
 }
 
+/**
+ * Send object data that was not packed from a local object, such as a frame
+ * taken from a UAVTalkBus, as an unacknowledged object update.
+ * \param[in] objId Object ID
+ * \param[in] instId Instance ID
+ * \param[in] data Packed object data
+ * \param[in] length Length of data
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::sendObjectData(quint32 objId, quint16 instId, const quint8 *data, int length)
+{
+    QMutexLocker locker(&mutex);
+
+    if (length < 0 || length >= MAX_PAYLOAD_LENGTH) {
+        qWarning() << "UAVTalk - error transmitting : object data exceeds max payload length" << objId << instId;
+        ++stats.txErrors;
+        return false;
+    }
+    memcpy(&txBuffer[HEADER_LENGTH], data, length);
+
+    return transmitPacket(TYPE_OBJ, objId, instId, length);
+}
+
 /**
  * Request an update for the specified object, on success the object data would have been
  * updated by the GCS.
@@ -210,34 +217,94 @@ bool UAVTalk::objectTransaction(quint8 type, quint32 objId, quint16 instId, UAVO
  */
 void UAVTalk::processInputStream()
 {
-    quint8 tmp;
-
     if (io && io->isReadable()) {
         while (io->bytesAvailable() > 0) {
-            int ret = io->read((char *)&tmp, 1);
-            if (ret != -1) {
-                processInputByte(tmp);
-            } else {
-                // TODOD
+            // Read everything that is available in one go, the buffer keeps its capacity between calls
+            rxReadBuffer.resize(io->bytesAvailable());
+            qint64 ret = io->read(rxReadBuffer.data(), rxReadBuffer.size());
+            if (ret <= 0) {
+                break;
             }
-            if (rxState == STATE_COMPLETE) {
-                mutex.lock();
-                if (receiveObject(rxType, rxObjId, rxInstId, rxBuffer, rxLength)) {
-                    stats.rxObjectBytes += rxLength;
-                    stats.rxObjects++;
-                } else {
-                    // TODO...
+            const quint8 *data = (const quint8 *)rxReadBuffer.constData();
+            qint64 pos = 0;
+            while (pos < ret) {
+                pos += processInputBytes(data + pos, ret - pos);
+                if (rxState == STATE_COMPLETE) {
+                    mutex.lock();
+                    if (receiveObject(rxType, rxObjId, rxInstId, rxBuffer, rxLength)) {
+                        stats.rxObjectBytes += rxLength;
+                        stats.rxObjects++;
+                    } else {
+                        // TODO...
+                    }
+                    if (bus && rxType != TYPE_OBJ_MULTI) {
+                        // the records of a multi object packet are published one by one as they are received
+                        bus->publish(UAVTalkBus::RX, rxType, rxObjId, rxInstId, rxBuffer, rxLength);
+                    }
+                    mutex.unlock();
                 }
-                mutex.unlock();
+            }
+        }
 
-                if (useUDPMirror) {
-                    // it is safe to do this outside of the above critical section as the rxDataArray is
-                    // accessed from this thread only
-                    udpSocketTx->writeDatagram(rxDataArray, QHostAddress::LocalHost, udpSocketRx->localPort());
-                }
+        QMutexLocker locker(&mutex);
+        if (bus) {
+            bus->notify();
+        }
+    }
+}
+
+/**
+ * Process a block of bytes from the telemetry stream.
+ * Stops right after a complete packet has been received so that it can be handled by the caller.
+ * The resync scan and the object payload are handled in bulk, everything else goes through
+ * processInputByte() so that the results are the same as feeding the bytes one at a time.
+ * \param[in] data Received bytes
+ * \param[in] length Number of bytes in data
+ * \return The number of bytes consumed
+ */
+int UAVTalk::processInputBytes(const quint8 *data, int length)
+{
+    int count = 0;
+
+    while (count < length) {
+        if (rxState == STATE_COMPLETE || rxState == STATE_ERROR) {
+            rxState = STATE_SYNC;
+        }
+
+        if (rxState == STATE_SYNC) {
+            // Skip everything up to the next sync byte
+            const quint8 *sync = (const quint8 *)memchr(data + count, SYNC_VAL, length - count);
+            int skipped = (sync ? sync - data : length) - count;
+            if (skipped > 0) {
+                stats.rxBytes      += skipped;
+                stats.rxSyncErrors += skipped;
+                rxPacketLength     += skipped;
+                count              += skipped;
+                continue;
+            }
+        } else if (rxState == STATE_DATA) {
+            // Copy as much of the payload as is available
+            int chunk = qMin(length - count, rxLength - rxCount);
+            memcpy(&rxBuffer[rxCount], data + count, chunk);
+            rxCS = Crc::updateCRC(rxCS, data + count, chunk);
+            stats.rxBytes  += chunk;
+            rxPacketLength += chunk;
+            rxCount        += chunk;
+            count          += chunk;
+            if (rxCount >= rxLength) {
+                rxCount = 0;
+                rxState = STATE_CS;
             }
+            continue;
+        }
+
+        processInputByte(data[count++]);
+        if (rxState == STATE_COMPLETE) {
+            break;
         }
     }
+
+    return count;
 }
 
 /**
@@ -249,10 +316,6 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
 {
     if (rxState == STATE_COMPLETE || rxState == STATE_ERROR) {
         rxState = STATE_SYNC;
-
-        if (useUDPMirror) {
-            rxDataArray.clear();
-        }
     }
 
     // Update stats
@@ -261,10 +324,6 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
     // update packet byte count
     rxPacketLength++;
 
-    if (useUDPMirror) {
-        rxDataArray.append(rxbyte);
-    }
-
     // Receive state machine
     switch (rxState) {
     case STATE_SYNC:
@@ -363,8 +422,9 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
 
         // Search for object, if not found reset state machine
         {
-            UAVObject *rxObj = objMngr->getObject(rxObjId);
-            if (rxObj == NULL && rxType != TYPE_OBJ_REQ) {
+            // Multi object packets have no object ID, their records are checked when received
+            UAVObject *rxObj = (rxType == TYPE_OBJ_MULTI) ? NULL : objMngr->getObject(rxObjId);
+            if (rxObj == NULL && rxType != TYPE_OBJ_REQ && rxType != TYPE_OBJ_MULTI) {
                 qWarning() << "UAVTalk - error : unknown object" << rxObjId;
                 stats.rxErrors++;
                 rxState = STATE_ERROR;
@@ -476,8 +536,6 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
  */
 bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *data, qint32 length)
 {
-    Q_UNUSED(length);
-
     UAVObject *obj    = NULL;
     bool error        = false;
     bool allInstances = (instId == ALL_INSTANCES);
@@ -569,6 +627,11 @@ bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *
         }
         break;
 
+    case TYPE_OBJ_MULTI:
+        // The instance ID holds the number of records
+        error = !receiveMultiObject(instId, data, length);
+        break;
+
     case TYPE_NACK:
         // All instances, not allowed for NACK messages
         if (!allInstances) {
@@ -596,6 +659,53 @@ bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *
     return !error;
 }
 
+/**
+ * Receive a multi object packet, each record is handled, and published to the bus,
+ * as an OBJ message. Records of unknown objects are skipped.
+ * \param[in] count Number of records in the packet
+ * \param[in] data Packet payload
+ * \param[in] length Payload length
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::receiveMultiObject(quint16 count, quint8 *data, qint32 length)
+{
+    bool error      = false;
+    qint32 pos      = 0;
+    quint16 records = 0;
+
+    while (records < count && pos + MULTI_RECORD_HEADER_LENGTH <= length) {
+        quint32 objId     = qFromLittleEndian<quint32>(&data[pos]);
+        quint16 instId    = qFromLittleEndian<quint16>(&data[pos + 4]);
+        quint8 dataLength = data[pos + 6];
+
+        pos += MULTI_RECORD_HEADER_LENGTH;
+
+        if (pos + dataLength > length) {
+            break;
+        }
+
+        if (bus) {
+            bus->publish(UAVTalkBus::RX, TYPE_OBJ, objId, instId, &data[pos], dataLength);
+        }
+
+        UAVObject *obj = objMngr->getObject(objId);
+        if (obj != NULL && obj->getNumBytes() == dataLength) {
+            error |= !receiveObject(TYPE_OBJ, objId, instId, &data[pos], dataLength);
+        } else {
+            qWarning() << "UAVTalk - error : unknown object in multi object packet" << objId;
+            error = true;
+        }
+        pos += dataLength;
+        records++;
+    }
+
+    if (records != count || pos != length) {
+        qWarning() << "UAVTalk - error : malformed multi object packet";
+        return false;
+    }
+    return !error;
+}
+
 /**
  * Update the data of an object from a byte array (unpack).
  * If the object instance could not be found in the list, then a
@@ -748,16 +858,6 @@ bool UAVTalk::transmitSingleObject(quint8 type, quint32 objId, quint16 instId, U
 
     // IMPORTANT : obj can be null (when type is NACK for example)
 
-    // Setup sync byte
-    txBuffer[0] = SYNC_VAL;
-    // Setup type
-    txBuffer[1] = type;
-    // next 2 bytes are reserved for data length (inserted here later)
-    // Setup object ID
-    qToLittleEndian<quint32>(objId, &txBuffer[4]);
-    // Setup instance ID
-    qToLittleEndian<quint16>(instId, &txBuffer[8]);
-
     // Determine data length
     if (type == TYPE_OBJ_REQ || type == TYPE_ACK || type == TYPE_NACK) {
         length = 0;
@@ -781,6 +881,28 @@ bool UAVTalk::transmitSingleObject(quint8 type, quint32 objId, quint16 instId, U
         }
     }
 
+    return transmitPacket(type, objId, instId, length);
+}
+
+/**
+ * Send a packet whose payload is already in the transmit buffer.
+ * \param[in] type Transaction type
+ * \param[in] objId Object ID
+ * \param[in] instId Instance ID
+ * \param[in] length Payload length
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::transmitPacket(quint8 type, quint32 objId, quint16 instId, qint32 length)
+{
+    // Setup sync byte
+    txBuffer[0] = SYNC_VAL;
+    // Setup type
+    txBuffer[1] = type;
+    // Setup object ID
+    qToLittleEndian<quint32>(objId, &txBuffer[4]);
+    // Setup instance ID
+    qToLittleEndian<quint16>(instId, &txBuffer[8]);
+
     // Store the packet length
     qToLittleEndian<quint16>(HEADER_LENGTH + length, &txBuffer[2]);
 
@@ -791,8 +913,9 @@ bool UAVTalk::transmitSingleObject(quint8 type, quint32 objId, quint16 instId, U
     if (!io.isNull() && io->isWritable()) {
         if (io->bytesToWrite() < TX_BUFFER_SIZE) {
             io->write((const char *)txBuffer, HEADER_LENGTH + length + CHECKSUM_LENGTH);
-            if (useUDPMirror) {
-                udpSocketRx->writeDatagram((const char *)txBuffer, HEADER_LENGTH + length + CHECKSUM_LENGTH, QHostAddress::LocalHost, udpSocketTx->localPort());
+            if (bus) {
+                bus->publish(UAVTalkBus::TX, type, objId, instId, &txBuffer[HEADER_LENGTH], length);
+                bus->notify();
             }
         } else {
             qWarning() << "UAVTalk - error transmitting : io device full";
@@ -898,6 +1021,11 @@ const char *UAVTalk::typeToString(quint8 type)
     case TYPE_NACK:
         return "nack";
 
+        break;
+
+    case TYPE_OBJ_MULTI:
+        return "multi object";
+
         break;
     }
     return "<error>";
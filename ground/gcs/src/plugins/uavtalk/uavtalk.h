@@ -36,7 +36,8 @@
 #include <QMutexLocker>
 #include <QMap>
 #include <QThread>
-#include <QtNetwork/QUdpSocket>
+
+class UAVTalkBus;
 
 class UAVTALK_EXPORT UAVTalk : public QObject {
     Q_OBJECT
@@ -68,14 +69,16 @@ public:
 
     bool sendObject(UAVObject *obj, bool acked, bool allInstances);
     bool sendObjectRequest(UAVObject *obj, bool allInstances);
+    bool sendObjectData(quint32 objId, quint16 instId, const quint8 *data, int length);
     void cancelTransaction(UAVObject *obj);
 
+    void setBus(UAVTalkBus *bus);
+
 signals:
     void transactionCompleted(UAVObject *obj, bool success);
 
 private slots:
     void processInputStream();
-    void dummyUDPRead();
 
 private:
 
@@ -86,19 +89,23 @@ private:
     } Transaction;
 
     // Constants
-    static const int TYPE_MASK     = 0xF8;
-    static const int TYPE_VER      = 0x20;
-    static const int TYPE_OBJ      = (TYPE_VER | 0x00);
-    static const int TYPE_OBJ_REQ  = (TYPE_VER | 0x01);
-    static const int TYPE_OBJ_ACK  = (TYPE_VER | 0x02);
-    static const int TYPE_ACK      = (TYPE_VER | 0x03);
-    static const int TYPE_NACK     = (TYPE_VER | 0x04);
+    static const int TYPE_MASK      = 0xF8;
+    static const int TYPE_VER       = 0x20;
+    static const int TYPE_OBJ       = (TYPE_VER | 0x00);
+    static const int TYPE_OBJ_REQ   = (TYPE_VER | 0x01);
+    static const int TYPE_OBJ_ACK   = (TYPE_VER | 0x02);
+    static const int TYPE_ACK       = (TYPE_VER | 0x03);
+    static const int TYPE_NACK      = (TYPE_VER | 0x04);
+    static const int TYPE_OBJ_MULTI = (TYPE_VER | 0x05);
 
     // header : sync(1), type (1), size(2), object ID(4), instance ID(2)
     static const int HEADER_LENGTH = 10;
 
     static const int MAX_PAYLOAD_LENGTH = 256;
 
+    // multi object record header : object ID(4), instance ID(2), data length(1)
+    static const int MULTI_RECORD_HEADER_LENGTH = 7;
+
     static const int CHECKSUM_LENGTH    = 1;
 
     static const int MAX_PACKET_LENGTH  = (HEADER_LENGTH + MAX_PAYLOAD_LENGTH + CHECKSUM_LENGTH);
@@ -140,20 +147,24 @@ private:
     quint8 rxCSPacket;
     quint8 rxCS;
 
-    bool useUDPMirror;
-    QUdpSocket *udpSocketTx;
-    QUdpSocket *udpSocketRx;
-    QByteArray rxDataArray;
+    // Decoded frames are published here for other local consumers, if set
+    UAVTalkBus *bus;
+
+    // Reusable buffer for bulk reads from the io device
+    QByteArray rxReadBuffer;
 
     // Methods
     bool objectTransaction(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
+    int processInputBytes(const quint8 *data, int length);
     bool processInputByte(quint8 rxbyte);
     bool receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *data, qint32 length);
+    bool receiveMultiObject(quint16 count, quint8 *data, qint32 length);
     UAVObject *updateObject(quint32 objId, quint16 instId, quint8 *data);
     void updateAck(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
     void updateNack(quint32 objId, quint16 instId, UAVObject *obj);
     bool transmitObject(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
     bool transmitSingleObject(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
+    bool transmitPacket(quint8 type, quint32 objId, quint16 instId, qint32 length);
 
     Transaction *findTransaction(quint32 objId, quint16 instId);
     void openTransaction(quint8 type, quint32 objId, quint16 instId);
@@ -1,7 +1,7 @@
 TEMPLATE = lib
 TARGET = UAVTalk
 
-QT += widgets network
+QT += widgets
 
 DEFINES += UAVTALK_LIBRARY
 
@@ -14,6 +14,7 @@ include(uavtalk_dependencies.pri)
 HEADERS += \
     uavtalk_global.h \
     uavtalk.h \
+    uavtalkbus.h \
     telemetry.h \
     telemetrymonitor.h \
     telemetrymanager.h \
@@ -22,6 +23,7 @@ HEADERS += \
 
 SOURCES += \
     uavtalk.cpp \
+    uavtalkbus.cpp \
     telemetry.cpp \
     telemetrymonitor.cpp \
     telemetrymanager.cpp \
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavtalkbus.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief Fan-out of decoded UAVTalk frames to local consumers
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "uavtalkbus.h"
+
+#include <QDateTime>
+#include <QDebug>
+
+#include <new>
+#include <stddef.h>
+#include <string.h>
+
+// the rings are shared with other processes, their atomics must not need a lock
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64 bit atomics are not lock free");
+// the layout is documented in uavtalkbus.h for tools outside of the GCS
+static_assert(sizeof(UAVTalkBus::RingHeader) == 24, "the ring header layout changed");
+static_assert(sizeof(UAVTalkBus::Slot) == 288 && offsetof(UAVTalkBus::Slot, data) == 26, "the slot layout changed");
+
+const char *const UAVTalkBus::SHARED_MEMORY_KEY = "LibrePilotGCS.UAVTalkBus";
+
+UAVTalkBus::UAVTalkBus(QObject *parent) : QObject(parent), m_sharedRing(0), m_notified(0)
+{
+    m_memory = new char[ringSize()];
+    m_ring   = initRing(m_memory);
+}
+
+UAVTalkBus::~UAVTalkBus()
+{
+    setShared(false);
+    delete[] m_memory;
+}
+
+size_t UAVTalkBus::ringSize()
+{
+    return sizeof(RingHeader) + SLOT_COUNT * sizeof(Slot);
+}
+
+UAVTalkBus::RingHeader *UAVTalkBus::initRing(void *memory)
+{
+    RingHeader *ring = new (memory) RingHeader;
+
+    ring->magic     = MAGIC;
+    ring->version   = VERSION;
+    ring->slotCount = SLOT_COUNT;
+    ring->slotSize  = sizeof(Slot);
+    ring->head.store(0, std::memory_order_relaxed);
+
+    for (int i = 0; i < SLOT_COUNT; i++) {
+        Slot *s = new (slot(ring, i)) Slot;
+        s->sequence.store(BUSY, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return ring;
+}
+
+/**
+ * Enable or disable publishing to the shared memory ring. An existing segment
+ * with the same key, left behind by a GCS that did not exit cleanly, is taken over.
+ */
+void UAVTalkBus::setShared(bool shared)
+{
+    if (shared == isShared()) {
+        return;
+    }
+
+    if (!shared) {
+        m_sharedRing = 0;
+        m_sharedMemory.detach();
+        return;
+    }
+
+    m_sharedMemory.setKey(SHARED_MEMORY_KEY);
+    bool ok = m_sharedMemory.create(ringSize());
+    if (!ok && m_sharedMemory.error() == QSharedMemory::AlreadyExists) {
+        ok = m_sharedMemory.attach() && m_sharedMemory.size() >= (int)ringSize();
+    }
+    if (!ok) {
+        qWarning() << "UAVTalkBus - error : cannot share telemetry" << m_sharedMemory.errorString();
+        if (m_sharedMemory.isAttached()) {
+            m_sharedMemory.detach();
+        }
+        return;
+    }
+
+    m_sharedRing = initRing(m_sharedMemory.data());
+    qDebug() << "UAVTalkBus - sharing telemetry in shared memory" << SHARED_MEMORY_KEY;
+}
+
+/**
+ * Publish one frame. There must only ever be one publisher at a time, UAVTalk
+ * guarantees that by publishing with its mutex held.
+ * \param[in] direction Received or transmitted
+ * \param[in] type UAVTalk message type
+ * \param[in] objId Object ID
+ * \param[in] instId Instance ID
+ * \param[in] data Payload
+ * \param[in] length Payload length
+ */
+void UAVTalkBus::publish(Direction direction, quint8 type, quint32 objId, quint16 instId, const quint8 *data, int length)
+{
+    Q_ASSERT(length >= 0 && length <= MAX_PAYLOAD_LENGTH);
+
+    Frame frame;
+    frame.timestamp = QDateTime::currentMSecsSinceEpoch();
+    frame.objId     = objId;
+    frame.instId    = instId;
+    frame.type      = type;
+    frame.direction = direction;
+    frame.length    = length;
+    frame.data      = data;
+
+    publish(m_ring, frame);
+    if (m_sharedRing) {
+        publish(m_sharedRing, frame);
+    }
+}
+
+void UAVTalkBus::publish(RingHeader *ring, const Frame &frame)
+{
+    const quint64 sequence = ring->head.load(std::memory_order_relaxed);
+    Slot *s = slot(ring, sequence);
+
+    // Readers that are still looking at the frame this one replaces will see the slot change
+    s->sequence.store(BUSY, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s->timestamp = frame.timestamp;
+    s->objId     = frame.objId;
+    s->instId    = frame.instId;
+    s->type      = frame.type;
+    s->direction = frame.direction;
+    s->length    = frame.length;
+    memcpy(s->data, frame.data, frame.length);
+
+    s->sequence.store(sequence, std::memory_order_release);
+    ring->head.store(sequence + 1, std::memory_order_release);
+}
+
+/**
+ * Signal the readers, once for all frames published since the last call.
+ */
+void UAVTalkBus::notify()
+{
+    const quint64 head = m_ring->head.load(std::memory_order_relaxed);
+
+    if (head != m_notified) {
+        m_notified = head;
+        emit framesPublished();
+    }
+}
+
+/**
+ * Create a reader that starts with the next frame published.
+ * The bus must outlive the reader.
+ */
+UAVTalkBusReader::UAVTalkBusReader(UAVTalkBus *bus) :
+    m_ring(bus->ring()), m_current(UAVTalkBus::BUSY), m_lost(0)
+{
+    m_next = m_ring->head.load(std::memory_order_acquire);
+}
+
+/**
+ * Get the next frame.
+ * \param[out] frame The frame, its payload points into the ring
+ * \return true if there was a frame, false if the reader is up to date
+ */
+bool UAVTalkBusReader::read(UAVTalkBus::Frame *frame)
+{
+    const quint64 head    = m_ring->head.load(std::memory_order_acquire);
+    const quint64 backlog = m_ring->slotCount / 2;
+
+    while (m_next < head) {
+        if (head - m_next > backlog) {
+            // Too far behind, the publisher is about to overwrite what is left
+            m_lost += head - backlog - m_next;
+            m_next  = head - backlog;
+        }
+
+        UAVTalkBus::Slot *slot = UAVTalkBus::slot(m_ring, m_next);
+        if (slot->sequence.load(std::memory_order_acquire) != m_next) {
+            // overwritten since head was read
+            m_lost++;
+            m_next++;
+            continue;
+        }
+
+        frame->timestamp = slot->timestamp;
+        frame->objId     = slot->objId;
+        frame->instId    = slot->instId;
+        frame->type      = slot->type;
+        frame->direction = slot->direction;
+        frame->length    = slot->length;
+        frame->data      = slot->data;
+
+        m_current = m_next++;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Done with the frame returned by the last read().
+ * \return true if the frame was intact all the time it was in use
+ */
+bool UAVTalkBusReader::release()
+{
+    if (m_current == UAVTalkBus::BUSY) {
+        return true;
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    bool intact = UAVTalkBus::slot(m_ring, m_current)->sequence.load(std::memory_order_relaxed) == m_current;
+    if (!intact) {
+        m_lost++;
+    }
+    m_current = UAVTalkBus::BUSY;
+
+    return intact;
+}
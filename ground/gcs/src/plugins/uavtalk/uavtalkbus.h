@@ -0,0 +1,188 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavtalkbus.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief Fan-out of decoded UAVTalk frames to local consumers
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef UAVTALKBUS_H
+#define UAVTALKBUS_H
+
+#include "uavtalk_global.h"
+
+#include <QObject>
+#include <QSharedMemory>
+
+#include <atomic>
+
+/**
+ * Publishes every frame UAVTalk receives or transmits, with its header
+ * already decoded, into a ring of fixed size slots. Any number of
+ * UAVTalkBusReader instances consume the ring at their own pace, without
+ * locking and without copying the payload, so that local consumers never
+ * have to parse the byte stream again.
+ *
+ * The records of a multi object packet are published as one OBJ frame each.
+ *
+ * When shared is enabled the frames are also published into a second ring in
+ * shared memory (SHARED_MEMORY_KEY, a QSharedMemory key) that tools outside of
+ * the GCS can attach to. Both rings have the same layout, in host byte order:
+ *
+ *     RingHeader, 24 bytes
+ *       0  quint32 magic       MAGIC
+ *       4  quint32 version     VERSION
+ *       8  quint32 slotCount   number of slots that follow the header
+ *      12  quint32 slotSize    size of a slot, 288 bytes
+ *      16  quint64 head        sequence number of the next frame
+ *     Slot, slotSize bytes, slotCount times
+ *       0  quint64 sequence    sequence number of the frame in the slot, BUSY while it is written
+ *       8  qint64  timestamp   ms since epoch
+ *      16  quint32 objId
+ *      20  quint16 instId
+ *      22  quint8  type        UAVTalk message type
+ *      23  quint8  direction   Direction
+ *      24  quint16 length      payload length
+ *      26  quint8  data[256]   payload, the packed object
+ *
+ * The frame with sequence number n is in slot n % slotCount. A reader starts
+ * at head and reads a slot only once head has passed it. It copies the slot,
+ * then reads its sequence again: the copy is good if the sequence is n both
+ * before and after. Anything else means the frame was overwritten in the
+ * meantime. A head lower than the one last seen means that the GCS restarted.
+ * ground/gcs/src/experimental/UAVTalkBusClient is an example of such a tool.
+ */
+class UAVTALK_EXPORT UAVTalkBus : public QObject {
+    Q_OBJECT
+
+public:
+    enum Direction { RX = 0, TX = 1 };
+
+    static const quint32 MAGIC          = 0x42564155; // "UAVB"
+    static const quint32 VERSION        = 1;
+    static const int SLOT_COUNT         = 1024;
+    static const int MAX_PAYLOAD_LENGTH = 256;
+    static const quint64 BUSY = ~0ULL;
+    static const char *const SHARED_MEMORY_KEY;
+
+    struct RingHeader {
+        quint32 magic;
+        quint32 version;
+        quint32 slotCount;
+        quint32 slotSize;
+        std::atomic<quint64> head; // sequence number of the next frame
+    };
+
+    struct Slot {
+        std::atomic<quint64> sequence; // sequence number of the frame in this slot, BUSY while it is written
+        qint64  timestamp; // ms since epoch
+        quint32 objId;
+        quint16 instId;
+        quint8  type;
+        quint8  direction;
+        quint16 length;
+        quint8  data[MAX_PAYLOAD_LENGTH];
+    };
+
+    struct Frame {
+        qint64  timestamp;
+        quint32 objId;
+        quint16 instId;
+        quint8  type;
+        quint8  direction;
+        quint16 length;
+        const quint8 *data; // payload, points into the ring
+    };
+
+    explicit UAVTalkBus(QObject *parent = 0);
+    ~UAVTalkBus();
+
+    void setShared(bool shared);
+    bool isShared() const
+    {
+        return m_sharedRing != 0;
+    }
+
+    // Producer side, called by UAVTalk with its mutex held
+    void publish(Direction direction, quint8 type, quint32 objId, quint16 instId, const quint8 *data, int length);
+    void notify();
+
+    RingHeader *ring() const
+    {
+        return m_ring;
+    }
+
+    static Slot *slot(RingHeader *ring, quint64 sequence)
+    {
+        return reinterpret_cast<Slot *>(reinterpret_cast<char *>(ring) + sizeof(RingHeader)) + (sequence % ring->slotCount);
+    }
+
+signals:
+    // emitted once per batch of published frames
+    void framesPublished();
+
+private:
+    static size_t ringSize();
+    static RingHeader *initRing(void *memory);
+    static void publish(RingHeader *ring, const Frame &frame);
+
+    char *m_memory;
+    RingHeader *m_ring;
+    QSharedMemory m_sharedMemory;
+    RingHeader *m_sharedRing;
+    quint64 m_notified;
+};
+
+/**
+ * A consumer of the bus. Typically read() is called until it returns false
+ * whenever the bus emits framesPublished():
+ *
+ *     UAVTalkBus::Frame frame;
+ *     while (reader.read(&frame)) {
+ *         ... use frame ...
+ *         if (!reader.release()) {
+ *             ... frame was overwritten while in use, discard what was done with it ...
+ *         }
+ *     }
+ *
+ * A reader that falls more than half a ring behind skips ahead, the skipped
+ * frames are counted in lost().
+ */
+class UAVTALK_EXPORT UAVTalkBusReader {
+public:
+    explicit UAVTalkBusReader(UAVTalkBus *bus);
+
+    bool read(UAVTalkBus::Frame *frame);
+    bool release();
+
+    quint64 lost() const
+    {
+        return m_lost;
+    }
+
+private:
+    UAVTalkBus::RingHeader *m_ring;
+    quint64 m_next;
+    quint64 m_current;
+    quint64 m_lost;
+};
+
+#endif // UAVTALKBUS_H
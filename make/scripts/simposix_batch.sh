@@ -0,0 +1,110 @@
+#!/bin/bash -e
+#
+# simposix_batch.sh - run the simposix firmware in lockstep for many seeds.
+# Copyright (c) 2016, The LibrePilot Project, http://www.librepilot.org
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+# for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+#
+
+usage()
+{
+    cat <<EOF
+Usage: $0 [-n RUNS] [-d SECONDS] [-j JOBS] [-s SETTINGS_DIR] [-o OUTPUT_DIR] FIRMWARE_ELF
+
+Runs FIRMWARE_ELF (build/firmware/simposix/simposix.elf) with --lockstep
+for seeds 1..RUNS, JOBS runs at a time, and prints the report line of every
+run followed by a summary. Each run gets its own directory in OUTPUT_DIR with
+a copy of the saved UAVObjects in SETTINGS_DIR (the *.o* files a simposix
+run leaves behind after the settings, waypoints and path plan were saved
+from the GCS), so that runs do not interfere.
+
+Two builds are compared by running both with the same seeds and diffing the
+report lines without the wall= and speedup= fields.
+
+  -n RUNS          number of seeds, default 16
+  -d SECONDS       simulated time per run, default 600
+  -j JOBS          parallel runs, default the number of cores
+  -s SETTINGS_DIR  saved UAVObjects to start from
+  -o OUTPUT_DIR    where to keep the run directories, default a temporary one
+EOF
+}
+
+RUNS=16
+DURATION=600
+JOBS=$(getconf _NPROCESSORS_ONLN)
+SETTINGS=
+OUTPUT=
+
+while getopts "n:d:j:s:o:h" opt; do
+    case $opt in
+        n) RUNS=$OPTARG ;;
+        d) DURATION=$OPTARG ;;
+        j) JOBS=$OPTARG ;;
+        s) SETTINGS=$OPTARG ;;
+        o) OUTPUT=$OPTARG ;;
+        h) usage; exit 0 ;;
+        *) usage; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -ne 1 ]; then
+    usage
+    exit 1
+fi
+FIRMWARE=$(readlink -f "$1")
+
+if [ -z "$OUTPUT" ]; then
+    OUTPUT=$(mktemp -d -t simposix_batch.XXXXXX)
+fi
+mkdir -p "$OUTPUT"
+
+# One run, in its own directory. The firmware log goes to run.log, the
+# report line to the standard output.
+run()
+{
+    local seed=$1
+    local dir="$OUTPUT/seed_$seed"
+
+    rm -rf "$dir"
+    mkdir -p "$dir"
+    if [ -n "$SETTINGS" ]; then
+        cp "$SETTINGS"/*.o* "$dir"/ 2>/dev/null || true
+    fi
+
+    cd "$dir"
+    if "$FIRMWARE" --lockstep --seed "$seed" --duration "$DURATION" > run.log 2>&1; then
+        grep "^simposix: " run.log || echo "simposix: seed=$seed failed, no report"
+    else
+        echo "simposix: seed=$seed failed with status $?"
+    fi
+}
+export -f run
+export OUTPUT SETTINGS FIRMWARE DURATION
+
+START=$(date +%s.%N)
+REPORT=$(seq 1 "$RUNS" | xargs -P "$JOBS" -I{} bash -c 'run {}' | sort -t= -k2 -n)
+END=$(date +%s.%N)
+
+echo "$REPORT"
+echo "$REPORT" | awk -v runs="$RUNS" -v duration="$DURATION" -v jobs="$JOBS" -v start="$START" -v end="$END" -v output="$OUTPUT" '
+    /failed/            { failed++ }
+    /late_ticks=[1-9]/  { late++ }
+    END {
+        wall = end - start
+        printf("%d runs of %ds in %.1fs wall with %d jobs, %.0fx real time, %d failed, %d not reproducible (late ticks)\n",
+               runs, duration, wall, jobs, runs * duration / wall, failed, late)
+        printf("run directories in %s\n", output)
+    }'